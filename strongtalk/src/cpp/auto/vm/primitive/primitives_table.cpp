@@ -165,2500 +165,2722 @@ static PrimitiveDescriptor primitive_022   = {
     "primitiveAlienAddressIfFail:", primitiveFunctionType( &ByteArrayPrimitives::alienGetAddress ), 1312257, signature_22, errors_22
 };
 
-static const char          *signature_23[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_23[]    = { nullptr };
+static const char          *signature_23[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_23[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_023   = {
-    "primitiveAlienCallResult:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult0 ), 1312258, signature_23, errors_23
+    "primitiveAlienAdvise:from:to:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienAdvise ), 1312260, signature_23, errors_23
 };
 
-static const char          *signature_24[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger" };
+static const char          *signature_24[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
 static const char          *errors_24[]    = { nullptr };
 static PrimitiveDescriptor primitive_024   = {
-    "primitiveAlienCallResult:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult1 ), 1312259, signature_24, errors_24
+    "primitiveAlienCallResult:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult0 ), 1312258, signature_24, errors_24
 };
 
-static const char          *signature_25[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
+static const char          *signature_25[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedInstanceVariables" };
 static const char          *errors_25[]    = { nullptr };
 static PrimitiveDescriptor primitive_025   = {
-    "primitiveAlienCallResult:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult2 ), 1312260, signature_25, errors_25
+    "primitiveAlienCallResult:signature:withArguments:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResultWithSignature ), 1312260, signature_25, errors_25
 };
 
-static const char          *signature_26[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
+static const char          *signature_26[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger" };
 static const char          *errors_26[]    = { nullptr };
 static PrimitiveDescriptor primitive_026   = {
-    "primitiveAlienCallResult:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult3 ), 1312261, signature_26, errors_26
+    "primitiveAlienCallResult:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult1 ), 1312259, signature_26, errors_26
 };
 
-static const char          *signature_27[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
+static const char          *signature_27[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
 static const char          *errors_27[]    = { nullptr };
 static PrimitiveDescriptor primitive_027   = {
-    "primitiveAlienCallResult:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult4 ), 1312262, signature_27, errors_27
+    "primitiveAlienCallResult:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult2 ), 1312260, signature_27, errors_27
 };
 
-static const char          *signature_28[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
+static const char          *signature_28[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
 static const char          *errors_28[]    = { nullptr };
 static PrimitiveDescriptor primitive_028   = {
-    "primitiveAlienCallResult:with:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult5 ), 1312263, signature_28, errors_28
+    "primitiveAlienCallResult:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult3 ), 1312261, signature_28, errors_28
 };
 
-static const char          *signature_29[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
+static const char          *signature_29[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
 static const char          *errors_29[]    = { nullptr };
 static PrimitiveDescriptor primitive_029   = {
-    "primitiveAlienCallResult:with:with:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult6 ), 1312264, signature_29, errors_29
+    "primitiveAlienCallResult:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult4 ), 1312262, signature_29, errors_29
 };
 
-static const char          *signature_30[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
+static const char          *signature_30[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
 static const char          *errors_30[]    = { nullptr };
 static PrimitiveDescriptor primitive_030   = {
-    "primitiveAlienCallResult:with:with:with:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult7 ), 1312265, signature_30, errors_30
+    "primitiveAlienCallResult:with:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult5 ), 1312263, signature_30, errors_30
 };
 
-static const char          *signature_31[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedInstanceVariables" };
+static const char          *signature_31[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
 static const char          *errors_31[]    = { nullptr };
 static PrimitiveDescriptor primitive_031   = {
-    "primitiveAlienCallResult:withArguments:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResultWithArguments ), 1312259, signature_31, errors_31
+    "primitiveAlienCallResult:with:with:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult6 ), 1312264, signature_31, errors_31
 };
 
-static const char          *signature_32[] = { "Float", "SmallInteger" };
+static const char          *signature_32[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables|SmallInteger" };
 static const char          *errors_32[]    = { nullptr };
 static PrimitiveDescriptor primitive_032   = {
-    "primitiveAlienCalloc:ifFail:", primitiveFunctionType( &SystemPrimitives::alienCalloc ), 327681, signature_32, errors_32
+    "primitiveAlienCallResult:with:with:with:with:with:with:with:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResult7 ), 1312265, signature_32, errors_32
 };
 
-static const char          *signature_33[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_33[] = { "Integer", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "IndexedInstanceVariables" };
 static const char          *errors_33[]    = { nullptr };
 static PrimitiveDescriptor primitive_033   = {
-    "primitiveAlienDoubleAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienDoubleAt ), 1312258, signature_33, errors_33
+    "primitiveAlienCallResult:withArguments:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCallResultWithArguments ), 1312259, signature_33, errors_33
 };
 
-static const char          *signature_34[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger", "Double" };
+static const char          *signature_34[] = { "Float", "SmallInteger" };
 static const char          *errors_34[]    = { nullptr };
 static PrimitiveDescriptor primitive_034   = {
-    "primitiveAlienDoubleAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienDoubleAtPut ), 1312259, signature_34, errors_34
+    "primitiveAlienCalloc:ifFail:", primitiveFunctionType( &SystemPrimitives::alienCalloc ), 327681, signature_34, errors_34
 };
 
-static const char          *signature_35[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger" };
-static const char          *errors_35[]    = { nullptr };
+static const char          *signature_35[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_35[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_035   = {
-    "primitiveAlienFloatAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienFloatAt ), 1312258, signature_35, errors_35
+    "primitiveAlienCopyFrom:to:intoBytes:startingAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienCopyFromToIntoBytes ), 1312261, signature_35, errors_35
 };
 
-static const char          *signature_36[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger", "Double" };
+static const char          *signature_36[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_36[]    = { nullptr };
 static PrimitiveDescriptor primitive_036   = {
-    "primitiveAlienFloatAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienFloatAtPut ), 1312259, signature_36, errors_36
+    "primitiveAlienDoubleAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienDoubleAt ), 1312258, signature_36, errors_36
 };
 
-static const char          *signature_37[] = { "Float", "SmallInteger|LargeInteger" };
+static const char          *signature_37[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger", "Double" };
 static const char          *errors_37[]    = { nullptr };
 static PrimitiveDescriptor primitive_037   = {
-    "primitiveAlienFree:ifFail:", primitiveFunctionType( &SystemPrimitives::alienFree ), 327681, signature_37, errors_37
+    "primitiveAlienDoubleAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienDoubleAtPut ), 1312259, signature_37, errors_37
 };
 
-static const char          *signature_38[] = { "Float", "SmallInteger" };
+static const char          *signature_38[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_38[]    = { nullptr };
 static PrimitiveDescriptor primitive_038   = {
-    "primitiveAlienMalloc:ifFail:", primitiveFunctionType( &SystemPrimitives::alienMalloc ), 327681, signature_38, errors_38
+    "primitiveAlienFloatAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienFloatAt ), 1312258, signature_38, errors_38
 };
 
-static const char          *signature_39[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_39[] = { "Double", "IndexedByteInstanceVariables", "SmallInteger", "Double" };
 static const char          *errors_39[]    = { nullptr };
 static PrimitiveDescriptor primitive_039   = {
-    "primitiveAlienSignedByteAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedByteAt ), 1312258, signature_39, errors_39
+    "primitiveAlienFloatAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienFloatAtPut ), 1312259, signature_39, errors_39
 };
 
-static const char          *signature_40[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *signature_40[] = { "Float", "SmallInteger|LargeInteger" };
 static const char          *errors_40[]    = { nullptr };
 static PrimitiveDescriptor primitive_040   = {
-    "primitiveAlienSignedByteAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedByteAtPut ), 1312259, signature_40, errors_40
+    "primitiveAlienFree:ifFail:", primitiveFunctionType( &SystemPrimitives::alienFree ), 327681, signature_40, errors_40
 };
 
-static const char          *signature_41[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_41[] = { "Float", "SmallInteger" };
 static const char          *errors_41[]    = { nullptr };
 static PrimitiveDescriptor primitive_041   = {
-    "primitiveAlienSignedLongAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedLongAt ), 1312258, signature_41, errors_41
+    "primitiveAlienMalloc:ifFail:", primitiveFunctionType( &SystemPrimitives::alienMalloc ), 327681, signature_41, errors_41
 };
 
-static const char          *signature_42[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger|LargeInteger" };
-static const char          *errors_42[]    = { nullptr };
+static const char          *signature_42[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "String", "Integer", "SmallInteger", "Boolean" };
+static const char          *errors_42[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_042   = {
-    "primitiveAlienSignedLongAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedLongAtPut ), 1312259, signature_42, errors_42
+    "primitiveAlienMapFile:offset:size:copyOnWrite:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienMapFile ), 1312261, signature_42, errors_42
 };
 
-static const char          *signature_43[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
-static const char          *errors_43[]    = { nullptr };
+static const char          *signature_43[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_43[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_043   = {
-    "primitiveAlienSignedShortAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedShortAt ), 1312258, signature_43, errors_43
+    "primitiveAlienReplaceFrom:to:withAlien:startingAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienReplaceFromToWithAlien ), 1312261, signature_43, errors_43
 };
 
-static const char          *signature_44[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
-static const char          *errors_44[]    = { nullptr };
+static const char          *signature_44[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_44[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_044   = {
-    "primitiveAlienSignedShortAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedShortAtPut ), 1312259, signature_44, errors_44
+    "primitiveAlienReplaceFrom:to:withBytes:startingAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienReplaceFromToWithBytes ), 1312261, signature_44, errors_44
 };
 
-static const char          *signature_45[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_45[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_45[]    = { nullptr };
 static PrimitiveDescriptor primitive_045   = {
-    "primitiveAlienSize:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSetSize ), 1312258, signature_45, errors_45
+    "primitiveAlienSignedByteAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedByteAt ), 1312258, signature_45, errors_45
 };
 
-static const char          *signature_46[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *signature_46[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
 static const char          *errors_46[]    = { nullptr };
 static PrimitiveDescriptor primitive_046   = {
-    "primitiveAlienSizeIfFail:", primitiveFunctionType( &ByteArrayPrimitives::alienGetSize ), 1312257, signature_46, errors_46
+    "primitiveAlienSignedByteAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedByteAtPut ), 1312259, signature_46, errors_46
 };
 
-static const char          *signature_47[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_47[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_47[]    = { nullptr };
 static PrimitiveDescriptor primitive_047   = {
-    "primitiveAlienUnsignedByteAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedByteAt ), 1312258, signature_47, errors_47
+    "primitiveAlienSignedLongAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedLongAt ), 1312258, signature_47, errors_47
 };
 
-static const char          *signature_48[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *signature_48[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger|LargeInteger" };
 static const char          *errors_48[]    = { nullptr };
 static PrimitiveDescriptor primitive_048   = {
-    "primitiveAlienUnsignedByteAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedByteAtPut ), 1312259, signature_48, errors_48
+    "primitiveAlienSignedLongAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedLongAtPut ), 1312259, signature_48, errors_48
 };
 
-static const char          *signature_49[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_49[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_49[]    = { nullptr };
 static PrimitiveDescriptor primitive_049   = {
-    "primitiveAlienUnsignedLongAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedLongAt ), 1312258, signature_49, errors_49
+    "primitiveAlienSignedShortAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedShortAt ), 1312258, signature_49, errors_49
 };
 
-static const char          *signature_50[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger|LargeInteger" };
+static const char          *signature_50[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
 static const char          *errors_50[]    = { nullptr };
 static PrimitiveDescriptor primitive_050   = {
-    "primitiveAlienUnsignedLongAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedLongAtPut ), 1312259, signature_50, errors_50
+    "primitiveAlienSignedShortAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSignedShortAtPut ), 1312259, signature_50, errors_50
 };
 
-static const char          *signature_51[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_51[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_51[]    = { nullptr };
 static PrimitiveDescriptor primitive_051   = {
-    "primitiveAlienUnsignedShortAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedShortAt ), 1312258, signature_51, errors_51
+    "primitiveAlienSize:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienSetSize ), 1312258, signature_51, errors_51
 };
 
-static const char          *signature_52[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *signature_52[] = { "SmallInteger", "IndexedByteInstanceVariables" };
 static const char          *errors_52[]    = { nullptr };
 static PrimitiveDescriptor primitive_052   = {
-    "primitiveAlienUnsignedShortAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedShortAtPut ), 1312259, signature_52, errors_52
+    "primitiveAlienSizeIfFail:", primitiveFunctionType( &ByteArrayPrimitives::alienGetSize ), 1312257, signature_52, errors_52
 };
 
-static const char          *signature_53[] = { "IndexedInstanceVariables", "SmallInteger" };
+static const char          *signature_53[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
 static const char          *errors_53[]    = { nullptr };
 static PrimitiveDescriptor primitive_053   = {
-    "primitiveAllObjectsLimit:ifFail:", primitiveFunctionType( &SystemPrimitives::all_objects ), 327681, signature_53, errors_53
+    "primitiveAlienUnmapIfFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnmap ), 1312257, signature_53, errors_53
 };
 
-static const char          *signature_54[] = { "Object", "IndexedInstanceVariables" };
+static const char          *signature_54[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_54[]    = { nullptr };
 static PrimitiveDescriptor primitive_054   = {
-    "primitiveApplyChange:ifFail:", primitiveFunctionType( &SystemPrimitives::applyChange ), 327681, signature_54, errors_54
+    "primitiveAlienUnsignedByteAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedByteAt ), 1312258, signature_54, errors_54
 };
 
-static const char          *signature_55[] = { "Float", "SmallInteger" };
+static const char          *signature_55[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
 static const char          *errors_55[]    = { nullptr };
 static PrimitiveDescriptor primitive_055   = {
-    "primitiveAsFloat", primitiveFunctionType( &double_from_smi ), 1573377, signature_55, errors_55
+    "primitiveAlienUnsignedByteAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedByteAtPut ), 1312259, signature_55, errors_55
 };
 
-static const char          *signature_56[] = { "SmallInteger", "Object" };
+static const char          *signature_56[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_56[]    = { nullptr };
 static PrimitiveDescriptor primitive_056   = {
-    "primitiveAsObjectID", primitiveFunctionType( &OopPrimitives::asObjectID ), 1114113, signature_56, errors_56
+    "primitiveAlienUnsignedLongAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedLongAt ), 1312258, signature_56, errors_56
 };
 
-static const char          *signature_57[] = { "Object", "SmallInteger" };
-static const char          *errors_57[]    = { "OutOfBounds", nullptr };
+static const char          *signature_57[] = { "SmallInteger|LargeInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger|LargeInteger" };
+static const char          *errors_57[]    = { nullptr };
 static PrimitiveDescriptor primitive_057   = {
-    "primitiveAsObjectIfFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::asObject ), 1310721, signature_57, errors_57
+    "primitiveAlienUnsignedLongAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedLongAtPut ), 1312259, signature_57, errors_57
 };
 
-static const char          *signature_58[] = { "Object", "Object", "Object" };
-static const char          *errors_58[]    = { "RecieverHasWrongType", nullptr };
+static const char          *signature_58[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_58[]    = { nullptr };
 static PrimitiveDescriptor primitive_058   = {
-    "primitiveBecome:ifFail:", primitiveFunctionType( &OopPrimitives::become ), 1376258, signature_58, errors_58
+    "primitiveAlienUnsignedShortAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedShortAt ), 1312258, signature_58, errors_58
 };
 
-static const char          *signature_59[] = { "GlobalAssociation", "Behavior", "SmallInteger" };
-static const char          *errors_59[]    = { "OutOfBounds", nullptr };
+static const char          *signature_59[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *errors_59[]    = { nullptr };
 static PrimitiveDescriptor primitive_059   = {
-    "primitiveBehavior:classVariableAt:ifFail:", primitiveFunctionType( &BehaviorPrimitives::classVariableAt ), 327682, signature_59, errors_59
+    "primitiveAlienUnsignedShortAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::alienUnsignedShortAtPut ), 1312259, signature_59, errors_59
 };
 
-static const char          *signature_60[] = { "IndexedInstanceVariables", "Behavior" };
-static const char          *errors_60[]    = { "OutOfBounds", nullptr };
+static const char          *signature_60[] = { "IndexedInstanceVariables", "SmallInteger" };
+static const char          *errors_60[]    = { nullptr };
 static PrimitiveDescriptor primitive_060   = {
-    "primitiveBehavior:classVariablesIfFail:", primitiveFunctionType( &BehaviorPrimitives::classVariables ), 327681, signature_60, errors_60
+    "primitiveAllObjectsLimit:ifFail:", primitiveFunctionType( &SystemPrimitives::all_objects ), 327681, signature_60, errors_60
 };
 
-static const char          *signature_61[] = { "Boolean", "Behavior" };
+static const char          *signature_61[] = { "Object", "IndexedInstanceVariables" };
 static const char          *errors_61[]    = { nullptr };
 static PrimitiveDescriptor primitive_061   = {
-    "primitiveBehaviorCanBeSubclassed:ifFail:", primitiveFunctionType( &BehaviorPrimitives::can_be_subclassed ), 327681, signature_61, errors_61
+    "primitiveApplyChange:ifFail:", primitiveFunctionType( &SystemPrimitives::applyChange ), 327681, signature_61, errors_61
 };
 
-static const char          *signature_62[] = { "Boolean", "Behavior" };
+static const char          *signature_62[] = { "Float", "SmallInteger" };
 static const char          *errors_62[]    = { nullptr };
 static PrimitiveDescriptor primitive_062   = {
-    "primitiveBehaviorCanHaveInstanceVariables:ifFail:", primitiveFunctionType( &BehaviorPrimitives::can_have_instance_variables ), 327681, signature_62, errors_62
+    "primitiveAsFloat", primitiveFunctionType( &double_from_smi ), 1573377, signature_62, errors_62
 };
 
-static const char          *signature_63[] = { "Symbol", "Behavior" };
+static const char          *signature_63[] = { "SmallInteger", "Object" };
 static const char          *errors_63[]    = { nullptr };
 static PrimitiveDescriptor primitive_063   = {
-    "primitiveBehaviorFormat:ifFail:", primitiveFunctionType( &BehaviorPrimitives::format ), 327681, signature_63, errors_63
+    "primitiveAsObjectID", primitiveFunctionType( &OopPrimitives::asObjectID ), 1114113, signature_63, errors_63
 };
 
-static const char          *signature_64[] = { "SmallInteger", "Behavior" };
-static const char          *errors_64[]    = { nullptr };
+static const char          *signature_64[] = { "Object", "SmallInteger" };
+static const char          *errors_64[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_064   = {
-    "primitiveBehaviorHeaderSizeOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::headerSize ), 327681, signature_64, errors_64
+    "primitiveAsObjectIfFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::asObject ), 1310721, signature_64, errors_64
 };
 
-static const char          *signature_65[] = { "Boolean", "Behavior", "Object" };
-static const char          *errors_65[]    = { nullptr };
+static const char          *signature_65[] = { "Object", "Object", "Object" };
+static const char          *errors_65[]    = { "RecieverHasWrongType", nullptr };
 static PrimitiveDescriptor primitive_065   = {
-    "primitiveBehaviorIsClassOf:", primitiveFunctionType( &BehaviorPrimitives::is_class_of ), 5308418, signature_65, errors_65
+    "primitiveBecome:ifFail:", primitiveFunctionType( &OopPrimitives::become ), 1376258, signature_65, errors_65
 };
 
-static const char          *signature_66[] = { "Boolean", "Behavior" };
-static const char          *errors_66[]    = { nullptr };
+static const char          *signature_66[] = { "GlobalAssociation", "Behavior", "SmallInteger" };
+static const char          *errors_66[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_066   = {
-    "primitiveBehaviorIsSpecializedClass:ifFail:", primitiveFunctionType( &BehaviorPrimitives::is_specialized_class ), 327681, signature_66, errors_66
+    "primitiveBehavior:classVariableAt:ifFail:", primitiveFunctionType( &BehaviorPrimitives::classVariableAt ), 327682, signature_66, errors_66
 };
 
-static const char          *signature_67[] = { "Mixin", "Behavior" };
-static const char          *errors_67[]    = { nullptr };
+static const char          *signature_67[] = { "IndexedInstanceVariables", "Behavior" };
+static const char          *errors_67[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_067   = {
-    "primitiveBehaviorMixinOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::mixinOf ), 327681, signature_67, errors_67
+    "primitiveBehavior:classVariablesIfFail:", primitiveFunctionType( &BehaviorPrimitives::classVariables ), 327681, signature_67, errors_67
 };
 
-static const char          *signature_68[] = { "SmallInteger", "Behavior" };
+static const char          *signature_68[] = { "Boolean", "Behavior" };
 static const char          *errors_68[]    = { nullptr };
 static PrimitiveDescriptor primitive_068   = {
-    "primitiveBehaviorNonIndexableSizeOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::nonIndexableSize ), 327681, signature_68, errors_68
+    "primitiveBehaviorCanBeSubclassed:ifFail:", primitiveFunctionType( &BehaviorPrimitives::can_be_subclassed ), 327681, signature_68, errors_68
 };
 
-static const char          *signature_69[] = { "Symbol", "Behavior" };
+static const char          *signature_69[] = { "Boolean", "Behavior" };
 static const char          *errors_69[]    = { nullptr };
 static PrimitiveDescriptor primitive_069   = {
-    "primitiveBehaviorVMType:ifFail:", primitiveFunctionType( &BehaviorPrimitives::vm_type ), 327681, signature_69, errors_69
+    "primitiveBehaviorCanHaveInstanceVariables:ifFail:", primitiveFunctionType( &BehaviorPrimitives::can_have_instance_variables ), 327681, signature_69, errors_69
 };
 
-static const char          *signature_70[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *signature_70[] = { "Symbol", "Behavior" };
 static const char          *errors_70[]    = { nullptr };
 static PrimitiveDescriptor primitive_070   = {
-    "primitiveBitAnd:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitAnd ), 6029826, signature_70, errors_70
+    "primitiveBehaviorFormat:ifFail:", primitiveFunctionType( &BehaviorPrimitives::format ), 327681, signature_70, errors_70
 };
 
-static const char          *signature_71[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *signature_71[] = { "SmallInteger", "Behavior" };
 static const char          *errors_71[]    = { nullptr };
 static PrimitiveDescriptor primitive_071   = {
-    "primitiveBitOr:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitOr ), 6029826, signature_71, errors_71
+    "primitiveBehaviorHeaderSizeOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::headerSize ), 327681, signature_71, errors_71
 };
 
-static const char          *signature_72[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *signature_72[] = { "Boolean", "Behavior", "Object" };
 static const char          *errors_72[]    = { nullptr };
 static PrimitiveDescriptor primitive_072   = {
-    "primitiveBitShift:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitShift ), 6029826, signature_72, errors_72
+    "primitiveBehaviorIsClassOf:", primitiveFunctionType( &BehaviorPrimitives::is_class_of ), 5308418, signature_72, errors_72
 };
 
-static const char          *signature_73[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *signature_73[] = { "Boolean", "Behavior" };
 static const char          *errors_73[]    = { nullptr };
 static PrimitiveDescriptor primitive_073   = {
-    "primitiveBitXor:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitXor ), 6029826, signature_73, errors_73
+    "primitiveBehaviorIsSpecializedClass:ifFail:", primitiveFunctionType( &BehaviorPrimitives::is_specialized_class ), 327681, signature_73, errors_73
 };
 
-static const char          *signature_74[] = { "Boolean", "Block" };
+static const char          *signature_74[] = { "Mixin", "Behavior" };
 static const char          *errors_74[]    = { nullptr };
 static PrimitiveDescriptor primitive_074   = {
-    "primitiveBlockIsOptimized", primitiveFunctionType( &block_is_optimized ), 1114113, signature_74, errors_74
+    "primitiveBehaviorMixinOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::mixinOf ), 327681, signature_74, errors_74
 };
 
-static const char          *signature_75[] = { "Method", "Block" };
+static const char          *signature_75[] = { "SmallInteger", "Behavior" };
 static const char          *errors_75[]    = { nullptr };
 static PrimitiveDescriptor primitive_075   = {
-    "primitiveBlockMethod", primitiveFunctionType( &block_method ), 1114113, signature_75, errors_75
+    "primitiveBehaviorNonIndexableSizeOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::nonIndexableSize ), 327681, signature_75, errors_75
 };
 
-static const char          *signature_76[] = { "Boolean", "Symbol" };
-static const char          *errors_76[]    = { "NotFound", nullptr };
+static const char          *signature_76[] = { "Symbol", "Behavior" };
+static const char          *errors_76[]    = { nullptr };
 static PrimitiveDescriptor primitive_076   = {
-    "primitiveBooleanFlagAt:ifFail:", primitiveFunctionType( &DebugPrimitives::boolAt ), 327681, signature_76, errors_76
+    "primitiveBehaviorVMType:ifFail:", primitiveFunctionType( &BehaviorPrimitives::vm_type ), 327681, signature_76, errors_76
 };
 
-static const char          *signature_77[] = { "Boolean", "Symbol", "Boolean" };
-static const char          *errors_77[]    = { "NotFound", nullptr };
+static const char          *signature_77[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_77[]    = { nullptr };
 static PrimitiveDescriptor primitive_077   = {
-    "primitiveBooleanFlagAt:put:ifFail:", primitiveFunctionType( &DebugPrimitives::boolAtPut ), 327682, signature_77, errors_77
+    "primitiveBitAnd:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitAnd ), 6029826, signature_77, errors_77
 };
 
-static const char          *signature_78[] = { "Object" };
+static const char          *signature_78[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
 static const char          *errors_78[]    = { nullptr };
 static PrimitiveDescriptor primitive_078   = {
-    "primitiveBreakpoint", primitiveFunctionType( &SystemPrimitives::breakpoint ), 65536, signature_78, errors_78
+    "primitiveBitOr:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitOr ), 6029826, signature_78, errors_78
 };
 
-static const char          *signature_79[] = { "Object", "Object", "Proxy" };
+static const char          *signature_79[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
 static const char          *errors_79[]    = { nullptr };
 static PrimitiveDescriptor primitive_079   = {
-    "primitiveCallBackInvokeC2:ifFail:", primitiveFunctionType( &CallBackPrimitives::invokeC ), 1376258, signature_79, errors_79
+    "primitiveBitShift:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitShift ), 6029826, signature_79, errors_79
 };
 
-static const char          *signature_80[] = { "Object", "Object", "Proxy" };
+static const char          *signature_80[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
 static const char          *errors_80[]    = { nullptr };
 static PrimitiveDescriptor primitive_080   = {
-    "primitiveCallBackInvokePascal2:ifFail:", primitiveFunctionType( &CallBackPrimitives::invokePascal ), 1376258, signature_80, errors_80
+    "primitiveBitXor:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::bitXor ), 6029826, signature_80, errors_80
 };
 
-static const char          *signature_81[] = { "Object", "Object", "Symbol" };
+static const char          *signature_81[] = { "Boolean", "Block" };
 static const char          *errors_81[]    = { nullptr };
 static PrimitiveDescriptor primitive_081   = {
-    "primitiveCallBackReceiver:selector:ifFail:", primitiveFunctionType( &CallBackPrimitives::initialize ), 327682, signature_81, errors_81
+    "primitiveBlockIsOptimized", primitiveFunctionType( &block_is_optimized ), 1114113, signature_81, errors_81
 };
 
-static const char          *signature_82[] = { "Object", "SmallInteger", "Proxy" };
+static const char          *signature_82[] = { "Method", "Block" };
 static const char          *errors_82[]    = { nullptr };
 static PrimitiveDescriptor primitive_082   = {
-    "primitiveCallBackRegisterCCall:result:ifFail:", primitiveFunctionType( &CallBackPrimitives::registerCCall ), 327682, signature_82, errors_82
+    "primitiveBlockMethod", primitiveFunctionType( &block_method ), 1114113, signature_82, errors_82
 };
 
-static const char          *signature_83[] = { "Object", "SmallInteger", "SmallInteger", "Proxy" };
-static const char          *errors_83[]    = { nullptr };
+static const char          *signature_83[] = { "Boolean", "Symbol" };
+static const char          *errors_83[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_083   = {
-    "primitiveCallBackRegisterPascalCall:numberOfArguments:result:ifFail:", primitiveFunctionType( &CallBackPrimitives::registerPascalCall ), 327683, signature_83, errors_83
+    "primitiveBooleanFlagAt:ifFail:", primitiveFunctionType( &DebugPrimitives::boolAt ), 327681, signature_83, errors_83
 };
 
-static const char          *signature_84[] = { "Object", "Object", "Proxy" };
-static const char          *errors_84[]    = { nullptr };
+static const char          *signature_84[] = { "Boolean", "Symbol", "Boolean" };
+static const char          *errors_84[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_084   = {
-    "primitiveCallBackUnregister:ifFail:", primitiveFunctionType( &CallBackPrimitives::unregister ), 1376258, signature_84, errors_84
+    "primitiveBooleanFlagAt:put:ifFail:", primitiveFunctionType( &DebugPrimitives::boolAtPut ), 327682, signature_84, errors_84
 };
 
-static const char          *signature_85[] = { "Boolean" };
+static const char          *signature_85[] = { "Object" };
 static const char          *errors_85[]    = { nullptr };
 static PrimitiveDescriptor primitive_085   = {
-    "primitiveCanScavenge", primitiveFunctionType( &SystemPrimitives::canScavenge ), 65536, signature_85, errors_85
+    "primitiveBreakpoint", primitiveFunctionType( &SystemPrimitives::breakpoint ), 65536, signature_85, errors_85
 };
 
-static const char          *signature_86[] = { "Proxy", "SmallInteger" };
-static const char          *errors_86[]    = { "OutOfBounds", nullptr };
+static const char          *signature_86[] = { "Object", "Object", "Proxy" };
+static const char          *errors_86[]    = { nullptr };
 static PrimitiveDescriptor primitive_086   = {
-    "primitiveCharacterFor:ifFail:", primitiveFunctionType( &SystemPrimitives::characterFor ), 327681, signature_86, errors_86
+    "primitiveCallBackInvokeC2:ifFail:", primitiveFunctionType( &CallBackPrimitives::invokeC ), 1376258, signature_86, errors_86
 };
 
-static const char          *signature_87[] = { "Self class", "Object" };
+static const char          *signature_87[] = { "Object", "Object", "Proxy" };
 static const char          *errors_87[]    = { nullptr };
 static PrimitiveDescriptor primitive_087   = {
-    "primitiveClass", primitiveFunctionType( &OopPrimitives::klass ), 5767169, signature_87, errors_87
+    "primitiveCallBackInvokePascal2:ifFail:", primitiveFunctionType( &CallBackPrimitives::invokePascal ), 1376258, signature_87, errors_87
 };
 
-static const char          *signature_88[] = { "Behavior", "Object" };
+static const char          *signature_88[] = { "Object", "Object", "Symbol" };
 static const char          *errors_88[]    = { nullptr };
 static PrimitiveDescriptor primitive_088   = {
-    "primitiveClassOf:", primitiveFunctionType( &OopPrimitives::klass_of ), 4718593, signature_88, errors_88
+    "primitiveCallBackReceiver:selector:ifFail:", primitiveFunctionType( &CallBackPrimitives::initialize ), 327682, signature_88, errors_88
 };
 
-static const char          *signature_89[] = { "Object" };
+static const char          *signature_89[] = { "Object", "SmallInteger", "Proxy" };
 static const char          *errors_89[]    = { nullptr };
 static PrimitiveDescriptor primitive_089   = {
-    "primitiveClearInlineCaches", primitiveFunctionType( &DebugPrimitives::clearInlineCaches ), 65536, signature_89, errors_89
+    "primitiveCallBackRegisterCCall:result:ifFail:", primitiveFunctionType( &CallBackPrimitives::registerCCall ), 327682, signature_89, errors_89
 };
 
-static const char          *signature_90[] = { "Object" };
+static const char          *signature_90[] = { "Object", "SmallInteger", "SmallInteger", "Proxy" };
 static const char          *errors_90[]    = { nullptr };
 static PrimitiveDescriptor primitive_090   = {
-    "primitiveClearInvocationCounters", primitiveFunctionType( &DebugPrimitives::clearInvocationCounters ), 65536, signature_90, errors_90
+    "primitiveCallBackRegisterPascalCall:numberOfArguments:result:ifFail:", primitiveFunctionType( &CallBackPrimitives::registerPascalCall ), 327683, signature_90, errors_90
 };
 
-static const char          *signature_91[] = { "Object" };
+static const char          *signature_91[] = { "Object", "Object", "Proxy" };
 static const char          *errors_91[]    = { nullptr };
 static PrimitiveDescriptor primitive_091   = {
-    "primitiveClearLookupCache", primitiveFunctionType( &DebugPrimitives::clearLookupCache ), 65536, signature_91, errors_91
+    "primitiveCallBackUnregister:ifFail:", primitiveFunctionType( &CallBackPrimitives::unregister ), 1376258, signature_91, errors_91
 };
 
-static const char          *signature_92[] = { "Object" };
+static const char          *signature_92[] = { "Boolean" };
 static const char          *errors_92[]    = { nullptr };
 static PrimitiveDescriptor primitive_092   = {
-    "primitiveClearLookupCacheStatistics", primitiveFunctionType( &DebugPrimitives::clearLookupCacheStatistics ), 65536, signature_92, errors_92
+    "primitiveCanScavenge", primitiveFunctionType( &SystemPrimitives::canScavenge ), 65536, signature_92, errors_92
 };
 
-static const char          *signature_93[] = { "Object" };
-static const char          *errors_93[]    = { nullptr };
+static const char          *signature_93[] = { "Proxy", "SmallInteger" };
+static const char          *errors_93[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_093   = {
-    "primitiveClearNativeMethodCounters", primitiveFunctionType( &DebugPrimitives::clearNativeMethodCounters ), 65536, signature_93, errors_93
+    "primitiveCharacterFor:ifFail:", primitiveFunctionType( &SystemPrimitives::characterFor ), 327681, signature_93, errors_93
 };
 
-static const char          *signature_94[] = { "Object" };
+static const char          *signature_94[] = { "Self class", "Object" };
 static const char          *errors_94[]    = { nullptr };
 static PrimitiveDescriptor primitive_094   = {
-    "primitiveClearPrimitiveCounters", primitiveFunctionType( &DebugPrimitives::clearPrimitiveCounters ), 65536, signature_94, errors_94
+    "primitiveClass", primitiveFunctionType( &OopPrimitives::klass ), 5767169, signature_94, errors_94
 };
 
-static const char          *signature_95[] = { "Array[String]" };
+static const char          *signature_95[] = { "Behavior", "Object" };
 static const char          *errors_95[]    = { nullptr };
 static PrimitiveDescriptor primitive_095   = {
-    "primitiveCommandLineArgs", primitiveFunctionType( &SystemPrimitives::command_line_args ), 65536, signature_95, errors_95
+    "primitiveClassOf:", primitiveFunctionType( &OopPrimitives::klass_of ), 4718593, signature_95, errors_95
 };
 
-static const char          *signature_96[] = { "Block" };
+static const char          *signature_96[] = { "Object" };
 static const char          *errors_96[]    = { nullptr };
 static PrimitiveDescriptor primitive_096   = {
-    "primitiveCompiledBlockAllocate0", primitiveFunctionType( &allocateBlock0 ), 6359040, signature_96, errors_96
+    "primitiveClearInlineCaches", primitiveFunctionType( &DebugPrimitives::clearInlineCaches ), 65536, signature_96, errors_96
 };
 
-static const char          *signature_97[] = { "Block" };
+static const char          *signature_97[] = { "Object" };
 static const char          *errors_97[]    = { nullptr };
 static PrimitiveDescriptor primitive_097   = {
-    "primitiveCompiledBlockAllocate1", primitiveFunctionType( &allocateBlock1 ), 6359040, signature_97, errors_97
+    "primitiveClearInvocationCounters", primitiveFunctionType( &DebugPrimitives::clearInvocationCounters ), 65536, signature_97, errors_97
 };
 
-static const char          *signature_98[] = { "Block" };
+static const char          *signature_98[] = { "Object" };
 static const char          *errors_98[]    = { nullptr };
 static PrimitiveDescriptor primitive_098   = {
-    "primitiveCompiledBlockAllocate2", primitiveFunctionType( &allocateBlock2 ), 6359040, signature_98, errors_98
+    "primitiveClearLookupCache", primitiveFunctionType( &DebugPrimitives::clearLookupCache ), 65536, signature_98, errors_98
 };
 
-static const char          *signature_99[] = { "Block" };
+static const char          *signature_99[] = { "Object" };
 static const char          *errors_99[]    = { nullptr };
 static PrimitiveDescriptor primitive_099   = {
-    "primitiveCompiledBlockAllocate3", primitiveFunctionType( &allocateBlock3 ), 6359040, signature_99, errors_99
+    "primitiveClearLookupCacheStatistics", primitiveFunctionType( &DebugPrimitives::clearLookupCacheStatistics ), 65536, signature_99, errors_99
 };
 
-static const char          *signature_100[] = { "Block" };
+static const char          *signature_100[] = { "Object" };
 static const char          *errors_100[]    = { nullptr };
 static PrimitiveDescriptor primitive_100    = {
-    "primitiveCompiledBlockAllocate4", primitiveFunctionType( &allocateBlock4 ), 6359040, signature_100, errors_100
+    "primitiveClearNativeMethodCounters", primitiveFunctionType( &DebugPrimitives::clearNativeMethodCounters ), 65536, signature_100, errors_100
 };
 
-static const char          *signature_101[] = { "Block" };
+static const char          *signature_101[] = { "Object" };
 static const char          *errors_101[]    = { nullptr };
 static PrimitiveDescriptor primitive_101    = {
-    "primitiveCompiledBlockAllocate5", primitiveFunctionType( &allocateBlock5 ), 6359040, signature_101, errors_101
+    "primitiveClearPrimitiveCounters", primitiveFunctionType( &DebugPrimitives::clearPrimitiveCounters ), 65536, signature_101, errors_101
 };
 
-static const char          *signature_102[] = { "Block" };
+static const char          *signature_102[] = { "Array[String]" };
 static const char          *errors_102[]    = { nullptr };
 static PrimitiveDescriptor primitive_102    = {
-    "primitiveCompiledBlockAllocate6", primitiveFunctionType( &allocateBlock6 ), 6359040, signature_102, errors_102
+    "primitiveCommandLineArgs", primitiveFunctionType( &SystemPrimitives::command_line_args ), 65536, signature_102, errors_102
 };
 
 static const char          *signature_103[] = { "Block" };
 static const char          *errors_103[]    = { nullptr };
 static PrimitiveDescriptor primitive_103    = {
-    "primitiveCompiledBlockAllocate7", primitiveFunctionType( &allocateBlock7 ), 6359040, signature_103, errors_103
+    "primitiveCompiledBlockAllocate0", primitiveFunctionType( &allocateBlock0 ), 6359040, signature_103, errors_103
 };
 
 static const char          *signature_104[] = { "Block" };
 static const char          *errors_104[]    = { nullptr };
 static PrimitiveDescriptor primitive_104    = {
-    "primitiveCompiledBlockAllocate8", primitiveFunctionType( &allocateBlock8 ), 6359040, signature_104, errors_104
+    "primitiveCompiledBlockAllocate1", primitiveFunctionType( &allocateBlock1 ), 6359040, signature_104, errors_104
 };
 
 static const char          *signature_105[] = { "Block" };
 static const char          *errors_105[]    = { nullptr };
 static PrimitiveDescriptor primitive_105    = {
-    "primitiveCompiledBlockAllocate9", primitiveFunctionType( &allocateBlock9 ), 6359040, signature_105, errors_105
+    "primitiveCompiledBlockAllocate2", primitiveFunctionType( &allocateBlock2 ), 6359040, signature_105, errors_105
 };
 
-static const char          *signature_106[] = { "Block", "SmallInteger" };
+static const char          *signature_106[] = { "Block" };
 static const char          *errors_106[]    = { nullptr };
 static PrimitiveDescriptor primitive_106    = {
-    "primitiveCompiledBlockAllocate:", primitiveFunctionType( &allocateBlock ), 2164737, signature_106, errors_106
+    "primitiveCompiledBlockAllocate3", primitiveFunctionType( &allocateBlock3 ), 6359040, signature_106, errors_106
 };
 
-static const char          *signature_107[] = { "Object" };
+static const char          *signature_107[] = { "Block" };
 static const char          *errors_107[]    = { nullptr };
 static PrimitiveDescriptor primitive_107    = {
-    "primitiveCompiledContextAllocate0", primitiveFunctionType( &allocateContext0 ), 6359040, signature_107, errors_107
+    "primitiveCompiledBlockAllocate4", primitiveFunctionType( &allocateBlock4 ), 6359040, signature_107, errors_107
 };
 
-static const char          *signature_108[] = { "Object" };
+static const char          *signature_108[] = { "Block" };
 static const char          *errors_108[]    = { nullptr };
 static PrimitiveDescriptor primitive_108    = {
-    "primitiveCompiledContextAllocate1", primitiveFunctionType( &allocateContext1 ), 6359040, signature_108, errors_108
+    "primitiveCompiledBlockAllocate5", primitiveFunctionType( &allocateBlock5 ), 6359040, signature_108, errors_108
 };
 
-static const char          *signature_109[] = { "Object" };
+static const char          *signature_109[] = { "Block" };
 static const char          *errors_109[]    = { nullptr };
 static PrimitiveDescriptor primitive_109    = {
-    "primitiveCompiledContextAllocate2", primitiveFunctionType( &allocateContext2 ), 6359040, signature_109, errors_109
+    "primitiveCompiledBlockAllocate6", primitiveFunctionType( &allocateBlock6 ), 6359040, signature_109, errors_109
 };
 
-static const char          *signature_110[] = { "Object", "SmallInteger" };
+static const char          *signature_110[] = { "Block" };
 static const char          *errors_110[]    = { nullptr };
 static PrimitiveDescriptor primitive_110    = {
-    "primitiveCompiledContextAllocate:", primitiveFunctionType( &allocateContext ), 6359041, signature_110, errors_110
+    "primitiveCompiledBlockAllocate7", primitiveFunctionType( &allocateBlock7 ), 6359040, signature_110, errors_110
 };
 
-static const char          *signature_111[] = { "Method", "Object", "SmallInteger", "SmallInteger", "Array", "ByteArray", "Array" };
+static const char          *signature_111[] = { "Block" };
 static const char          *errors_111[]    = { nullptr };
 static PrimitiveDescriptor primitive_111    = {
-    "primitiveConstructMethod:flags:nofArgs:debugInfo:bytes:oops:ifFail:", primitiveFunctionType( &MethodOopPrimitives::constructMethod ), 327686, signature_111, errors_111
+    "primitiveCompiledBlockAllocate8", primitiveFunctionType( &allocateBlock8 ), 6359040, signature_111, errors_111
 };
 
-static const char          *signature_112[] = { "Object", "Object" };
-static const char          *errors_112[]    = { "NotOops", nullptr };
+static const char          *signature_112[] = { "Block" };
+static const char          *errors_112[]    = { nullptr };
 static PrimitiveDescriptor primitive_112    = {
-    "primitiveCopyTenuredIfFail:", primitiveFunctionType( &OopPrimitives::copy_tenured ), 1376257, signature_112, errors_112
+    "primitiveCompiledBlockAllocate9", primitiveFunctionType( &allocateBlock9 ), 6359040, signature_112, errors_112
 };
 
-static const char          *signature_113[] = { "GlobalAssociation", "Mixin", "Symbol", "Boolean", "Behavior", "Symbol" };
-static const char          *errors_113[]    = { "WrongFormat", nullptr };
+static const char          *signature_113[] = { "Block", "SmallInteger" };
+static const char          *errors_113[]    = { nullptr };
 static PrimitiveDescriptor primitive_113    = {
-    "primitiveCreateInvocationOf:named:isPrimaryInvocation:superclass:format:ifFail:", primitiveFunctionType( &SystemPrimitives::createNamedInvocation ), 327685, signature_113, errors_113
+    "primitiveCompiledBlockAllocate:", primitiveFunctionType( &allocateBlock ), 2164737, signature_113, errors_113
 };
 
-static const char          *signature_114[] = { "GlobalAssociation", "Mixin", "Behavior", "Symbol" };
-static const char          *errors_114[]    = { "WrongFormat", nullptr };
+static const char          *signature_114[] = { "Object" };
+static const char          *errors_114[]    = { nullptr };
 static PrimitiveDescriptor primitive_114    = {
-    "primitiveCreateInvocationOf:superclass:format:ifFail:", primitiveFunctionType( &SystemPrimitives::createInvocation ), 327683, signature_114, errors_114
+    "primitiveCompiledContextAllocate0", primitiveFunctionType( &allocateContext0 ), 6359040, signature_114, errors_114
 };
 
-static const char          *signature_115[] = { "SmallInteger" };
+static const char          *signature_115[] = { "Object" };
 static const char          *errors_115[]    = { nullptr };
 static PrimitiveDescriptor primitive_115    = {
-    "primitiveCurrentThreadId", primitiveFunctionType( &SystemPrimitives::current_thread_id ), 65536, signature_115, errors_115
+    "primitiveCompiledContextAllocate1", primitiveFunctionType( &allocateContext1 ), 6359040, signature_115, errors_115
 };
 
-static const char          *signature_116[] = { "Proxy", "Symbol", "Proxy" };
+static const char          *signature_116[] = { "Object" };
 static const char          *errors_116[]    = { nullptr };
 static PrimitiveDescriptor primitive_116    = {
-    "primitiveDLLLoad:result:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_load ), 327682, signature_116, errors_116
+    "primitiveCompiledContextAllocate2", primitiveFunctionType( &allocateContext2 ), 6359040, signature_116, errors_116
 };
 
-static const char          *signature_117[] = { "Proxy", "Symbol", "Proxy", "Proxy" };
+static const char          *signature_117[] = { "Object", "SmallInteger" };
 static const char          *errors_117[]    = { nullptr };
 static PrimitiveDescriptor primitive_117    = {
-    "primitiveDLLLookup:in:result:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_lookup ), 327683, signature_117, errors_117
+    "primitiveCompiledContextAllocate:", primitiveFunctionType( &allocateContext ), 6359041, signature_117, errors_117
 };
 
-static const char          *signature_118[] = { "Object", "Object", "Symbol" };
+static const char          *signature_118[] = { "Method", "Object", "SmallInteger", "SmallInteger", "Array", "ByteArray", "Array" };
 static const char          *errors_118[]    = { nullptr };
 static PrimitiveDescriptor primitive_118    = {
-    "primitiveDLLSetupLookup:selector:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_setup ), 327682, signature_118, errors_118
+    "primitiveConstructMethod:flags:nofArgs:debugInfo:bytes:oops:ifFail:", primitiveFunctionType( &MethodOopPrimitives::constructMethod ), 327686, signature_118, errors_118
 };
 
-static const char          *signature_119[] = { "Object", "Proxy" };
-static const char          *errors_119[]    = { nullptr };
+static const char          *signature_119[] = { "Object", "Object" };
+static const char          *errors_119[]    = { "NotOops", nullptr };
 static PrimitiveDescriptor primitive_119    = {
-    "primitiveDLLUnload:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_unload ), 327681, signature_119, errors_119
+    "primitiveCopyTenuredIfFail:", primitiveFunctionType( &OopPrimitives::copy_tenured ), 1376257, signature_119, errors_119
 };
 
-static const char          *signature_120[] = { "Object" };
-static const char          *errors_120[]    = { nullptr };
+static const char          *signature_120[] = { "GlobalAssociation", "Mixin", "Symbol", "Boolean", "Behavior", "Symbol" };
+static const char          *errors_120[]    = { "WrongFormat", nullptr };
 static PrimitiveDescriptor primitive_120    = {
-    "primitiveDecodeAllMethods", primitiveFunctionType( &DebugPrimitives::decodeAllMethods ), 65536, signature_120, errors_120
+    "primitiveCreateInvocationOf:named:isPrimaryInvocation:superclass:format:ifFail:", primitiveFunctionType( &SystemPrimitives::createNamedInvocation ), 327685, signature_120, errors_120
 };
 
-static const char          *signature_121[] = { "Object", "Object", "Symbol" };
-static const char          *errors_121[]    = { "NotFound", nullptr };
+static const char          *signature_121[] = { "GlobalAssociation", "Mixin", "Behavior", "Symbol" };
+static const char          *errors_121[]    = { "WrongFormat", nullptr };
 static PrimitiveDescriptor primitive_121    = {
-    "primitiveDecodeMethod:ifFail:", primitiveFunctionType( &DebugPrimitives::decodeMethod ), 1376258, signature_121, errors_121
+    "primitiveCreateInvocationOf:superclass:format:ifFail:", primitiveFunctionType( &SystemPrimitives::createInvocation ), 327683, signature_121, errors_121
 };
 
-static const char          *signature_122[] = { "Proxy", "Proxy" };
+static const char          *signature_122[] = { "SmallInteger" };
 static const char          *errors_122[]    = { nullptr };
 static PrimitiveDescriptor primitive_122    = {
-    "primitiveDefWindowProc:ifFail:", primitiveFunctionType( &SystemPrimitives::defWindowProc ), 327681, signature_122, errors_122
+    "primitiveCurrentThreadId", primitiveFunctionType( &SystemPrimitives::current_thread_id ), 65536, signature_122, errors_122
 };
 
-static const char          *signature_123[] = { "Object" };
+static const char          *signature_123[] = { "Proxy", "Symbol", "Proxy" };
 static const char          *errors_123[]    = { nullptr };
 static PrimitiveDescriptor primitive_123    = {
-    "primitiveDeoptimizeStacks", primitiveFunctionType( &DebugPrimitives::deoptimizeStacks ), 196608, signature_123, errors_123
+    "primitiveDLLLoad:result:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_load ), 327682, signature_123, errors_123
 };
 
-static const char          *signature_124[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
-static const char          *errors_124[]    = { "Overflow", "DivisionByZero", nullptr };
+static const char          *signature_124[] = { "Proxy", "Symbol", "Proxy", "Proxy" };
+static const char          *errors_124[]    = { nullptr };
 static PrimitiveDescriptor primitive_124    = {
-    "primitiveDiv:ifFail:", primitiveFunctionType( &smiOopPrimitives_div ), 6029826, signature_124, errors_124
+    "primitiveDLLLookup:in:result:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_lookup ), 327683, signature_124, errors_124
 };
 
-static const char          *signature_125[] = { "Float" };
+static const char          *signature_125[] = { "Object", "Object", "Symbol" };
 static const char          *errors_125[]    = { nullptr };
 static PrimitiveDescriptor primitive_125    = {
-    "primitiveElapsedTime", primitiveFunctionType( &SystemPrimitives::elapsedTime ), 65536, signature_125, errors_125
+    "primitiveDLLSetupLookup:selector:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_setup ), 327682, signature_125, errors_125
 };
 
-static const char          *signature_126[] = { "Boolean", "Object", "Object" };
+static const char          *signature_126[] = { "Object", "Proxy" };
 static const char          *errors_126[]    = { nullptr };
 static PrimitiveDescriptor primitive_126    = {
-    "primitiveEqual:", primitiveFunctionType( &OopPrimitives::equal ), 1572866, signature_126, errors_126
+    "primitiveDLLUnload:ifFail:", primitiveFunctionType( &SystemPrimitives::dll_unload ), 327681, signature_126, errors_126
 };
 
-static const char          *signature_127[] = { "Object", "SmallInteger" };
+static const char          *signature_127[] = { "Object" };
 static const char          *errors_127[]    = { nullptr };
 static PrimitiveDescriptor primitive_127    = {
-    "primitiveExpandMemory:", primitiveFunctionType( &SystemPrimitives::expandMemory ), 65537, signature_127, errors_127
+    "primitiveDecodeAllMethods", primitiveFunctionType( &DebugPrimitives::decodeAllMethods ), 65536, signature_127, errors_127
 };
 
-static const char          *signature_128[] = { "SmallInteger" };
-static const char          *errors_128[]    = { nullptr };
+static const char          *signature_128[] = { "Object", "Object", "Symbol" };
+static const char          *errors_128[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_128    = {
-    "primitiveExpansions", primitiveFunctionType( &SystemPrimitives::expansions ), 65536, signature_128, errors_128
+    "primitiveDecodeMethod:ifFail:", primitiveFunctionType( &DebugPrimitives::decodeMethod ), 1376258, signature_128, errors_128
 };
 
-static const char          *signature_129[] = { "Process|nil" };
+static const char          *signature_129[] = { "Proxy", "Proxy" };
 static const char          *errors_129[]    = { nullptr };
 static PrimitiveDescriptor primitive_129    = {
-    "primitiveFlatProfilerDisengage", primitiveFunctionType( &SystemPrimitives::flat_profiler_disengage ), 65536, signature_129, errors_129
+    "primitiveDefWindowProc:ifFail:", primitiveFunctionType( &SystemPrimitives::defWindowProc ), 327681, signature_129, errors_129
 };
 
-static const char          *signature_130[] = { "Process", "Process" };
+static const char          *signature_130[] = { "Object" };
 static const char          *errors_130[]    = { nullptr };
 static PrimitiveDescriptor primitive_130    = {
-    "primitiveFlatProfilerEngage:ifFail:", primitiveFunctionType( &SystemPrimitives::flat_profiler_engage ), 327681, signature_130, errors_130
+    "primitiveDeoptimizeStacks", primitiveFunctionType( &DebugPrimitives::deoptimizeStacks ), 196608, signature_130, errors_130
 };
 
-static const char          *signature_131[] = { "Object" };
-static const char          *errors_131[]    = { nullptr };
+static const char          *signature_131[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_131[]    = { "Overflow", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_131    = {
-    "primitiveFlatProfilerPrint", primitiveFunctionType( &SystemPrimitives::flat_profiler_print ), 65536, signature_131, errors_131
+    "primitiveDiv:ifFail:", primitiveFunctionType( &smiOopPrimitives_div ), 6029826, signature_131, errors_131
 };
 
-static const char          *signature_132[] = { "Process|nil" };
+static const char          *signature_132[] = { "Float" };
 static const char          *errors_132[]    = { nullptr };
 static PrimitiveDescriptor primitive_132    = {
-    "primitiveFlatProfilerProcess", primitiveFunctionType( &SystemPrimitives::flat_profiler_process ), 65536, signature_132, errors_132
+    "primitiveElapsedTime", primitiveFunctionType( &SystemPrimitives::elapsedTime ), 65536, signature_132, errors_132
 };
 
-static const char          *signature_133[] = { "Object" };
+static const char          *signature_133[] = { "Boolean", "Object", "Object" };
 static const char          *errors_133[]    = { nullptr };
 static PrimitiveDescriptor primitive_133    = {
-    "primitiveFlatProfilerReset", primitiveFunctionType( &SystemPrimitives::flat_profiler_reset ), 65536, signature_133, errors_133
+    "primitiveEqual:", primitiveFunctionType( &OopPrimitives::equal ), 1572866, signature_133, errors_133
 };
 
-static const char          *signature_134[] = { "Float", "Float", "Float" };
+static const char          *signature_134[] = { "Object", "SmallInteger" };
 static const char          *errors_134[]    = { nullptr };
 static PrimitiveDescriptor primitive_134    = {
-    "primitiveFloatAdd:ifFail:", primitiveFunctionType( &double_add ), 6030338, signature_134, errors_134
+    "primitiveExpandMemory:", primitiveFunctionType( &SystemPrimitives::expandMemory ), 65537, signature_134, errors_134
 };
 
-static const char          *signature_135[] = { "Float", "Float" };
+static const char          *signature_135[] = { "SmallInteger" };
 static const char          *errors_135[]    = { nullptr };
 static PrimitiveDescriptor primitive_135    = {
-    "primitiveFloatArcCosineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::arcCosine ), 1836033, signature_135, errors_135
+    "primitiveExpansions", primitiveFunctionType( &SystemPrimitives::expansions ), 65536, signature_135, errors_135
 };
 
-static const char          *signature_136[] = { "Float", "Float" };
+static const char          *signature_136[] = { "Process|nil" };
 static const char          *errors_136[]    = { nullptr };
 static PrimitiveDescriptor primitive_136    = {
-    "primitiveFloatArcSineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::arcSine ), 1836033, signature_136, errors_136
+    "primitiveFlatProfilerDisengage", primitiveFunctionType( &SystemPrimitives::flat_profiler_disengage ), 65536, signature_136, errors_136
 };
 
-static const char          *signature_137[] = { "Float", "Float" };
+static const char          *signature_137[] = { "Process", "Process" };
 static const char          *errors_137[]    = { nullptr };
 static PrimitiveDescriptor primitive_137    = {
-    "primitiveFloatArcTangentIfFail:", primitiveFunctionType( &DoubleOopPrimitives::arcTangent ), 1836033, signature_137, errors_137
+    "primitiveFlatProfilerEngage:ifFail:", primitiveFunctionType( &SystemPrimitives::flat_profiler_engage ), 327681, signature_137, errors_137
 };
 
-static const char          *signature_138[] = { "SmallInteger", "Float" };
-static const char          *errors_138[]    = { "SmallIntegerConversionFailed", nullptr };
+static const char          *signature_138[] = { "Object" };
+static const char          *errors_138[]    = { nullptr };
 static PrimitiveDescriptor primitive_138    = {
-    "primitiveFloatAsSmallIntegerIfFail:", primitiveFunctionType( &DoubleOopPrimitives::asSmallInteger ), 1836033, signature_138, errors_138
+    "primitiveFlatProfilerPrint", primitiveFunctionType( &SystemPrimitives::flat_profiler_print ), 65536, signature_138, errors_138
 };
 
-static const char          *signature_139[] = { "Float", "Float" };
+static const char          *signature_139[] = { "Process|nil" };
 static const char          *errors_139[]    = { nullptr };
 static PrimitiveDescriptor primitive_139    = {
-    "primitiveFloatCeiling", primitiveFunctionType( &DoubleOopPrimitives::ceiling ), 1573889, signature_139, errors_139
+    "primitiveFlatProfilerProcess", primitiveFunctionType( &SystemPrimitives::flat_profiler_process ), 65536, signature_139, errors_139
 };
 
-static const char          *signature_140[] = { "Float", "Float" };
+static const char          *signature_140[] = { "Object" };
 static const char          *errors_140[]    = { nullptr };
 static PrimitiveDescriptor primitive_140    = {
-    "primitiveFloatCosine", primitiveFunctionType( &DoubleOopPrimitives::cosine ), 1573889, signature_140, errors_140
+    "primitiveFlatProfilerReset", primitiveFunctionType( &SystemPrimitives::flat_profiler_reset ), 65536, signature_140, errors_140
 };
 
 static const char          *signature_141[] = { "Float", "Float", "Float" };
 static const char          *errors_141[]    = { nullptr };
 static PrimitiveDescriptor primitive_141    = {
-    "primitiveFloatDivide:ifFail:", primitiveFunctionType( &double_divide ), 6030338, signature_141, errors_141
+    "primitiveFloatAdd:ifFail:", primitiveFunctionType( &double_add ), 6030338, signature_141, errors_141
 };
 
-static const char          *signature_142[] = { "Boolean", "Float", "Float" };
+static const char          *signature_142[] = { "Float", "Float" };
 static const char          *errors_142[]    = { nullptr };
 static PrimitiveDescriptor primitive_142    = {
-    "primitiveFloatEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::equal ), 6030082, signature_142, errors_142
+    "primitiveFloatArcCosineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::arcCosine ), 1836033, signature_142, errors_142
 };
 
 static const char          *signature_143[] = { "Float", "Float" };
 static const char          *errors_143[]    = { nullptr };
 static PrimitiveDescriptor primitive_143    = {
-    "primitiveFloatExp", primitiveFunctionType( &DoubleOopPrimitives::exp ), 1573889, signature_143, errors_143
+    "primitiveFloatArcSineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::arcSine ), 1836033, signature_143, errors_143
 };
 
-static const char          *signature_144[] = { "SmallInteger", "Float" };
+static const char          *signature_144[] = { "Float", "Float" };
 static const char          *errors_144[]    = { nullptr };
 static PrimitiveDescriptor primitive_144    = {
-    "primitiveFloatExponent", primitiveFunctionType( &DoubleOopPrimitives::exponent ), 1573889, signature_144, errors_144
+    "primitiveFloatArcTangentIfFail:", primitiveFunctionType( &DoubleOopPrimitives::arcTangent ), 1836033, signature_144, errors_144
 };
 
-static const char          *signature_145[] = { "Float", "Float" };
-static const char          *errors_145[]    = { nullptr };
+static const char          *signature_145[] = { "SmallInteger", "Float" };
+static const char          *errors_145[]    = { "SmallIntegerConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_145    = {
-    "primitiveFloatFloor", primitiveFunctionType( &DoubleOopPrimitives::floor ), 1573889, signature_145, errors_145
+    "primitiveFloatAsSmallIntegerIfFail:", primitiveFunctionType( &DoubleOopPrimitives::asSmallInteger ), 1836033, signature_145, errors_145
 };
 
-static const char          *signature_146[] = { "Boolean", "Float", "Float" };
+static const char          *signature_146[] = { "Float", "Float" };
 static const char          *errors_146[]    = { nullptr };
 static PrimitiveDescriptor primitive_146    = {
-    "primitiveFloatGreaterThan:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::greaterThan ), 6030082, signature_146, errors_146
+    "primitiveFloatCeiling", primitiveFunctionType( &DoubleOopPrimitives::ceiling ), 1573889, signature_146, errors_146
 };
 
-static const char          *signature_147[] = { "Boolean", "Float", "Float" };
+static const char          *signature_147[] = { "Float", "Float" };
 static const char          *errors_147[]    = { nullptr };
 static PrimitiveDescriptor primitive_147    = {
-    "primitiveFloatGreaterThanOrEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::greaterThanOrEqual ), 6030082, signature_147, errors_147
+    "primitiveFloatCosine", primitiveFunctionType( &DoubleOopPrimitives::cosine ), 1573889, signature_147, errors_147
 };
 
-static const char          *signature_148[] = { "Float", "Float" };
+static const char          *signature_148[] = { "Float", "Float", "Float" };
 static const char          *errors_148[]    = { nullptr };
 static PrimitiveDescriptor primitive_148    = {
-    "primitiveFloatHyperbolicCosineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::hyperbolicCosine ), 1836033, signature_148, errors_148
+    "primitiveFloatDivide:ifFail:", primitiveFunctionType( &double_divide ), 6030338, signature_148, errors_148
 };
 
-static const char          *signature_149[] = { "Float", "Float" };
+static const char          *signature_149[] = { "Boolean", "Float", "Float" };
 static const char          *errors_149[]    = { nullptr };
 static PrimitiveDescriptor primitive_149    = {
-    "primitiveFloatHyperbolicSineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::hyperbolicSine ), 1836033, signature_149, errors_149
+    "primitiveFloatEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::equal ), 6030082, signature_149, errors_149
 };
 
 static const char          *signature_150[] = { "Float", "Float" };
 static const char          *errors_150[]    = { nullptr };
 static PrimitiveDescriptor primitive_150    = {
-    "primitiveFloatHyperbolicTangentIfFail:", primitiveFunctionType( &DoubleOopPrimitives::hyperbolicTangent ), 1836033, signature_150, errors_150
+    "primitiveFloatExp", primitiveFunctionType( &DoubleOopPrimitives::exp ), 1573889, signature_150, errors_150
 };
 
-static const char          *signature_151[] = { "Boolean", "Float" };
+static const char          *signature_151[] = { "SmallInteger", "Float" };
 static const char          *errors_151[]    = { nullptr };
 static PrimitiveDescriptor primitive_151    = {
-    "primitiveFloatIsFinite", primitiveFunctionType( &DoubleOopPrimitives::isFinite ), 1573889, signature_151, errors_151
+    "primitiveFloatExponent", primitiveFunctionType( &DoubleOopPrimitives::exponent ), 1573889, signature_151, errors_151
 };
 
-static const char          *signature_152[] = { "Boolean", "Float" };
+static const char          *signature_152[] = { "Float", "Float" };
 static const char          *errors_152[]    = { nullptr };
 static PrimitiveDescriptor primitive_152    = {
-    "primitiveFloatIsNan", primitiveFunctionType( &DoubleOopPrimitives::isNan ), 1573889, signature_152, errors_152
+    "primitiveFloatFloor", primitiveFunctionType( &DoubleOopPrimitives::floor ), 1573889, signature_152, errors_152
 };
 
 static const char          *signature_153[] = { "Boolean", "Float", "Float" };
 static const char          *errors_153[]    = { nullptr };
 static PrimitiveDescriptor primitive_153    = {
-    "primitiveFloatLessThan:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::lessThan ), 6030082, signature_153, errors_153
+    "primitiveFloatGreaterThan:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::greaterThan ), 6030082, signature_153, errors_153
 };
 
 static const char          *signature_154[] = { "Boolean", "Float", "Float" };
 static const char          *errors_154[]    = { nullptr };
 static PrimitiveDescriptor primitive_154    = {
-    "primitiveFloatLessThanOrEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::lessThanOrEqual ), 6030082, signature_154, errors_154
+    "primitiveFloatGreaterThanOrEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::greaterThanOrEqual ), 6030082, signature_154, errors_154
 };
 
 static const char          *signature_155[] = { "Float", "Float" };
-static const char          *errors_155[]    = { "ReceiverNotStrictlyPositive", nullptr };
+static const char          *errors_155[]    = { nullptr };
 static PrimitiveDescriptor primitive_155    = {
-    "primitiveFloatLnIfFail:", primitiveFunctionType( &DoubleOopPrimitives::ln ), 1836033, signature_155, errors_155
+    "primitiveFloatHyperbolicCosineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::hyperbolicCosine ), 1836033, signature_155, errors_155
 };
 
 static const char          *signature_156[] = { "Float", "Float" };
-static const char          *errors_156[]    = { "ReceiverNotStrictlyPositive", nullptr };
+static const char          *errors_156[]    = { nullptr };
 static PrimitiveDescriptor primitive_156    = {
-    "primitiveFloatLog10IfFail:", primitiveFunctionType( &DoubleOopPrimitives::log10 ), 1836033, signature_156, errors_156
+    "primitiveFloatHyperbolicSineIfFail:", primitiveFunctionType( &DoubleOopPrimitives::hyperbolicSine ), 1836033, signature_156, errors_156
 };
 
 static const char          *signature_157[] = { "Float", "Float" };
 static const char          *errors_157[]    = { nullptr };
 static PrimitiveDescriptor primitive_157    = {
-    "primitiveFloatMantissa", primitiveFunctionType( &DoubleOopPrimitives::mantissa ), 1573889, signature_157, errors_157
+    "primitiveFloatHyperbolicTangentIfFail:", primitiveFunctionType( &DoubleOopPrimitives::hyperbolicTangent ), 1836033, signature_157, errors_157
 };
 
-static const char          *signature_158[] = { "Float" };
+static const char          *signature_158[] = { "Boolean", "Float" };
 static const char          *errors_158[]    = { nullptr };
 static PrimitiveDescriptor primitive_158    = {
-    "primitiveFloatMaxValue", primitiveFunctionType( &DoubleOopPrimitives::min_positive_value ), 524288, signature_158, errors_158
+    "primitiveFloatIsFinite", primitiveFunctionType( &DoubleOopPrimitives::isFinite ), 1573889, signature_158, errors_158
 };
 
-static const char          *signature_159[] = { "Float" };
+static const char          *signature_159[] = { "Boolean", "Float" };
 static const char          *errors_159[]    = { nullptr };
 static PrimitiveDescriptor primitive_159    = {
-    "primitiveFloatMinPositiveValue", primitiveFunctionType( &DoubleOopPrimitives::min_positive_value ), 524288, signature_159, errors_159
+    "primitiveFloatIsNan", primitiveFunctionType( &DoubleOopPrimitives::isNan ), 1573889, signature_159, errors_159
 };
 
-static const char          *signature_160[] = { "Float", "Float", "Float" };
+static const char          *signature_160[] = { "Boolean", "Float", "Float" };
 static const char          *errors_160[]    = { nullptr };
 static PrimitiveDescriptor primitive_160    = {
-    "primitiveFloatMod:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::mod ), 1836034, signature_160, errors_160
+    "primitiveFloatLessThan:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::lessThan ), 6030082, signature_160, errors_160
 };
 
-static const char          *signature_161[] = { "Float", "Float", "Float" };
+static const char          *signature_161[] = { "Boolean", "Float", "Float" };
 static const char          *errors_161[]    = { nullptr };
 static PrimitiveDescriptor primitive_161    = {
-    "primitiveFloatMultiply:ifFail:", primitiveFunctionType( &double_multiply ), 6030338, signature_161, errors_161
+    "primitiveFloatLessThanOrEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::lessThanOrEqual ), 6030082, signature_161, errors_161
 };
 
-static const char          *signature_162[] = { "Boolean", "Float", "Float" };
-static const char          *errors_162[]    = { nullptr };
+static const char          *signature_162[] = { "Float", "Float" };
+static const char          *errors_162[]    = { "ReceiverNotStrictlyPositive", nullptr };
 static PrimitiveDescriptor primitive_162    = {
-    "primitiveFloatNotEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::notEqual ), 6030082, signature_162, errors_162
+    "primitiveFloatLnIfFail:", primitiveFunctionType( &DoubleOopPrimitives::ln ), 1836033, signature_162, errors_162
 };
 
-static const char          *signature_163[] = { "Self", "Float", "IndexedByteInstanceVariables" };
-static const char          *errors_163[]    = { nullptr };
+static const char          *signature_163[] = { "Float", "Float" };
+static const char          *errors_163[]    = { "ReceiverNotStrictlyPositive", nullptr };
 static PrimitiveDescriptor primitive_163    = {
-    "primitiveFloatPrintFormat:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::printFormat ), 1310722, signature_163, errors_163
+    "primitiveFloatLog10IfFail:", primitiveFunctionType( &DoubleOopPrimitives::log10 ), 1836033, signature_163, errors_163
 };
 
-static const char          *signature_164[] = { "IndexedByteInstanceVariables", "Float" };
+static const char          *signature_164[] = { "Float", "Float" };
 static const char          *errors_164[]    = { nullptr };
 static PrimitiveDescriptor primitive_164    = {
-    "primitiveFloatPrintString", primitiveFunctionType( &DoubleOopPrimitives::printString ), 1048577, signature_164, errors_164
+    "primitiveFloatMantissa", primitiveFunctionType( &DoubleOopPrimitives::mantissa ), 1573889, signature_164, errors_164
 };
 
-static const char          *signature_165[] = { "SmallInteger", "Float" };
-static const char          *errors_165[]    = { "SmallIntegerConversionFailed", nullptr };
+static const char          *signature_165[] = { "Float" };
+static const char          *errors_165[]    = { nullptr };
 static PrimitiveDescriptor primitive_165    = {
-    "primitiveFloatRoundedAsSmallIntegerIfFail:", primitiveFunctionType( &DoubleOopPrimitives::roundedAsSmallInteger ), 1836033, signature_165, errors_165
+    "primitiveFloatMaxValue", primitiveFunctionType( &DoubleOopPrimitives::min_positive_value ), 524288, signature_165, errors_165
 };
 
-static const char          *signature_166[] = { "Float", "Float" };
+static const char          *signature_166[] = { "Float" };
 static const char          *errors_166[]    = { nullptr };
 static PrimitiveDescriptor primitive_166    = {
-    "primitiveFloatSine", primitiveFunctionType( &DoubleOopPrimitives::sine ), 1573889, signature_166, errors_166
+    "primitiveFloatMinPositiveValue", primitiveFunctionType( &DoubleOopPrimitives::min_positive_value ), 524288, signature_166, errors_166
 };
 
-static const char          *signature_167[] = { "SmallInteger", "Float" };
-static const char          *errors_167[]    = { "ConversionFailed", nullptr };
+static const char          *signature_167[] = { "Float", "Float", "Float" };
+static const char          *errors_167[]    = { nullptr };
 static PrimitiveDescriptor primitive_167    = {
-    "primitiveFloatSmallIntegerFloorIfFail:", primitiveFunctionType( &DoubleOopPrimitives::smi_floor ), 6030337, signature_167, errors_167
+    "primitiveFloatMod:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::mod ), 1836034, signature_167, errors_167
 };
 
-static const char          *signature_168[] = { "Float", "Float" };
-static const char          *errors_168[]    = { "ReceiverNegative", nullptr };
+static const char          *signature_168[] = { "Float", "Float", "Float" };
+static const char          *errors_168[]    = { nullptr };
 static PrimitiveDescriptor primitive_168    = {
-    "primitiveFloatSqrtIfFail:", primitiveFunctionType( &DoubleOopPrimitives::sqrt ), 1836033, signature_168, errors_168
+    "primitiveFloatMultiply:ifFail:", primitiveFunctionType( &double_multiply ), 6030338, signature_168, errors_168
 };
 
-static const char          *signature_169[] = { "Float", "Float" };
+static const char          *signature_169[] = { "Boolean", "Float", "Float" };
 static const char          *errors_169[]    = { nullptr };
 static PrimitiveDescriptor primitive_169    = {
-    "primitiveFloatSquared", primitiveFunctionType( &DoubleOopPrimitives::squared ), 1573889, signature_169, errors_169
+    "primitiveFloatNotEqual:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::notEqual ), 6030082, signature_169, errors_169
 };
 
-static const char          *signature_170[] = { "ByteArray", "Float" };
+static const char          *signature_170[] = { "Self", "Float", "IndexedByteInstanceVariables" };
 static const char          *errors_170[]    = { nullptr };
 static PrimitiveDescriptor primitive_170    = {
-    "primitiveFloatStoreString", primitiveFunctionType( &DoubleOopPrimitives::store_string ), 1048577, signature_170, errors_170
+    "primitiveFloatPrintFormat:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::printFormat ), 1310722, signature_170, errors_170
 };
 
-static const char          *signature_171[] = { "Float", "Float", "Float" };
+static const char          *signature_171[] = { "IndexedByteInstanceVariables", "Float" };
 static const char          *errors_171[]    = { nullptr };
 static PrimitiveDescriptor primitive_171    = {
-    "primitiveFloatSubtract:ifFail:", primitiveFunctionType( &double_subtract ), 6030338, signature_171, errors_171
+    "primitiveFloatPrintString", primitiveFunctionType( &DoubleOopPrimitives::printString ), 1048577, signature_171, errors_171
 };
 
-static const char          *signature_172[] = { "Float", "Float" };
-static const char          *errors_172[]    = { nullptr };
+static const char          *signature_172[] = { "SmallInteger", "Float" };
+static const char          *errors_172[]    = { "SmallIntegerConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_172    = {
-    "primitiveFloatTangentIfFail:", primitiveFunctionType( &DoubleOopPrimitives::tangent ), 1836033, signature_172, errors_172
+    "primitiveFloatRoundedAsSmallIntegerIfFail:", primitiveFunctionType( &DoubleOopPrimitives::roundedAsSmallInteger ), 1836033, signature_172, errors_172
 };
 
-static const char          *signature_173[] = { "Float", "Float", "SmallInteger" };
-static const char          *errors_173[]    = { "RangeError", nullptr };
+static const char          *signature_173[] = { "Float", "Float" };
+static const char          *errors_173[]    = { nullptr };
 static PrimitiveDescriptor primitive_173    = {
-    "primitiveFloatTimesTwoPower:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::timesTwoPower ), 1836034, signature_173, errors_173
+    "primitiveFloatSine", primitiveFunctionType( &DoubleOopPrimitives::sine ), 1573889, signature_173, errors_173
 };
 
-static const char          *signature_174[] = { "Float", "Float" };
-static const char          *errors_174[]    = { nullptr };
+static const char          *signature_174[] = { "SmallInteger", "Float" };
+static const char          *errors_174[]    = { "ConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_174    = {
-    "primitiveFloatTruncated", primitiveFunctionType( &DoubleOopPrimitives::truncated ), 1573889, signature_174, errors_174
+    "primitiveFloatSmallIntegerFloorIfFail:", primitiveFunctionType( &DoubleOopPrimitives::smi_floor ), 6030337, signature_174, errors_174
 };
 
-static const char          *signature_175[] = { "Object" };
-static const char          *errors_175[]    = { nullptr };
+static const char          *signature_175[] = { "Float", "Float" };
+static const char          *errors_175[]    = { "ReceiverNegative", nullptr };
 static PrimitiveDescriptor primitive_175    = {
-    "primitiveFlushCodeCache", primitiveFunctionType( &SystemPrimitives::flush_code_cache ), 65536, signature_175, errors_175
+    "primitiveFloatSqrtIfFail:", primitiveFunctionType( &DoubleOopPrimitives::sqrt ), 1836033, signature_175, errors_175
 };
 
-static const char          *signature_176[] = { "Object" };
+static const char          *signature_176[] = { "Float", "Float" };
 static const char          *errors_176[]    = { nullptr };
 static PrimitiveDescriptor primitive_176    = {
-    "primitiveFlushDeadCode", primitiveFunctionType( &SystemPrimitives::flush_dead_code ), 65536, signature_176, errors_176
+    "primitiveFloatSquared", primitiveFunctionType( &DoubleOopPrimitives::squared ), 1573889, signature_176, errors_176
 };
 
-static const char          *signature_177[] = { "SmallInteger" };
+static const char          *signature_177[] = { "ByteArray", "Float" };
 static const char          *errors_177[]    = { nullptr };
 static PrimitiveDescriptor primitive_177    = {
-    "primitiveFreeSpace", primitiveFunctionType( &SystemPrimitives::freeSpace ), 65536, signature_177, errors_177
+    "primitiveFloatStoreString", primitiveFunctionType( &DoubleOopPrimitives::store_string ), 1048577, signature_177, errors_177
 };
 
-static const char          *signature_178[] = { "Self", "Object" };
+static const char          *signature_178[] = { "Float", "Float", "Float" };
 static const char          *errors_178[]    = { nullptr };
 static PrimitiveDescriptor primitive_178    = {
-    "primitiveGarbageCollect", primitiveFunctionType( &SystemPrimitives::garbageGollect ), 1114113, signature_178, errors_178
+    "primitiveFloatSubtract:ifFail:", primitiveFunctionType( &double_subtract ), 6030338, signature_178, errors_178
 };
 
-static const char          *signature_179[] = { "Object", "Object", "Symbol" };
-static const char          *errors_179[]    = { "NotFound", nullptr };
+static const char          *signature_179[] = { "Float", "Float" };
+static const char          *errors_179[]    = { nullptr };
 static PrimitiveDescriptor primitive_179    = {
-    "primitiveGenerateIR:ifFail:", primitiveFunctionType( &DebugPrimitives::generateIR ), 1376258, signature_179, errors_179
+    "primitiveFloatTangentIfFail:", primitiveFunctionType( &DoubleOopPrimitives::tangent ), 1836033, signature_179, errors_179
 };
 
-static const char          *signature_180[] = { "Integer" };
-static const char          *errors_180[]    = { nullptr };
+static const char          *signature_180[] = { "Float", "Float", "SmallInteger" };
+static const char          *errors_180[]    = { "RangeError", nullptr };
 static PrimitiveDescriptor primitive_180    = {
-    "primitiveGetLastError", primitiveFunctionType( &SystemPrimitives::getLastError ), 65536, signature_180, errors_180
+    "primitiveFloatTimesTwoPower:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::timesTwoPower ), 1836034, signature_180, errors_180
 };
 
-static const char          *signature_181[] = { "Boolean", "GlobalAssociation" };
+static const char          *signature_181[] = { "Float", "Float" };
 static const char          *errors_181[]    = { nullptr };
 static PrimitiveDescriptor primitive_181    = {
-    "primitiveGlobalAssociationIsConstant", primitiveFunctionType( &SystemPrimitives::globalAssociationIsConstant ), 1114113, signature_181, errors_181
+    "primitiveFloatTruncated", primitiveFunctionType( &DoubleOopPrimitives::truncated ), 1573889, signature_181, errors_181
 };
 
-static const char          *signature_182[] = { "Symbol", "GlobalAssociation" };
+static const char          *signature_182[] = { "Object" };
 static const char          *errors_182[]    = { nullptr };
 static PrimitiveDescriptor primitive_182    = {
-    "primitiveGlobalAssociationKey", primitiveFunctionType( &SystemPrimitives::globalAssociationKey ), 1114113, signature_182, errors_182
+    "primitiveFlushCodeCache", primitiveFunctionType( &SystemPrimitives::flush_code_cache ), 65536, signature_182, errors_182
 };
 
-static const char          *signature_183[] = { "Boolean", "GlobalAssociation", "Boolean" };
+static const char          *signature_183[] = { "Object" };
 static const char          *errors_183[]    = { nullptr };
 static PrimitiveDescriptor primitive_183    = {
-    "primitiveGlobalAssociationSetConstant:", primitiveFunctionType( &SystemPrimitives::globalAssociationSetConstant ), 1114114, signature_183, errors_183
+    "primitiveFlushDeadCode", primitiveFunctionType( &SystemPrimitives::flush_dead_code ), 65536, signature_183, errors_183
 };
 
-static const char          *signature_184[] = { "Object", "GlobalAssociation", "Symbol" };
+static const char          *signature_184[] = { "SmallInteger" };
 static const char          *errors_184[]    = { nullptr };
 static PrimitiveDescriptor primitive_184    = {
-    "primitiveGlobalAssociationSetKey:", primitiveFunctionType( &SystemPrimitives::globalAssociationSetKey ), 1114114, signature_184, errors_184
+    "primitiveFreeSpace", primitiveFunctionType( &SystemPrimitives::freeSpace ), 65536, signature_184, errors_184
 };
 
-static const char          *signature_185[] = { "Object", "GlobalAssociation", "Object" };
+static const char          *signature_185[] = { "Self", "Object" };
 static const char          *errors_185[]    = { nullptr };
 static PrimitiveDescriptor primitive_185    = {
-    "primitiveGlobalAssociationSetValue:", primitiveFunctionType( &SystemPrimitives::globalAssociationSetValue ), 1114114, signature_185, errors_185
+    "primitiveGarbageCollect", primitiveFunctionType( &SystemPrimitives::garbageGollect ), 1114113, signature_185, errors_185
 };
 
-static const char          *signature_186[] = { "Object", "GlobalAssociation" };
-static const char          *errors_186[]    = { nullptr };
+static const char          *signature_186[] = { "Object", "Object", "Symbol" };
+static const char          *errors_186[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_186    = {
-    "primitiveGlobalAssociationValue", primitiveFunctionType( &SystemPrimitives::globalAssociationValue ), 1114113, signature_186, errors_186
+    "primitiveGenerateIR:ifFail:", primitiveFunctionType( &DebugPrimitives::generateIR ), 1376258, signature_186, errors_186
 };
 
-static const char          *signature_187[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *signature_187[] = { "Integer" };
 static const char          *errors_187[]    = { nullptr };
 static PrimitiveDescriptor primitive_187    = {
-    "primitiveGreaterThan:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::greaterThan ), 6029570, signature_187, errors_187
+    "primitiveGetLastError", primitiveFunctionType( &SystemPrimitives::getLastError ), 65536, signature_187, errors_187
 };
 
-static const char          *signature_188[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *signature_188[] = { "Boolean", "GlobalAssociation" };
 static const char          *errors_188[]    = { nullptr };
 static PrimitiveDescriptor primitive_188    = {
-    "primitiveGreaterThanOrEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::greaterThanOrEqual ), 6029570, signature_188, errors_188
+    "primitiveGlobalAssociationIsConstant", primitiveFunctionType( &SystemPrimitives::globalAssociationIsConstant ), 1114113, signature_188, errors_188
 };
 
-static const char          *signature_189[] = { "Boolean", "Object" };
+static const char          *signature_189[] = { "Symbol", "GlobalAssociation" };
 static const char          *errors_189[]    = { nullptr };
 static PrimitiveDescriptor primitive_189    = {
-    "primitiveHadNearDeathExperience:", primitiveFunctionType( &SystemPrimitives::hadNearDeathExperience ), 65537, signature_189, errors_189
+    "primitiveGlobalAssociationKey", primitiveFunctionType( &SystemPrimitives::globalAssociationKey ), 1114113, signature_189, errors_189
 };
 
-static const char          *signature_190[] = { "Object" };
+static const char          *signature_190[] = { "Boolean", "GlobalAssociation", "Boolean" };
 static const char          *errors_190[]    = { nullptr };
 static PrimitiveDescriptor primitive_190    = {
-    "primitiveHalt", primitiveFunctionType( &SystemPrimitives::halt ), 65536, signature_190, errors_190
+    "primitiveGlobalAssociationSetConstant:", primitiveFunctionType( &SystemPrimitives::globalAssociationSetConstant ), 1114114, signature_190, errors_190
 };
 
-static const char          *signature_191[] = { "SmallInteger", "Object" };
+static const char          *signature_191[] = { "Object", "GlobalAssociation", "Symbol" };
 static const char          *errors_191[]    = { nullptr };
 static PrimitiveDescriptor primitive_191    = {
-    "primitiveHash", primitiveFunctionType( &OopPrimitives::hash ), 1114113, signature_191, errors_191
+    "primitiveGlobalAssociationSetKey:", primitiveFunctionType( &SystemPrimitives::globalAssociationSetKey ), 1114114, signature_191, errors_191
 };
 
-static const char          *signature_192[] = { "SmallInteger", "Object" };
+static const char          *signature_192[] = { "Object", "GlobalAssociation", "Object" };
 static const char          *errors_192[]    = { nullptr };
 static PrimitiveDescriptor primitive_192    = {
-    "primitiveHashOf:", primitiveFunctionType( &OopPrimitives::hash_of ), 65537, signature_192, errors_192
+    "primitiveGlobalAssociationSetValue:", primitiveFunctionType( &SystemPrimitives::globalAssociationSetValue ), 1114114, signature_192, errors_192
 };
 
-static const char          *signature_193[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
-static const char          *errors_193[]    = { "OutOfBounds", nullptr };
+static const char          *signature_193[] = { "Object", "GlobalAssociation" };
+static const char          *errors_193[]    = { nullptr };
 static PrimitiveDescriptor primitive_193    = {
-    "primitiveIndexedByteAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::at ), 1312258, signature_193, errors_193
+    "primitiveGlobalAssociationValue", primitiveFunctionType( &SystemPrimitives::globalAssociationValue ), 1114113, signature_193, errors_193
 };
 
-static const char          *signature_194[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
-static const char          *errors_194[]    = { "OutOfBounds", "ValueOutOfBounds", nullptr };
+static const char          *signature_194[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *errors_194[]    = { nullptr };
 static PrimitiveDescriptor primitive_194    = {
-    "primitiveIndexedByteAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::atPut ), 1312259, signature_194, errors_194
+    "primitiveGreaterThan:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::greaterThan ), 6029570, signature_194, errors_194
 };
 
-static const char          *signature_195[] = { "Self", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *signature_195[] = { "Boolean", "SmallInteger", "SmallInteger" };
 static const char          *errors_195[]    = { nullptr };
 static PrimitiveDescriptor primitive_195    = {
-    "primitiveIndexedByteAtAllPut:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::at_all_put ), 1376258, signature_195, errors_195
+    "primitiveGreaterThanOrEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::greaterThanOrEqual ), 6029570, signature_195, errors_195
 };
 
-static const char          *signature_196[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
-static const char          *errors_196[]    = { "OutOfBounds", nullptr };
+static const char          *signature_196[] = { "Boolean", "Object" };
+static const char          *errors_196[]    = { nullptr };
 static PrimitiveDescriptor primitive_196    = {
-    "primitiveIndexedByteCharacterAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::characterAt ), 1312258, signature_196, errors_196
+    "primitiveHadNearDeathExperience:", primitiveFunctionType( &SystemPrimitives::hadNearDeathExperience ), 65537, signature_196, errors_196
 };
 
-static const char          *signature_197[] = { "SmallInteger", "IndexedByteInstanceVariables", "String" };
+static const char          *signature_197[] = { "Object" };
 static const char          *errors_197[]    = { nullptr };
 static PrimitiveDescriptor primitive_197    = {
-    "primitiveIndexedByteCompare:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::compare ), 1376258, signature_197, errors_197
+    "primitiveHalt", primitiveFunctionType( &SystemPrimitives::halt ), 65536, signature_197, errors_197
 };
 
-static const char          *signature_198[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *signature_198[] = { "SmallInteger", "Object" };
 static const char          *errors_198[]    = { nullptr };
 static PrimitiveDescriptor primitive_198    = {
-    "primitiveIndexedByteHash", primitiveFunctionType( &ByteArrayPrimitives::hash ), 1574401, signature_198, errors_198
+    "primitiveHash", primitiveFunctionType( &OopPrimitives::hash ), 1114113, signature_198, errors_198
 };
 
-static const char          *signature_199[] = { "CompressedSymbol", "IndexedByteInstanceVariables" };
-static const char          *errors_199[]    = { "ValueOutOfBounds", nullptr };
+static const char          *signature_199[] = { "SmallInteger", "Object" };
+static const char          *errors_199[]    = { nullptr };
 static PrimitiveDescriptor primitive_199    = {
-    "primitiveIndexedByteInternIfFail:", primitiveFunctionType( &ByteArrayPrimitives::intern ), 1376257, signature_199, errors_199
+    "primitiveHashOf:", primitiveFunctionType( &OopPrimitives::hash_of ), 65537, signature_199, errors_199
 };
 
-static const char          *signature_200[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_200[]    = { "ArgumentIsInvalid", nullptr };
+static const char          *signature_200[] = { "Object", "SmallInteger", "SmallInteger", "Object" };
+static const char          *errors_200[]    = { "NotYetImplemented", "ValueOutOfRange", "IllegalState", "Failed", nullptr };
 static PrimitiveDescriptor primitive_200    = {
-    "primitiveIndexedByteLargeIntegerAdd:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerAdd ), 1312258, signature_200, errors_200
+    "primitiveIOPollerArm:events:waiter:ifFail:", primitiveFunctionType( &SystemPrimitives::ioPollerArm ), 327683, signature_200, errors_200
 };
 
-static const char          *signature_201[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_201[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *signature_201[] = { "SmallInteger" };
+static const char          *errors_201[]    = { nullptr };
 static PrimitiveDescriptor primitive_201    = {
-    "primitiveIndexedByteLargeIntegerAnd:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerAnd ), 1312258, signature_201, errors_201
+    "primitiveIOPollerArmed", primitiveFunctionType( &SystemPrimitives::ioPollerArmed ), 65536, signature_201, errors_201
 };
 
-static const char          *signature_202[] = { "Float", "IndexedByteInstanceVariables" };
+static const char          *signature_202[] = { "SmallInteger" };
 static const char          *errors_202[]    = { nullptr };
 static PrimitiveDescriptor primitive_202    = {
-    "primitiveIndexedByteLargeIntegerAsFloatIfFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerToFloat ), 1312257, signature_202, errors_202
+    "primitiveIOPollerPoll", primitiveFunctionType( &SystemPrimitives::ioPollerPoll ), 65536, signature_202, errors_202
 };
 
-static const char          *signature_203[] = { "SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_203[]    = { nullptr };
+static const char          *signature_203[] = { "SmallInteger", "SmallInteger" };
+static const char          *errors_203[]    = { "IsAbsent", nullptr };
 static PrimitiveDescriptor primitive_203    = {
-    "primitiveIndexedByteLargeIntegerCompare:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerCompare ), 1312258, signature_203, errors_203
+    "primitiveIOPollerReadyEvents:ifFail:", primitiveFunctionType( &SystemPrimitives::ioPollerReadyEvents ), 327681, signature_203, errors_203
 };
 
-static const char          *signature_204[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_204[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *signature_204[] = { "Object", "SmallInteger" };
+static const char          *errors_204[]    = { "IsAbsent", nullptr };
 static PrimitiveDescriptor primitive_204    = {
-    "primitiveIndexedByteLargeIntegerDiv:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerDiv ), 1312258, signature_204, errors_204
+    "primitiveIOPollerRemove:ifFail:", primitiveFunctionType( &SystemPrimitives::ioPollerRemove ), 327681, signature_204, errors_204
 };
 
-static const char          *signature_205[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "Float" };
-static const char          *errors_205[]    = { nullptr };
+static const char          *signature_205[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_205[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_205    = {
-    "primitiveIndexedByteLargeIntegerFromFloat:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerFromDouble ), 1310722, signature_205, errors_205
+    "primitiveIndexedByteAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::at ), 1312258, signature_205, errors_205
 };
 
-static const char          *signature_206[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "SmallInteger" };
-static const char          *errors_206[]    = { nullptr };
+static const char          *signature_206[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *errors_206[]    = { "OutOfBounds", "ValueOutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_206    = {
-    "primitiveIndexedByteLargeIntegerFromSmallInteger:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerFromSmallInteger ), 1310722, signature_206, errors_206
+    "primitiveIndexedByteAt:put:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::atPut ), 1312259, signature_206, errors_206
 };
 
-static const char          *signature_207[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "String", "Integer" };
-static const char          *errors_207[]    = { "ConversionFailed", nullptr };
+static const char          *signature_207[] = { "Self", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_207[]    = { nullptr };
 static PrimitiveDescriptor primitive_207    = {
-    "primitiveIndexedByteLargeIntegerFromString:base:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerFromString ), 1312259, signature_207, errors_207
+    "primitiveIndexedByteAtAllPut:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::at_all_put ), 1376258, signature_207, errors_207
 };
 
-static const char          *signature_208[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_208[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *signature_208[] = { "SmallInteger", "IndexedByteInstanceVariables", "String" };
+static const char          *errors_208[]    = { nullptr };
 static PrimitiveDescriptor primitive_208    = {
-    "primitiveIndexedByteLargeIntegerMod:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerMod ), 1312258, signature_208, errors_208
+    "primitiveIndexedByteCaseInsensitiveCompare:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::compareIgnoringCase ), 5506562, signature_208, errors_208
 };
 
-static const char          *signature_209[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_209[]    = { "ArgumentIsInvalid", nullptr };
+static const char          *signature_209[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_209[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_209    = {
-    "primitiveIndexedByteLargeIntegerMultiply:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerMultiply ), 1312258, signature_209, errors_209
+    "primitiveIndexedByteCharacterAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::characterAt ), 1312258, signature_209, errors_209
 };
 
-static const char          *signature_210[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_210[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *signature_210[] = { "SmallInteger", "IndexedByteInstanceVariables", "String" };
+static const char          *errors_210[]    = { nullptr };
 static PrimitiveDescriptor primitive_210    = {
-    "primitiveIndexedByteLargeIntegerOr:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerOr ), 1312258, signature_210, errors_210
+    "primitiveIndexedByteCompare:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::compare ), 1376258, signature_210, errors_210
 };
 
-static const char          *signature_211[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_211[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *signature_211[] = { "Boolean", "IndexedByteInstanceVariables", "String" };
+static const char          *errors_211[]    = { nullptr };
 static PrimitiveDescriptor primitive_211    = {
-    "primitiveIndexedByteLargeIntegerQuo:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerQuo ), 1312258, signature_211, errors_211
+    "primitiveIndexedByteEqual:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::equal ), 5506562, signature_211, errors_211
 };
 
-static const char          *signature_212[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_212[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *signature_212[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *errors_212[]    = { nullptr };
 static PrimitiveDescriptor primitive_212    = {
-    "primitiveIndexedByteLargeIntegerRem:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerRem ), 1312258, signature_212, errors_212
+    "primitiveIndexedByteHash", primitiveFunctionType( &ByteArrayPrimitives::hash ), 1574401, signature_212, errors_212
 };
 
-static const char          *signature_213[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "SmallInt" };
-static const char          *errors_213[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *signature_213[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *errors_213[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_213    = {
-    "primitiveIndexedByteLargeIntegerShift:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerShift ), 1312258, signature_213, errors_213
+    "primitiveIndexedByteIndexOf:startingAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::indexOf ), 5506563, signature_213, errors_213
 };
 
-static const char          *signature_214[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_214[]    = { "ArgumentIsInvalid", nullptr };
+static const char          *signature_214[] = { "SmallInteger", "IndexedByteInstanceVariables", "String", "SmallInteger" };
+static const char          *errors_214[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_214    = {
-    "primitiveIndexedByteLargeIntegerSubtract:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerSubtract ), 1312258, signature_214, errors_214
+    "primitiveIndexedByteIndexOfSubstring:startingAt:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::indexOfSubstring ), 5506563, signature_214, errors_214
 };
 
-static const char          *signature_215[] = { "String", "IndexedByteInstanceVariables", "SmallInteger" };
-static const char          *errors_215[]    = { nullptr };
+static const char          *signature_215[] = { "CompressedSymbol", "IndexedByteInstanceVariables" };
+static const char          *errors_215[]    = { "ValueOutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_215    = {
-    "primitiveIndexedByteLargeIntegerToStringBase:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerToString ), 1312258, signature_215, errors_215
+    "primitiveIndexedByteInternIfFail:", primitiveFunctionType( &ByteArrayPrimitives::intern ), 1376257, signature_215, errors_215
 };
 
 static const char          *signature_216[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
-static const char          *errors_216[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
+static const char          *errors_216[]    = { "ArgumentIsInvalid", nullptr };
 static PrimitiveDescriptor primitive_216    = {
-    "primitiveIndexedByteLargeIntegerXor:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerXor ), 1312258, signature_216, errors_216
+    "primitiveIndexedByteLargeIntegerAdd:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerAdd ), 1312258, signature_216, errors_216
 };
 
-static const char          *signature_217[] = { "Object", "IndexedByteInstanceVariables class", "SmallInteger" };
-static const char          *errors_217[]    = { "NegativeSize", nullptr };
+static const char          *signature_217[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_217[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_217    = {
-    "primitiveIndexedByteNew:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::allocateSize ), 1376258, signature_217, errors_217
+    "primitiveIndexedByteLargeIntegerAnd:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerAnd ), 1312258, signature_217, errors_217
 };
 
-static const char          *signature_218[] = { "Object", "IndexedByteInstanceVariables class", "SmallInteger", "Boolean" };
-static const char          *errors_218[]    = { "NegativeSize", nullptr };
+static const char          *signature_218[] = { "Float", "IndexedByteInstanceVariables" };
+static const char          *errors_218[]    = { nullptr };
 static PrimitiveDescriptor primitive_218    = {
-    "primitiveIndexedByteNew:size:tenured:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::allocateSize2 ), 327683, signature_218, errors_218
+    "primitiveIndexedByteLargeIntegerAsFloatIfFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerToFloat ), 1312257, signature_218, errors_218
 };
 
-static const char          *signature_219[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *signature_219[] = { "SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
 static const char          *errors_219[]    = { nullptr };
 static PrimitiveDescriptor primitive_219    = {
-    "primitiveIndexedByteSize", primitiveFunctionType( &ByteArrayPrimitives::size ), 1574401, signature_219, errors_219
+    "primitiveIndexedByteLargeIntegerCompare:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerCompare ), 1312258, signature_219, errors_219
 };
 
-static const char          *signature_220[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger" };
-static const char          *errors_220[]    = { "OutOfBounds", nullptr };
+static const char          *signature_220[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_220[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_220    = {
-    "primitiveIndexedDoubleByteAt:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::at ), 1312514, signature_220, errors_220
+    "primitiveIndexedByteLargeIntegerDiv:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerDiv ), 1312258, signature_220, errors_220
 };
 
-static const char          *signature_221[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger", "SmallInteger" };
-static const char          *errors_221[]    = { "OutOfBounds", "ValueOutOfBounds", nullptr };
+static const char          *signature_221[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "Float" };
+static const char          *errors_221[]    = { nullptr };
 static PrimitiveDescriptor primitive_221    = {
-    "primitiveIndexedDoubleByteAt:put:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::atPut ), 1312515, signature_221, errors_221
+    "primitiveIndexedByteLargeIntegerFromFloat:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerFromDouble ), 1310722, signature_221, errors_221
 };
 
-static const char          *signature_222[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger" };
-static const char          *errors_222[]    = { "OutOfBounds", nullptr };
+static const char          *signature_222[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "SmallInteger" };
+static const char          *errors_222[]    = { nullptr };
 static PrimitiveDescriptor primitive_222    = {
-    "primitiveIndexedDoubleByteCharacterAt:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::characterAt ), 1312514, signature_222, errors_222
+    "primitiveIndexedByteLargeIntegerFromSmallInteger:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerFromSmallInteger ), 1310722, signature_222, errors_222
 };
 
-static const char          *signature_223[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "String" };
-static const char          *errors_223[]    = { nullptr };
+static const char          *signature_223[] = { "IndexedByteInstanceVariables", "IndexedByteInstanceVariables class", "String", "Integer" };
+static const char          *errors_223[]    = { "ConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_223    = {
-    "primitiveIndexedDoubleByteCompare:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::compare ), 1310722, signature_223, errors_223
+    "primitiveIndexedByteLargeIntegerFromString:base:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerFromString ), 1312259, signature_223, errors_223
 };
 
-static const char          *signature_224[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables" };
-static const char          *errors_224[]    = { nullptr };
+static const char          *signature_224[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_224[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_224    = {
-    "primitiveIndexedDoubleByteHash", primitiveFunctionType( &DoubleByteArrayPrimitives::hash ), 1114113, signature_224, errors_224
+    "primitiveIndexedByteLargeIntegerMod:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerMod ), 1312258, signature_224, errors_224
 };
 
-static const char          *signature_225[] = { "CompressedSymbol", "IndexedDoubleByteInstanceVariables" };
-static const char          *errors_225[]    = { "ValueOutOfBounds", nullptr };
+static const char          *signature_225[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_225[]    = { "ArgumentIsInvalid", nullptr };
 static PrimitiveDescriptor primitive_225    = {
-    "primitiveIndexedDoubleByteInternIfFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::intern ), 1376257, signature_225, errors_225
+    "primitiveIndexedByteLargeIntegerMultiply:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerMultiply ), 1312258, signature_225, errors_225
 };
 
-static const char          *signature_226[] = { "Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger" };
-static const char          *errors_226[]    = { "NegativeSize", nullptr };
+static const char          *signature_226[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_226[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_226    = {
-    "primitiveIndexedDoubleByteNew:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::allocateSize ), 1376258, signature_226, errors_226
+    "primitiveIndexedByteLargeIntegerOr:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerOr ), 1312258, signature_226, errors_226
 };
 
-static const char          *signature_227[] = { "Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger", "Boolean" };
-static const char          *errors_227[]    = { "NegativeSize", nullptr };
+static const char          *signature_227[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_227[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_227    = {
-    "primitiveIndexedDoubleByteNew:size:tenured:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::allocateSize2 ), 327683, signature_227, errors_227
+    "primitiveIndexedByteLargeIntegerQuo:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerQuo ), 1312258, signature_227, errors_227
 };
 
-static const char          *signature_228[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables" };
-static const char          *errors_228[]    = { nullptr };
+static const char          *signature_228[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_228[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_228    = {
-    "primitiveIndexedDoubleByteSize", primitiveFunctionType( &DoubleByteArrayPrimitives::size ), 1574657, signature_228, errors_228
+    "primitiveIndexedByteLargeIntegerRem:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerRem ), 1312258, signature_228, errors_228
 };
 
-static const char          *signature_229[] = { "Float", "IndexedFloatValueInstanceVariables", "SmallInteger" };
-static const char          *errors_229[]    = { "OutOfBounds", nullptr };
+static const char          *signature_229[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "SmallInt" };
+static const char          *errors_229[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_229    = {
-    "primitiveIndexedFloatValueAt:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::at ), 1310722, signature_229, errors_229
+    "primitiveIndexedByteLargeIntegerShift:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerShift ), 1312258, signature_229, errors_229
 };
 
-static const char          *signature_230[] = { "Float", "IndexedFloatValueInstanceVariables", "SmallInteger", "Float" };
-static const char          *errors_230[]    = { "OutOfBounds", "ValueOutOfBounds", nullptr };
+static const char          *signature_230[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_230[]    = { "ArgumentIsInvalid", nullptr };
 static PrimitiveDescriptor primitive_230    = {
-    "primitiveIndexedFloatValueAt:put:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::atPut ), 1310723, signature_230, errors_230
+    "primitiveIndexedByteLargeIntegerSubtract:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerSubtract ), 1312258, signature_230, errors_230
 };
 
-static const char          *signature_231[] = { "Object", "IndexedFloatValueInstanceVariables class", "SmallInteger" };
-static const char          *errors_231[]    = { "NegativeSize", nullptr };
+static const char          *signature_231[] = { "String", "IndexedByteInstanceVariables", "SmallInteger" };
+static const char          *errors_231[]    = { nullptr };
 static PrimitiveDescriptor primitive_231    = {
-    "primitiveIndexedFloatValueNew:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::allocateSize ), 1376258, signature_231, errors_231
+    "primitiveIndexedByteLargeIntegerToStringBase:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerToString ), 1312258, signature_231, errors_231
 };
 
-static const char          *signature_232[] = { "SmallInteger", "IndexedFloatValueInstanceVariables" };
-static const char          *errors_232[]    = { nullptr };
+static const char          *signature_232[] = { "IndexedByteInstanceVariables|SmallInteger", "IndexedByteInstanceVariables", "IndexedByteInstanceVariables" };
+static const char          *errors_232[]    = { "ArgumentIsInvalid", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_232    = {
-    "primitiveIndexedFloatValueSize", primitiveFunctionType( &DoubleValueArrayPrimitives::size ), 1572865, signature_232, errors_232
+    "primitiveIndexedByteLargeIntegerXor:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerXor ), 1312258, signature_232, errors_232
 };
 
-static const char          *signature_233[] = { "SmallInteger", "IndexedInstanceVariables", "SmallInteger" };
-static const char          *errors_233[]    = { "OutOfBounds", nullptr };
+static const char          *signature_233[] = { "Object", "IndexedByteInstanceVariables class", "SmallInteger" };
+static const char          *errors_233[]    = { "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_233    = {
-    "primitiveIndexedObjectAt:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::at ), 1312002, signature_233, errors_233
+    "primitiveIndexedByteNew:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::allocateSize ), 1376258, signature_233, errors_233
 };
 
-static const char          *signature_234[] = { "Object", "IndexedInstanceVariables", "SmallInteger", "Object" };
-static const char          *errors_234[]    = { "OutOfBounds", nullptr };
+static const char          *signature_234[] = { "Object", "IndexedByteInstanceVariables class", "SmallInteger", "Boolean" };
+static const char          *errors_234[]    = { "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_234    = {
-    "primitiveIndexedObjectAt:put:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::atPut ), 1312003, signature_234, errors_234
+    "primitiveIndexedByteNew:size:tenured:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::allocateSize2 ), 327683, signature_234, errors_234
 };
 
-static const char          *signature_235[] = { "Self", "IndexedInstanceVariables", "Object" };
+static const char          *signature_235[] = { "SmallInteger", "IndexedByteInstanceVariables", "SmallInteger" };
 static const char          *errors_235[]    = { nullptr };
 static PrimitiveDescriptor primitive_235    = {
-    "primitiveIndexedObjectAtAllPut:", primitiveFunctionType( &ObjectArrayPrimitives::at_all_put ), 1049858, signature_235, errors_235
+    "primitiveIndexedByteOccurrencesOf:ifFail:", primitiveFunctionType( &ByteArrayPrimitives::occurrencesOf ), 5506562, signature_235, errors_235
 };
 
-static const char          *signature_236[] = { "Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "SmallInteger" };
-static const char          *errors_236[]    = { "OutOfBounds", "NegativeSize", nullptr };
+static const char          *signature_236[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *errors_236[]    = { nullptr };
 static PrimitiveDescriptor primitive_236    = {
-    "primitiveIndexedObjectCopyFrom:startingAt:size:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::copy_size ), 1377540, signature_236, errors_236
+    "primitiveIndexedByteSize", primitiveFunctionType( &ByteArrayPrimitives::size ), 1574401, signature_236, errors_236
 };
 
-static const char          *signature_237[] = { "Object", "IndexedInstanceVariables class", "SmallInteger" };
-static const char          *errors_237[]    = { "NegativeSize", nullptr };
+static const char          *signature_237[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger" };
+static const char          *errors_237[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_237    = {
-    "primitiveIndexedObjectNew:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::allocateSize ), 1376258, signature_237, errors_237
+    "primitiveIndexedDoubleByteAt:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::at ), 1312514, signature_237, errors_237
 };
 
-static const char          *signature_238[] = { "Object", "IndexedInstanceVariables class", "SmallInteger", "Boolean" };
-static const char          *errors_238[]    = { "NegativeSize", nullptr };
+static const char          *signature_238[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *errors_238[]    = { "OutOfBounds", "ValueOutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_238    = {
-    "primitiveIndexedObjectNew:size:tenured:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::allocateSize2 ), 327683, signature_238, errors_238
+    "primitiveIndexedDoubleByteAt:put:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::atPut ), 1312515, signature_238, errors_238
 };
 
-static const char          *signature_239[] = { "Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "IndexedInstanceVariables", "SmallInteger" };
-static const char          *errors_239[]    = { "OutOfBounds", nullptr };
+static const char          *signature_239[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "String" };
+static const char          *errors_239[]    = { nullptr };
 static PrimitiveDescriptor primitive_239    = {
-    "primitiveIndexedObjectReplaceFrom:to:with:startingAt:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::replace_from_to ), 1377541, signature_239, errors_239
+    "primitiveIndexedDoubleByteCaseInsensitiveCompare:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::compareIgnoringCase ), 5506818, signature_239, errors_239
 };
 
-static const char          *signature_240[] = { "Self", "IndexedInstanceVariables" };
-static const char          *errors_240[]    = { nullptr };
+static const char          *signature_240[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger" };
+static const char          *errors_240[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_240    = {
-    "primitiveIndexedObjectSize", primitiveFunctionType( &ObjectArrayPrimitives::size ), 1574145, signature_240, errors_240
+    "primitiveIndexedDoubleByteCharacterAt:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::characterAt ), 1312514, signature_240, errors_240
 };
 
-static const char          *signature_241[] = { "Instance", "Behavior", "SmallInt" };
+static const char          *signature_241[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "String" };
 static const char          *errors_241[]    = { nullptr };
 static PrimitiveDescriptor primitive_241    = {
-    "primitiveInlineAllocations:count:", primitiveFunctionType( &primitiveInlineAllocations ), 4259842, signature_241, errors_241
+    "primitiveIndexedDoubleByteCompare:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::compare ), 1310722, signature_241, errors_241
 };
 
-static const char          *signature_242[] = { "Boolean", "Behavior", "Symbol" };
+static const char          *signature_242[] = { "Boolean", "IndexedDoubleByteInstanceVariables", "String" };
 static const char          *errors_242[]    = { nullptr };
 static PrimitiveDescriptor primitive_242    = {
-    "primitiveInliningDatabaseAddLookupEntryClass:selector:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_add_entry ), 327682, signature_242, errors_242
+    "primitiveIndexedDoubleByteEqual:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::equal ), 5506818, signature_242, errors_242
 };
 
-static const char          *signature_243[] = { "Boolean" };
+static const char          *signature_243[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables" };
 static const char          *errors_243[]    = { nullptr };
 static PrimitiveDescriptor primitive_243    = {
-    "primitiveInliningDatabaseCompile", primitiveFunctionType( &SystemPrimitives::inlining_database_compile_next ), 65536, signature_243, errors_243
+    "primitiveIndexedDoubleByteHash", primitiveFunctionType( &DoubleByteArrayPrimitives::hash ), 1114113, signature_243, errors_243
 };
 
-static const char          *signature_244[] = { "Object", "String" };
-static const char          *errors_244[]    = { nullptr };
+static const char          *signature_244[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger", "SmallInteger" };
+static const char          *errors_244[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_244    = {
-    "primitiveInliningDatabaseCompile:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_compile ), 327681, signature_244, errors_244
+    "primitiveIndexedDoubleByteIndexOf:startingAt:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::indexOf ), 5506819, signature_244, errors_244
 };
 
-static const char          *signature_245[] = { "IndexedByteInstanceVariables", "String" };
-static const char          *errors_245[]    = { nullptr };
+static const char          *signature_245[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "String", "SmallInteger" };
+static const char          *errors_245[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_245    = {
-    "primitiveInliningDatabaseCompileDemangled:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_demangle ), 327681, signature_245, errors_245
+    "primitiveIndexedDoubleByteIndexOfSubstring:startingAt:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::indexOfSubstring ), 5506819, signature_245, errors_245
 };
 
-static const char          *signature_246[] = { "Symbol" };
-static const char          *errors_246[]    = { nullptr };
+static const char          *signature_246[] = { "CompressedSymbol", "IndexedDoubleByteInstanceVariables" };
+static const char          *errors_246[]    = { "ValueOutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_246    = {
-    "primitiveInliningDatabaseDirectory", primitiveFunctionType( &SystemPrimitives::inlining_database_directory ), 65536, signature_246, errors_246
+    "primitiveIndexedDoubleByteInternIfFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::intern ), 1376257, signature_246, errors_246
 };
 
-static const char          *signature_247[] = { "SmallInteger" };
-static const char          *errors_247[]    = { nullptr };
+static const char          *signature_247[] = { "Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger" };
+static const char          *errors_247[]    = { "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_247    = {
-    "primitiveInliningDatabaseFileOutAllIfFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_file_out_all ), 327680, signature_247, errors_247
+    "primitiveIndexedDoubleByteNew:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::allocateSize ), 1376258, signature_247, errors_247
 };
 
-static const char          *signature_248[] = { "SmallInteger", "Behavior" };
-static const char          *errors_248[]    = { nullptr };
+static const char          *signature_248[] = { "Object", "IndexedDoubleByteInstanceVariables class", "SmallInteger", "Boolean" };
+static const char          *errors_248[]    = { "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_248    = {
-    "primitiveInliningDatabaseFileOutClass:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_file_out_class ), 327681, signature_248, errors_248
+    "primitiveIndexedDoubleByteNew:size:tenured:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::allocateSize2 ), 327683, signature_248, errors_248
 };
 
-static const char          *signature_249[] = { "IndexedByteInstanceVariables", "String" };
+static const char          *signature_249[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables", "SmallInteger" };
 static const char          *errors_249[]    = { nullptr };
 static PrimitiveDescriptor primitive_249    = {
-    "primitiveInliningDatabaseMangle:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_mangle ), 327681, signature_249, errors_249
+    "primitiveIndexedDoubleByteOccurrencesOf:ifFail:", primitiveFunctionType( &DoubleByteArrayPrimitives::occurrencesOf ), 5506818, signature_249, errors_249
 };
 
-static const char          *signature_250[] = { "Symbol", "Symbol" };
+static const char          *signature_250[] = { "SmallInteger", "IndexedDoubleByteInstanceVariables" };
 static const char          *errors_250[]    = { nullptr };
 static PrimitiveDescriptor primitive_250    = {
-    "primitiveInliningDatabaseSetDirectory:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_set_directory ), 327681, signature_250, errors_250
+    "primitiveIndexedDoubleByteSize", primitiveFunctionType( &DoubleByteArrayPrimitives::size ), 1574657, signature_250, errors_250
 };
 
-static const char          *signature_251[] = { "Object", "Object", "SmallInteger" };
+static const char          *signature_251[] = { "Self", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables" };
 static const char          *errors_251[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_251    = {
-    "primitiveInstVarAt:ifFail:", primitiveFunctionType( &OopPrimitives::instVarAt ), 1376258, signature_251, errors_251
+    "primitiveIndexedFloatValueAdd:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::add ), 5505026, signature_251, errors_251
 };
 
-static const char          *signature_252[] = { "Symbol", "Reciever", "Object", "SmallInteger" };
+static const char          *signature_252[] = { "Self", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables", "Float" };
 static const char          *errors_252[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_252    = {
-    "primitiveInstVarNameFor:at:ifFail:", primitiveFunctionType( &OopPrimitives::instance_variable_name_at ), 1376259, signature_252, errors_252
+    "primitiveIndexedFloatValueAdd:times:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::axpy ), 5505027, signature_252, errors_252
 };
 
-static const char          *signature_253[] = { "Object", "Object", "SmallInteger", "Object" };
+static const char          *signature_253[] = { "Float", "IndexedFloatValueInstanceVariables", "SmallInteger" };
 static const char          *errors_253[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_253    = {
-    "primitiveInstVarOf:at:put:ifFail:", primitiveFunctionType( &OopPrimitives::instVarAtPut ), 327683, signature_253, errors_253
+    "primitiveIndexedFloatValueAt:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::at ), 1310722, signature_253, errors_253
 };
 
-static const char          *signature_254[] = { "IndexedInstanceVariables", "Class", "SmallInteger" };
-static const char          *errors_254[]    = { nullptr };
+static const char          *signature_254[] = { "Float", "IndexedFloatValueInstanceVariables", "SmallInteger", "Float" };
+static const char          *errors_254[]    = { "OutOfBounds", "ValueOutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_254    = {
-    "primitiveInstancesOf:limit:ifFail:", primitiveFunctionType( &SystemPrimitives::instances_of ), 327682, signature_254, errors_254
+    "primitiveIndexedFloatValueAt:put:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::atPut ), 1310723, signature_254, errors_254
 };
 
-static const char          *signature_255[] = { "SmallInteger" };
+static const char          *signature_255[] = { "Self", "IndexedFloatValueInstanceVariables", "Float" };
 static const char          *errors_255[]    = { nullptr };
 static PrimitiveDescriptor primitive_255    = {
-    "primitiveInterpreterInvocationCounterLimit", primitiveFunctionType( &DebugPrimitives::interpreterInvocationCounterLimit ), 65536, signature_255, errors_255
+    "primitiveIndexedFloatValueAtAllPut:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::at_all_put ), 5505026, signature_255, errors_255
 };
 
-static const char          *signature_256[] = { "SmallInteger", "IndexedByteInstanceVariables" };
-static const char          *errors_256[]    = { nullptr };
+static const char          *signature_256[] = { "Self", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables" };
+static const char          *errors_256[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_256    = {
-    "primitiveLargeIntegerHash", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerHash ), 1574401, signature_256, errors_256
+    "primitiveIndexedFloatValueDivide:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::divide ), 5505026, signature_256, errors_256
 };
 
-static const char          *signature_257[] = { "Boolean", "SmallInteger", "SmallInteger" };
-static const char          *errors_257[]    = { nullptr };
+static const char          *signature_257[] = { "Float", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables" };
+static const char          *errors_257[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_257    = {
-    "primitiveLessThan:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::lessThan ), 6029570, signature_257, errors_257
+    "primitiveIndexedFloatValueDot:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::dot ), 1310722, signature_257, errors_257
 };
 
-static const char          *signature_258[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *signature_258[] = { "Boolean", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables" };
 static const char          *errors_258[]    = { nullptr };
 static PrimitiveDescriptor primitive_258    = {
-    "primitiveLessThanOrEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::lessThanOrEqual ), 6029570, signature_258, errors_258
+    "primitiveIndexedFloatValueEqual:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::equal ), 5505026, signature_258, errors_258
 };
 
-static const char          *signature_259[] = { "SmallInteger", "Float", "Float", "SmallInteger" };
+static const char          *signature_259[] = { "SmallInteger", "IndexedFloatValueInstanceVariables" };
 static const char          *errors_259[]    = { nullptr };
 static PrimitiveDescriptor primitive_259    = {
-    "primitiveMandelbrotAtRe:im:iterate:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::mandelbrot ), 4980739, signature_259, errors_259
+    "primitiveIndexedFloatValueMaxIndex", primitiveFunctionType( &DoubleValueArrayPrimitives::max_index ), 5242881, signature_259, errors_259
 };
 
-static const char          *signature_260[] = { "Block", "Method", "Object" };
+static const char          *signature_260[] = { "SmallInteger", "IndexedFloatValueInstanceVariables" };
 static const char          *errors_260[]    = { nullptr };
 static PrimitiveDescriptor primitive_260    = {
-    "primitiveMethodAllocateBlock:ifFail:", primitiveFunctionType( &MethodOopPrimitives::allocate_block_self ), 1376258, signature_260, errors_260
+    "primitiveIndexedFloatValueMinIndex", primitiveFunctionType( &DoubleValueArrayPrimitives::min_index ), 5242881, signature_260, errors_260
 };
 
-static const char          *signature_261[] = { "Block", "Method" };
-static const char          *errors_261[]    = { nullptr };
+static const char          *signature_261[] = { "Self", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables" };
+static const char          *errors_261[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_261    = {
-    "primitiveMethodAllocateBlockIfFail:", primitiveFunctionType( &MethodOopPrimitives::allocate_block ), 1376257, signature_261, errors_261
+    "primitiveIndexedFloatValueMultiply:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::multiply ), 5505026, signature_261, errors_261
 };
 
-static const char          *signature_262[] = { "Object", "Method" };
-static const char          *errors_262[]    = { nullptr };
+static const char          *signature_262[] = { "Object", "IndexedFloatValueInstanceVariables class", "SmallInteger" };
+static const char          *errors_262[]    = { "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_262    = {
-    "primitiveMethodBody", primitiveFunctionType( &MethodOopPrimitives::fileout_body ), 1114113, signature_262, errors_262
+    "primitiveIndexedFloatValueNew:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::allocateSize ), 1376258, signature_262, errors_262
 };
 
-static const char          *signature_263[] = { "Object", "Method" };
-static const char          *errors_263[]    = { nullptr };
+static const char          *signature_263[] = { "Self", "IndexedFloatValueInstanceVariables", "SmallInteger", "SmallInteger", "IndexedFloatValueInstanceVariables", "SmallInteger" };
+static const char          *errors_263[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_263    = {
-    "primitiveMethodDebugInfo", primitiveFunctionType( &MethodOopPrimitives::debug_info ), 1114113, signature_263, errors_263
+    "primitiveIndexedFloatValueReplaceFrom:to:with:startingAt:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::replace_from_to ), 5505029, signature_263, errors_263
 };
 
-static const char          *signature_264[] = { "Method", "Behavior", "CompressedSymbol" };
-static const char          *errors_264[]    = { "NotFound", nullptr };
+static const char          *signature_264[] = { "Self", "IndexedFloatValueInstanceVariables", "Float" };
+static const char          *errors_264[]    = { nullptr };
 static PrimitiveDescriptor primitive_264    = {
-    "primitiveMethodFor:ifFail:", primitiveFunctionType( &BehaviorPrimitives::methodFor ), 1376258, signature_264, errors_264
+    "primitiveIndexedFloatValueScaleBy:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::scale ), 5505026, signature_264, errors_264
 };
 
-static const char          *signature_265[] = { "Symbol", "Method" };
+static const char          *signature_265[] = { "SmallInteger", "IndexedFloatValueInstanceVariables" };
 static const char          *errors_265[]    = { nullptr };
 static PrimitiveDescriptor primitive_265    = {
-    "primitiveMethodInliningInfo", primitiveFunctionType( &MethodOopPrimitives::inlining_info ), 1114113, signature_265, errors_265
+    "primitiveIndexedFloatValueSize", primitiveFunctionType( &DoubleValueArrayPrimitives::size ), 1572865, signature_265, errors_265
 };
 
-static const char          *signature_266[] = { "SmallInteger", "Method" };
-static const char          *errors_266[]    = { nullptr };
+static const char          *signature_266[] = { "Self", "IndexedFloatValueInstanceVariables", "IndexedFloatValueInstanceVariables" };
+static const char          *errors_266[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_266    = {
-    "primitiveMethodNumberOfArguments", primitiveFunctionType( &MethodOopPrimitives::numberOfArguments ), 1114113, signature_266, errors_266
+    "primitiveIndexedFloatValueSubtract:ifFail:", primitiveFunctionType( &DoubleValueArrayPrimitives::subtract ), 5505026, signature_266, errors_266
 };
 
-static const char          *signature_267[] = { "Symbol", "Method", "Method" };
+static const char          *signature_267[] = { "Float", "IndexedFloatValueInstanceVariables" };
 static const char          *errors_267[]    = { nullptr };
 static PrimitiveDescriptor primitive_267    = {
-    "primitiveMethodOuter:ifFail:", primitiveFunctionType( &MethodOopPrimitives::setOuter ), 1376258, signature_267, errors_267
+    "primitiveIndexedFloatValueSum", primitiveFunctionType( &DoubleValueArrayPrimitives::sum ), 1048577, signature_267, errors_267
 };
 
-static const char          *signature_268[] = { "Method", "Method" };
-static const char          *errors_268[]    = { "ReceiverNotBlockMethod", nullptr };
+static const char          *signature_268[] = { "SmallInteger", "IndexedInstanceVariables", "SmallInteger" };
+static const char          *errors_268[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_268    = {
-    "primitiveMethodOuterIfFail:", primitiveFunctionType( &MethodOopPrimitives::outer ), 1376257, signature_268, errors_268
+    "primitiveIndexedObjectAt:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::at ), 1312002, signature_268, errors_268
 };
 
-static const char          *signature_269[] = { "Method", "Method", "Object" };
-static const char          *errors_269[]    = { nullptr };
+static const char          *signature_269[] = { "Object", "IndexedInstanceVariables", "SmallInteger", "Object" };
+static const char          *errors_269[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_269    = {
-    "primitiveMethodPrettyPrintKlass:ifFail:", primitiveFunctionType( &MethodOopPrimitives::prettyPrint ), 1376258, signature_269, errors_269
+    "primitiveIndexedObjectAt:put:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::atPut ), 1312003, signature_269, errors_269
 };
 
-static const char          *signature_270[] = { "ByteIndexedInstanceVariables", "Method", "Object" };
+static const char          *signature_270[] = { "Self", "IndexedInstanceVariables", "Object" };
 static const char          *errors_270[]    = { nullptr };
 static PrimitiveDescriptor primitive_270    = {
-    "primitiveMethodPrettyPrintSourceKlass:ifFail:", primitiveFunctionType( &MethodOopPrimitives::prettyPrintSource ), 1376258, signature_270, errors_270
+    "primitiveIndexedObjectAtAllPut:", primitiveFunctionType( &ObjectArrayPrimitives::at_all_put ), 1049858, signature_270, errors_270
 };
 
-static const char          *signature_271[] = { "Symbol", "Method" };
-static const char          *errors_271[]    = { nullptr };
+static const char          *signature_271[] = { "Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_271[]    = { "OutOfBounds", "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_271    = {
-    "primitiveMethodPrintCodes", primitiveFunctionType( &MethodOopPrimitives::printCodes ), 1114113, signature_271, errors_271
+    "primitiveIndexedObjectCopyFrom:startingAt:size:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::copy_size ), 1377540, signature_271, errors_271
 };
 
-static const char          *signature_272[] = { "IndexedInstanceVariables", "Method" };
-static const char          *errors_272[]    = { nullptr };
+static const char          *signature_272[] = { "Object", "IndexedInstanceVariables class", "SmallInteger" };
+static const char          *errors_272[]    = { "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_272    = {
-    "primitiveMethodReferencedClassVarNames", primitiveFunctionType( &MethodOopPrimitives::referenced_class_variable_names ), 1114113, signature_272, errors_272
+    "primitiveIndexedObjectNew:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::allocateSize ), 1376258, signature_272, errors_272
 };
 
-static const char          *signature_273[] = { "IndexedInstanceVariables", "Method" };
-static const char          *errors_273[]    = { nullptr };
+static const char          *signature_273[] = { "Object", "IndexedInstanceVariables class", "SmallInteger", "Boolean" };
+static const char          *errors_273[]    = { "NegativeSize", nullptr };
 static PrimitiveDescriptor primitive_273    = {
-    "primitiveMethodReferencedGlobalNames", primitiveFunctionType( &MethodOopPrimitives::referenced_global_names ), 1114113, signature_273, errors_273
+    "primitiveIndexedObjectNew:size:tenured:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::allocateSize2 ), 327683, signature_273, errors_273
 };
 
-static const char          *signature_274[] = { "IndexedInstanceVariables", "Method", "Mixin" };
-static const char          *errors_274[]    = { nullptr };
+static const char          *signature_274[] = { "Self", "IndexedInstanceVariables", "SmallInteger", "SmallInteger", "IndexedInstanceVariables", "SmallInteger" };
+static const char          *errors_274[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_274    = {
-    "primitiveMethodReferencedInstVarNamesMixin:ifFail:", primitiveFunctionType( &MethodOopPrimitives::referenced_instance_variable_names ), 1376258, signature_274, errors_274
+    "primitiveIndexedObjectReplaceFrom:to:with:startingAt:ifFail:", primitiveFunctionType( &ObjectArrayPrimitives::replace_from_to ), 5506309, signature_274, errors_274
 };
 
-static const char          *signature_275[] = { "Symbol", "Method" };
+static const char          *signature_275[] = { "Self", "IndexedInstanceVariables" };
 static const char          *errors_275[]    = { nullptr };
 static PrimitiveDescriptor primitive_275    = {
-    "primitiveMethodSelector", primitiveFunctionType( &MethodOopPrimitives::selector ), 1114113, signature_275, errors_275
+    "primitiveIndexedObjectSize", primitiveFunctionType( &ObjectArrayPrimitives::size ), 1574145, signature_275, errors_275
 };
 
-static const char          *signature_276[] = { "Symbol", "Method", "Symbol" };
+static const char          *signature_276[] = { "Instance", "Behavior", "SmallInt" };
 static const char          *errors_276[]    = { nullptr };
 static PrimitiveDescriptor primitive_276    = {
-    "primitiveMethodSelector:ifFail:", primitiveFunctionType( &MethodOopPrimitives::setSelector ), 1376258, signature_276, errors_276
+    "primitiveInlineAllocations:count:", primitiveFunctionType( &primitiveInlineAllocations ), 4259842, signature_276, errors_276
 };
 
-static const char          *signature_277[] = { "IndexedInstanceVariables", "Method" };
+static const char          *signature_277[] = { "Boolean", "Behavior", "Symbol" };
 static const char          *errors_277[]    = { nullptr };
 static PrimitiveDescriptor primitive_277    = {
-    "primitiveMethodSenders", primitiveFunctionType( &MethodOopPrimitives::senders ), 1114113, signature_277, errors_277
+    "primitiveInliningDatabaseAddLookupEntryClass:selector:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_add_entry ), 327682, signature_277, errors_277
 };
 
-static const char          *signature_278[] = { "Symbol", "Method", "Symbol" };
-static const char          *errors_278[]    = { "ArgumentIsInvalid", nullptr };
+static const char          *signature_278[] = { "Boolean" };
+static const char          *errors_278[]    = { nullptr };
 static PrimitiveDescriptor primitive_278    = {
-    "primitiveMethodSetInliningInfo:ifFail:", primitiveFunctionType( &MethodOopPrimitives::set_inlining_info ), 1376258, signature_278, errors_278
+    "primitiveInliningDatabaseCompile", primitiveFunctionType( &SystemPrimitives::inlining_database_compile_next ), 65536, signature_278, errors_278
 };
 
-static const char          *signature_279[] = { "Object", "Method" };
+static const char          *signature_279[] = { "Object", "String" };
 static const char          *errors_279[]    = { nullptr };
 static PrimitiveDescriptor primitive_279    = {
-    "primitiveMethodSizeAndFlags", primitiveFunctionType( &MethodOopPrimitives::size_and_flags ), 1114113, signature_279, errors_279
+    "primitiveInliningDatabaseCompile:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_compile ), 327681, signature_279, errors_279
 };
 
-static const char          *signature_280[] = { "Mixin", "Mixin", "Symbol" };
-static const char          *errors_280[]    = { "IsInstalled", "OutOfBounds", nullptr };
+static const char          *signature_280[] = { "IndexedByteInstanceVariables", "String" };
+static const char          *errors_280[]    = { nullptr };
 static PrimitiveDescriptor primitive_280    = {
-    "primitiveMixin:addClassVariable:ifFail:", primitiveFunctionType( &MixinOopPrimitives::add_class_variable ), 327682, signature_280, errors_280
+    "primitiveInliningDatabaseCompileDemangled:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_demangle ), 327681, signature_280, errors_280
 };
 
-static const char          *signature_281[] = { "Symbol", "Mixin", "Symbol" };
-static const char          *errors_281[]    = { "IsInstalled", "OutOfBounds", nullptr };
+static const char          *signature_281[] = { "Symbol" };
+static const char          *errors_281[]    = { nullptr };
 static PrimitiveDescriptor primitive_281    = {
-    "primitiveMixin:addInstanceVariable:ifFail:", primitiveFunctionType( &MixinOopPrimitives::add_instance_variable ), 327682, signature_281, errors_281
+    "primitiveInliningDatabaseDirectory", primitiveFunctionType( &SystemPrimitives::inlining_database_directory ), 65536, signature_281, errors_281
 };
 
-static const char          *signature_282[] = { "Method", "Mixin", "Method" };
-static const char          *errors_282[]    = { "IsInstalled", nullptr };
+static const char          *signature_282[] = { "SmallInteger" };
+static const char          *errors_282[]    = { nullptr };
 static PrimitiveDescriptor primitive_282    = {
-    "primitiveMixin:addMethod:ifFail:", primitiveFunctionType( &MixinOopPrimitives::add_method ), 327682, signature_282, errors_282
+    "primitiveInliningDatabaseFileOutAllIfFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_file_out_all ), 327680, signature_282, errors_282
 };
 
-static const char          *signature_283[] = { "Symbol", "Mixin", "SmallInteger" };
-static const char          *errors_283[]    = { "OutOfBounds", nullptr };
+static const char          *signature_283[] = { "SmallInteger", "Behavior" };
+static const char          *errors_283[]    = { nullptr };
 static PrimitiveDescriptor primitive_283    = {
-    "primitiveMixin:classVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::class_variable_at ), 327682, signature_283, errors_283
+    "primitiveInliningDatabaseFileOutClass:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_file_out_class ), 327681, signature_283, errors_283
 };
 
-static const char          *signature_284[] = { "Symbol", "Mixin" };
+static const char          *signature_284[] = { "IndexedByteInstanceVariables", "String" };
 static const char          *errors_284[]    = { nullptr };
 static PrimitiveDescriptor primitive_284    = {
-    "primitiveMixin:classVariablesIfFail:", primitiveFunctionType( &MixinOopPrimitives::class_variables ), 327681, signature_284, errors_284
+    "primitiveInliningDatabaseMangle:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_mangle ), 327681, signature_284, errors_284
 };
 
-static const char          *signature_285[] = { "Symbol", "Mixin", "SmallInteger" };
-static const char          *errors_285[]    = { "OutOfBounds", nullptr };
+static const char          *signature_285[] = { "Symbol", "Symbol" };
+static const char          *errors_285[]    = { nullptr };
 static PrimitiveDescriptor primitive_285    = {
-    "primitiveMixin:instanceVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::instance_variable_at ), 327682, signature_285, errors_285
+    "primitiveInliningDatabaseSetDirectory:ifFail:", primitiveFunctionType( &SystemPrimitives::inlining_database_set_directory ), 327681, signature_285, errors_285
 };
 
-static const char          *signature_286[] = { "Symbol", "Mixin" };
-static const char          *errors_286[]    = { nullptr };
+static const char          *signature_286[] = { "Object", "Object", "SmallInteger" };
+static const char          *errors_286[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_286    = {
-    "primitiveMixin:instanceVariablesIfFail:", primitiveFunctionType( &MixinOopPrimitives::instance_variables ), 327681, signature_286, errors_286
+    "primitiveInstVarAt:ifFail:", primitiveFunctionType( &OopPrimitives::instVarAt ), 1376258, signature_286, errors_286
 };
 
-static const char          *signature_287[] = { "Method", "Mixin", "SmallInteger" };
+static const char          *signature_287[] = { "Symbol", "Reciever", "Object", "SmallInteger" };
 static const char          *errors_287[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_287    = {
-    "primitiveMixin:methodAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::method_at ), 327682, signature_287, errors_287
+    "primitiveInstVarNameFor:at:ifFail:", primitiveFunctionType( &OopPrimitives::instance_variable_name_at ), 1376259, signature_287, errors_287
 };
 
-static const char          *signature_288[] = { "Symbol", "Mixin" };
-static const char          *errors_288[]    = { nullptr };
+static const char          *signature_288[] = { "Object", "Object", "SmallInteger", "Object" };
+static const char          *errors_288[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_288    = {
-    "primitiveMixin:methodsIfFail:", primitiveFunctionType( &MixinOopPrimitives::methods ), 327681, signature_288, errors_288
+    "primitiveInstVarOf:at:put:ifFail:", primitiveFunctionType( &OopPrimitives::instVarAtPut ), 327683, signature_288, errors_288
 };
 
-static const char          *signature_289[] = { "Symbol", "Mixin", "SmallInteger" };
-static const char          *errors_289[]    = { "IsInstalled", "OutOfBounds", nullptr };
+static const char          *signature_289[] = { "IndexedInstanceVariables", "Class", "SmallInteger" };
+static const char          *errors_289[]    = { nullptr };
 static PrimitiveDescriptor primitive_289    = {
-    "primitiveMixin:removeClassVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::remove_class_variable_at ), 327682, signature_289, errors_289
+    "primitiveInstancesOf:limit:ifFail:", primitiveFunctionType( &SystemPrimitives::instances_of ), 327682, signature_289, errors_289
 };
 
-static const char          *signature_290[] = { "Symbol", "Mixin", "SmallInteger" };
-static const char          *errors_290[]    = { "IsInstalled", "OutOfBounds", nullptr };
+static const char          *signature_290[] = { "SmallInteger" };
+static const char          *errors_290[]    = { nullptr };
 static PrimitiveDescriptor primitive_290    = {
-    "primitiveMixin:removeInstanceVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::remove_instance_variable_at ), 327682, signature_290, errors_290
+    "primitiveInterpreterInvocationCounterLimit", primitiveFunctionType( &DebugPrimitives::interpreterInvocationCounterLimit ), 65536, signature_290, errors_290
 };
 
-static const char          *signature_291[] = { "Method", "Mixin", "SmallInteger" };
-static const char          *errors_291[]    = { "IsInstalled", "OutOfBounds", nullptr };
+static const char          *signature_291[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *errors_291[]    = { nullptr };
 static PrimitiveDescriptor primitive_291    = {
-    "primitiveMixin:removeMethodAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::remove_method_at ), 327682, signature_291, errors_291
+    "primitiveLargeIntegerHash", primitiveFunctionType( &ByteArrayPrimitives::largeIntegerHash ), 1574401, signature_291, errors_291
 };
 
-static const char          *signature_292[] = { "Mixin", "Mixin" };
+static const char          *signature_292[] = { "Boolean", "SmallInteger", "SmallInteger" };
 static const char          *errors_292[]    = { nullptr };
 static PrimitiveDescriptor primitive_292    = {
-    "primitiveMixinClassMixinOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::class_mixin ), 327681, signature_292, errors_292
+    "primitiveLessThan:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::lessThan ), 6029570, signature_292, errors_292
 };
 
-static const char          *signature_293[] = { "Boolean", "Mixin" };
+static const char          *signature_293[] = { "Boolean", "SmallInteger", "SmallInteger" };
 static const char          *errors_293[]    = { nullptr };
 static PrimitiveDescriptor primitive_293    = {
-    "primitiveMixinIsInstalled:ifFail:", primitiveFunctionType( &MixinOopPrimitives::is_installed ), 327681, signature_293, errors_293
+    "primitiveLessThanOrEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::lessThanOrEqual ), 6029570, signature_293, errors_293
 };
 
-static const char          *signature_294[] = { "SmallInteger", "Mixin" };
+static const char          *signature_294[] = { "SmallInteger", "Float", "Float", "SmallInteger" };
 static const char          *errors_294[]    = { nullptr };
 static PrimitiveDescriptor primitive_294    = {
-    "primitiveMixinNumberOfClassVariablesOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::number_of_class_variables ), 327681, signature_294, errors_294
+    "primitiveMandelbrotAtRe:im:iterate:ifFail:", primitiveFunctionType( &DoubleOopPrimitives::mandelbrot ), 4980739, signature_294, errors_294
 };
 
-static const char          *signature_295[] = { "SmallInteger", "Mixin" };
+static const char          *signature_295[] = { "Block", "Method", "Object" };
 static const char          *errors_295[]    = { nullptr };
 static PrimitiveDescriptor primitive_295    = {
-    "primitiveMixinNumberOfInstanceVariablesOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::number_of_instance_variables ), 327681, signature_295, errors_295
+    "primitiveMethodAllocateBlock:ifFail:", primitiveFunctionType( &MethodOopPrimitives::allocate_block_self ), 1376258, signature_295, errors_295
 };
 
-static const char          *signature_296[] = { "SmallInteger", "Mixin" };
+static const char          *signature_296[] = { "Block", "Method" };
 static const char          *errors_296[]    = { nullptr };
 static PrimitiveDescriptor primitive_296    = {
-    "primitiveMixinNumberOfMethodsOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::number_of_methods ), 327681, signature_296, errors_296
+    "primitiveMethodAllocateBlockIfFail:", primitiveFunctionType( &MethodOopPrimitives::allocate_block ), 1376257, signature_296, errors_296
 };
 
-static const char          *signature_297[] = { "Class", "Mixin" };
+static const char          *signature_297[] = { "Object", "Method" };
 static const char          *errors_297[]    = { nullptr };
 static PrimitiveDescriptor primitive_297    = {
-    "primitiveMixinPrimaryInvocationOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::primary_invocation ), 327681, signature_297, errors_297
+    "primitiveMethodBody", primitiveFunctionType( &MethodOopPrimitives::fileout_body ), 1114113, signature_297, errors_297
 };
 
-static const char          *signature_298[] = { "Mixin", "Mixin", "Mixin" };
-static const char          *errors_298[]    = { "IsInstalled", nullptr };
+static const char          *signature_298[] = { "Object", "Method" };
+static const char          *errors_298[]    = { nullptr };
 static PrimitiveDescriptor primitive_298    = {
-    "primitiveMixinSetClassMixinOf:to:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_class_mixin ), 327682, signature_298, errors_298
+    "primitiveMethodDebugInfo", primitiveFunctionType( &MethodOopPrimitives::debug_info ), 1114113, signature_298, errors_298
 };
 
-static const char          *signature_299[] = { "Boolean", "Mixin" };
-static const char          *errors_299[]    = { nullptr };
+static const char          *signature_299[] = { "Method", "Behavior", "CompressedSymbol" };
+static const char          *errors_299[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_299    = {
-    "primitiveMixinSetInstalled:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_installed ), 327681, signature_299, errors_299
+    "primitiveMethodFor:ifFail:", primitiveFunctionType( &BehaviorPrimitives::methodFor ), 1376258, signature_299, errors_299
 };
 
-static const char          *signature_300[] = { "Class", "Mixin", "Class" };
-static const char          *errors_300[]    = { "IsInstalled", nullptr };
+static const char          *signature_300[] = { "Symbol", "Method" };
+static const char          *errors_300[]    = { nullptr };
 static PrimitiveDescriptor primitive_300    = {
-    "primitiveMixinSetPrimaryInvocationOf:to:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_primary_invocation ), 327682, signature_300, errors_300
+    "primitiveMethodInliningInfo", primitiveFunctionType( &MethodOopPrimitives::inlining_info ), 1114113, signature_300, errors_300
 };
 
-static const char          *signature_301[] = { "Boolean", "Mixin" };
+static const char          *signature_301[] = { "SmallInteger", "Method" };
 static const char          *errors_301[]    = { nullptr };
 static PrimitiveDescriptor primitive_301    = {
-    "primitiveMixinSetUnInstalled:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_uninstalled ), 327681, signature_301, errors_301
+    "primitiveMethodNumberOfArguments", primitiveFunctionType( &MethodOopPrimitives::numberOfArguments ), 1114113, signature_301, errors_301
 };
 
-static const char          *signature_302[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
-static const char          *errors_302[]    = { "Overflow", "DivisionByZero", nullptr };
+static const char          *signature_302[] = { "Symbol", "Method", "Method" };
+static const char          *errors_302[]    = { nullptr };
 static PrimitiveDescriptor primitive_302    = {
-    "primitiveMod:ifFail:", primitiveFunctionType( &smiOopPrimitives_mod ), 6029826, signature_302, errors_302
+    "primitiveMethodOuter:ifFail:", primitiveFunctionType( &MethodOopPrimitives::setOuter ), 1376258, signature_302, errors_302
 };
 
-static const char          *signature_303[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
-static const char          *errors_303[]    = { "Overflow", nullptr };
+static const char          *signature_303[] = { "Method", "Method" };
+static const char          *errors_303[]    = { "ReceiverNotBlockMethod", nullptr };
 static PrimitiveDescriptor primitive_303    = {
-    "primitiveMultiply:ifFail:", primitiveFunctionType( &smiOopPrimitives_multiply ), 6029826, signature_303, errors_303
+    "primitiveMethodOuterIfFail:", primitiveFunctionType( &MethodOopPrimitives::outer ), 1376257, signature_303, errors_303
 };
 
-static const char          *signature_304[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_304[] = { "Method", "Method", "Object" };
 static const char          *errors_304[]    = { nullptr };
 static PrimitiveDescriptor primitive_304    = {
-    "primitiveNew0:ifFail:", primitiveFunctionType( &primitiveNew0 ), 7667714, signature_304, errors_304
+    "primitiveMethodPrettyPrintKlass:ifFail:", primitiveFunctionType( &MethodOopPrimitives::prettyPrint ), 1376258, signature_304, errors_304
 };
 
-static const char          *signature_305[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_305[] = { "ByteIndexedInstanceVariables", "Method", "Object" };
 static const char          *errors_305[]    = { nullptr };
 static PrimitiveDescriptor primitive_305    = {
-    "primitiveNew1:ifFail:", primitiveFunctionType( &primitiveNew1 ), 7667714, signature_305, errors_305
+    "primitiveMethodPrettyPrintSourceKlass:ifFail:", primitiveFunctionType( &MethodOopPrimitives::prettyPrintSource ), 1376258, signature_305, errors_305
 };
 
-static const char          *signature_306[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_306[] = { "Symbol", "Method" };
 static const char          *errors_306[]    = { nullptr };
 static PrimitiveDescriptor primitive_306    = {
-    "primitiveNew2:ifFail:", primitiveFunctionType( &primitiveNew2 ), 7667714, signature_306, errors_306
+    "primitiveMethodPrintCodes", primitiveFunctionType( &MethodOopPrimitives::printCodes ), 1114113, signature_306, errors_306
 };
 
-static const char          *signature_307[] = { "Instance", "Behavior" };
-static const char          *errors_307[]    = { "ReceiverIsIndexable", nullptr };
+static const char          *signature_307[] = { "IndexedInstanceVariables", "Method" };
+static const char          *errors_307[]    = { nullptr };
 static PrimitiveDescriptor primitive_307    = {
-    "primitiveNew2IfFail:", primitiveFunctionType( &BehaviorPrimitives::allocate2 ), 1376257, signature_307, errors_307
+    "primitiveMethodReferencedClassVarNames", primitiveFunctionType( &MethodOopPrimitives::referenced_class_variable_names ), 1114113, signature_307, errors_307
 };
 
-static const char          *signature_308[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_308[] = { "IndexedInstanceVariables", "Method" };
 static const char          *errors_308[]    = { nullptr };
 static PrimitiveDescriptor primitive_308    = {
-    "primitiveNew3:ifFail:", primitiveFunctionType( &primitiveNew3 ), 7667714, signature_308, errors_308
+    "primitiveMethodReferencedGlobalNames", primitiveFunctionType( &MethodOopPrimitives::referenced_global_names ), 1114113, signature_308, errors_308
 };
 
-static const char          *signature_309[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_309[] = { "IndexedInstanceVariables", "Method", "Mixin" };
 static const char          *errors_309[]    = { nullptr };
 static PrimitiveDescriptor primitive_309    = {
-    "primitiveNew4:ifFail:", primitiveFunctionType( &primitiveNew4 ), 7667714, signature_309, errors_309
+    "primitiveMethodReferencedInstVarNamesMixin:ifFail:", primitiveFunctionType( &MethodOopPrimitives::referenced_instance_variable_names ), 1376258, signature_309, errors_309
 };
 
-static const char          *signature_310[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_310[] = { "Symbol", "Method" };
 static const char          *errors_310[]    = { nullptr };
 static PrimitiveDescriptor primitive_310    = {
-    "primitiveNew5:ifFail:", primitiveFunctionType( &primitiveNew5 ), 7667714, signature_310, errors_310
+    "primitiveMethodSelector", primitiveFunctionType( &MethodOopPrimitives::selector ), 1114113, signature_310, errors_310
 };
 
-static const char          *signature_311[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_311[] = { "Symbol", "Method", "Symbol" };
 static const char          *errors_311[]    = { nullptr };
 static PrimitiveDescriptor primitive_311    = {
-    "primitiveNew6:ifFail:", primitiveFunctionType( &primitiveNew6 ), 7667714, signature_311, errors_311
+    "primitiveMethodSelector:ifFail:", primitiveFunctionType( &MethodOopPrimitives::setSelector ), 1376258, signature_311, errors_311
 };
 
-static const char          *signature_312[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_312[] = { "IndexedInstanceVariables", "Method" };
 static const char          *errors_312[]    = { nullptr };
 static PrimitiveDescriptor primitive_312    = {
-    "primitiveNew7:ifFail:", primitiveFunctionType( &primitiveNew7 ), 7667714, signature_312, errors_312
+    "primitiveMethodSenders", primitiveFunctionType( &MethodOopPrimitives::senders ), 1114113, signature_312, errors_312
 };
 
-static const char          *signature_313[] = { "Instance", "Behavior", "Boolean" };
-static const char          *errors_313[]    = { nullptr };
+static const char          *signature_313[] = { "Symbol", "Method", "Symbol" };
+static const char          *errors_313[]    = { "ArgumentIsInvalid", nullptr };
 static PrimitiveDescriptor primitive_313    = {
-    "primitiveNew8:ifFail:", primitiveFunctionType( &primitiveNew8 ), 7667714, signature_313, errors_313
+    "primitiveMethodSetInliningInfo:ifFail:", primitiveFunctionType( &MethodOopPrimitives::set_inlining_info ), 1376258, signature_313, errors_313
 };
 
-static const char          *signature_314[] = { "Instance", "Behavior", "Boolean" };
+static const char          *signature_314[] = { "Object", "Method" };
 static const char          *errors_314[]    = { nullptr };
 static PrimitiveDescriptor primitive_314    = {
-    "primitiveNew9:ifFail:", primitiveFunctionType( &primitiveNew9 ), 7667714, signature_314, errors_314
+    "primitiveMethodSizeAndFlags", primitiveFunctionType( &MethodOopPrimitives::size_and_flags ), 1114113, signature_314, errors_314
 };
 
-static const char          *signature_315[] = { "Instance", "Behavior", "Boolean" };
-static const char          *errors_315[]    = { "ReceiverIsIndexable", nullptr };
+static const char          *signature_315[] = { "Mixin", "Mixin", "Symbol" };
+static const char          *errors_315[]    = { "IsInstalled", "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_315    = {
-    "primitiveNew:tenured:ifFail:", primitiveFunctionType( &BehaviorPrimitives::allocate3 ), 327682, signature_315, errors_315
+    "primitiveMixin:addClassVariable:ifFail:", primitiveFunctionType( &MixinOopPrimitives::add_class_variable ), 327682, signature_315, errors_315
 };
 
-static const char          *signature_316[] = { "Instance", "Behavior" };
-static const char          *errors_316[]    = { "ReceiverIsIndexable", nullptr };
+static const char          *signature_316[] = { "Symbol", "Mixin", "Symbol" };
+static const char          *errors_316[]    = { "IsInstalled", "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_316    = {
-    "primitiveNewIfFail:", primitiveFunctionType( &BehaviorPrimitives::allocate ), 1376257, signature_316, errors_316
+    "primitiveMixin:addInstanceVariable:ifFail:", primitiveFunctionType( &MixinOopPrimitives::add_instance_variable ), 327682, signature_316, errors_316
 };
 
-static const char          *signature_317[] = { "Boolean", "Object", "Object" };
-static const char          *errors_317[]    = { nullptr };
+static const char          *signature_317[] = { "Method", "Mixin", "Method" };
+static const char          *errors_317[]    = { "IsInstalled", nullptr };
 static PrimitiveDescriptor primitive_317    = {
-    "primitiveNotEqual:", primitiveFunctionType( &OopPrimitives::not_equal ), 1572866, signature_317, errors_317
+    "primitiveMixin:addMethod:ifFail:", primitiveFunctionType( &MixinOopPrimitives::add_method ), 327682, signature_317, errors_317
 };
 
-static const char          *signature_318[] = { "Object" };
-static const char          *errors_318[]    = { "EmptyQueue", nullptr };
+static const char          *signature_318[] = { "Symbol", "Mixin", "SmallInteger" };
+static const char          *errors_318[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_318    = {
-    "primitiveNotificationQueueGetIfFail:", primitiveFunctionType( &SystemPrimitives::notificationQueueGet ), 327680, signature_318, errors_318
+    "primitiveMixin:classVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::class_variable_at ), 327682, signature_318, errors_318
 };
 
-static const char          *signature_319[] = { "Object", "Object" };
+static const char          *signature_319[] = { "Symbol", "Mixin" };
 static const char          *errors_319[]    = { nullptr };
 static PrimitiveDescriptor primitive_319    = {
-    "primitiveNotificationQueuePut:", primitiveFunctionType( &SystemPrimitives::notificationQueuePut ), 65537, signature_319, errors_319
+    "primitiveMixin:classVariablesIfFail:", primitiveFunctionType( &MixinOopPrimitives::class_variables ), 327681, signature_319, errors_319
 };
 
-static const char          *signature_320[] = { "SmallInteger" };
-static const char          *errors_320[]    = { nullptr };
+static const char          *signature_320[] = { "Symbol", "Mixin", "SmallInteger" };
+static const char          *errors_320[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_320    = {
-    "primitiveNumberOfLookupCacheMisses", primitiveFunctionType( &DebugPrimitives::numberOfLookupCacheMisses ), 65536, signature_320, errors_320
+    "primitiveMixin:instanceVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::instance_variable_at ), 327682, signature_320, errors_320
 };
 
-static const char          *signature_321[] = { "SmallInteger" };
+static const char          *signature_321[] = { "Symbol", "Mixin" };
 static const char          *errors_321[]    = { nullptr };
 static PrimitiveDescriptor primitive_321    = {
-    "primitiveNumberOfMethodInvocations", primitiveFunctionType( &DebugPrimitives::numberOfMethodInvocations ), 65536, signature_321, errors_321
+    "primitiveMixin:instanceVariablesIfFail:", primitiveFunctionType( &MixinOopPrimitives::instance_variables ), 327681, signature_321, errors_321
 };
 
-static const char          *signature_322[] = { "SmallInteger" };
-static const char          *errors_322[]    = { nullptr };
+static const char          *signature_322[] = { "Method", "Mixin", "SmallInteger" };
+static const char          *errors_322[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_322    = {
-    "primitiveNumberOfNativeMethodInvocations", primitiveFunctionType( &DebugPrimitives::numberOfNativeMethodInvocations ), 65536, signature_322, errors_322
+    "primitiveMixin:methodAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::method_at ), 327682, signature_322, errors_322
 };
 
-static const char          *signature_323[] = { "SmallInteger" };
+static const char          *signature_323[] = { "Symbol", "Mixin" };
 static const char          *errors_323[]    = { nullptr };
 static PrimitiveDescriptor primitive_323    = {
-    "primitiveNumberOfPrimaryLookupCacheHits", primitiveFunctionType( &DebugPrimitives::numberOfPrimaryLookupCacheHits ), 65536, signature_323, errors_323
+    "primitiveMixin:methodsIfFail:", primitiveFunctionType( &MixinOopPrimitives::methods ), 327681, signature_323, errors_323
 };
 
-static const char          *signature_324[] = { "SmallInteger" };
-static const char          *errors_324[]    = { nullptr };
+static const char          *signature_324[] = { "Symbol", "Mixin", "SmallInteger" };
+static const char          *errors_324[]    = { "IsInstalled", "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_324    = {
-    "primitiveNumberOfSecondaryLookupCacheHits", primitiveFunctionType( &DebugPrimitives::numberOfSecondaryLookupCacheHits ), 65536, signature_324, errors_324
+    "primitiveMixin:removeClassVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::remove_class_variable_at ), 327682, signature_324, errors_324
 };
 
-static const char          *signature_325[] = { "SmallInteger" };
-static const char          *errors_325[]    = { nullptr };
+static const char          *signature_325[] = { "Symbol", "Mixin", "SmallInteger" };
+static const char          *errors_325[]    = { "IsInstalled", "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_325    = {
-    "primitiveNurseryFreeSpace", primitiveFunctionType( &SystemPrimitives::nurseryFreeSpace ), 65536, signature_325, errors_325
+    "primitiveMixin:removeInstanceVariableAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::remove_instance_variable_at ), 327682, signature_325, errors_325
 };
 
-static const char          *signature_326[] = { "Float" };
-static const char          *errors_326[]    = { nullptr };
+static const char          *signature_326[] = { "Method", "Mixin", "SmallInteger" };
+static const char          *errors_326[]    = { "IsInstalled", "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_326    = {
-    "primitiveObjectMemorySize", primitiveFunctionType( &SystemPrimitives::object_memory_size ), 65536, signature_326, errors_326
+    "primitiveMixin:removeMethodAt:ifFail:", primitiveFunctionType( &MixinOopPrimitives::remove_method_at ), 327682, signature_326, errors_326
 };
 
-static const char          *signature_327[] = { "SmallInteger", "Object" };
+static const char          *signature_327[] = { "Mixin", "Mixin" };
 static const char          *errors_327[]    = { nullptr };
 static PrimitiveDescriptor primitive_327    = {
-    "primitiveOopSize", primitiveFunctionType( &OopPrimitives::oop_size ), 1572865, signature_327, errors_327
+    "primitiveMixinClassMixinOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::class_mixin ), 327681, signature_327, errors_327
 };
 
-static const char          *signature_328[] = { "Object", "Object", "Symbol" };
-static const char          *errors_328[]    = { "NotFound", nullptr };
+static const char          *signature_328[] = { "Boolean", "Mixin" };
+static const char          *errors_328[]    = { nullptr };
 static PrimitiveDescriptor primitive_328    = {
-    "primitiveOptimizeMethod:ifFail:", primitiveFunctionType( &DebugPrimitives::optimizeMethod ), 1376258, signature_328, errors_328
+    "primitiveMixinIsInstalled:ifFail:", primitiveFunctionType( &MixinOopPrimitives::is_installed ), 327681, signature_328, errors_328
 };
 
-static const char          *signature_329[] = { "Object", "Object", "CompressedSymbol", "Array" };
-static const char          *errors_329[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
+static const char          *signature_329[] = { "SmallInteger", "Mixin" };
+static const char          *errors_329[]    = { nullptr };
 static PrimitiveDescriptor primitive_329    = {
-    "primitivePerform:arguments:ifFail:", primitiveFunctionType( &OopPrimitives::performArguments ), 1507331, signature_329, errors_329
+    "primitiveMixinNumberOfClassVariablesOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::number_of_class_variables ), 327681, signature_329, errors_329
 };
 
-static const char          *signature_330[] = { "Object", "Object", "CompressedSymbol" };
-static const char          *errors_330[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
+static const char          *signature_330[] = { "SmallInteger", "Mixin" };
+static const char          *errors_330[]    = { nullptr };
 static PrimitiveDescriptor primitive_330    = {
-    "primitivePerform:ifFail:", primitiveFunctionType( &OopPrimitives::perform ), 1376258, signature_330, errors_330
+    "primitiveMixinNumberOfInstanceVariablesOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::number_of_instance_variables ), 327681, signature_330, errors_330
 };
 
-static const char          *signature_331[] = { "Object", "Object", "CompressedSymbol", "Object" };
-static const char          *errors_331[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
+static const char          *signature_331[] = { "SmallInteger", "Mixin" };
+static const char          *errors_331[]    = { nullptr };
 static PrimitiveDescriptor primitive_331    = {
-    "primitivePerform:with:ifFail:", primitiveFunctionType( &OopPrimitives::performWith ), 1507331, signature_331, errors_331
+    "primitiveMixinNumberOfMethodsOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::number_of_methods ), 327681, signature_331, errors_331
 };
 
-static const char          *signature_332[] = { "Object", "Object", "CompressedSymbol", "Object", "Object" };
-static const char          *errors_332[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
+static const char          *signature_332[] = { "Class", "Mixin" };
+static const char          *errors_332[]    = { nullptr };
 static PrimitiveDescriptor primitive_332    = {
-    "primitivePerform:with:with:ifFail:", primitiveFunctionType( &OopPrimitives::performWithWith ), 1507332, signature_332, errors_332
+    "primitiveMixinPrimaryInvocationOf:ifFail:", primitiveFunctionType( &MixinOopPrimitives::primary_invocation ), 327681, signature_332, errors_332
 };
 
-static const char          *signature_333[] = { "Object", "Object", "CompressedSymbol", "Object", "Object", "Object" };
-static const char          *errors_333[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
+static const char          *signature_333[] = { "Mixin", "Mixin", "Mixin" };
+static const char          *errors_333[]    = { "IsInstalled", nullptr };
 static PrimitiveDescriptor primitive_333    = {
-    "primitivePerform:with:with:with:ifFail:", primitiveFunctionType( &OopPrimitives::performWithWithWith ), 1507333, signature_333, errors_333
+    "primitiveMixinSetClassMixinOf:to:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_class_mixin ), 327682, signature_333, errors_333
 };
 
-static const char          *signature_334[] = { "Self", "Object" };
+static const char          *signature_334[] = { "Boolean", "Mixin" };
 static const char          *errors_334[]    = { nullptr };
 static PrimitiveDescriptor primitive_334    = {
-    "primitivePrint", primitiveFunctionType( &OopPrimitives::print ), 1114113, signature_334, errors_334
+    "primitiveMixinSetInstalled:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_installed ), 327681, signature_334, errors_334
 };
 
-static const char          *signature_335[] = { "SmallInteger", "SmallInteger" };
-static const char          *errors_335[]    = { "OutOfBounds", nullptr };
+static const char          *signature_335[] = { "Class", "Mixin", "Class" };
+static const char          *errors_335[]    = { "IsInstalled", nullptr };
 static PrimitiveDescriptor primitive_335    = {
-    "primitivePrintCharacterIfFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::printCharacter ), 1310721, signature_335, errors_335
+    "primitiveMixinSetPrimaryInvocationOf:to:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_primary_invocation ), 327682, signature_335, errors_335
 };
 
-static const char          *signature_336[] = { "Object", "SmallInteger" };
+static const char          *signature_336[] = { "Boolean", "Mixin" };
 static const char          *errors_336[]    = { nullptr };
 static PrimitiveDescriptor primitive_336    = {
-    "primitivePrintInvocationCounterHistogram:ifFail:", primitiveFunctionType( &DebugPrimitives::printInvocationCounterHistogram ), 327681, signature_336, errors_336
+    "primitiveMixinSetUnInstalled:ifFail:", primitiveFunctionType( &MixinOopPrimitives::set_uninstalled ), 327681, signature_336, errors_336
 };
 
-static const char          *signature_337[] = { "Object" };
-static const char          *errors_337[]    = { nullptr };
+static const char          *signature_337[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_337[]    = { "Overflow", "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_337    = {
-    "primitivePrintLayout", primitiveFunctionType( &DebugPrimitives::printMemoryLayout ), 65536, signature_337, errors_337
+    "primitiveMod:ifFail:", primitiveFunctionType( &smiOopPrimitives_mod ), 6029826, signature_337, errors_337
 };
 
-static const char          *signature_338[] = { "Object" };
-static const char          *errors_338[]    = { nullptr };
+static const char          *signature_338[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_338[]    = { "Overflow", nullptr };
 static PrimitiveDescriptor primitive_338    = {
-    "primitivePrintLookupCacheStatistics", primitiveFunctionType( &DebugPrimitives::printLookupCacheStatistics ), 65536, signature_338, errors_338
+    "primitiveMultiply:ifFail:", primitiveFunctionType( &smiOopPrimitives_multiply ), 6029826, signature_338, errors_338
 };
 
-static const char          *signature_339[] = { "Object" };
+static const char          *signature_339[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_339[]    = { nullptr };
 static PrimitiveDescriptor primitive_339    = {
-    "primitivePrintMemory", primitiveFunctionType( &SystemPrimitives::print_memory ), 65536, signature_339, errors_339
+    "primitiveNew0:ifFail:", primitiveFunctionType( &primitiveNew0 ), 7667714, signature_339, errors_339
 };
 
-static const char          *signature_340[] = { "Behavior", "Behavior", "ByteArray" };
+static const char          *signature_340[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_340[]    = { nullptr };
 static PrimitiveDescriptor primitive_340    = {
-    "primitivePrintMethod:ifFail:", primitiveFunctionType( &BehaviorPrimitives::printMethod ), 1376258, signature_340, errors_340
+    "primitiveNew1:ifFail:", primitiveFunctionType( &primitiveNew1 ), 7667714, signature_340, errors_340
 };
 
-static const char          *signature_341[] = { "Object", "Object", "Symbol" };
-static const char          *errors_341[]    = { "NotFound", nullptr };
+static const char          *signature_341[] = { "Instance", "Behavior", "Boolean" };
+static const char          *errors_341[]    = { nullptr };
 static PrimitiveDescriptor primitive_341    = {
-    "primitivePrintMethodCodes:ifFail:", primitiveFunctionType( &DebugPrimitives::printMethodCodes ), 1376258, signature_341, errors_341
+    "primitiveNew2:ifFail:", primitiveFunctionType( &primitiveNew2 ), 7667714, signature_341, errors_341
 };
 
-static const char          *signature_342[] = { "Object", "SmallInteger" };
-static const char          *errors_342[]    = { nullptr };
+static const char          *signature_342[] = { "Instance", "Behavior" };
+static const char          *errors_342[]    = { "ReceiverIsIndexable", nullptr };
 static PrimitiveDescriptor primitive_342    = {
-    "primitivePrintNativeMethodCounterHistogram:ifFail:", primitiveFunctionType( &DebugPrimitives::printNativeMethodCounterHistogram ), 327681, signature_342, errors_342
+    "primitiveNew2IfFail:", primitiveFunctionType( &BehaviorPrimitives::allocate2 ), 1376257, signature_342, errors_342
 };
 
-static const char          *signature_343[] = { "Object" };
+static const char          *signature_343[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_343[]    = { nullptr };
 static PrimitiveDescriptor primitive_343    = {
-    "primitivePrintObjectHistogram", primitiveFunctionType( &DebugPrimitives::printObjectHistogram ), 65536, signature_343, errors_343
+    "primitiveNew3:ifFail:", primitiveFunctionType( &primitiveNew3 ), 7667714, signature_343, errors_343
 };
 
-static const char          *signature_344[] = { "Object" };
+static const char          *signature_344[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_344[]    = { nullptr };
 static PrimitiveDescriptor primitive_344    = {
-    "primitivePrintPrimitiveCounters", primitiveFunctionType( &DebugPrimitives::printPrimitiveCounters ), 65536, signature_344, errors_344
+    "primitiveNew4:ifFail:", primitiveFunctionType( &primitiveNew4 ), 7667714, signature_344, errors_344
 };
 
-static const char          *signature_345[] = { "Object" };
+static const char          *signature_345[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_345[]    = { nullptr };
 static PrimitiveDescriptor primitive_345    = {
-    "primitivePrintPrimitiveTable", primitiveFunctionType( &SystemPrimitives::printPrimitiveTable ), 65536, signature_345, errors_345
+    "primitiveNew5:ifFail:", primitiveFunctionType( &primitiveNew5 ), 7667714, signature_345, errors_345
 };
 
-static const char          *signature_346[] = { "Self", "Object" };
+static const char          *signature_346[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_346[]    = { nullptr };
 static PrimitiveDescriptor primitive_346    = {
-    "primitivePrintValue", primitiveFunctionType( &OopPrimitives::printValue ), 1114113, signature_346, errors_346
+    "primitiveNew6:ifFail:", primitiveFunctionType( &primitiveNew6 ), 7667714, signature_346, errors_346
 };
 
-static const char          *signature_347[] = { "Object" };
+static const char          *signature_347[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_347[]    = { nullptr };
 static PrimitiveDescriptor primitive_347    = {
-    "primitivePrintZone", primitiveFunctionType( &SystemPrimitives::print_zone ), 65536, signature_347, errors_347
+    "primitiveNew7:ifFail:", primitiveFunctionType( &primitiveNew7 ), 7667714, signature_347, errors_347
 };
 
-static const char          *signature_348[] = { "Object" };
+static const char          *signature_348[] = { "Instance", "Behavior", "Boolean" };
 static const char          *errors_348[]    = { nullptr };
 static PrimitiveDescriptor primitive_348    = {
-    "primitiveProcessActiveProcess", primitiveFunctionType( &ProcessOopPrimitives::activeProcess ), 65536, signature_348, errors_348
+    "primitiveNew8:ifFail:", primitiveFunctionType( &primitiveNew8 ), 7667714, signature_348, errors_348
 };
 
-static const char          *signature_349[] = { "Process", "Process class", "BlockWithoutArguments" };
-static const char          *errors_349[]    = { "ProcessAllocationFailed", nullptr };
+static const char          *signature_349[] = { "Instance", "Behavior", "Boolean" };
+static const char          *errors_349[]    = { nullptr };
 static PrimitiveDescriptor primitive_349    = {
-    "primitiveProcessCreate:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::create ), 1376258, signature_349, errors_349
+    "primitiveNew9:ifFail:", primitiveFunctionType( &primitiveNew9 ), 7667714, signature_349, errors_349
 };
 
-static const char          *signature_350[] = { "Process" };
-static const char          *errors_350[]    = { nullptr };
+static const char          *signature_350[] = { "Instance", "Behavior", "Boolean" };
+static const char          *errors_350[]    = { "ReceiverIsIndexable", nullptr };
 static PrimitiveDescriptor primitive_350    = {
-    "primitiveProcessEnterCritical", primitiveFunctionType( &ProcessOopPrimitives::enter_critical ), 65536, signature_350, errors_350
+    "primitiveNew:tenured:ifFail:", primitiveFunctionType( &BehaviorPrimitives::allocate3 ), 327682, signature_350, errors_350
 };
 
-static const char          *signature_351[] = { "Process" };
-static const char          *errors_351[]    = { nullptr };
+static const char          *signature_351[] = { "Instance", "Behavior" };
+static const char          *errors_351[]    = { "ReceiverIsIndexable", nullptr };
 static PrimitiveDescriptor primitive_351    = {
-    "primitiveProcessLeaveCritical", primitiveFunctionType( &ProcessOopPrimitives::leave_critical ), 65536, signature_351, errors_351
+    "primitiveNewIfFail:", primitiveFunctionType( &BehaviorPrimitives::allocate ), 1376257, signature_351, errors_351
 };
 
-static const char          *signature_352[] = { "Boolean", "Process", "SmallInteger" };
+static const char          *signature_352[] = { "Boolean", "Object", "Object" };
 static const char          *errors_352[]    = { nullptr };
 static PrimitiveDescriptor primitive_352    = {
-    "primitiveProcessSchedulerWait:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::scheduler_wait ), 1376258, signature_352, errors_352
+    "primitiveNotEqual:", primitiveFunctionType( &OopPrimitives::not_equal ), 1572866, signature_352, errors_352
 };
 
-static const char          *signature_353[] = { "Symbol", "Process", "Symbol", "Activation", "Object" };
-static const char          *errors_353[]    = { "InScheduler", "Dead", nullptr };
+static const char          *signature_353[] = { "Object" };
+static const char          *errors_353[]    = { "EmptyQueue", nullptr };
 static PrimitiveDescriptor primitive_353    = {
-    "primitiveProcessSetMode:activation:returnValue:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::set_mode ), 1376260, signature_353, errors_353
+    "primitiveNotificationQueueGetIfFail:", primitiveFunctionType( &SystemPrimitives::notificationQueueGet ), 327680, signature_353, errors_353
 };
 
-static const char          *signature_354[] = { "IndexedInstanceVariables", "Process", "SmallInteger" };
+static const char          *signature_354[] = { "Object", "Object" };
 static const char          *errors_354[]    = { nullptr };
 static PrimitiveDescriptor primitive_354    = {
-    "primitiveProcessStackLimit:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::stack ), 1376258, signature_354, errors_354
+    "primitiveNotificationQueuePut:", primitiveFunctionType( &SystemPrimitives::notificationQueuePut ), 65537, signature_354, errors_354
 };
 
-static const char          *signature_355[] = { "Object", "Process" };
-static const char          *errors_355[]    = { "NotInScheduler", "ProcessCannotContinue", "Dead", nullptr };
+static const char          *signature_355[] = { "SmallInteger" };
+static const char          *errors_355[]    = { nullptr };
 static PrimitiveDescriptor primitive_355    = {
-    "primitiveProcessStartEvaluator:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::start_evaluator ), 327681, signature_355, errors_355
+    "primitiveNumberOfLookupCacheMisses", primitiveFunctionType( &DebugPrimitives::numberOfLookupCacheMisses ), 65536, signature_355, errors_355
 };
 
-static const char          *signature_356[] = { "Symbol", "Process" };
+static const char          *signature_356[] = { "SmallInteger" };
 static const char          *errors_356[]    = { nullptr };
 static PrimitiveDescriptor primitive_356    = {
-    "primitiveProcessStatus", primitiveFunctionType( &ProcessOopPrimitives::status ), 1114113, signature_356, errors_356
+    "primitiveNumberOfMethodInvocations", primitiveFunctionType( &DebugPrimitives::numberOfMethodInvocations ), 65536, signature_356, errors_356
 };
 
-static const char          *signature_357[] = { "Process" };
+static const char          *signature_357[] = { "SmallInteger" };
 static const char          *errors_357[]    = { nullptr };
 static PrimitiveDescriptor primitive_357    = {
-    "primitiveProcessStop", primitiveFunctionType( &ProcessOopPrimitives::stop ), 65536, signature_357, errors_357
+    "primitiveNumberOfNativeMethodInvocations", primitiveFunctionType( &DebugPrimitives::numberOfNativeMethodInvocations ), 65536, signature_357, errors_357
 };
 
-static const char          *signature_358[] = { "Float", "Process" };
+static const char          *signature_358[] = { "SmallInteger" };
 static const char          *errors_358[]    = { nullptr };
 static PrimitiveDescriptor primitive_358    = {
-    "primitiveProcessSystemTime", primitiveFunctionType( &ProcessOopPrimitives::user_time ), 1114113, signature_358, errors_358
+    "primitiveNumberOfPrimaryLookupCacheHits", primitiveFunctionType( &DebugPrimitives::numberOfPrimaryLookupCacheHits ), 65536, signature_358, errors_358
 };
 
-static const char          *signature_359[] = { "Self", "Process" };
-static const char          *errors_359[]    = { "Dead", nullptr };
+static const char          *signature_359[] = { "SmallInteger" };
+static const char          *errors_359[]    = { nullptr };
 static PrimitiveDescriptor primitive_359    = {
-    "primitiveProcessTerminateIfFail:", primitiveFunctionType( &ProcessOopPrimitives::terminate ), 1507329, signature_359, errors_359
+    "primitiveNumberOfSecondaryLookupCacheHits", primitiveFunctionType( &DebugPrimitives::numberOfSecondaryLookupCacheHits ), 65536, signature_359, errors_359
 };
 
-static const char          *signature_360[] = { "Self", "Process", "SmallInteger" };
+static const char          *signature_360[] = { "SmallInteger" };
 static const char          *errors_360[]    = { nullptr };
 static PrimitiveDescriptor primitive_360    = {
-    "primitiveProcessTraceStack:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::trace_stack ), 1376258, signature_360, errors_360
+    "primitiveNurseryFreeSpace", primitiveFunctionType( &SystemPrimitives::nurseryFreeSpace ), 65536, signature_360, errors_360
 };
 
-static const char          *signature_361[] = { "Object", "Process" };
-static const char          *errors_361[]    = { "NotInScheduler", "ProcessCannotContinue", "Dead", nullptr };
+static const char          *signature_361[] = { "Float" };
+static const char          *errors_361[]    = { nullptr };
 static PrimitiveDescriptor primitive_361    = {
-    "primitiveProcessTransferTo:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::transferTo ), 327681, signature_361, errors_361
+    "primitiveObjectMemorySize", primitiveFunctionType( &SystemPrimitives::object_memory_size ), 65536, signature_361, errors_361
 };
 
-static const char          *signature_362[] = { "Float", "Process" };
+static const char          *signature_362[] = { "SmallInteger", "Object" };
 static const char          *errors_362[]    = { nullptr };
 static PrimitiveDescriptor primitive_362    = {
-    "primitiveProcessUserTime", primitiveFunctionType( &ProcessOopPrimitives::user_time ), 1114113, signature_362, errors_362
+    "primitiveOopSize", primitiveFunctionType( &OopPrimitives::oop_size ), 1572865, signature_362, errors_362
 };
 
-static const char          *signature_363[] = { "Process" };
-static const char          *errors_363[]    = { nullptr };
+static const char          *signature_363[] = { "Object", "Object", "Symbol" };
+static const char          *errors_363[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_363    = {
-    "primitiveProcessYield", primitiveFunctionType( &ProcessOopPrimitives::yield ), 65536, signature_363, errors_363
+    "primitiveOptimizeMethod:ifFail:", primitiveFunctionType( &DebugPrimitives::optimizeMethod ), 1376258, signature_363, errors_363
 };
 
-static const char          *signature_364[] = { "Process" };
-static const char          *errors_364[]    = { nullptr };
+static const char          *signature_364[] = { "Object", "Object", "CompressedSymbol", "Array" };
+static const char          *errors_364[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
 static PrimitiveDescriptor primitive_364    = {
-    "primitiveProcessYieldInCritical", primitiveFunctionType( &ProcessOopPrimitives::yield_in_critical ), 65536, signature_364, errors_364
+    "primitivePerform:arguments:ifFail:", primitiveFunctionType( &OopPrimitives::performArguments ), 1507331, signature_364, errors_364
 };
 
-static const char          *signature_365[] = { "SmallInteger", "Proxy", "SmallInteger" };
-static const char          *errors_365[]    = { nullptr };
+static const char          *signature_365[] = { "Object", "Object", "CompressedSymbol" };
+static const char          *errors_365[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
 static PrimitiveDescriptor primitive_365    = {
-    "primitiveProxyByteAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::byteAt ), 5570562, signature_365, errors_365
+    "primitivePerform:ifFail:", primitiveFunctionType( &OopPrimitives::perform ), 1376258, signature_365, errors_365
 };
 
-static const char          *signature_366[] = { "SmallInteger", "Proxy", "SmallInteger", "SmallInteger" };
-static const char          *errors_366[]    = { nullptr };
+static const char          *signature_366[] = { "Object", "Object", "CompressedSymbol", "Object" };
+static const char          *errors_366[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
 static PrimitiveDescriptor primitive_366    = {
-    "primitiveProxyByteAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::byteAtPut ), 5570563, signature_366, errors_366
+    "primitivePerform:with:ifFail:", primitiveFunctionType( &OopPrimitives::performWith ), 1507331, signature_366, errors_366
 };
 
-static const char          *signature_367[] = { "Self", "Proxy", "SmallInteger" };
-static const char          *errors_367[]    = { nullptr };
+static const char          *signature_367[] = { "Object", "Object", "CompressedSymbol", "Object", "Object" };
+static const char          *errors_367[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
 static PrimitiveDescriptor primitive_367    = {
-    "primitiveProxyCalloc:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::calloc ), 1376258, signature_367, errors_367
+    "primitivePerform:with:with:ifFail:", primitiveFunctionType( &OopPrimitives::performWithWith ), 1507332, signature_367, errors_367
 };
 
-static const char          *signature_368[] = { "SmallInteger", "Proxy", "SmallInteger" };
-static const char          *errors_368[]    = { nullptr };
+static const char          *signature_368[] = { "Object", "Object", "CompressedSymbol", "Object", "Object", "Object" };
+static const char          *errors_368[]    = { "SelectorHasWrongNumberOfArguments", nullptr };
 static PrimitiveDescriptor primitive_368    = {
-    "primitiveProxyDoubleByteAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doubleByteAt ), 1376258, signature_368, errors_368
+    "primitivePerform:with:with:with:ifFail:", primitiveFunctionType( &OopPrimitives::performWithWithWith ), 1507333, signature_368, errors_368
 };
 
-static const char          *signature_369[] = { "SmallInteger", "Proxy", "SmallInteger", "SmallInteger" };
+static const char          *signature_369[] = { "Self", "Object" };
 static const char          *errors_369[]    = { nullptr };
 static PrimitiveDescriptor primitive_369    = {
-    "primitiveProxyDoubleByteAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doubleByteAtPut ), 1376259, signature_369, errors_369
+    "primitivePrint", primitiveFunctionType( &OopPrimitives::print ), 1114113, signature_369, errors_369
 };
 
-static const char          *signature_370[] = { "Float", "Proxy", "SmallInteger" };
-static const char          *errors_370[]    = { nullptr };
+static const char          *signature_370[] = { "SmallInteger", "SmallInteger" };
+static const char          *errors_370[]    = { "OutOfBounds", nullptr };
 static PrimitiveDescriptor primitive_370    = {
-    "primitiveProxyDoublePrecisionFloatAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doublePrecisionFloatAt ), 1376258, signature_370, errors_370
+    "primitivePrintCharacterIfFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::printCharacter ), 1310721, signature_370, errors_370
 };
 
-static const char          *signature_371[] = { "Self", "Proxy", "SmallInteger", "Float" };
-static const char          *errors_371[]    = { "ConversionFailed", nullptr };
+static const char          *signature_371[] = { "Object", "SmallInteger" };
+static const char          *errors_371[]    = { nullptr };
 static PrimitiveDescriptor primitive_371    = {
-    "primitiveProxyDoublePrecisionFloatAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doublePrecisionFloatAtPut ), 1376259, signature_371, errors_371
+    "primitivePrintInvocationCounterHistogram:ifFail:", primitiveFunctionType( &DebugPrimitives::printInvocationCounterHistogram ), 327681, signature_371, errors_371
 };
 
-static const char          *signature_372[] = { "Self", "Proxy" };
+static const char          *signature_372[] = { "Object" };
 static const char          *errors_372[]    = { nullptr };
 static PrimitiveDescriptor primitive_372    = {
-    "primitiveProxyFree", primitiveFunctionType( &ProxyOopPrimitives::free ), 1114113, signature_372, errors_372
+    "primitivePrintLayout", primitiveFunctionType( &DebugPrimitives::printMemoryLayout ), 65536, signature_372, errors_372
 };
 
-static const char          *signature_373[] = { "SmallInteger", "Proxy" };
+static const char          *signature_373[] = { "Object" };
 static const char          *errors_373[]    = { nullptr };
 static PrimitiveDescriptor primitive_373    = {
-    "primitiveProxyGetHigh", primitiveFunctionType( &ProxyOopPrimitives::getHigh ), 1114113, signature_373, errors_373
+    "primitivePrintLookupCacheStatistics", primitiveFunctionType( &DebugPrimitives::printLookupCacheStatistics ), 65536, signature_373, errors_373
 };
 
-static const char          *signature_374[] = { "SmallInteger", "Proxy" };
-static const char          *errors_374[]    = { "ConversionFailed", nullptr };
+static const char          *signature_374[] = { "Object" };
+static const char          *errors_374[]    = { nullptr };
 static PrimitiveDescriptor primitive_374    = {
-    "primitiveProxyGetIfFail:", primitiveFunctionType( &ProxyOopPrimitives::getSmi ), 1376257, signature_374, errors_374
+    "primitivePrintMemory", primitiveFunctionType( &SystemPrimitives::print_memory ), 65536, signature_374, errors_374
 };
 
-static const char          *signature_375[] = { "SmallInteger", "Proxy" };
+static const char          *signature_375[] = { "Behavior", "Behavior", "ByteArray" };
 static const char          *errors_375[]    = { nullptr };
 static PrimitiveDescriptor primitive_375    = {
-    "primitiveProxyGetLow", primitiveFunctionType( &ProxyOopPrimitives::getLow ), 1114113, signature_375, errors_375
+    "primitivePrintMethod:ifFail:", primitiveFunctionType( &BehaviorPrimitives::printMethod ), 1376258, signature_375, errors_375
 };
 
-static const char          *signature_376[] = { "Boolean", "Proxy" };
-static const char          *errors_376[]    = { nullptr };
+static const char          *signature_376[] = { "Object", "Object", "Symbol" };
+static const char          *errors_376[]    = { "NotFound", nullptr };
 static PrimitiveDescriptor primitive_376    = {
-    "primitiveProxyIsAllOnes", primitiveFunctionType( &ProxyOopPrimitives::isAllOnes ), 1114113, signature_376, errors_376
+    "primitivePrintMethodCodes:ifFail:", primitiveFunctionType( &DebugPrimitives::printMethodCodes ), 1376258, signature_376, errors_376
 };
 
-static const char          *signature_377[] = { "Boolean", "Proxy" };
+static const char          *signature_377[] = { "Object", "SmallInteger" };
 static const char          *errors_377[]    = { nullptr };
 static PrimitiveDescriptor primitive_377    = {
-    "primitiveProxyIsNull", primitiveFunctionType( &ProxyOopPrimitives::isNull ), 1114113, signature_377, errors_377
+    "primitivePrintNativeMethodCounterHistogram:ifFail:", primitiveFunctionType( &DebugPrimitives::printNativeMethodCounterHistogram ), 327681, signature_377, errors_377
 };
 
-static const char          *signature_378[] = { "Self", "Proxy", "SmallInteger" };
+static const char          *signature_378[] = { "Object" };
 static const char          *errors_378[]    = { nullptr };
 static PrimitiveDescriptor primitive_378    = {
-    "primitiveProxyMalloc:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::malloc ), 1376258, signature_378, errors_378
+    "primitivePrintObjectHistogram", primitiveFunctionType( &DebugPrimitives::printObjectHistogram ), 65536, signature_378, errors_378
 };
 
-static const char          *signature_379[] = { "Proxy", "Proxy", "SmallInteger", "Proxy" };
+static const char          *signature_379[] = { "Object" };
 static const char          *errors_379[]    = { nullptr };
 static PrimitiveDescriptor primitive_379    = {
-    "primitiveProxyProxyAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::proxyAtPut ), 1376259, signature_379, errors_379
+    "primitivePrintPrimitiveCounters", primitiveFunctionType( &DebugPrimitives::printPrimitiveCounters ), 65536, signature_379, errors_379
 };
 
-static const char          *signature_380[] = { "Proxy", "Proxy", "SmallInteger", "Proxy" };
+static const char          *signature_380[] = { "Object" };
 static const char          *errors_380[]    = { nullptr };
 static PrimitiveDescriptor primitive_380    = {
-    "primitiveProxyProxyAt:result:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::proxyAt ), 1376259, signature_380, errors_380
+    "primitivePrintPrimitiveTable", primitiveFunctionType( &SystemPrimitives::printPrimitiveTable ), 65536, signature_380, errors_380
 };
 
-static const char          *signature_381[] = { "Self", "Proxy", "SmallInteger|Proxy" };
+static const char          *signature_381[] = { "Self", "Object" };
 static const char          *errors_381[]    = { nullptr };
 static PrimitiveDescriptor primitive_381    = {
-    "primitiveProxySet:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::set ), 1376258, signature_381, errors_381
+    "primitivePrintValue", primitiveFunctionType( &OopPrimitives::printValue ), 1114113, signature_381, errors_381
 };
 
-static const char          *signature_382[] = { "Self", "Proxy", "SmallInteger", "SmallInteger" };
+static const char          *signature_382[] = { "Object" };
 static const char          *errors_382[]    = { nullptr };
 static PrimitiveDescriptor primitive_382    = {
-    "primitiveProxySetHigh:low:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::setHighLow ), 1376259, signature_382, errors_382
+    "primitivePrintZone", primitiveFunctionType( &SystemPrimitives::print_zone ), 65536, signature_382, errors_382
 };
 
-static const char          *signature_383[] = { "Float", "Proxy", "SmallInteger" };
+static const char          *signature_383[] = { "Object" };
 static const char          *errors_383[]    = { nullptr };
 static PrimitiveDescriptor primitive_383    = {
-    "primitiveProxySinglePrecisionFloatAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::singlePrecisionFloatAt ), 1376258, signature_383, errors_383
+    "primitiveProcessActiveProcess", primitiveFunctionType( &ProcessOopPrimitives::activeProcess ), 65536, signature_383, errors_383
 };
 
-static const char          *signature_384[] = { "Self", "Proxy", "SmallInteger", "Float" };
-static const char          *errors_384[]    = { "ConversionFailed", nullptr };
+static const char          *signature_384[] = { "IndexedInstanceVariables" };
+static const char          *errors_384[]    = { nullptr };
 static PrimitiveDescriptor primitive_384    = {
-    "primitiveProxySinglePrecisionFloatAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::singlePrecisionFloatAtPut ), 1376259, signature_384, errors_384
+    "primitiveProcessCompletedAsyncCalls", primitiveFunctionType( &ProcessOopPrimitives::completed_async_calls ), 65536, signature_384, errors_384
 };
 
-static const char          *signature_385[] = { "SmallInteger", "Proxy", "SmallInteger" };
-static const char          *errors_385[]    = { "ConversionFailed", nullptr };
+static const char          *signature_385[] = { "Process", "Process class", "BlockWithoutArguments" };
+static const char          *errors_385[]    = { "ProcessAllocationFailed", nullptr };
 static PrimitiveDescriptor primitive_385    = {
-    "primitiveProxySmiAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::smiAt ), 1376258, signature_385, errors_385
+    "primitiveProcessCreate:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::create ), 1376258, signature_385, errors_385
 };
 
-static const char          *signature_386[] = { "SmallInteger", "Proxy", "SmallInteger", "SmallInteger" };
+static const char          *signature_386[] = { "Process" };
 static const char          *errors_386[]    = { nullptr };
 static PrimitiveDescriptor primitive_386    = {
-    "primitiveProxySmiAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::smiAtPut ), 1376259, signature_386, errors_386
+    "primitiveProcessEnterCritical", primitiveFunctionType( &ProcessOopPrimitives::enter_critical ), 65536, signature_386, errors_386
 };
 
-static const char          *signature_387[] = { "Proxy", "Proxy", "SmallInteger", "Proxy" };
+static const char          *signature_387[] = { "Process" };
 static const char          *errors_387[]    = { nullptr };
 static PrimitiveDescriptor primitive_387    = {
-    "primitiveProxySubProxyAt:result:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::subProxyAt ), 1376259, signature_387, errors_387
+    "primitiveProcessLeaveCritical", primitiveFunctionType( &ProcessOopPrimitives::leave_critical ), 65536, signature_387, errors_387
 };
 
-static const char          *signature_388[] = { "BottomType" };
+static const char          *signature_388[] = { "Boolean", "Process", "SmallInteger" };
 static const char          *errors_388[]    = { nullptr };
 static PrimitiveDescriptor primitive_388    = {
-    "primitiveQuit", primitiveFunctionType( &SystemPrimitives::quit ), 65536, signature_388, errors_388
+    "primitiveProcessSchedulerWait:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::scheduler_wait ), 1376258, signature_388, errors_388
 };
 
-static const char          *signature_389[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
-static const char          *errors_389[]    = { "NotImplementedYet", nullptr };
+static const char          *signature_389[] = { "Symbol", "Process", "Symbol", "Activation", "Object" };
+static const char          *errors_389[]    = { "InScheduler", "Dead", nullptr };
 static PrimitiveDescriptor primitive_389    = {
-    "primitiveQuo:ifFail:", primitiveFunctionType( &smiOopPrimitives_quo ), 6029826, signature_389, errors_389
+    "primitiveProcessSetMode:activation:returnValue:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::set_mode ), 1376260, signature_389, errors_389
 };
 
-static const char          *signature_390[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *signature_390[] = { "IndexedInstanceVariables", "Process", "SmallInteger" };
 static const char          *errors_390[]    = { nullptr };
 static PrimitiveDescriptor primitive_390    = {
-    "primitiveRawBitShift:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::rawBitShift ), 6029826, signature_390, errors_390
+    "primitiveProcessStackLimit:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::stack ), 1376258, signature_390, errors_390
 };
 
 static const char          *signature_391[] = { "Object", "Process" };
-static const char          *errors_391[]    = { nullptr };
+static const char          *errors_391[]    = { "NotInScheduler", "ProcessCannotContinue", "Dead", nullptr };
 static PrimitiveDescriptor primitive_391    = {
-    "primitiveRecordMainProcessIfFail:", primitiveFunctionType( &ProcessOopPrimitives::setMainProcess ), 1376257, signature_391, errors_391
+    "primitiveProcessStartEvaluator:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::start_evaluator ), 327681, signature_391, errors_391
 };
 
-static const char          *signature_392[] = { "IndexedInstanceVariables", "Object", "SmallInteger" };
+static const char          *signature_392[] = { "Symbol", "Process" };
 static const char          *errors_392[]    = { nullptr };
 static PrimitiveDescriptor primitive_392    = {
-    "primitiveReferencesTo:limit:ifFail:", primitiveFunctionType( &SystemPrimitives::references_to ), 327682, signature_392, errors_392
+    "primitiveProcessStatus", primitiveFunctionType( &ProcessOopPrimitives::status ), 1114113, signature_392, errors_392
 };
 
-static const char          *signature_393[] = { "IndexedInstanceVariables", "Class", "SmallInteger" };
+static const char          *signature_393[] = { "Process" };
 static const char          *errors_393[]    = { nullptr };
 static PrimitiveDescriptor primitive_393    = {
-    "primitiveReferencesToInstancesOf:limit:ifFail:", primitiveFunctionType( &SystemPrimitives::references_to_instances_of ), 327682, signature_393, errors_393
+    "primitiveProcessStop", primitiveFunctionType( &ProcessOopPrimitives::stop ), 65536, signature_393, errors_393
 };
 
-static const char          *signature_394[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
-static const char          *errors_394[]    = { "DivisionByZero", nullptr };
+static const char          *signature_394[] = { "Float", "Process" };
+static const char          *errors_394[]    = { nullptr };
 static PrimitiveDescriptor primitive_394    = {
-    "primitiveRemainder:ifFail:", primitiveFunctionType( &smiOopPrimitives_remainder ), 6029826, signature_394, errors_394
+    "primitiveProcessSystemTime", primitiveFunctionType( &ProcessOopPrimitives::user_time ), 1114113, signature_394, errors_394
 };
 
-static const char          *signature_395[] = { "BottomType", "BlockWithoutArguments" };
-static const char          *errors_395[]    = { nullptr };
+static const char          *signature_395[] = { "Self", "Process" };
+static const char          *errors_395[]    = { "Dead", nullptr };
 static PrimitiveDescriptor primitive_395    = {
-    "primitiveRepeat", primitiveFunctionType( &blockRepeat ), 1245185, signature_395, errors_395
+    "primitiveProcessTerminateIfFail:", primitiveFunctionType( &ProcessOopPrimitives::terminate ), 1507329, signature_395, errors_395
 };
 
-static const char          *signature_396[] = { "Self", "Object" };
+static const char          *signature_396[] = { "Self", "Process", "SmallInteger" };
 static const char          *errors_396[]    = { nullptr };
 static PrimitiveDescriptor primitive_396    = {
-    "primitiveScavenge", primitiveFunctionType( &SystemPrimitives::scavenge ), 1114113, signature_396, errors_396
+    "primitiveProcessTraceStack:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::trace_stack ), 1376258, signature_396, errors_396
 };
 
-static const char          *signature_397[] = { "Object", "SmallInteger" };
-static const char          *errors_397[]    = { nullptr };
+static const char          *signature_397[] = { "Object", "Process" };
+static const char          *errors_397[]    = { "NotInScheduler", "ProcessCannotContinue", "Dead", nullptr };
 static PrimitiveDescriptor primitive_397    = {
-    "primitiveSetInterpreterInvocationCounterLimitTo:ifFail:", primitiveFunctionType( &DebugPrimitives::setInterpreterInvocationCounterLimit ), 327681, signature_397, errors_397
+    "primitiveProcessTransferTo:ifFail:", primitiveFunctionType( &ProcessOopPrimitives::transferTo ), 327681, signature_397, errors_397
 };
 
-static const char          *signature_398[] = { "Behavior", "Behavior", "Behavior" };
-static const char          *errors_398[]    = { "NotAClass", nullptr };
+static const char          *signature_398[] = { "Float", "Process" };
+static const char          *errors_398[]    = { nullptr };
 static PrimitiveDescriptor primitive_398    = {
-    "primitiveSetSuperclassOf:toClass:ifFail:", primitiveFunctionType( &BehaviorPrimitives::setSuperclass ), 327682, signature_398, errors_398
+    "primitiveProcessUserTime", primitiveFunctionType( &ProcessOopPrimitives::user_time ), 1114113, signature_398, errors_398
 };
 
-static const char          *signature_399[] = { "Object", "Object" };
-static const char          *errors_399[]    = { "ReceiverHasWrongType", nullptr };
+static const char          *signature_399[] = { "Process" };
+static const char          *errors_399[]    = { nullptr };
 static PrimitiveDescriptor primitive_399    = {
-    "primitiveShallowCopyIfFail:", primitiveFunctionType( &OopPrimitives::shallowCopy ), 1376257, signature_399, errors_399
+    "primitiveProcessYield", primitiveFunctionType( &ProcessOopPrimitives::yield ), 65536, signature_399, errors_399
 };
 
-static const char          *signature_400[] = { "Object", "SmallInteger" };
+static const char          *signature_400[] = { "Process" };
 static const char          *errors_400[]    = { nullptr };
 static PrimitiveDescriptor primitive_400    = {
-    "primitiveShrinkMemory:", primitiveFunctionType( &SystemPrimitives::shrinkMemory ), 65537, signature_400, errors_400
+    "primitiveProcessYieldInCritical", primitiveFunctionType( &ProcessOopPrimitives::yield_in_critical ), 65536, signature_400, errors_400
 };
 
-static const char          *signature_401[] = { "SmallInteger" };
+static const char          *signature_401[] = { "SmallInteger", "Proxy", "SmallInteger" };
 static const char          *errors_401[]    = { nullptr };
 static PrimitiveDescriptor primitive_401    = {
-    "primitiveSizeOfOop", primitiveFunctionType( &SystemPrimitives::oopSize ), 65536, signature_401, errors_401
+    "primitiveProxyByteAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::byteAt ), 5570562, signature_401, errors_401
 };
 
-static const char          *signature_402[] = { "IndexedInstanceVariables" };
+static const char          *signature_402[] = { "SmallInteger", "Proxy", "SmallInteger", "SmallInteger" };
 static const char          *errors_402[]    = { nullptr };
 static PrimitiveDescriptor primitive_402    = {
-    "primitiveSlidingSystemAverageIfFail:", primitiveFunctionType( &SystemPrimitives::sliding_system_average ), 327680, signature_402, errors_402
+    "primitiveProxyByteAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::byteAtPut ), 5570563, signature_402, errors_402
 };
 
-static const char          *signature_403[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *signature_403[] = { "Self", "Proxy", "SmallInteger" };
 static const char          *errors_403[]    = { nullptr };
 static PrimitiveDescriptor primitive_403    = {
-    "primitiveSmallIntegerEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::equal ), 6029570, signature_403, errors_403
+    "primitiveProxyCalloc:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::calloc ), 1376258, signature_403, errors_403
 };
 
-static const char          *signature_404[] = { "SmallInteger", "Symbol" };
-static const char          *errors_404[]    = { "NotFound", nullptr };
+static const char          *signature_404[] = { "SmallInteger", "Proxy", "SmallInteger" };
+static const char          *errors_404[]    = { nullptr };
 static PrimitiveDescriptor primitive_404    = {
-    "primitiveSmallIntegerFlagAt:ifFail:", primitiveFunctionType( &DebugPrimitives::smiAt ), 327681, signature_404, errors_404
+    "primitiveProxyDoubleByteAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doubleByteAt ), 1376258, signature_404, errors_404
 };
 
-static const char          *signature_405[] = { "Boolean", "Symbol", "Boolean" };
-static const char          *errors_405[]    = { "NotFound", nullptr };
+static const char          *signature_405[] = { "SmallInteger", "Proxy", "SmallInteger", "SmallInteger" };
+static const char          *errors_405[]    = { nullptr };
 static PrimitiveDescriptor primitive_405    = {
-    "primitiveSmallIntegerFlagAt:put:ifFail:", primitiveFunctionType( &DebugPrimitives::smiAtPut ), 327682, signature_405, errors_405
+    "primitiveProxyDoubleByteAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doubleByteAtPut ), 1376259, signature_405, errors_405
 };
 
-static const char          *signature_406[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *signature_406[] = { "Float", "Proxy", "SmallInteger" };
 static const char          *errors_406[]    = { nullptr };
 static PrimitiveDescriptor primitive_406    = {
-    "primitiveSmallIntegerNotEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::notEqual ), 6029570, signature_406, errors_406
+    "primitiveProxyDoublePrecisionFloatAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doublePrecisionFloatAt ), 1376258, signature_406, errors_406
 };
 
-static const char          *signature_407[] = { "IndexedInstanceVariables" };
-static const char          *errors_407[]    = { nullptr };
+static const char          *signature_407[] = { "Self", "Proxy", "SmallInteger", "Float" };
+static const char          *errors_407[]    = { "ConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_407    = {
-    "primitiveSmalltalkArray", primitiveFunctionType( &SystemPrimitives::smalltalk_array ), 65536, signature_407, errors_407
+    "primitiveProxyDoublePrecisionFloatAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::doublePrecisionFloatAtPut ), 1376259, signature_407, errors_407
 };
 
-static const char          *signature_408[] = { "GlobalAssociation", "Symbol", "Object" };
+static const char          *signature_408[] = { "Self", "Proxy" };
 static const char          *errors_408[]    = { nullptr };
 static PrimitiveDescriptor primitive_408    = {
-    "primitiveSmalltalkAt:Put:ifFail:", primitiveFunctionType( &SystemPrimitives::smalltalk_at_put ), 327682, signature_408, errors_408
+    "primitiveProxyFree", primitiveFunctionType( &ProxyOopPrimitives::free ), 1114113, signature_408, errors_408
 };
 
-static const char          *signature_409[] = { "GlobalAssociation", "SmallInteger" };
-static const char          *errors_409[]    = { "OutOfBounds", nullptr };
+static const char          *signature_409[] = { "SmallInteger", "Proxy" };
+static const char          *errors_409[]    = { nullptr };
 static PrimitiveDescriptor primitive_409    = {
-    "primitiveSmalltalkAt:ifFail:", primitiveFunctionType( &SystemPrimitives::smalltalk_at ), 327681, signature_409, errors_409
+    "primitiveProxyGetHigh", primitiveFunctionType( &ProxyOopPrimitives::getHigh ), 1114113, signature_409, errors_409
 };
 
-static const char          *signature_410[] = { "GlobalAssociation", "SmallInteger" };
-static const char          *errors_410[]    = { nullptr };
+static const char          *signature_410[] = { "SmallInteger", "Proxy" };
+static const char          *errors_410[]    = { "ConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_410    = {
-    "primitiveSmalltalkRemoveAt:ifFail:", primitiveFunctionType( &SystemPrimitives::smalltalk_remove_at ), 327681, signature_410, errors_410
+    "primitiveProxyGetIfFail:", primitiveFunctionType( &ProxyOopPrimitives::getSmi ), 1376257, signature_410, errors_410
 };
 
-static const char          *signature_411[] = { "SmallInteger" };
+static const char          *signature_411[] = { "SmallInteger", "Proxy" };
 static const char          *errors_411[]    = { nullptr };
 static PrimitiveDescriptor primitive_411    = {
-    "primitiveSmalltalkSize", primitiveFunctionType( &SystemPrimitives::smalltalk_size ), 65536, signature_411, errors_411
+    "primitiveProxyGetLow", primitiveFunctionType( &ProxyOopPrimitives::getLow ), 1114113, signature_411, errors_411
 };
 
-static const char          *signature_412[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
-static const char          *errors_412[]    = { "Overflow", nullptr };
+static const char          *signature_412[] = { "Boolean", "Proxy" };
+static const char          *errors_412[]    = { nullptr };
 static PrimitiveDescriptor primitive_412    = {
-    "primitiveSubtract:ifFail:", primitiveFunctionType( &smiOopPrimitives_subtract ), 6029826, signature_412, errors_412
+    "primitiveProxyIsAllOnes", primitiveFunctionType( &ProxyOopPrimitives::isAllOnes ), 1114113, signature_412, errors_412
 };
 
-static const char          *signature_413[] = { "Behavior|Nil", "Behavior" };
+static const char          *signature_413[] = { "Boolean", "Proxy" };
 static const char          *errors_413[]    = { nullptr };
 static PrimitiveDescriptor primitive_413    = {
-    "primitiveSuperclass", primitiveFunctionType( &BehaviorPrimitives::superclass ), 1114113, signature_413, errors_413
+    "primitiveProxyIsNull", primitiveFunctionType( &ProxyOopPrimitives::isNull ), 1114113, signature_413, errors_413
 };
 
-static const char          *signature_414[] = { "Behavior|Nil", "Behavior" };
+static const char          *signature_414[] = { "Self", "Proxy", "SmallInteger" };
 static const char          *errors_414[]    = { nullptr };
 static PrimitiveDescriptor primitive_414    = {
-    "primitiveSuperclassOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::superclass_of ), 327681, signature_414, errors_414
+    "primitiveProxyMalloc:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::malloc ), 1376258, signature_414, errors_414
 };
 
-static const char          *signature_415[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *signature_415[] = { "Proxy", "Proxy", "SmallInteger", "Proxy" };
 static const char          *errors_415[]    = { nullptr };
 static PrimitiveDescriptor primitive_415    = {
-    "primitiveSymbolNumberOfArguments", primitiveFunctionType( &ByteArrayPrimitives::numberOfArguments ), 1574401, signature_415, errors_415
+    "primitiveProxyProxyAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::proxyAtPut ), 1376259, signature_415, errors_415
 };
 
-static const char          *signature_416[] = { "Float" };
+static const char          *signature_416[] = { "Proxy", "Proxy", "SmallInteger", "Proxy" };
 static const char          *errors_416[]    = { nullptr };
 static PrimitiveDescriptor primitive_416    = {
-    "primitiveSystemTime", primitiveFunctionType( &SystemPrimitives::systemTime ), 65536, signature_416, errors_416
+    "primitiveProxyProxyAt:result:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::proxyAt ), 1376259, signature_416, errors_416
 };
 
-static const char          *signature_417[] = { "Object" };
+static const char          *signature_417[] = { "Self", "Proxy", "SmallInteger|Proxy" };
 static const char          *errors_417[]    = { nullptr };
 static PrimitiveDescriptor primitive_417    = {
-    "primitiveTimerPrintBuffer", primitiveFunctionType( &DebugPrimitives::timerPrintBuffer ), 65536, signature_417, errors_417
+    "primitiveProxySet:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::set ), 1376258, signature_417, errors_417
 };
 
-static const char          *signature_418[] = { "Object" };
+static const char          *signature_418[] = { "Self", "Proxy", "SmallInteger", "SmallInteger" };
 static const char          *errors_418[]    = { nullptr };
 static PrimitiveDescriptor primitive_418    = {
-    "primitiveTimerStart", primitiveFunctionType( &DebugPrimitives::timerStart ), 65536, signature_418, errors_418
+    "primitiveProxySetHigh:low:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::setHighLow ), 1376259, signature_418, errors_418
 };
 
-static const char          *signature_419[] = { "Object" };
+static const char          *signature_419[] = { "Float", "Proxy", "SmallInteger" };
 static const char          *errors_419[]    = { nullptr };
 static PrimitiveDescriptor primitive_419    = {
-    "primitiveTimerStop", primitiveFunctionType( &DebugPrimitives::timerStop ), 65536, signature_419, errors_419
+    "primitiveProxySinglePrecisionFloatAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::singlePrecisionFloatAt ), 1376258, signature_419, errors_419
 };
 
-static const char          *signature_420[] = { "Object" };
-static const char          *errors_420[]    = { nullptr };
+static const char          *signature_420[] = { "Self", "Proxy", "SmallInteger", "Float" };
+static const char          *errors_420[]    = { "ConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_420    = {
-    "primitiveTraceStack", primitiveFunctionType( &SystemPrimitives::traceStack ), 65536, signature_420, errors_420
+    "primitiveProxySinglePrecisionFloatAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::singlePrecisionFloatAtPut ), 1376259, signature_420, errors_420
 };
 
-static const char          *signature_421[] = { "Object", "BlockWithoutArguments", "BlockWithoutArguments" };
-static const char          *errors_421[]    = { nullptr };
+static const char          *signature_421[] = { "SmallInteger", "Proxy", "SmallInteger" };
+static const char          *errors_421[]    = { "ConversionFailed", nullptr };
 static PrimitiveDescriptor primitive_421    = {
-    "primitiveUnwindProtect:ifFail:", primitiveFunctionType( &unwindprotect ), 1507330, signature_421, errors_421
+    "primitiveProxySmiAt:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::smiAt ), 1376258, signature_421, errors_421
 };
 
-static const char          *signature_422[] = { "Float" };
+static const char          *signature_422[] = { "SmallInteger", "Proxy", "SmallInteger", "SmallInteger" };
 static const char          *errors_422[]    = { nullptr };
 static PrimitiveDescriptor primitive_422    = {
-    "primitiveUserTime", primitiveFunctionType( &SystemPrimitives::userTime ), 65536, signature_422, errors_422
+    "primitiveProxySmiAt:put:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::smiAtPut ), 1376259, signature_422, errors_422
 };
 
-static const char          *signature_423[] = { "Object" };
+static const char          *signature_423[] = { "Proxy", "Proxy", "SmallInteger", "Proxy" };
 static const char          *errors_423[]    = { nullptr };
 static PrimitiveDescriptor primitive_423    = {
-    "primitiveVMBreakpoint", primitiveFunctionType( &SystemPrimitives::vmbreakpoint ), 65536, signature_423, errors_423
+    "primitiveProxySubProxyAt:result:ifFail:", primitiveFunctionType( &ProxyOopPrimitives::subProxyAt ), 1376259, signature_423, errors_423
 };
 
-static const char          *signature_424[] = { "Object", "BlockWithoutArguments" };
+static const char          *signature_424[] = { "BottomType" };
 static const char          *errors_424[]    = { nullptr };
 static PrimitiveDescriptor primitive_424    = {
-    "primitiveValue", primitiveFunctionType( &primitiveValue0 ), 5441537, signature_424, errors_424
+    "primitiveQuit", primitiveFunctionType( &SystemPrimitives::quit ), 65536, signature_424, errors_424
 };
 
-static const char          *signature_425[] = { "Object", "BlockWithOneArgument", "Object" };
-static const char          *errors_425[]    = { nullptr };
+static const char          *signature_425[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_425[]    = { "NotImplementedYet", nullptr };
 static PrimitiveDescriptor primitive_425    = {
-    "primitiveValue:", primitiveFunctionType( &primitiveValue1 ), 5441538, signature_425, errors_425
+    "primitiveQuo:ifFail:", primitiveFunctionType( &smiOopPrimitives_quo ), 6029826, signature_425, errors_425
 };
 
-static const char          *signature_426[] = { "Object", "BlockWithTwoArguments", "Object", "Object" };
+static const char          *signature_426[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
 static const char          *errors_426[]    = { nullptr };
 static PrimitiveDescriptor primitive_426    = {
-    "primitiveValue:value:", primitiveFunctionType( &primitiveValue2 ), 5441539, signature_426, errors_426
+    "primitiveRawBitShift:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::rawBitShift ), 6029826, signature_426, errors_426
 };
 
-static const char          *signature_427[] = { "Object", "BlockWithThreeArguments", "Object", "Object", "Object" };
+static const char          *signature_427[] = { "Object", "Process" };
 static const char          *errors_427[]    = { nullptr };
 static PrimitiveDescriptor primitive_427    = {
-    "primitiveValue:value:value:", primitiveFunctionType( &primitiveValue3 ), 5441540, signature_427, errors_427
+    "primitiveRecordMainProcessIfFail:", primitiveFunctionType( &ProcessOopPrimitives::setMainProcess ), 1376257, signature_427, errors_427
 };
 
-static const char          *signature_428[] = { "Object", "BlockWithFourArguments", "Object", "Object", "Object", "Object" };
+static const char          *signature_428[] = { "IndexedInstanceVariables", "Object", "SmallInteger" };
 static const char          *errors_428[]    = { nullptr };
 static PrimitiveDescriptor primitive_428    = {
-    "primitiveValue:value:value:value:", primitiveFunctionType( &primitiveValue4 ), 5441541, signature_428, errors_428
+    "primitiveReferencesTo:limit:ifFail:", primitiveFunctionType( &SystemPrimitives::references_to ), 327682, signature_428, errors_428
 };
 
-static const char          *signature_429[] = { "Object", "BlockWithFiveArguments", "Object", "Object", "Object", "Object", "Object" };
+static const char          *signature_429[] = { "IndexedInstanceVariables", "Class", "SmallInteger" };
 static const char          *errors_429[]    = { nullptr };
 static PrimitiveDescriptor primitive_429    = {
-    "primitiveValue:value:value:value:value:", primitiveFunctionType( &primitiveValue5 ), 5441542, signature_429, errors_429
+    "primitiveReferencesToInstancesOf:limit:ifFail:", primitiveFunctionType( &SystemPrimitives::references_to_instances_of ), 327682, signature_429, errors_429
 };
 
-static const char          *signature_430[] = { "Object", "BlockWithSixArguments", "Object", "Object", "Object", "Object", "Object", "Object" };
-static const char          *errors_430[]    = { nullptr };
+static const char          *signature_430[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_430[]    = { "DivisionByZero", nullptr };
 static PrimitiveDescriptor primitive_430    = {
-    "primitiveValue:value:value:value:value:value:", primitiveFunctionType( &primitiveValue6 ), 5441543, signature_430, errors_430
+    "primitiveRemainder:ifFail:", primitiveFunctionType( &smiOopPrimitives_remainder ), 6029826, signature_430, errors_430
 };
 
-static const char          *signature_431[] = { "Object", "BlockWithSevenArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object" };
+static const char          *signature_431[] = { "BottomType", "BlockWithoutArguments" };
 static const char          *errors_431[]    = { nullptr };
 static PrimitiveDescriptor primitive_431    = {
-    "primitiveValue:value:value:value:value:value:value:", primitiveFunctionType( &primitiveValue7 ), 5441544, signature_431, errors_431
+    "primitiveRepeat", primitiveFunctionType( &blockRepeat ), 1245185, signature_431, errors_431
 };
 
-static const char          *signature_432[] = { "Object", "BlockWithEightArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object" };
+static const char          *signature_432[] = { "Self", "Object" };
 static const char          *errors_432[]    = { nullptr };
 static PrimitiveDescriptor primitive_432    = {
-    "primitiveValue:value:value:value:value:value:value:value:", primitiveFunctionType( &primitiveValue8 ), 5441545, signature_432, errors_432
+    "primitiveScavenge", primitiveFunctionType( &SystemPrimitives::scavenge ), 1114113, signature_432, errors_432
 };
 
-static const char          *signature_433[] = { "Object", "BlockWithNineArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object" };
+static const char          *signature_433[] = { "Object", "SmallInteger" };
 static const char          *errors_433[]    = { nullptr };
 static PrimitiveDescriptor primitive_433    = {
-    "primitiveValue:value:value:value:value:value:value:value:value:", primitiveFunctionType( &primitiveValue9 ), 5441546, signature_433, errors_433
+    "primitiveSetInterpreterInvocationCounterLimitTo:ifFail:", primitiveFunctionType( &DebugPrimitives::setInterpreterInvocationCounterLimit ), 327681, signature_433, errors_433
 };
 
-static const char          *signature_434[] = { "Object" };
-static const char          *errors_434[]    = { nullptr };
+static const char          *signature_434[] = { "Behavior", "Behavior", "Behavior" };
+static const char          *errors_434[]    = { "NotAClass", nullptr };
 static PrimitiveDescriptor primitive_434    = {
-    "primitiveVerify", primitiveFunctionType( &DebugPrimitives::verify ), 65536, signature_434, errors_434
+    "primitiveSetSuperclassOf:toClass:ifFail:", primitiveFunctionType( &BehaviorPrimitives::setSuperclass ), 327682, signature_434, errors_434
 };
 
-static const char          *signature_435[] = { "Proxy", "Proxy" };
-static const char          *errors_435[]    = { nullptr };
+static const char          *signature_435[] = { "Object", "Object" };
+static const char          *errors_435[]    = { "ReceiverHasWrongType", nullptr };
 static PrimitiveDescriptor primitive_435    = {
-    "primitiveWindowsHInstance:ifFail:", primitiveFunctionType( &SystemPrimitives::windowsHInstance ), 327681, signature_435, errors_435
+    "primitiveShallowCopyIfFail:", primitiveFunctionType( &OopPrimitives::shallowCopy ), 1376257, signature_435, errors_435
 };
 
-static const char          *signature_436[] = { "Proxy", "Proxy" };
+static const char          *signature_436[] = { "Object", "SmallInteger" };
 static const char          *errors_436[]    = { nullptr };
 static PrimitiveDescriptor primitive_436    = {
-    "primitiveWindowsHPrevInstance:ifFail:", primitiveFunctionType( &SystemPrimitives::windowsHPrevInstance ), 327681, signature_436, errors_436
+    "primitiveShrinkMemory:", primitiveFunctionType( &SystemPrimitives::shrinkMemory ), 65537, signature_436, errors_436
 };
 
-static const char          *signature_437[] = { "Object" };
+static const char          *signature_437[] = { "SmallInteger" };
 static const char          *errors_437[]    = { nullptr };
 static PrimitiveDescriptor primitive_437    = {
-    "primitiveWindowsNCmdShow", primitiveFunctionType( &SystemPrimitives::windowsNCmdShow ), 65536, signature_437, errors_437
+    "primitiveSizeOfOop", primitiveFunctionType( &SystemPrimitives::oopSize ), 65536, signature_437, errors_437
 };
 
-static const char          *signature_438[] = { "Object", "String" };
+static const char          *signature_438[] = { "IndexedInstanceVariables" };
 static const char          *errors_438[]    = { nullptr };
 static PrimitiveDescriptor primitive_438    = {
-    "primitiveWriteSnapshot:", primitiveFunctionType( &SystemPrimitives::writeSnapshot ), 65537, signature_438, errors_438
+    "primitiveSlidingSystemAverageIfFail:", primitiveFunctionType( &SystemPrimitives::sliding_system_average ), 327680, signature_438, errors_438
+};
+
+static const char          *signature_439[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *errors_439[]    = { nullptr };
+static PrimitiveDescriptor primitive_439    = {
+    "primitiveSmallIntegerEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::equal ), 6029570, signature_439, errors_439
+};
+
+static const char          *signature_440[] = { "SmallInteger", "Symbol" };
+static const char          *errors_440[]    = { "NotFound", nullptr };
+static PrimitiveDescriptor primitive_440    = {
+    "primitiveSmallIntegerFlagAt:ifFail:", primitiveFunctionType( &DebugPrimitives::smiAt ), 327681, signature_440, errors_440
+};
+
+static const char          *signature_441[] = { "Boolean", "Symbol", "Boolean" };
+static const char          *errors_441[]    = { "NotFound", nullptr };
+static PrimitiveDescriptor primitive_441    = {
+    "primitiveSmallIntegerFlagAt:put:ifFail:", primitiveFunctionType( &DebugPrimitives::smiAtPut ), 327682, signature_441, errors_441
+};
+
+static const char          *signature_442[] = { "Boolean", "SmallInteger", "SmallInteger" };
+static const char          *errors_442[]    = { nullptr };
+static PrimitiveDescriptor primitive_442    = {
+    "primitiveSmallIntegerNotEqual:ifFail:", primitiveFunctionType( &SmallIntegerOopPrimitives::notEqual ), 6029570, signature_442, errors_442
+};
+
+static const char          *signature_443[] = { "IndexedInstanceVariables" };
+static const char          *errors_443[]    = { nullptr };
+static PrimitiveDescriptor primitive_443    = {
+    "primitiveSmalltalkArray", primitiveFunctionType( &SystemPrimitives::smalltalk_array ), 65536, signature_443, errors_443
+};
+
+static const char          *signature_444[] = { "GlobalAssociation", "Symbol", "Object" };
+static const char          *errors_444[]    = { nullptr };
+static PrimitiveDescriptor primitive_444    = {
+    "primitiveSmalltalkAt:Put:ifFail:", primitiveFunctionType( &SystemPrimitives::smalltalk_at_put ), 327682, signature_444, errors_444
+};
+
+static const char          *signature_445[] = { "GlobalAssociation", "SmallInteger" };
+static const char          *errors_445[]    = { "OutOfBounds", nullptr };
+static PrimitiveDescriptor primitive_445    = {
+    "primitiveSmalltalkAt:ifFail:", primitiveFunctionType( &SystemPrimitives::smalltalk_at ), 327681, signature_445, errors_445
+};
+
+static const char          *signature_446[] = { "GlobalAssociation", "SmallInteger" };
+static const char          *errors_446[]    = { nullptr };
+static PrimitiveDescriptor primitive_446    = {
+    "primitiveSmalltalkRemoveAt:ifFail:", primitiveFunctionType( &SystemPrimitives::smalltalk_remove_at ), 327681, signature_446, errors_446
+};
+
+static const char          *signature_447[] = { "SmallInteger" };
+static const char          *errors_447[]    = { nullptr };
+static PrimitiveDescriptor primitive_447    = {
+    "primitiveSmalltalkSize", primitiveFunctionType( &SystemPrimitives::smalltalk_size ), 65536, signature_447, errors_447
+};
+
+static const char          *signature_448[] = { "SmallInteger" };
+static const char          *errors_448[]    = { nullptr };
+static PrimitiveDescriptor primitive_448    = {
+    "primitiveStringHashVersion", primitiveFunctionType( &SystemPrimitives::stringHashVersion ), 65536, signature_448, errors_448
+};
+
+static const char          *signature_449[] = { "SmallInteger", "SmallInteger", "SmallInteger" };
+static const char          *errors_449[]    = { "Overflow", nullptr };
+static PrimitiveDescriptor primitive_449    = {
+    "primitiveSubtract:ifFail:", primitiveFunctionType( &smiOopPrimitives_subtract ), 6029826, signature_449, errors_449
+};
+
+static const char          *signature_450[] = { "Behavior|Nil", "Behavior" };
+static const char          *errors_450[]    = { nullptr };
+static PrimitiveDescriptor primitive_450    = {
+    "primitiveSuperclass", primitiveFunctionType( &BehaviorPrimitives::superclass ), 1114113, signature_450, errors_450
+};
+
+static const char          *signature_451[] = { "Behavior|Nil", "Behavior" };
+static const char          *errors_451[]    = { nullptr };
+static PrimitiveDescriptor primitive_451    = {
+    "primitiveSuperclassOf:ifFail:", primitiveFunctionType( &BehaviorPrimitives::superclass_of ), 327681, signature_451, errors_451
+};
+
+static const char          *signature_452[] = { "SmallInteger", "IndexedByteInstanceVariables" };
+static const char          *errors_452[]    = { nullptr };
+static PrimitiveDescriptor primitive_452    = {
+    "primitiveSymbolNumberOfArguments", primitiveFunctionType( &ByteArrayPrimitives::numberOfArguments ), 1574401, signature_452, errors_452
+};
+
+static const char          *signature_453[] = { "Float" };
+static const char          *errors_453[]    = { nullptr };
+static PrimitiveDescriptor primitive_453    = {
+    "primitiveSystemTime", primitiveFunctionType( &SystemPrimitives::systemTime ), 65536, signature_453, errors_453
+};
+
+static const char          *signature_454[] = { "Object" };
+static const char          *errors_454[]    = { nullptr };
+static PrimitiveDescriptor primitive_454    = {
+    "primitiveTimerPrintBuffer", primitiveFunctionType( &DebugPrimitives::timerPrintBuffer ), 65536, signature_454, errors_454
+};
+
+static const char          *signature_455[] = { "Object" };
+static const char          *errors_455[]    = { nullptr };
+static PrimitiveDescriptor primitive_455    = {
+    "primitiveTimerStart", primitiveFunctionType( &DebugPrimitives::timerStart ), 65536, signature_455, errors_455
+};
+
+static const char          *signature_456[] = { "Object" };
+static const char          *errors_456[]    = { nullptr };
+static PrimitiveDescriptor primitive_456    = {
+    "primitiveTimerStop", primitiveFunctionType( &DebugPrimitives::timerStop ), 65536, signature_456, errors_456
+};
+
+static const char          *signature_457[] = { "Object" };
+static const char          *errors_457[]    = { nullptr };
+static PrimitiveDescriptor primitive_457    = {
+    "primitiveTraceStack", primitiveFunctionType( &SystemPrimitives::traceStack ), 65536, signature_457, errors_457
+};
+
+static const char          *signature_458[] = { "Object", "BlockWithoutArguments", "BlockWithoutArguments" };
+static const char          *errors_458[]    = { nullptr };
+static PrimitiveDescriptor primitive_458    = {
+    "primitiveUnwindProtect:ifFail:", primitiveFunctionType( &unwindprotect ), 1507330, signature_458, errors_458
+};
+
+static const char          *signature_459[] = { "Float" };
+static const char          *errors_459[]    = { nullptr };
+static PrimitiveDescriptor primitive_459    = {
+    "primitiveUserTime", primitiveFunctionType( &SystemPrimitives::userTime ), 65536, signature_459, errors_459
+};
+
+static const char          *signature_460[] = { "Object" };
+static const char          *errors_460[]    = { nullptr };
+static PrimitiveDescriptor primitive_460    = {
+    "primitiveVMBreakpoint", primitiveFunctionType( &SystemPrimitives::vmbreakpoint ), 65536, signature_460, errors_460
+};
+
+static const char          *signature_461[] = { "Object", "BlockWithoutArguments" };
+static const char          *errors_461[]    = { nullptr };
+static PrimitiveDescriptor primitive_461    = {
+    "primitiveValue", primitiveFunctionType( &primitiveValue0 ), 5441537, signature_461, errors_461
+};
+
+static const char          *signature_462[] = { "Object", "BlockWithOneArgument", "Object" };
+static const char          *errors_462[]    = { nullptr };
+static PrimitiveDescriptor primitive_462    = {
+    "primitiveValue:", primitiveFunctionType( &primitiveValue1 ), 5441538, signature_462, errors_462
+};
+
+static const char          *signature_463[] = { "Object", "BlockWithTwoArguments", "Object", "Object" };
+static const char          *errors_463[]    = { nullptr };
+static PrimitiveDescriptor primitive_463    = {
+    "primitiveValue:value:", primitiveFunctionType( &primitiveValue2 ), 5441539, signature_463, errors_463
+};
+
+static const char          *signature_464[] = { "Object", "BlockWithThreeArguments", "Object", "Object", "Object" };
+static const char          *errors_464[]    = { nullptr };
+static PrimitiveDescriptor primitive_464    = {
+    "primitiveValue:value:value:", primitiveFunctionType( &primitiveValue3 ), 5441540, signature_464, errors_464
+};
+
+static const char          *signature_465[] = { "Object", "BlockWithFourArguments", "Object", "Object", "Object", "Object" };
+static const char          *errors_465[]    = { nullptr };
+static PrimitiveDescriptor primitive_465    = {
+    "primitiveValue:value:value:value:", primitiveFunctionType( &primitiveValue4 ), 5441541, signature_465, errors_465
+};
+
+static const char          *signature_466[] = { "Object", "BlockWithFiveArguments", "Object", "Object", "Object", "Object", "Object" };
+static const char          *errors_466[]    = { nullptr };
+static PrimitiveDescriptor primitive_466    = {
+    "primitiveValue:value:value:value:value:", primitiveFunctionType( &primitiveValue5 ), 5441542, signature_466, errors_466
+};
+
+static const char          *signature_467[] = { "Object", "BlockWithSixArguments", "Object", "Object", "Object", "Object", "Object", "Object" };
+static const char          *errors_467[]    = { nullptr };
+static PrimitiveDescriptor primitive_467    = {
+    "primitiveValue:value:value:value:value:value:", primitiveFunctionType( &primitiveValue6 ), 5441543, signature_467, errors_467
+};
+
+static const char          *signature_468[] = { "Object", "BlockWithSevenArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object" };
+static const char          *errors_468[]    = { nullptr };
+static PrimitiveDescriptor primitive_468    = {
+    "primitiveValue:value:value:value:value:value:value:", primitiveFunctionType( &primitiveValue7 ), 5441544, signature_468, errors_468
+};
+
+static const char          *signature_469[] = { "Object", "BlockWithEightArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object" };
+static const char          *errors_469[]    = { nullptr };
+static PrimitiveDescriptor primitive_469    = {
+    "primitiveValue:value:value:value:value:value:value:value:", primitiveFunctionType( &primitiveValue8 ), 5441545, signature_469, errors_469
+};
+
+static const char          *signature_470[] = { "Object", "BlockWithNineArguments", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object", "Object" };
+static const char          *errors_470[]    = { nullptr };
+static PrimitiveDescriptor primitive_470    = {
+    "primitiveValue:value:value:value:value:value:value:value:value:", primitiveFunctionType( &primitiveValue9 ), 5441546, signature_470, errors_470
+};
+
+static const char          *signature_471[] = { "Object" };
+static const char          *errors_471[]    = { nullptr };
+static PrimitiveDescriptor primitive_471    = {
+    "primitiveVerify", primitiveFunctionType( &DebugPrimitives::verify ), 65536, signature_471, errors_471
+};
+
+static const char          *signature_472[] = { "Proxy", "Proxy" };
+static const char          *errors_472[]    = { nullptr };
+static PrimitiveDescriptor primitive_472    = {
+    "primitiveWindowsHInstance:ifFail:", primitiveFunctionType( &SystemPrimitives::windowsHInstance ), 327681, signature_472, errors_472
+};
+
+static const char          *signature_473[] = { "Proxy", "Proxy" };
+static const char          *errors_473[]    = { nullptr };
+static PrimitiveDescriptor primitive_473    = {
+    "primitiveWindowsHPrevInstance:ifFail:", primitiveFunctionType( &SystemPrimitives::windowsHPrevInstance ), 327681, signature_473, errors_473
+};
+
+static const char          *signature_474[] = { "Object" };
+static const char          *errors_474[]    = { nullptr };
+static PrimitiveDescriptor primitive_474    = {
+    "primitiveWindowsNCmdShow", primitiveFunctionType( &SystemPrimitives::windowsNCmdShow ), 65536, signature_474, errors_474
+};
+
+static const char          *signature_475[] = { "Object", "String" };
+static const char          *errors_475[]    = { nullptr };
+static PrimitiveDescriptor primitive_475    = {
+    "primitiveWriteSnapshot:", primitiveFunctionType( &SystemPrimitives::writeSnapshot ), 65537, signature_475, errors_475
 };
 
 PrimitiveDescriptor *primitive_table[] = {
@@ -3100,5 +3322,42 @@ PrimitiveDescriptor *primitive_table[] = {
     &primitive_435, \
     &primitive_436, \
     &primitive_437, \
-    &primitive_438
+    &primitive_438, \
+    &primitive_439, \
+    &primitive_440, \
+    &primitive_441, \
+    &primitive_442, \
+    &primitive_443, \
+    &primitive_444, \
+    &primitive_445, \
+    &primitive_446, \
+    &primitive_447, \
+    &primitive_448, \
+    &primitive_449, \
+    &primitive_450, \
+    &primitive_451, \
+    &primitive_452, \
+    &primitive_453, \
+    &primitive_454, \
+    &primitive_455, \
+    &primitive_456, \
+    &primitive_457, \
+    &primitive_458, \
+    &primitive_459, \
+    &primitive_460, \
+    &primitive_461, \
+    &primitive_462, \
+    &primitive_463, \
+    &primitive_464, \
+    &primitive_465, \
+    &primitive_466, \
+    &primitive_467, \
+    &primitive_468, \
+    &primitive_469, \
+    &primitive_470, \
+    &primitive_471, \
+    &primitive_472, \
+    &primitive_473, \
+    &primitive_474, \
+    &primitive_475
 };
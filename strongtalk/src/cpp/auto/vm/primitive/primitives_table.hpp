@@ -10,5 +10,5 @@
 #include "vm/primitive/PrimitiveDescriptor.hpp"
 
 
-constexpr std::int32_t     size_of_primitive_table = 439;
+constexpr std::int32_t     size_of_primitive_table = 476;
 extern PrimitiveDescriptor *primitive_table[];
@@ -19,10 +19,10 @@ MacroAssembler *theMacroAssembler = nullptr;
 
 CodeBuffer::CodeBuffer( std::int32_t instsSize, std::int32_t locsSize ) :
     _codeStart{ new_resource_array<char>( instsSize ) },
-    _codeEnd{ new_resource_array<char>( instsSize ) },
+    _codeEnd{ (char *) _codeStart },
     _codeOverflow{ _codeStart + instsSize },
     _locsStart{ (RelocationInformation *) new_resource_array<char>( locsSize ) },
-    _locsEnd{ (RelocationInformation *) new_resource_array<char>( locsSize ) },
+    _locsEnd{ _locsStart },
     _locsOverflow{ (RelocationInformation *) ( (const char *) _locsStart + locsSize ) },
     _last_reloc_offset{ code_size() },
     _decode_begin{ nullptr } {
@@ -72,6 +72,21 @@ void CodeBuffer::relocate( const char *at, RelocationInformation::RelocationType
 }
 
 
+std::int32_t CodeBuffer::collect_oop_offsets( std::int32_t *offsets ) const {
+    std::int32_t n      = 0;
+    std::int32_t offset = 0;
+    for ( RelocationInformation *r = _locsStart; r < _locsEnd and r->isValid(); r++ ) {
+        offset += r->offset();
+        if ( r->type() == RelocationInformation::RelocationType::oop_type ) {
+            if ( offsets not_eq nullptr )
+                offsets[ n ] = offset;
+            n++;
+        }
+    }
+    return n;
+}
+
+
 void CodeBuffer::decode() {
     Disassembler::decode( (const char *) decode_begin(), (const char *) code_end() );
     _decode_begin = code_end();
@@ -96,6 +111,10 @@ void CodeBuffer::copyTo( NativeMethod *nm ) {
     copy_oops( (Oop *) _codeStart, (Oop *) nm->instructionsStart(), code_size() / OOP_SIZE );
     copy_oops( (Oop *) _locsStart, (Oop *) nm->locs(), reloc_size() / OOP_SIZE );
 
+    // The oop offsets are relative to the start of the code and thus stay valid when the NativeMethod is moved
+    st_assert( collect_oop_offsets( nullptr ) == nm->number_of_oops(), "wrong size of oop offset table" );
+    collect_oop_offsets( nm->oop_offsets() );
+
     // Fix the pc relative information after the move
     std::int32_t delta = (const char *) _codeStart - (const char *) nm->instructionsStart();
     nm->fix_relocation_at_move( delta );
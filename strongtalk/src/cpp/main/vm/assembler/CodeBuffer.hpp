@@ -27,6 +27,9 @@ private:
 
     const char *decode_begin();
 
+    // Walks the relocation records like RelocationInformationIterator; stores the code offsets of the embedded oops if offsets is not nullptr
+    std::int32_t collect_oop_offsets( std::int32_t *offsets ) const;
+
 public:
     CodeBuffer( const char *code_start, std::int32_t code_size );
 
@@ -65,6 +68,12 @@ public:
     }
 
 
+    // number of embedded oops (i.e., entries of the NativeMethod's oop offset table)
+    std::int32_t number_of_oops() const {
+        return collect_oop_offsets( nullptr );
+    }
+
+
     void set_code_end( const char *end );
 
     void relocate( const char *at, RelocationInformation::RelocationType rtype );
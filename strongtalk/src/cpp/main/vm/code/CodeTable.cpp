@@ -8,76 +8,133 @@
 #include "vm/code/NativeMethod.hpp"
 
 
-CodeTable::CodeTable( std::int32_t size ) :
-    tableSize{ size },
-    buckets{ new_c_heap_array<CodeTableEntry>( size ) } {
+static std::int32_t home_bucket( std::int32_t hash, std::int32_t size ) {
+    return static_cast<std::uint32_t>( hash ) & ( size - 1 );
+}
+
 
-    //
+CodeTable::CodeTable( std::int32_t size ) :
+    _tableSize{ size },
+    _buckets{ new_buckets( size ) },
+    _numberOfEntries{ 0 },
+    _numberOfTombstones{ 0 },
+    _oldTableSize{ 0 },
+    _oldBuckets{ nullptr },
+    _migrationIndex{ 0 },
+    _numberOfLookups{ 0 },
+    _numberOfProbes{ 0 },
+    _numberOfResizes{ 0 } {
+
+    st_assert( ( size & ( size - 1 ) ) == 0, "code table size must be a power of 2" );
     clear();
 }
 
 
-CodeTableLink *CodeTable::new_link( NativeMethod *nm, CodeTableLink *n ) {
-    CodeTableLink *res = new_c_heap_array<CodeTableLink>( 1 );
-    res->_nativeMethod = nm;
-    res->_next         = n;
-    return res;
+NativeMethod **CodeTable::new_buckets( std::int32_t size ) {
+    NativeMethod **buckets = new_c_heap_array<NativeMethod *>( size );
+    for ( std::int32_t i = 0; i < size; i++ ) {
+        buckets[ i ] = nullptr;
+    }
+    return buckets;
 }
 
 
 void CodeTable::clear() {
 
-    //
-    for ( std::size_t i = 0; i < tableSize; i++ ) {
-        at( i )->clear();
+    if ( is_resizing() ) {
+        FreeHeap( _oldBuckets );
+        _oldBuckets     = nullptr;
+        _oldTableSize   = 0;
+        _migrationIndex = 0;
     }
 
+    for ( std::int32_t i = 0; i < _tableSize; i++ ) {
+        _buckets[ i ] = nullptr;
+    }
+
+    _numberOfEntries    = 0;
+    _numberOfTombstones = 0;
+    _numberOfLookups    = 0;
+    _numberOfProbes     = 0;
+    _numberOfResizes    = 0;
 }
 
 
-NativeMethod *CodeTable::lookup( const LookupKey *L ) {
-    CodeTableEntry *bucket = bucketFor( L->hash() );
+NativeMethod **CodeTable::find_slot( NativeMethod **buckets, std::int32_t size, const LookupKey *L ) {
+    std::int32_t index = home_bucket( L->hash(), size );
 
-    // Empty
-    if ( bucket->is_empty() )
-        return nullptr;
-
-    // Singleton
-    if ( bucket->is_nativeMethod() ) {
-        if ( bucket->get_nativeMethod()->_lookupKey.equal( L ) )
-            return bucket->get_nativeMethod();
-        return nullptr;
+    for ( std::int32_t n = 0; n < size; n++ ) {
+        _numberOfProbes++;
+        NativeMethod *nm = buckets[ index ];
+        if ( nm == nullptr )
+            return nullptr;
+        if ( nm not_eq tombstone() and nm->_lookupKey.equal( L ) )
+            return &buckets[ index ];
+        index = ( index + 1 ) & ( size - 1 );
     }
 
-    // Bucket
-    for ( CodeTableLink *l = bucket->get_link(); l; l = l->_next ) {
-        if ( l->_nativeMethod->_lookupKey.equal( L ) ) {
-            return l->_nativeMethod;
-        }
+    return nullptr;
+}
+
+
+NativeMethod **CodeTable::find_slot_for( NativeMethod **buckets, std::int32_t size, NativeMethod *nm ) {
+    std::int32_t index = home_bucket( nm->_lookupKey.hash(), size );
+
+    for ( std::int32_t n = 0; n < size; n++ ) {
+        if ( buckets[ index ] == nullptr )
+            return nullptr;
+        if ( buckets[ index ] == nm )
+            return &buckets[ index ];
+        index = ( index + 1 ) & ( size - 1 );
     }
 
     return nullptr;
 }
 
 
+NativeMethod **CodeTable::find_free_slot( NativeMethod **buckets, std::int32_t size, std::int32_t hash ) {
+    std::int32_t index = home_bucket( hash, size );
+
+    // the load factor guarantees that there is always a free slot
+    while ( is_live( buckets[ index ] ) ) {
+        index = ( index + 1 ) & ( size - 1 );
+    }
+
+    return &buckets[ index ];
+}
+
+
+NativeMethod *CodeTable::lookup( const LookupKey *L ) {
+    _numberOfLookups++;
+
+    NativeMethod **slot = find_slot( _buckets, _tableSize, L );
+    if ( slot == nullptr and is_resizing() ) {
+        slot = find_slot( _oldBuckets, _oldTableSize, L );
+    }
+
+    return slot ? *slot : nullptr;
+}
+
+
 void CodeTable::add( NativeMethod *nm ) {
 
     if ( lookup( &nm->_lookupKey ) ) {
         st_fatal2( "adding duplicate key to code table: 0x{0:x} and new 0x{0:x}", lookup( &nm->_lookupKey ), nm );
     }
-    CodeTableEntry *bucket = bucketFor( nm->_lookupKey.hash() );
 
-    if ( bucket->is_empty() ) {
-        bucket->set_nativeMethod( nm );
-    } else {
-        CodeTableLink *old_link;
-        if ( bucket->is_nativeMethod() ) {
-            old_link = new_link( bucket->get_nativeMethod() );
-        } else {
-            old_link = bucket->get_link();
-        }
-        bucket->set_link( new_link( nm, old_link ) );
+    if ( is_resizing() ) {
+        migrate( codeTableMigrationStride );
+    } else if ( ( _numberOfEntries + _numberOfTombstones + 1 ) * 100 > _tableSize * codeTableMaxLoad ) {
+        start_resize();
+        migrate( codeTableMigrationStride );
     }
+
+    NativeMethod **slot = find_free_slot( _buckets, _tableSize, nm->_lookupKey.hash() );
+    if ( *slot == tombstone() ) {
+        _numberOfTombstones--;
+    }
+    *slot = nm;
+    _numberOfEntries++;
 }
 
 
@@ -95,41 +152,124 @@ bool CodeTable::is_present( NativeMethod *nm ) {
 
 void CodeTable::remove( NativeMethod *nm ) {
 
-    CodeTableEntry *bucket = bucketFor( nm->_lookupKey.hash() );
-    if ( bucket->is_empty() ) {
+    NativeMethod **slot = find_slot_for( _buckets, _tableSize, nm );
+    if ( slot ) {
+        _numberOfTombstones++;
+    } else if ( is_resizing() ) {
+        // tombstones in the old array are not counted; the array is discarded once migrated
+        slot = find_slot_for( _oldBuckets, _oldTableSize, nm );
+    }
+
+    if ( slot == nullptr ) {
         st_fatal( "trying to remove NativeMethod that is not present" );
     }
 
-    if ( bucket->is_nativeMethod() ) {
-        bucket->clear();
-        return;
-    }
-
-    if ( bucket->get_link()->_nativeMethod == nm ) {
-        // is it the first link
-        CodeTableLink *disposable_link = bucket->get_link();
-        bucket->set_link( disposable_link->_next );
-        delete disposable_link;
-    } else {
-        // the the method must be further down the chain
-        CodeTableLink *current = bucket->get_link();
-        while ( current->_next ) {
-            if ( current->_next->_nativeMethod == nm ) {
-                CodeTableLink *disposable_link = current->_next;
-                current->_next = disposable_link->_next;
-                delete disposable_link;
-                return;
-            }
-            current = current->_next;
+    *slot = tombstone();
+    _numberOfEntries--;
+}
+
+
+void CodeTable::replace( NativeMethod *from, NativeMethod *to ) {
+
+    NativeMethod **slot = find_slot_for( _buckets, _tableSize, from );
+    if ( slot == nullptr and is_resizing() ) {
+        slot = find_slot_for( _oldBuckets, _oldTableSize, from );
+    }
+
+    if ( slot == nullptr ) {
+        st_fatal( "trying to replace NativeMethod that is not present" );
+    }
+
+    // the key (and hence the probe chain) stays the same
+    *slot = to;
+}
+
+
+void CodeTable::start_resize() {
+    st_assert( not is_resizing(), "resize already in progress" );
+
+    // grow only if the live entries alone need it, otherwise just get rid of the tombstones
+    std::int32_t newSize = _tableSize;
+    if ( ( _numberOfEntries + 1 ) * 100 > _tableSize * codeTableMaxLoad / 2 ) {
+        newSize = _tableSize * 2;
+    }
+
+    _oldBuckets         = _buckets;
+    _oldTableSize       = _tableSize;
+    _migrationIndex     = 0;
+    _buckets            = new_buckets( newSize );
+    _tableSize          = newSize;
+    _numberOfTombstones = 0;
+    _numberOfResizes++;
+
+    if ( PrintCodeReclamation ) {
+        SPDLOG_INFO( "CodeTable: resizing from {} to {} buckets ({} entries)", _oldTableSize, _tableSize, _numberOfEntries );
+    }
+}
+
+
+void CodeTable::migrate( std::int32_t nofBuckets ) {
+    st_assert( is_resizing(), "no resize in progress" );
+
+    std::int32_t end = min( _migrationIndex + nofBuckets, _oldTableSize );
+    for ( ; _migrationIndex < end; _migrationIndex++ ) {
+        NativeMethod *nm = _oldBuckets[ _migrationIndex ];
+        if ( is_live( nm ) ) {
+            *find_free_slot( _buckets, _tableSize, nm->_lookupKey.hash() ) = nm;
+            // leave a tombstone so that probe chains through this bucket stay intact for lookups in the old array
+            _oldBuckets[ _migrationIndex ] = tombstone();
         }
-        st_fatal( "trying to remove NativeMethod that is not present" );
     }
 
+    if ( _migrationIndex == _oldTableSize ) {
+        finish_resize();
+    }
+}
+
+
+void CodeTable::finish_resize() {
+    FreeHeap( _oldBuckets );
+    _oldBuckets     = nullptr;
+    _oldTableSize   = 0;
+    _migrationIndex = 0;
 }
 
 
 bool CodeTable::verify() {
     bool flag = true;
+
+    std::int32_t live       = 0;
+    std::int32_t tombstones = 0;
+    for ( std::int32_t i = 0; i < _tableSize; i++ ) {
+        NativeMethod *nm = _buckets[ i ];
+        if ( nm == tombstone() ) {
+            tombstones++;
+        } else if ( nm not_eq nullptr ) {
+            live++;
+            if ( find_slot_for( _buckets, _tableSize, nm ) not_eq &_buckets[ i ] ) {
+                error( "CodeTable: NativeMethod 0x%lx not reachable from its home bucket", nm );
+                flag = false;
+            }
+        }
+    }
+
+    if ( is_resizing() ) {
+        for ( std::int32_t i = _migrationIndex; i < _oldTableSize; i++ ) {
+            if ( is_live( _oldBuckets[ i ] ) )
+                live++;
+        }
+    }
+
+    if ( live not_eq _numberOfEntries ) {
+        error( "CodeTable: wrong number of entries - should be %ld, is %ld", live, _numberOfEntries );
+        flag = false;
+    }
+
+    if ( tombstones not_eq _numberOfTombstones ) {
+        error( "CodeTable: wrong number of tombstones - should be %ld, is %ld", tombstones, _numberOfTombstones );
+        flag = false;
+    }
+
     return flag;
 }
 
@@ -140,27 +280,34 @@ void CodeTable::print() {
 
 
 void CodeTable::print_stats() {
-#ifdef NOT_IMPLEMENTED
-    std::int32_t nmin = 9999999, nmax = 0, total = 0, nonzero = 0;
+    std::int32_t total    = 0;
+    std::int32_t maxProbe = 0;
+    std::int32_t sumProbe = 0;
+
     constexpr std::int32_t N = 10;
-    std::int32_t histo[N];
-    for (std::int32_t i = 0; i < N; i++) histo[i] = 0;
-    for (nmln* p = buckets;  p < &buckets[tableSize];  ++p) {
-      std::int32_t len = 0;
-      for (nmln* q = p->next;  q not_eq p;  q = q->next) len++;
-      if (len < nmin) nmin = len;
-      if (len > nmax) nmax = len;
-      if (len) nonzero++;
-      total += len;
-      histo[min(len, N-1)]++;
-    }
-
-    SPDLOG_INFO("codeTable statistics: 0x{0:x} nativeMethods; min chain = 0x{0:x}, max = 0x{0:x}, avg = {:04.1f}", total, nmin, nmax, (float)total / nonzero);
-    SPDLOG_INFO("histogram:");
-
-    for (std::int32_t i = 0; i < N - 1; i++)
-        SPDLOG_INFO("%4d:\t{:d}", i, histo[i]);
-
-    SPDLOG_INFO(">=0x{0:x}:\t0x{0:x}", N-1, histo[N-1]);
-#endif
+    std::int32_t           histo[N];
+    for ( std::int32_t     i = 0; i < N; i++ )
+        histo[ i ] = 0;
+
+    // probe length = distance (in buckets) from the home bucket, plus one
+    for ( std::int32_t i = 0; i < _tableSize; i++ ) {
+        NativeMethod *nm = _buckets[ i ];
+        if ( not is_live( nm ) )
+            continue;
+        std::int32_t len = ( ( i - home_bucket( nm->_lookupKey.hash(), _tableSize ) ) & ( _tableSize - 1 ) ) + 1;
+        maxProbe = max( maxProbe, len );
+        sumProbe += len;
+        total++;
+        histo[ min( len, N ) - 1 ]++;
+    }
+
+    SPDLOG_INFO( "  CodeTable: {} entries in {} buckets (load {}%, {} tombstones, {} resizes{})", _numberOfEntries, _tableSize, load_factor(), _numberOfTombstones, _numberOfResizes, is_resizing() ? ", resizing" : "" );
+    SPDLOG_INFO( "    probe length: avg {:4.2f}, max {}; {:4.2f} probes per lookup", total ? (float) sumProbe / total : 0.0, maxProbe, _numberOfLookups ? (float) _numberOfProbes / _numberOfLookups : 0.0 );
+
+    for ( std::int32_t i = 0; i < N - 1; i++ ) {
+        if ( histo[ i ] )
+            SPDLOG_INFO( "    {:4d}: {}", i + 1, histo[ i ] );
+    }
+    if ( histo[ N - 1 ] )
+        SPDLOG_INFO( "   >={:d}: {}", N, histo[ N - 1 ] );
 }
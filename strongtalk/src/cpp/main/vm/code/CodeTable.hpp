@@ -13,95 +13,66 @@ class NativeMethod;
 
 
 // The code table is used to find nativeMethods in the zone.
-// It is a hash table, where each bucket contains a list of nativeMethods.
-
-//%note
-// Should implement free list like SymbolTable (Lars 2/10-95)
-
-constexpr std::int32_t codeTableSize  = 2048;
-constexpr std::int32_t debugTableSize = 256;
-
-//struct CodeTableEntry;
-
-struct CodeTableLink : public CHeapAllocatedObject {
-
-    // instance variable
-    NativeMethod  *_nativeMethod;
-    CodeTableLink *_next;
-
-    // memory operations
-    bool verify( std::int32_t i );
-};
-
-struct CodeTableEntry : ValueObject {
-
-    // methods are tagged, links are not.
-    void *_nativeMethodOrLink;
-
-
-    bool is_empty() {
-        return _nativeMethodOrLink == nullptr;
-    }
-
-
-    bool is_nativeMethod() {
-        return (std::int32_t) _nativeMethodOrLink & 1;
-    }
+// It is an open-addressed hash table (linear probing) mapping a LookupKey to its NativeMethod.
+//
+// When the table gets too full it is resized incrementally: a new bucket array is allocated and every subsequent add moves a
+// few buckets of the old array over, so there is never a stop-the-world rehash. While a resize is in progress lookups search
+// both arrays. Removed entries leave a tombstone behind so that probe chains stay intact; tombstones are dropped on resize.
 
+constexpr std::int32_t codeTableSize            = 2048;   // initial number of buckets (must be a power of 2)
+constexpr std::int32_t codeTableMaxLoad         = 75;     // (in %) start a resize when live entries + tombstones exceed this
+constexpr std::int32_t codeTableMigrationStride = 16;     // # of old buckets moved to the new array per add
 
-    void clear() {
-        _nativeMethodOrLink = nullptr;
-    }
 
+class CodeTable : public PrintableCHeapAllocatedObject {
 
-    NativeMethod *get_nativeMethod() {
-        return (NativeMethod *) ( (std::int32_t) _nativeMethodOrLink - 1 );
-    }
+protected:
+    std::int32_t  _tableSize;           // # of buckets in _buckets
+    NativeMethod **_buckets;            // current bucket array
+    std::int32_t  _numberOfEntries;     // # of live entries (in both arrays)
+    std::int32_t  _numberOfTombstones;  // # of tombstones in _buckets
 
+    // incremental resizing
+    std::int32_t  _oldTableSize;        // # of buckets in _oldBuckets
+    NativeMethod **_oldBuckets;         // bucket array being migrated, or nullptr
+    std::int32_t  _migrationIndex;      // next bucket in _oldBuckets to be migrated
 
-    void set_nativeMethod( const NativeMethod *nm ) {
-        st_assert_oop_aligned( nm );
-        _nativeMethodOrLink = (void *) ( (std::int32_t) nm + 1 );
-    }
+    // statistics
+    std::int32_t _numberOfLookups;      // # of lookups since the last clear
+    std::int32_t _numberOfProbes;       // # of buckets inspected by those lookups
+    std::int32_t _numberOfResizes;      // # of resizes since the last clear
 
 
-    CodeTableLink *get_link() {
-        return (CodeTableLink *) _nativeMethodOrLink;
+    static NativeMethod *tombstone() {
+        return (NativeMethod *) 1;
     }
 
 
-    void set_link( CodeTableLink *l ) {
-        st_assert_oop_aligned( l );
-        _nativeMethodOrLink = (void *) l;
+    static bool is_live( NativeMethod *nm ) {
+        return nm not_eq nullptr and nm not_eq tombstone();
     }
 
 
-    // memory operations
-    void deallocate();
-
-    std::size_t length();   // returns the number of NativeMethod in this bucket.
-
-    bool verify( std::int32_t i );
-};
+    static NativeMethod **new_buckets( std::int32_t size );
 
+    // probing
+    NativeMethod **find_slot( NativeMethod **buckets, std::int32_t size, const LookupKey *L );
 
-class CodeTable : public PrintableCHeapAllocatedObject {
-protected:
-    std::int32_t   tableSize;
-    CodeTableEntry *buckets;
+    static NativeMethod **find_slot_for( NativeMethod **buckets, std::int32_t size, NativeMethod *nm );
 
+    static NativeMethod **find_free_slot( NativeMethod **buckets, std::int32_t size, std::int32_t hash );
 
-    CodeTableEntry *at( std::int32_t index ) {
-        return &buckets[ index ];
+    // resizing
+    bool is_resizing() const {
+        return _oldBuckets not_eq nullptr;
     }
 
 
-    CodeTableEntry *bucketFor( std::int32_t hash ) {
-        return at( hash & ( tableSize - 1 ) );
-    }
+    void start_resize();
 
+    void migrate( std::int32_t nofBuckets );
 
-    CodeTableLink *new_link( NativeMethod *nm, CodeTableLink *n = nullptr );
+    void finish_resize();
 
 public:
     CodeTable( std::int32_t size );
@@ -122,12 +93,32 @@ public:
 
     void print_stats();
 
+
+    std::int32_t length() const {
+        return _numberOfEntries;
+    }
+
+
+    std::int32_t capacity() const {
+        return _tableSize;
+    }
+
+
+    // live entries per bucket (in %)
+    std::int32_t load_factor() const {
+        return _numberOfEntries * 100 / _tableSize;
+    }
+
+
     // Tells whether a NativeMethod is present
     bool is_present( NativeMethod *nm );
 
     // Removes a NativeMethod from the table
     void remove( NativeMethod *nm );
 
+    // Replaces a NativeMethod by its moved copy (same lookup key)
+    void replace( NativeMethod *from, NativeMethod *to );
+
 protected:
     // should always add through zone->addToCodeTable()
     void add( NativeMethod *nm );
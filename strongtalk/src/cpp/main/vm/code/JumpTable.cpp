@@ -33,21 +33,58 @@ JumpTableEntry *JumpTable::jump_entry_for_at( const char *entries, std::int32_t
 
 JumpTable::JumpTable() :
     _firstFree{ 0 },
-    _entries{ nullptr },
-    length{ Universe::current_sizes._jump_table_size },
+    _blocks{ nullptr },
+    _numberOfBlocks{ 0 },
+    _maxNumberOfBlocks{ 4 },
+    _blockLength{ Universe::current_sizes._jump_table_size },
+    length{ 0 },
     usedIDs{ 0 } {
-    st_assert( length < 32 * 1024, "must change code to handle >32K entries" );
-    _entries = allocate_jump_entries( length );
-    init();
+    _blocks = new_c_heap_array<const char *>( _maxNumberOfBlocks );
+    grow();
 }
 
 
 void JumpTable::init() {
     // free list: firstFree keeps first free index
     // entries[firstFree] keeps index of next free element, etc.
+    // the list is terminated by length, the index of the first entry of the next block to be added.
     for ( std::size_t i = 0; i < length; i++ ) {
         major_at( i )->initialize_as_unused( i + 1 );
     }
+    _firstFree = 0;
+    usedIDs    = 0;
+}
+
+
+void JumpTable::grow() {
+    st_assert( _firstFree == length, "free list must be exhausted" );
+    if ( length + _blockLength >= JumpTableID::max_major_value ) {
+        st_fatal( "jump table overflow" );
+    }
+
+    if ( _numberOfBlocks == _maxNumberOfBlocks ) {
+        // only the block directory moves, the entries themselves stay where they are
+        const char **blocks = new_c_heap_array<const char *>( _maxNumberOfBlocks * 2 );
+        for ( std::int32_t i = 0; i < _numberOfBlocks; i++ ) {
+            blocks[ i ] = _blocks[ i ];
+        }
+        FreeHeap( _blocks );
+        _blocks            = blocks;
+        _maxNumberOfBlocks = _maxNumberOfBlocks * 2;
+    }
+
+    _blocks[ _numberOfBlocks++ ] = allocate_jump_entries( _blockLength );
+
+    // the old free list ends at the old length, i.e., at the first new entry
+    std::int32_t first = length;
+    length += _blockLength;
+    for ( std::size_t i = first; i < length; i++ ) {
+        major_at( i )->initialize_as_unused( i + 1 );
+    }
+
+    if ( PrintCodeReclamation and _numberOfBlocks > 1 ) {
+        SPDLOG_INFO( "JumpTable: grown to {} entries ({} blocks)", length, _numberOfBlocks );
+    }
 }
 
 
@@ -74,12 +111,15 @@ JumpTableID JumpTable::allocate( std::int32_t number_of_entries ) {
 
 
 JumpTable::~JumpTable() {
-    free( const_cast<char *>( _entries ) );
+    for ( std::int32_t i = 0; i < _numberOfBlocks; i++ ) {
+        os::release_memory( _blocks[ i ], _blockLength * JumpTableEntry::size() );
+    }
+    FreeHeap( _blocks );
 }
 
 
-JumpTableEntry *JumpTable::major_at( std::uint16_t index ) {
-    return jump_entry_for_at( _entries, index );
+JumpTableEntry *JumpTable::major_at( std::uint32_t index ) {
+    return jump_entry_for_at( _blocks[ index / _blockLength ], index % _blockLength );
 }
 
 
@@ -92,8 +132,9 @@ JumpTableEntry *JumpTable::at( JumpTableID id ) {
 
 
 std::int32_t JumpTable::newID() {
+    if ( _firstFree == length )
+        grow();
     std::int32_t id = _firstFree;
-    if ( id >= length - 2 ) st_fatal( "grow not implemented" );
     _firstFree = major_at( _firstFree )->next_free();
     usedIDs++;
     return id;
@@ -101,6 +142,7 @@ std::int32_t JumpTable::newID() {
 
 
 std::int32_t JumpTable::peekID() {
+    // the ID is valid even if the table still has to grow for it
     return _firstFree;
 }
 
@@ -129,6 +171,11 @@ void JumpTable::print() {
 }
 
 
+void JumpTable::print_stats() {
+    SPDLOG_INFO( "  JumpTable: {} of {} entries used ({}%), {} blocks of {} entries", usedIDs, length, usedIDs * 100 / length, _numberOfBlocks, _blockLength );
+}
+
+
 const char *JumpTable::compile_new_block( BlockClosureOop blk ) {
 
     // Called from the compile_block stub routine (see StubRoutines)
@@ -164,7 +211,6 @@ NativeMethod *JumpTable::compile_block( BlockClosureOop closure ) {
 }
 
 
-// XXX this verify function needs verification itself
 void JumpTable::verify() {
 
     std::int32_t id   = 0;
@@ -176,15 +222,18 @@ void JumpTable::verify() {
         check[ i ] = false;
 
     std::int32_t j = 0;
-    for ( id = _firstFree, j = 0; j < length - usedIDs; id = _entries[ id ], j++ ) {
+    for ( id = _firstFree, j = 0; j < length - usedIDs; j++ ) {
         if ( id < 0 or id >= length ) {
             error( "JumpTable: invalid ID %ld in free list (#%ld)\n", id, j );
+            return;
         }
         if ( check[ id ] ) {
             error( "JumpTable: loop with ID %ld in free list (#%ld)\n", id, j );
+            return;
         }
         check[ id ] = true;
         prev = id;
+        id   = major_at( id )->next_free();
     }
 
     if ( id not_eq length )
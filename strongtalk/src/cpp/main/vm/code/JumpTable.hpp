@@ -16,8 +16,8 @@
 // If optimized code has become invalid the jump table entry is simply snapped.
 // In addition the JumpTable serves as a dispatch table for block closures for optimized code.
 
-// %implementation note:
-//   make JumpTable growable
+// The table grows by adding blocks of entries; existing entries are never moved since compiled code
+// and block closures refer to them directly.
 
 class JumpTableEntry;
 
@@ -28,32 +28,33 @@ class NativeMethod;
 class JumpTableID : ValueObject {
 
 private:
-    std::uint16_t _major;
+    std::uint32_t _major;
     std::uint16_t _minor;
 
     friend class JumpTable;
 
-    static constexpr std::int32_t max_value = nthMask( 16 ); //
+    static constexpr std::uint32_t max_major_value = 0xFFFFFFFF;    // invalid major
+    static constexpr std::uint16_t max_minor_value = 0xFFFF;        // no minor
 
 
 public:
     JumpTableID() :
-        _major( max_value ), _minor( max_value ) {
+        _major( max_major_value ), _minor( max_minor_value ) {
     }
 
 
-    JumpTableID( std::uint16_t major ) :
-        _major( major ), _minor( max_value ) {
+    JumpTableID( std::uint32_t major ) :
+        _major( major ), _minor( max_minor_value ) {
     }
 
 
-    JumpTableID( std::uint16_t major, std::uint16_t minor ) :
+    JumpTableID( std::uint32_t major, std::uint16_t minor ) :
         _major( major ), _minor( minor ) {
     }
 
 
     bool has_minor() const {
-        return _minor not_eq max_value;
+        return _minor not_eq max_minor_value;
     }
 
 
@@ -63,11 +64,11 @@ public:
 
 
     bool is_valid() const {
-        return _major not_eq max_value;
+        return _major not_eq max_major_value;
     }
 
 
-    std::uint16_t major() const {
+    std::uint32_t major() const {
         return _major;
     }
 
@@ -86,17 +87,23 @@ public:
 class JumpTable : public ValueObject {
 
 protected:
-    std::int32_t _firstFree;    // index of first free elem
+    std::int32_t _firstFree;            // index of first free elem
+    const char   **_blocks;             // blocks of _blockLength entries each
+    std::int32_t _numberOfBlocks;       // # of allocated blocks
+    std::int32_t _maxNumberOfBlocks;    // capacity of _blocks
+    std::int32_t _blockLength;          // # of entries per block
+
     static const char *allocate_jump_entries( std::int32_t size );
 
     static JumpTableEntry *jump_entry_for_at( const char *entries, std::int32_t index );
 
-    JumpTableEntry *major_at( std::uint16_t index );
+    JumpTableEntry *major_at( std::uint32_t index );
+
+    void grow();                        // add a block of entries
 
 public:
-    const char   *_entries;
-    std::size_t length;        // max. number of IDs
-    std::int32_t usedIDs;        // # of used ID
+    std::size_t  length;                // current max. number of IDs
+    std::int32_t usedIDs;               // # of used ID
 
 public:
     JumpTable();
@@ -123,6 +130,8 @@ public:
 
     void print();
 
+    void print_stats();
+
     // compilation of blocks
     static const char *compile_new_block( BlockClosureOop blk );       // create NativeMethod, return entry point
     static NativeMethod *compile_block( BlockClosureOop blk );         // (re)compile block NativeMethod
@@ -9,6 +9,7 @@
 #include "vm/compiler/Compiler.hpp"
 #include "vm/compiler/RecompilationScope.hpp"
 #include "vm/lookup/LookupCache.hpp"
+#include "vm/interpreter/BranchProfile.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/oop/ObjectArrayOopDescriptor.hpp"
 #include "vm/primitive/Primitives.hpp"
@@ -31,6 +32,7 @@ static std::int32_t instruction_length;
 static std::int32_t location_length;
 static std::int32_t scope_length;
 static std::int32_t nof_noninlined_blocks;
+static std::int32_t nof_oops;
 
 
 NativeMethod *new_nativeMethod( Compiler *c ) {
@@ -40,11 +42,19 @@ NativeMethod *new_nativeMethod( Compiler *c ) {
     location_length       = roundTo( c->code()->reloc_size(), OOP_SIZE );
     scope_length          = roundTo( c->scopeDescRecorder()->size(), OOP_SIZE );
     nof_noninlined_blocks = c->number_of_noninlined_blocks();
+    nof_oops              = c->code()->number_of_oops();
 
     NativeMethod *nm = new NativeMethod( c );
     if ( c->is_method_compile() ) {
         Universe::code->addToCodeTable( nm );
     }
+    if ( nm->has_new_oops() ) {
+        Universe::code->addToScavengableList( nm );
+    }
+    Universe::code->noteCompilation( nm );
+
+    // the branch counts have been consumed by the compiler; free the entries for jumps still interpreted
+    BranchProfile::flush( nm->method() );
 
     return nm;
 }
@@ -54,7 +64,7 @@ void *NativeMethod::operator new( std::size_t size ) {
     st_unused( size ); // unused
 
     st_assert( sizeof( NativeMethod ) % OOP_SIZE == 0, "NativeMethod size must be multiple of a word" );
-    std::int32_t nativeMethod_size = sizeof( NativeMethod ) + instruction_length + location_length + scope_length + roundTo( ( nof_noninlined_blocks ) * sizeof( std::uint16_t ), OOP_SIZE );
+    std::int32_t nativeMethod_size = sizeof( NativeMethod ) + instruction_length + location_length + scope_length + roundTo( ( nof_noninlined_blocks ) * sizeof( std::uint16_t ), OOP_SIZE ) + nof_oops * sizeof( std::int32_t );
 
     void *p = Universe::code->allocate( nativeMethod_size );
     if ( not p ) {
@@ -72,10 +82,14 @@ void NativeMethod::initForTesting( std::int32_t size, LookupKey *key ) {
     _locsLen                  = 0;
     _scopeLen                 = 0;
     _numberOfNoninlinedBlocks = 0;
+    _numberOfOops             = 0;
+    _idleSweeps               = 0;
     _mainId                   = Universe::code->jump_table()->allocate( 1 );
     _promotedId               = 0;
     _invocationCount          = 0;
     _uncommonTrapCounter      = 0;
+    _lastInvocationCount      = 0;
+    _compileTime              = 0;
     _numberOfLinks            = 0;
     _specialHandlerCallOffset = 0;
     _entryPointOffset         = 0;
@@ -98,11 +112,15 @@ NativeMethod::NativeMethod( Compiler *c ) :
     _verifiedEntryPointOffset{},
     _scopeLen{},
     _numberOfNoninlinedBlocks{},
+    _numberOfOops{},
+    _idleSweeps{},
     _numberOfLinks{},
     _numberOfFloatTemporaries{},
     _floatSectionStartOffset{},
     _invocationCount{},
     _uncommonTrapCounter{},
+    _lastInvocationCount{},
+    _compileTime{ c->compile_time() },
     _nativeMethodFlags{},
     _lookupKey( c->key->klass(), c->key->selector_or_method() ),
     _mainId{},
@@ -121,6 +139,9 @@ NativeMethod::NativeMethod( Compiler *c ) :
 
     _numberOfNoninlinedBlocks = nof_noninlined_blocks;
 
+    st_assert( nof_oops <= 0xFFFF, "too many embedded oops" );
+    _numberOfOops = nof_oops;
+
     _specialHandlerCallOffset = theCompiler->special_handler_call_offset();
     _entryPointOffset         = theCompiler->entry_point_offset();
     _verifiedEntryPointOffset = theCompiler->verified_entry_point_offset();
@@ -152,7 +173,7 @@ NativeMethod::NativeMethod( Compiler *c ) :
 
     debug();
 
-    // Fill in instructions and locations.
+    // Fill in instructions, locations and oop offsets.
     c->code()->copyTo( this );
 
     // Fill in scope information
@@ -270,44 +291,36 @@ KlassOop NativeMethod::receiver_klass() const {
 
 
 void NativeMethod::moveTo( void *p, std::int32_t size ) {
-    st_unused( p ); // unused
-    st_unused( size ); // unused
+    // Copies the NativeMethod (code, relocation info and scopes) to p and redirects its jump table entries.
+    // Inline caches and PICs of other nativeMethods that call this one, the code table, and activations
+    // are not fixed here - that is up to the caller (see Zone::compactStep).
+    NativeMethod *to = (NativeMethod *) p;
+    if ( this == to )
+        return;
 
-#ifdef NOT_IMPLEMENTED
-    NativeMethod* to = (NativeMethod*)p;
-    if (this == to) return;
-    if (PrintCodeCompaction) {
-      SPDLOG_INFO("*moving NativeMethod 0x{0:x} (", this);
-      key.print();
-      SPDLOG_INFO(") to 0x{0:x}\n", to);
-      fflush(stdout);
+    if ( PrintCodeCompaction ) {
+        SPDLOG_INFO( "*moving NativeMethod 0x{0:x} to 0x{0:x}", static_cast<const void *>( this ), static_cast<const void *>( to ) );
     }
 
-    assert(iabs((char*)to - (char*)this) >= sizeof(NCodeBase),
-       "nativeMethods overlap too much");
-    assert(sizeof(NCodeBase) % OOP_SIZE == 0, "should be word-aligned");
-    copy_oops((Oop*)this, (Oop*)to, sizeof(NCodeBase) / OOP_SIZE);
-            // init to's vtable
-    std::int32_t delta = (char*) to - (char*) this;
-
-    for (RelocationInformation* q = locs(), *pend = locsEnd(); q < pend; q++) {
-      bool needShift;		// speed optimization - q->shift() is slow
-      if (q->isIC()) {
-        InlineCache* sd = q->asIC(this);
-        sd->shift(delta, this);
-        needShift = true;
-      } else {
-        needShift = true;
-      }
-      if (needShift) {
-        q->shift(this, delta);
-      }
+    st_assert( size % OOP_SIZE == 0, "not a multiple of OOP_SIZE" );
+    st_assert( size >= this->size(), "NativeMethod doesn't fit" );
+
+    // redirect the jump table entries (main entry for methods, promoted entry for blocks with noninlined blocks)
+    std::int32_t delta    = (const char *) to - (const char *) this;
+    JumpTableID  ids[ 2 ] = { _mainId, _promotedId };
+    for ( std::int32_t i = 0; i < 2; i++ ) {
+        if ( not ids[ i ].is_valid() )
+            continue;
+        JumpTableEntry *entry = Universe::code->jump_table()->at( ids[ i ] );
+        if ( entry->is_NativeMethod_stub() and encompasses( entry->destination() ) ) {
+            entry->set_destination( entry->destination() + delta );
+        }
     }
 
-    assert(size % OOP_SIZE == 0, "not a multiple of OOP_SIZE");
-    copy_oops_overlapping((Oop*) this, (Oop*) to, size / OOP_SIZE);
-    flushICacheRange(to->insts(), to->instsEnd());
-#endif
+    copy_oops_overlapping( (Oop *) this, (Oop *) to, size / OOP_SIZE );
+
+    // pc-relative calls and internal words have to be adjusted (same as after CodeBuffer::copyTo)
+    to->fix_relocation_at_move( (const char *) this - (const char *) to );
 }
 
 
@@ -655,12 +668,11 @@ void NativeMethod::oops_do( void f( Oop * ) ) {
     // LookupKey
     _lookupKey.oops_do( f );
 
-    // Compiled code
-    RelocationInformationIterator iter( this );
-    while ( iter.next() ) {
-        if ( iter.type() == RelocationInformation::RelocationType::oop_type ) {
-            f( iter.oop_addr() );
-        }
+    // Compiled code (uses the oop offset table instead of decoding the relocation information)
+    char               *code    = instructionsStart();
+    const std::int32_t *offsets = oop_offsets();
+    for ( std::int32_t i = 0; i < _numberOfOops; i++ ) {
+        f( (Oop *) ( code + offsets[ i ] ) );
     }
 
     // Debugging information
@@ -668,6 +680,22 @@ void NativeMethod::oops_do( void f( Oop * ) ) {
 }
 
 
+static bool found_new_oop;
+
+
+static void check_new_oop( Oop *p ) {
+    if ( ( *p )->isMemOop() and ( *p )->is_new() )
+        found_new_oop = true;
+}
+
+
+bool NativeMethod::has_new_oops() {
+    found_new_oop = false;
+    oops_do( &check_new_oop );
+    return found_new_oop;
+}
+
+
 void NativeMethod::verify() {
 
     ResourceMark resourceMark;
@@ -697,6 +725,21 @@ void NativeMethod::verify() {
         }
     }
 
+    // the oop offset table must list exactly the oops of the relocation information
+    std::int32_t                  n = 0;
+    RelocationInformationIterator iter( this );
+    while ( iter.next() ) {
+        if ( iter.type() == RelocationInformation::RelocationType::oop_type ) {
+            if ( n >= _numberOfOops or instructionsStart() + oop_offsets()[ n ] not_eq (char *) iter.oop_addr() ) {
+                error( "NativeMethod at 0x%lx has a bad oop offset table entry %ld", this, n );
+            }
+            n++;
+        }
+    }
+    if ( n not_eq _numberOfOops ) {
+        error( "NativeMethod at 0x%lx has %ld oop offsets, should be %ld", this, _numberOfOops, n );
+    }
+
     if ( findNativeMethod( (char *) instructionsEnd() - OOP_SIZE ) not_eq this ) {
         error( "findNativeMethod did not find this NativeMethod (0x{0:x})", this );
     }
@@ -1037,17 +1080,33 @@ void NativeMethod::decay_invocation_count( double decay_factor ) {
 
 
 // Perform a sweeper task
-void NativeMethod::sweeper_step( double decay_factor ) {
+void NativeMethod::sweeper_step( double decay_factor, double trap_decay_factor ) {
     // Ignore zombies
     if ( isZombie() )
         return;
+    if ( invocation_count() > _lastInvocationCount ) {
+        _idleSweeps = 0;
+    } else if ( _idleSweeps < 0xFFFF ) {
+        _idleSweeps++;
+    }
     decay_invocation_count( decay_factor );
-    _uncommonTrapCounter = std::int32_t( _uncommonTrapCounter / decay_factor );
+    _lastInvocationCount = invocation_count();
+    _uncommonTrapCounter = std::int32_t( _uncommonTrapCounter / trap_decay_factor );
     cleanup_inline_caches();
     incrementAge();
 }
 
 
+double NativeMethod::retentionScore() const {
+    // The benefit of keeping the code (how often it is used and what it would cost to recompile it), per byte of zone
+    // it occupies; methods that haven't been used for a while decay quickly, and methods that were recompiled right
+    // after a previous eviction are kept longer.
+    double benefit = double( invocation_count() + number_of_links() + 1 ) * double( compileTime() + 1 );
+    double cost    = double( size() ) * double( idleSweeps() + 1 ) * double( idleSweeps() + 1 );
+    return benefit / cost * double( 1 << evictionBackoff() );
+}
+
+
 bool NativeMethod::isYoung() {
     if ( not UseNativeMethodAging )
         return false;
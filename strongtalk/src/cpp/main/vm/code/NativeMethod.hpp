@@ -30,6 +30,10 @@ struct NativeMethodFlags {
 
     std::uint32_t markedForDeoptimization: 1; // Used for stack deoptimization
 
+    std::uint32_t isScavengable: 1;           // on the zone's list of code with pointers to new objects?
+
+    std::uint32_t evictionBackoff: 3;         // # of times this method was recompiled soon after being evicted from the zone
+
     void clear();
 };
 
@@ -41,6 +45,7 @@ struct NativeMethodFlags {
 //  4) mapping from block_closure_index to NonInlinedBlockScope offset
 //  5) debugging information
 //  6) dependency information
+//  7) offsets of the embedded oops (so that GC doesn't have to decode the relocation information)
 
 class ProgramCounterDescriptor;
 
@@ -59,12 +64,16 @@ protected:
     std::uint16_t       _verifiedEntryPointOffset;   // offset (in bytes) of entry point without class check
     std::uint16_t       _scopeLen;                   //
     std::uint16_t       _numberOfNoninlinedBlocks;   //
+    std::uint16_t       _numberOfOops;               // # of entries in the oop offset table
+    std::uint16_t       _idleSweeps;                 // # of zone sweeps since the invocation count last went up
     std::uint16_t       _numberOfLinks;              // # of inline caches (including PICs) calling this NativeMethod
     std::uint16_t       _numberOfFloatTemporaries;   // # of floats in activation frame of this NativeMethod
     std::uint16_t       _floatSectionSize;           // size of float section in words
     std::uint16_t       _floatSectionStartOffset;    // offset of float section relative to frame pointer (in oops)
     std::int32_t        _invocationCount;            // incremented for each NativeMethod invocation if CountExecution == true
     std::int32_t        _uncommonTrapCounter;        // # of times uncommon traps have been executed
+    std::int32_t        _lastInvocationCount;        // invocation count after the last sweeper step
+    std::int32_t        _compileTime;                // time spent compiling this NativeMethod (in microseconds)
 
     static std::int32_t _allUncommonTrapCounter;     // # of times uncommon traps have been executed across all nativeMethods
     NativeMethodFlags   _nativeMethodFlags;          // various flags to keep track of NativeMethod state
@@ -135,8 +144,19 @@ public:
     }
 
 
+    // offsets (relative to instructionsStart()) of the oops embedded in the code, in ascending order
+    std::int32_t *oop_offsets() const {
+        return (std::int32_t *) ( (const char *) noninlined_block_offsets() + roundTo( _numberOfNoninlinedBlocks * sizeof( std::uint16_t ), OOP_SIZE ) );
+    }
+
+
+    std::int32_t number_of_oops() const {
+        return _numberOfOops;
+    }
+
+
     const char *end() const {
-        return ( (const char *) ( noninlined_block_offsets() + _numberOfNoninlinedBlocks ) );
+        return ( (const char *) ( oop_offsets() + _numberOfOops ) );
     }
 
 
@@ -305,6 +325,42 @@ public:
     }
 
 
+    bool isScavengable() const {
+        return _nativeMethodFlags.isScavengable;
+    }
+
+
+    void setScavengable( bool value ) {
+        _nativeMethodFlags.isScavengable = value ? 1 : 0;
+    }
+
+
+    // for the zone's eviction policy
+    std::int32_t evictionBackoff() const {
+        return _nativeMethodFlags.evictionBackoff;
+    }
+
+
+    void setEvictionBackoff( std::int32_t n ) {
+        const std::int32_t MaxBackoff = 7;
+        _nativeMethodFlags.evictionBackoff = min( n, MaxBackoff );
+    }
+
+
+    std::int32_t idleSweeps() const {
+        return _idleSweeps;
+    }
+
+
+    std::int32_t compileTime() const {
+        return _compileTime;
+    }
+
+
+    // Tells how much it would cost to throw this NativeMethod away (the lowest scoring ones are evicted first when the zone is full)
+    double retentionScore() const;
+
+
     void makeToBeRecompiled() {
         _nativeMethodFlags.isToBeRecompiled = 1;
     }
@@ -377,6 +433,9 @@ public:
     // Iterate over all oops in the NativeMethod
     void oops_do( void f( Oop * ) );
 
+    // Tells whether the NativeMethod refers to new objects (and hence has to be visited by scavenges)
+    bool has_new_oops();
+
     bool switch_pointers( Oop from, Oop to, GrowableArray<NativeMethod *> *nativeMethods_to_invalidate );
 
     void relocate();
@@ -481,7 +540,7 @@ public:
 
 
     // Perform a sweeper task
-    void sweeper_step( double decay_factor );
+    void sweeper_step( double decay_factor, double trap_decay_factor );
 
 private:
     inline void decay_invocation_count( double decay_factor );
@@ -706,6 +706,7 @@ void *PolymorphicInlineCache::operator new( std::size_t size, std::int32_t code_
 
 
 void PolymorphicInlineCache::operator delete( void *p ) {
+    Universe::code->removeFromScavengableList( (PolymorphicInlineCache *) p );
     Universe::code->_picHeap->deallocate( p, 0 );
 }
 
@@ -776,6 +777,10 @@ PolymorphicInlineCache *PolymorphicInlineCache::allocate( CompiledInlineCache *i
 
     new_pic->verify();
 
+    if ( new_pic->has_new_oops() ) {
+        Universe::code->addToScavengableList( new_pic );
+    }
+
     return new_pic;
 }
 
@@ -836,6 +841,22 @@ void PolymorphicInlineCache::oops_do( void f( Oop * ) ) {
 }
 
 
+static bool found_new_oop;
+
+
+static void check_new_oop( Oop *p ) {
+    if ( ( *p )->isMemOop() and ( *p )->is_new() )
+        found_new_oop = true;
+}
+
+
+bool PolymorphicInlineCache::has_new_oops() {
+    found_new_oop = false;
+    oops_do( &check_new_oop );
+    return found_new_oop;
+}
+
+
 void PolymorphicInlineCache::print() {
     SPDLOG_INFO( "\tPolymorphicInlineCache with {} entr{}", number_of_targets(), number_of_targets() == 1 ? "y" : "ies" );
     SPDLOG_INFO( "\t- selector [{}]", selector()->print_value_string() );
@@ -153,6 +153,9 @@ public:
     // Iterate over all oops in the pic
     void oops_do( void f( Oop * ) );
 
+    // Tells whether the pic refers to new objects (and hence has to be visited by scavenges)
+    bool has_new_oops();
+
     // printing operation
     void print();
 
@@ -23,6 +23,7 @@
 #include "vm/recompiler/Recompilation.hpp"
 #include "vm/oop/ContextOopDescriptor.hpp"
 #include "vm/memory/Scavenge.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
 
 
 constexpr std::int32_t max_fast_allocate_size   = 9;
@@ -56,12 +57,18 @@ const char *StubRoutines::_continueNlrInDelta           = nullptr;
 const char *StubRoutines::_handlePascalCallbackStub     = nullptr;
 const char *StubRoutines::_handleCCallbackStub          = nullptr;
 const char *StubRoutines::_oopifyFloat                  = nullptr;
+const char *StubRoutines::_switchStack                  = nullptr;
 const char *StubRoutines::_alienCallWithArgsEntry       = nullptr;
 
 const char *StubRoutines::_PolymorphicInlineCache_stub_entries[static_cast<std::int32_t>( PolymorphicInlineCache::Constant::max_nof_entries ) + 1]; // entry 0 ignored
 const char *StubRoutines::_allocate_entries[max_fast_allocate_size + 1];
 const char *StubRoutines::_alien_call_entries[max_fast_alien_call_size + 1];
 
+const char                         *StubRoutines::_signature_code       = nullptr;
+std::int32_t                       StubRoutines::_signature_code_used   = 0;
+std::int32_t                       StubRoutines::_signature_stub_count  = 0;
+StubRoutines::AlienSignatureStub   *StubRoutines::_signature_stubs      = nullptr;
+
 
 //-----------------------------------------------------------------------------------------
 // extern "C" Oop call_delta(void* method, Oop receiver, std::int32_t nofArgs, Oop* args)
@@ -1366,6 +1373,45 @@ const char *StubRoutines::generate_oopify_float( MacroAssembler *masm ) {
 }
 
 
+const char *StubRoutines::generate_switch_stack( MacroAssembler *masm ) {
+// Switches from one process stack to another in user mode (see Process::switch_stack).
+// Called from C as
+//
+//   void switch_stack( void **save_sp, void *new_sp )
+//
+// The callee-saved registers are pushed onto the current stack and the resulting stack pointer
+// is stored at save_sp; then the registers saved on the new stack are restored and the routine
+// returns to wherever the new stack was left (or to the entry of a new process, see
+// Process::allocate_stack).
+//
+// Stack layout of a switched-out process:
+//
+// [return address]	<--- save_sp + 16
+// [ebp           ]
+// [ebx           ]
+// [esi           ]
+// [edi           ]	<--- save_sp
+
+    const char *entry_point = masm->pc();
+
+    masm->pushl( ebp );
+    masm->pushl( ebx );
+    masm->pushl( esi );
+    masm->pushl( edi );
+    masm->movl( eax, Address( esp, 5 * OOP_SIZE ) );    // save_sp
+    masm->movl( ecx, Address( esp, 6 * OOP_SIZE ) );    // new_sp
+    masm->movl( Address( eax ), esp );
+    masm->movl( esp, ecx );
+    masm->popl( edi );
+    masm->popl( esi );
+    masm->popl( ebx );
+    masm->popl( ebp );
+    masm->ret();
+
+    return entry_point;
+}
+
+
 const char *StubRoutines::generate_PolymorphicInlineCache_stub( MacroAssembler *masm, std::int32_t pic_size ) {
 // Called from within a PolymorphicInlineCache (POLYMORPHIC inline cache).
 // The stub interprets the methodOop section of compiled PICs.
@@ -1571,6 +1617,114 @@ void StubRoutines::push_alien_arg( MacroAssembler *masm, Label &nextArg ) {
 }
 
 
+void StubRoutines::store_alien_result( MacroAssembler *masm, const Address &result ) {
+    Label no_result, ptr_result, short_ptr_result, short_result;
+
+    masm->movl( ecx, result );                      // result alien
+
+    masm->testl( ecx, ecx );
+    masm->jcc( Assembler::Condition::equal, no_result );       // is a result required?
+
+    // get the start of the alien area
+    masm->movl( ecx, Address( ecx ) );
+    masm->movl( esi, Address( ecx, MemOopDescriptor::klass_byte_offset() ) );
+
+    masm->movl( esi, Address( esi, KlassOopDescriptor::nonIndexableSizeOffset() ) );
+    masm->leal( ecx, Address( ecx, esi, Address::ScaleFactor::times_1, 4 - MEMOOP_TAG ) );
+    // ecx now points to start of alien contents
+    masm->movl( esi, Address( ecx ) );
+    masm->testl( esi, esi );
+    masm->jcc( Assembler::Condition::less, ptr_result );
+    masm->jcc( Assembler::Condition::equal, short_result );
+
+    masm->cmpl( esi, 4 );                           // direct result
+    masm->jcc( Assembler::Condition::equal, short_result );
+    masm->movl( Address( ecx, 8 ), edx );
+    masm->bind( short_result );
+    masm->movl( Address( ecx, 4 ), eax );
+
+    masm->jmp( no_result );
+
+    masm->bind( ptr_result );                       // indirect/pointer result
+    masm->cmpl( esi, -4 );
+    masm->movl( esi, Address( ecx, 4 ) );
+    masm->jcc( Assembler::Condition::equal, short_ptr_result );
+    masm->movl( Address( esi, 4 ), edx );
+    masm->bind( short_ptr_result );
+    masm->movl( Address( esi ), eax );
+
+    masm->bind( no_result );
+}
+
+
+void StubRoutines::store_alien_float_result( MacroAssembler *masm, const Address &result, bool is_double ) {
+    Label no_result, is_direct, store, done;
+
+    masm->movl( ecx, result );                      // result alien
+    masm->testl( ecx, ecx );
+    masm->jcc( Assembler::Condition::equal, no_result );       // is a result required?
+
+    masm->movl( ecx, Address( ecx ) );
+    masm->movl( esi, Address( ecx, MemOopDescriptor::klass_byte_offset() ) );
+    masm->movl( esi, Address( esi, KlassOopDescriptor::nonIndexableSizeOffset() ) );
+    masm->leal( ecx, Address( ecx, esi, Address::ScaleFactor::times_1, 4 - MEMOOP_TAG ) );
+    // ecx now points to start of alien contents
+    masm->cmpl( Address( ecx ), 0 );
+    masm->jcc( Assembler::Condition::greater, is_direct );
+    masm->movl( ecx, Address( ecx, 4 ) );           // indirect/pointer result
+    masm->jmp( store );
+
+    masm->bind( is_direct );
+    masm->addl( ecx, 4 );
+
+    masm->bind( store );
+    if ( is_double ) {
+        masm->fstp_d( Address( ecx ) );
+    } else {
+        masm->fstp_s( Address( ecx ) );
+    }
+    masm->jmp( done );
+
+    masm->bind( no_result );                        // the result must be popped anyway
+    masm->fpop();
+
+    masm->bind( done );
+}
+
+
+void StubRoutines::alien_address( MacroAssembler *masm ) {
+    // eax: an alien or unsafe alien, replaced by the address of its contents
+    Label isUnsafe, isDirect, done;
+
+    masm->movl( esi, Address( eax, sizeof( MemOopDescriptor ) - MEMOOP_TAG ) );
+    // load the first ivar
+    //   either SmallIntegerOop for normal alien
+    //   or MemOop for unsafe alien
+    masm->testl( esi, MEMOOP_TAG );
+    masm->jcc( Assembler::Condition::notEqual, isUnsafe );
+
+    masm->movl( esi, Address( eax, MemOopDescriptor::klass_byte_offset() ) );
+    masm->movl( esi, Address( esi, KlassOopDescriptor::nonIndexableSizeOffset() ) );
+    masm->leal( eax, Address( eax, esi, Address::ScaleFactor::times_1, 4 - MEMOOP_TAG ) ); // start of the alien
+
+    masm->cmpl( Address( eax ), 0 );                          // direct?
+    masm->jcc( Assembler::Condition::greater, isDirect );
+    masm->movl( eax, Address( eax, 4 ) );                     // indirect or pointer: the address
+    masm->jmp( done );
+
+    masm->bind( isDirect );
+    masm->addl( eax, 4 );                                   // start of direct contents
+    masm->jmp( done );
+
+    masm->bind( isUnsafe );
+    masm->movl( eax, Address( esi, MemOopDescriptor::klass_byte_offset() ) );
+    masm->movl( eax, Address( eax, KlassOopDescriptor::nonIndexableSizeOffset() ) );
+    masm->leal( eax, Address( esi, eax, Address::ScaleFactor::times_1, 4 - MEMOOP_TAG ) ); // start of the bytes in the array
+
+    masm->bind( done );
+}
+
+
 extern "C" {
 void __CALLING_CONVENTION enter_async_call( DeltaProcess ** );
 void __CALLING_CONVENTION exit_async_call( DeltaProcess ** );
@@ -1578,7 +1732,7 @@ void __CALLING_CONVENTION exit_async_call( DeltaProcess ** );
 
 
 const char *StubRoutines::generate_alien_call_with_args( MacroAssembler *masm ) {
-    Label no_result, ptr_result, short_ptr_result, short_result, argLoopStart;
+    Label argLoopStart;
     Label isSMI, isDirect, startMove, isPointer, nextArg, moveLoopHead, moveLoopEnd, moveLoopTest, argLoopExit, argLoopTest, pushArgs;
     Label sizeLoopTest, sizeLoopStart;
 
@@ -1645,41 +1799,7 @@ const char *StubRoutines::generate_alien_call_with_args( MacroAssembler *masm )
   masm->popl(edx);
   masm->popl(eax);
 #endif
-    masm->movl( ecx, result );                      // result alien
-
-    masm->testl( ecx, ecx );
-    masm->jcc( Assembler::Condition::equal, no_result );       // is a result required?
-
-    //masm->int3(); //debug
-    // get the start of the alien area
-    masm->movl( ecx, Address( ecx ) );
-    masm->movl( esi, Address( ecx, MemOopDescriptor::klass_byte_offset() ) );
-
-    masm->movl( esi, Address( esi, KlassOopDescriptor::nonIndexableSizeOffset() ) );
-    masm->leal( ecx, Address( ecx, esi, Address::ScaleFactor::times_1, 4 - MEMOOP_TAG ) );
-    // ecx now points to start of alien contents
-    masm->movl( esi, Address( ecx ) );
-    masm->testl( esi, esi );
-    masm->jcc( Assembler::Condition::less, ptr_result );
-    masm->jcc( Assembler::Condition::equal, short_result );
-
-    masm->cmpl( esi, 4 );                           // direct result
-    masm->jcc( Assembler::Condition::equal, short_result );
-    masm->movl( Address( ecx, 8 ), edx );
-    masm->bind( short_result );
-    masm->movl( Address( ecx, 4 ), eax );
-
-    masm->jmp( no_result );
-
-    masm->bind( ptr_result );                       // indirect result
-    masm->cmpl( esi, -4 );
-    masm->movl( esi, Address( ecx, 4 ) );
-    masm->jcc( Assembler::Condition::equal, short_ptr_result );
-    masm->movl( Address( esi, 4 ), edx );
-    masm->bind( short_ptr_result );
-    masm->movl( Address( esi ), eax );
-
-    masm->bind( no_result );
+    store_alien_result( masm, result );
     masm->movl( esi, Address( ebp, -4 ) );            // restore registers
     masm->movl( edi, Address( ebp, -8 ) );
     masm->movl( ebx, Address( ebp, -12 ) );
@@ -1691,7 +1811,7 @@ const char *StubRoutines::generate_alien_call_with_args( MacroAssembler *masm )
 
 
 const char *StubRoutines::generate_alien_call( MacroAssembler *masm, std::int32_t args ) {
-    Label      no_result, ptr_result, short_ptr_result, short_result, pushArgs;
+    Label      pushArgs;
     Address    fnptr( ebp, 8 );
     Address    result( ebp, 12 );
     Address    proc( ebp, -8 );
@@ -1749,45 +1869,98 @@ const char *StubRoutines::generate_alien_call( MacroAssembler *masm, std::int32_
   masm->popl(eax);
 #endif
 
-    masm->movl( ecx, result );                      // result alien
+    store_alien_result( masm, result );
 
-    masm->testl( ecx, ecx );
-    masm->jcc( Assembler::Condition::equal, no_result );       // is a result required?
+    masm->movl( esi, Address( ebp, -4 ) );            // restore registers
+    masm->leave();
+    masm->ret( 8 + ( args << 2 ) );
+    return entry_point;
+}
 
-    //masm->int3(); //debug
-    // get the start of the alien area
-    masm->movl( ecx, Address( ecx ) );
-    masm->movl( esi, Address( ecx, MemOopDescriptor::klass_byte_offset() ) );
 
-    masm->movl( esi, Address( esi, KlassOopDescriptor::nonIndexableSizeOffset() ) );
-    masm->leal( ecx, Address( ecx, esi, Address::ScaleFactor::times_1, 4 - MEMOOP_TAG ) );
-    // ecx now points to start of alien contents
-    masm->movl( esi, Address( ecx ) );
-    masm->testl( esi, esi );
-    masm->jcc( Assembler::Condition::less, ptr_result );
-    masm->jcc( Assembler::Condition::equal, short_result );
+const char *StubRoutines::generate_alien_call_with_signature( MacroAssembler *masm, const char *signature, std::int32_t length ) {
+    // stub( function, result_handle, arguments ): the arguments are moved straight into an
+    // outgoing area of fixed size, so no size calculation or copy loops are needed
+    Address    fnptr( ebp, 8 );
+    Address    result( ebp, 12 );
+    Address    argArray( ebp, 16 );
+    Address    proc( ebp, -12 );
+    const char *entry_point = masm->pc();
 
-    masm->cmpl( esi, 4 );                           // direct result
-    masm->jcc( Assembler::Condition::equal, short_result );
-    masm->movl( Address( ecx, 8 ), edx );
-    masm->bind( short_result );
-    masm->movl( Address( ecx, 4 ), eax );
+    std::int32_t args        = alien_signature_args( signature, length );
+    char         result_type = alien_signature_result( signature, length );
+    std::int32_t arg_bytes   = 0;
+    for ( std::int32_t index = 0; index < args; index++ ) {
+        arg_bytes += signature[ index ] == 'd' ? 8 : 4;
+    }
 
-    masm->jmp( no_result );
+    masm->enter();
+    masm->pushl( esi );                                       // preserve registers
+    masm->pushl( edi );
+    masm->subl( esp, 4 );                                     // process pointer
+    if ( arg_bytes > 0 ) {
+        masm->subl( esp, arg_bytes );
+    }
+    masm->andl( esp, -16 );                                   // align the arguments
+
+    masm->movl( edi, argArray );
+    std::int32_t offset = 0;
+    for ( std::int32_t index = 0; index < args; index++ ) {
+        masm->movl( eax, Address( edi, index * OOP_SIZE ) );
+        switch ( signature[ index ] ) {
+            case 'i':
+                masm->sarl( eax, TAG_SIZE );
+                masm->movl( Address( esp, offset ), eax );
+                offset += 4;
+                break;
+            case 'p':
+                alien_address( masm );
+                masm->movl( Address( esp, offset ), eax );
+                offset += 4;
+                break;
+            case 'd':
+                masm->movl( ecx, Address( eax, DoubleOopDescriptor::value_offset() * OOP_SIZE - MEMOOP_TAG ) );
+                masm->movl( Address( esp, offset ), ecx );
+                masm->movl( ecx, Address( eax, DoubleOopDescriptor::value_offset() * OOP_SIZE - MEMOOP_TAG + 4 ) );
+                masm->movl( Address( esp, offset + 4 ), ecx );
+                offset += 8;
+                break;
+            case 'f':
+                masm->fld_d( Address( eax, DoubleOopDescriptor::value_offset() * OOP_SIZE - MEMOOP_TAG ) );
+                masm->fstp_s( Address( esp, offset ) );
+                offset += 4;
+                break;
+            default: ShouldNotReachHere();
+        }
+    }
+#ifdef ASYNC_ALIEN
+                                                                                                                            masm->leal(eax, proc);
+  masm->pushl(eax);
+  masm->call((char*)enter_async_call, RelocationInformation::RelocationType::external_word_type);
+#endif
 
-    masm->bind( ptr_result );                       // indirect/pointer result
-    masm->cmpl( esi, -4 );
-    masm->movl( esi, Address( ecx, 4 ) );
-    masm->jcc( Assembler::Condition::equal, short_ptr_result );
-    masm->movl( Address( esi, 4 ), edx );
-    masm->bind( short_ptr_result );
-    masm->movl( Address( esi ), eax );
+    masm->call( fnptr );                            // call the alien function
 
-    masm->bind( no_result );
+#ifdef ASYNC_ALIEN
+                                                                                                                            masm->pushl(eax);
+  masm->leal(eax, proc);
+  masm->pushl(edx);
+  masm->pushl(eax);
+  masm->call((char*) exit_async_call, RelocationInformation::RelocationType::external_word_type);
+  masm->popl(edx);
+  masm->popl(eax);
+#endif
+
+    if ( result_type == 'i' ) {
+        store_alien_result( masm, result );
+    } else {
+        store_alien_float_result( masm, result, result_type == 'd' );
+    }
 
     masm->movl( esi, Address( ebp, -4 ) );            // restore registers
+    masm->movl( edi, Address( ebp, -8 ) );
     masm->leave();
-    masm->ret( 8 + ( args << 2 ) );
+    masm->ret( 12 );
     return entry_point;
 }
 
@@ -1815,6 +1988,86 @@ const char *StubRoutines::alien_call_entry( std::int32_t args ) {
 }
 
 
+std::int32_t StubRoutines::alien_signature_args( const char *signature, std::int32_t length ) {
+    std::int32_t args = 0;
+    while ( args < length and signature[ args ] not_eq '>' ) {
+        if ( std::strchr( "ipdf", signature[ args ] ) == nullptr or signature[ args ] == '\0' )
+            return -1;
+        args++;
+    }
+    if ( args > max_alien_signature_args )
+        return -1;
+    if ( args == length )
+        return args;
+    if ( length not_eq args + 2 or std::strchr( "idf", signature[ args + 1 ] ) == nullptr or signature[ args + 1 ] == '\0' )
+        return -1;
+    return args;
+}
+
+
+char StubRoutines::alien_signature_result( const char *signature, std::int32_t length ) {
+    st_assert( alien_signature_args( signature, length ) >= 0, "invalid signature" );
+    return length >= 2 and signature[ length - 2 ] == '>' ? signature[ length - 1 ] : 'i';
+}
+
+
+const char *StubRoutines::alien_call_entry( const char *signature, std::int32_t length ) {
+    st_assert( _is_initialized, "StubRoutines not initialized yet" );
+    if ( alien_signature_args( signature, length ) < 0 )
+        return nullptr;
+
+    std::uint32_t hash = 0;
+    for ( std::int32_t index = 0; index < length; index++ ) {
+        hash = hash * 31 + signature[ index ];
+    }
+
+    if ( _signature_stubs == nullptr ) {
+        _signature_stubs = new_c_heap_array<AlienSignatureStub>( _max_signature_stubs );
+        for ( std::int32_t index = 0; index < _max_signature_stubs; index++ ) {
+            _signature_stubs[ index ] = { 0, nullptr, nullptr };
+        }
+    }
+
+    std::int32_t index = hash & ( _max_signature_stubs - 1 );
+    while ( _signature_stubs[ index ].entry not_eq nullptr ) {
+        AlienSignatureStub *stub = &_signature_stubs[ index ];
+        if ( stub->length == length and std::memcmp( stub->signature, signature, length ) == 0 )
+            return stub->entry;
+        index = ( index + 1 ) & ( _max_signature_stubs - 1 );
+    }
+
+    // a new signature: generate its stub, if there is room (the cache is kept at most half full)
+    constexpr std::int32_t max_stub_size = 256 + 64 * max_alien_signature_args;
+    if ( _signature_stub_count >= _max_signature_stubs / 2 or _signature_code_used + max_stub_size > _signature_code_size )
+        return nullptr;
+    if ( _signature_code == nullptr ) {
+        _signature_code = os::exec_memory( _signature_code_size );
+    }
+
+    ResourceMark   rm;
+    CodeBuffer     *code = new CodeBuffer( _signature_code + _signature_code_used, _signature_code_size - _signature_code_used );
+    MacroAssembler *masm = new MacroAssembler( code );
+
+    const char *entry_point = generate_alien_call_with_signature( masm, signature, length );
+    masm->finalize();
+    st_assert( masm->offset() <= max_stub_size, "signature stub larger than expected" );
+    _signature_code_used += masm->offset();
+
+    char *copy = new_c_heap_array<char>( length );
+    std::memcpy( copy, signature, length );
+    _signature_stubs[ index ] = { length, copy, entry_point };
+    _signature_stub_count++;
+
+    SPDLOG_INFO( "stubroutine-generate[alien_call_with_signature], signature [{}], size [0x{08:x}] bytes, entry point address [0x{08:x}]", std::string( signature, length ), masm->offset(), entry_point );
+    if ( PrintStubRoutines ) {
+        masm->code()->decode();
+        _console->cr();
+    }
+
+    return entry_point;
+}
+
+
 // Initialization
 
 bool       StubRoutines::_is_initialized = false;
@@ -1890,6 +2143,7 @@ void StubRoutines::init() {
     _handlePascalCallbackStub     = generateStubRoutine( masm, "handle_pascal_callback_stub", generate_handle_pascal_callback_stub );
     _handleCCallbackStub          = generateStubRoutine( masm, "handle_C_callback_stub", generate_handle_C_callback_stub );
     _oopifyFloat                  = generateStubRoutine( masm, "oopify_float", generate_oopify_float );
+    _switchStack                  = generateStubRoutine( masm, "switch_stack", generate_switch_stack );
     _alienCallWithArgsEntry       = generateStubRoutine( masm, "alien_call_with_args", generate_alien_call_with_args );
 
     for ( std::int32_t pic_size = 1; pic_size <= static_cast<std::int32_t>( PolymorphicInlineCache::Constant::max_nof_entries ); pic_size++ ) {
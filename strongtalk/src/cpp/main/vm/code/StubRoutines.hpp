@@ -63,12 +63,27 @@ private:
     static const char *_handlePascalCallbackStub;
     static const char *_handleCCallbackStub;
     static const char *_oopifyFloat;
+    static const char *_switchStack;
 
     static const char *_PolymorphicInlineCache_stub_entries[];
     static const char *_allocate_entries[];
     static const char *_alien_call_entries[];
     static const char *_alienCallWithArgsEntry;
 
+    // alien call outs specialized to a signature, generated on demand into a separate stub zone
+    static constexpr std::int32_t _signature_code_size  = 1024 * 128;  //
+    static constexpr std::int32_t _max_signature_stubs  = 512;         // capacity of the signature cache (a power of two)
+    static const char             *_signature_code;                    // the code buffer for the signature stubs
+    static std::int32_t           _signature_code_used;                // bytes of _signature_code used
+    static std::int32_t           _signature_stub_count;               // number of signature stubs generated
+
+    struct AlienSignatureStub {
+        std::int32_t length;
+        const char   *signature;                                       // C-heap copy of the signature
+        const char   *entry;
+    };
+    static AlienSignatureStub *_signature_stubs;                       // open addressed cache of the signature stubs
+
     // add tracing routines here
     static void trace_DLL_call_1( dll_func_ptr_t function, Oop *last_argument, std::int32_t nof_arguments );
 
@@ -134,10 +149,12 @@ private:
     static const char *generate_handle_pascal_callback_stub( MacroAssembler *masm );
     static const char *generate_handle_C_callback_stub( MacroAssembler *masm );
     static const char *generate_oopify_float( MacroAssembler *masm );
+    static const char *generate_switch_stack( MacroAssembler *masm );
     static const char *generate_PolymorphicInlineCache_stub( MacroAssembler *masm, std::int32_t pic_size );
     static const char *generate_allocate( MacroAssembler *masm, std::int32_t size );
     static const char *generate_alien_call( MacroAssembler *masm, std::int32_t args );
     static const char *generate_alien_call_with_args( MacroAssembler *masm );
+    static const char *generate_alien_call_with_signature( MacroAssembler *masm, const char *signature, std::int32_t length );
 
     // helpers for generation
     static const char *generateStubRoutine( MacroAssembler *masm, const char *title, const char *gen( MacroAssembler * ) );
@@ -145,6 +162,9 @@ private:
     static void alien_arg_size( MacroAssembler *masm, Label &nextArg );
     static void push_alien_arg( MacroAssembler *masm, Label &nextArg );
     static void push_alignment_spacers( MacroAssembler *masm );
+    static void alien_address( MacroAssembler *masm );
+    static void store_alien_result( MacroAssembler *masm, const Address &result );
+    static void store_alien_float_result( MacroAssembler *masm, const Address &result, bool is_double );
 
 public:
     // add entry point accessors here
@@ -273,6 +293,11 @@ public:
     }
 
 
+    static const char *switch_stack() {
+        return _switchStack;
+    }
+
+
     static const char *alien_call_with_args_entry() {
         return _alienCallWithArgsEntry;
     }
@@ -282,9 +307,27 @@ public:
     static const char *allocate_entry( std::int32_t size );                            // allocation of memOops: size is words in addition to header
     static const char *alien_call_entry( std::int32_t args );                          // alien call out: args is the number of arguments passed to the function called
 
+    // Alien call outs specialized to a signature
+    //
+    // The signature has a character per argument, optionally followed by '>' and the result type:
+    //   i  a SmallInteger passed as an int (the default result: eax and edx stored in the result alien)
+    //   p  an alien or unsafe alien passed as the address of its contents (structs by pointer)
+    //   d  a Float passed as a double (as a result: st(0) stored as a double)
+    //   f  a Float passed as a float (as a result: st(0) stored as a float)
+    //
+    // The stub is called as stub(function, result_handle, arguments), with arguments pointing to the
+    // first argument oop; it marshals the arguments without looking at their type, so the caller
+    // must have checked them against the signature. Stubs are generated on first use and shared by
+    // all call sites with the same signature.
+    static constexpr std::int32_t max_alien_signature_args = 16;
+
+    static std::int32_t alien_signature_args( const char *signature, std::int32_t length );    // number of arguments, or -1 if the signature is invalid
+    static char alien_signature_result( const char *signature, std::int32_t length );          // result type of a valid signature
+    static const char *alien_call_entry( const char *signature, std::int32_t length );         // nullptr if the signature is invalid or the stub zone is full
+
     // Support for profiling
     static bool contains( const char *pc ) {
-        return ( _code <= pc ) and ( pc < &_code[ _code_size ] );
+        return ( ( _code <= pc ) and ( pc < &_code[ _code_size ] ) ) or ( ( _signature_code <= pc ) and ( pc < &_signature_code[ _signature_code_used ] ) );
     }
 
 
@@ -16,6 +16,13 @@
 #include "vm/utility/EventLog.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/runtime/Processes.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+#include "vm/runtime/Sweeper.hpp"
+#include "vm/compiler/Compiler.hpp"
+#include "vm/code/RelocationInformation.hpp"
+#include "vm/code/CompiledInlineCache.hpp"
+#include "vm/interpreter/InlineCacheIterator.hpp"
+#include "vm/utility/GrowableArray.hpp"
 
 
 constexpr std::int32_t LRU_RESOLUTION     = 16;    // resolution (in secs) of LRU timer
@@ -88,13 +95,28 @@ Zone::Zone( std::int32_t &size ) :
     _picHeap{ nullptr },
     _methodTable{ nullptr },
     _jumpTable{},
+    _scavengableNativeMethods{ nullptr },
+    _scavengablePICs{ nullptr },
     LRUhand{ nullptr },
     _needsCompaction{ false },
     _needsLRUSweep{ false },
     _needsSweep{ false },
     compactTime{ 0 },
     compactDuration{ 0 },
-    minFreeFrac{ 0 } {
+    minFreeFrac{ 0 },
+    _compactionRegion{ -1 },
+    _skippedRegion{ -1 },
+    _compactionSteps{ 0 },
+    _compactedBytes{ 0 },
+    _evictionHistory{ nullptr },
+    _evictionHistoryIndex{ 0 },
+    _compilationCount{ 0 },
+    _evictionRounds{ 0 },
+    _evictedNativeMethods{ 0 },
+    _evictedBytes{ 0 },
+    _recompiledAfterEviction{ 0 },
+    _prematureEvictions{ 0 },
+    _recompilationDistance{} {
 
     st_unused( size ); // unused
 
@@ -102,6 +124,10 @@ Zone::Zone( std::int32_t &size ) :
     _picHeap     = new ZoneHeap( Universe::current_sizes._pic_heap_size, POLYMORPHIC_INLINE_CACHE_BLOCK );
     _methodTable = new CodeTable( codeTableSize );
 
+    _scavengableNativeMethods = new( true ) GrowableArray<NativeMethod *>( 16, true );
+    _scavengablePICs          = new( true ) GrowableArray<PolymorphicInlineCache *>( 16, true );
+    _evictionHistory          = new_c_heap_array<EvictionRecord>( evictionHistorySize );
+
     // LRUflag = idManager->data;
     LRUtable = (LRUcount *) LRUflag;
     clear();
@@ -115,6 +141,8 @@ void Zone::clear() {
     _methodHeap->clear();
     _picHeap->clear();
     _methodTable->clear();
+    _scavengableNativeMethods->clear();
+    _scavengablePICs->clear();
 
     LRUhand = nullptr;
     LRUtime = 0;
@@ -124,6 +152,20 @@ void Zone::clear() {
     compactTime      = 0;
     compactDuration  = 1;
     minFreeFrac      = 0.05;
+
+    _compactionRegion = _skippedRegion = -1;
+    _compactionSteps  = _compactedBytes = 0;
+
+    for ( std::int32_t i = 0; i < evictionHistorySize; i++ ) {
+        _evictionHistory[ i ].key.clear();
+        _evictionHistory[ i ].evictedAt = -1;
+    }
+    _evictionHistoryIndex    = _compilationCount = 0;
+    _evictionRounds          = _evictedNativeMethods = _evictedBytes = 0;
+    _recompiledAfterEviction = _prematureEvictions = 0;
+    for ( std::int32_t i = 0; i < evictionHistogramSize; i++ ) {
+        _recompilationDistance[ i ] = 0;
+    }
 }
 
 
@@ -145,6 +187,11 @@ NativeMethod *Zone::allocate( std::int32_t size ) {
         // allocation failed so flush zombies and retry
         flushZombies();
         n = (NativeMethod *) _methodHeap->allocate( size );
+        if ( n == nullptr and UseCodeEviction ) {
+            // still full: evict enough code so that the next few compilations won't have to do this again
+            flushNextMethod( max( size, capacity() / 100 * CodeEvictionFraction ) );
+            n = (NativeMethod *) _methodHeap->allocate( size );
+        }
         if ( n == nullptr ) {
             print();
             st_fatal( "cannot allocate enough Space for NativeMethod" );
@@ -185,40 +232,6 @@ void Zone::flush() {
 }
 
 
-std::int32_t Zone::findReplCandidates( std::int32_t needed ) {
-    st_unused( needed ); // unused
-
-    // find replacement candidates; stop if > needed bytes found or if
-    // there seem to be no more candidates
-# ifdef NOT_IMPLEMENTED
-    std::int32_t reclaimed = 0, iter = 0;
-    while (iter++ < LRU_RETIREMENT_AGE and reclaimed < needed) {
-      std::int32_t vis, recl;
-      std::int32_t limit = numberOfNativeMethods();		// because usedIDs may change
-      std::int32_t newTime = sweeper(limit, needed, &vis, &recl);
-      reclaimed += recl;
-      if (recl < needed and newTime > LRUtime + 1) {
-        // next sweep wouldn't reclaim anything
-        assert(vis == limit, "should have visited them all");
-        LRUtime = newTime - 1;
-        if (PrintLRUSweep) SPDLOG_INFO("\n*forced new LRU time: %ld", LRUtime);
-      }
-    }
-    return reclaimed;
-#endif
-    return 0;
-}
-
-
-// flush next replacement candidate; return # bytes freed
-std::int32_t Zone::flushNextMethod( std::int32_t needed ) {
-    st_unused( needed ); // unused
-    std::int32_t freed = 0;
-    Unimplemented();
-    return freed;
-}
-
-
 void moveInsts( const char *from, char *to, std::int32_t size ) {
     st_unused( size ); // unused
 
@@ -371,11 +384,272 @@ void Zone::compact( bool forced ) {
 }
 
 
+// ---------------- incremental compaction -----------------
+
+// State of the current compaction step (resource allocated).
+static GrowableArray<NativeMethod *> *pinnedNativeMethods = nullptr;   // must not move (activations or being swept)
+static GrowableArray<const char *>   *movedStart          = nullptr;   // old location of the moved nativeMethods
+static GrowableArray<const char *>   *movedEnd            = nullptr;   //
+static GrowableArray<char *>         *movedTo             = nullptr;   // new location of the moved nativeMethods
+
+
+static void pinFrames( Frame f ) {
+    while ( not f.is_first_frame() ) {
+        if ( f.is_compiled_frame() ) {
+            NativeMethod *nm = findNativeMethod( f.pc() );
+            if ( not pinnedNativeMethods->contains( nm ) )
+                pinnedNativeMethods->append( nm );
+        }
+        f = f.sender();
+    }
+}
+
+
+class PinActivationsClosure : public ProcessClosure {
+    void do_process( DeltaProcess *p ) {
+        // compaction and eviction run in VM operations or below primitive calls, where every process
+        // with a stack (the active one included) has a last Delta frame
+        if ( p->has_stack() ) {
+            pinFrames( p->last_frame() );
+        }
+    }
+};
+
+
+// returns the new address of addr if it pointed into a nativeMethod moved in this step, nullptr otherwise
+static const char *movedAddress( const char *addr ) {
+    for ( std::int32_t i = 0; i < movedStart->length(); i++ ) {
+        if ( addr >= movedStart->at( i ) and addr < movedEnd->at( i ) )
+            return movedTo->at( i ) + ( addr - movedStart->at( i ) );
+    }
+    return nullptr;
+}
+
+
+bool Zone::moveNativeMethod( const char *from, char *to, std::int32_t nbytes ) {
+    NativeMethod *nm = (NativeMethod *) from;
+    if ( nm->isZombie() or pinnedNativeMethods->contains( nm ) )
+        return false;
+
+    Zone *zone = Universe::code;
+    if ( zone->_methodTable->is_present( nm ) ) {
+        zone->_methodTable->replace( nm, (NativeMethod *) to );
+    }
+    if ( nm->isScavengable() ) {
+        GrowableArray<NativeMethod *> *list = zone->_scavengableNativeMethods;
+        list->at_put( list->find( nm ), (NativeMethod *) to );
+    }
+    nm->moveTo( to, nbytes );
+    if ( zone->LRUhand == nm ) {
+        zone->LRUhand = (NativeMethod *) to;
+    }
+
+    movedStart->append( from );
+    movedEnd->append( from + nbytes );
+    movedTo->append( to );
+    return true;
+}
+
+
+void Zone::redirect_moved_calls() {
+    // inline caches of compiled code (including the moved code itself, e.g. recursive calls)
+    FOR_ALL_NMETHODS( nm ) {
+        RelocationInformationIterator iter( nm );
+        while ( iter.next() ) {
+            if ( iter.type() == RelocationInformation::RelocationType::ic_type ) {
+                CompiledInlineCache *ic   = iter.ic();
+                const char          *dest = movedAddress( ic->destination() );
+                if ( dest )
+                    ic->set_call_destination( dest );
+            }
+        }
+    }
+
+    // compiled targets of PICs
+    FOR_ALL_PICS( pic ) {
+        PolymorphicInlineCacheIterator it( pic );
+        for ( ; not it.at_end(); it.advance() ) {
+            if ( it.is_compiled() ) {
+                const char *dest = movedAddress( it.get_call_addr() );
+                if ( dest )
+                    it.set_nativeMethod( findNativeMethod( dest ) );
+            }
+        }
+    }
+}
+
+
+void Zone::compactStep() {
+    if ( not UseIncrementalCodeCompaction )
+        return;
+
+    if ( _compactionRegion < 0 ) {
+        _compactionRegion = _methodHeap->findEvacuationCandidate( CodeCompactionMaxOccupancy, _skippedRegion );
+        if ( _compactionRegion < 0 )
+            return;
+    }
+
+    ResourceMark resourceMark;
+    EventMarker  em( "incremental zone compaction" );
+    TraceTime    t( "*incremental code compaction...", PrintCodeCompaction );
+
+    pinnedNativeMethods = new GrowableArray<NativeMethod *>( 10 );
+    movedStart          = new GrowableArray<const char *>( 10 );
+    movedEnd            = new GrowableArray<const char *>( 10 );
+    movedTo             = new GrowableArray<char *>( 10 );
+
+    if ( Sweeper::active_nativeMethod() ) {
+        pinnedNativeMethods->append( Sweeper::active_nativeMethod() );
+    }
+    PinActivationsClosure blk;
+    Processes::process_iterate( &blk );
+
+    bool         done;
+    std::int32_t region = _compactionRegion;
+    std::int32_t moved  = _methodHeap->evacuate( region, CodeCompactionStepSize * 1024, moveNativeMethod, done );
+    if ( moved > 0 ) {
+        redirect_moved_calls();
+    }
+
+    if ( done ) {
+        // don't pick the same region again right away if something in it couldn't be moved
+        _skippedRegion    = _methodHeap->usedBytesInRegion( region ) ? region : -1;
+        _compactionRegion = -1;
+    }
+    _compactionSteps++;
+    _compactedBytes += moved;
+
+    if ( PrintCodeCompaction ) {
+        SPDLOG_INFO( "*moved {} bytes ({} nativeMethods) out of code region {}{}", moved, movedTo->length(), region, done ? " (done)" : "" );
+    }
+
+    pinnedNativeMethods = nullptr;
+    movedStart          = movedEnd = nullptr;
+    movedTo             = nullptr;
+
+    verify_if_often();
+}
+
+
+// ---------------- eviction -----------------
+
+static std::int32_t compareRetentionScores( NativeMethod **a, NativeMethod **b ) {
+    double sa = ( *a )->retentionScore();
+    double sb = ( *b )->retentionScore();
+    return sa < sb ? -1 : ( sa > sb ? 1 : 0 );
+}
+
+
+std::int32_t Zone::findReplCandidates( std::int32_t needed ) {
+    ResourceMark resourceMark;
+
+    // nativeMethods with activations would have to be deoptimized; leave them alone
+    pinnedNativeMethods = new GrowableArray<NativeMethod *>( 10 );
+    if ( Sweeper::active_nativeMethod() ) {
+        pinnedNativeMethods->append( Sweeper::active_nativeMethod() );
+    }
+    // the compiler may still refer to the nativeMethod being recompiled and to the lexical parent of a block being compiled
+    if ( recompilee ) {
+        pinnedNativeMethods->append( recompilee );
+    }
+    if ( theCompiler and theCompiler->parentNativeMethod ) {
+        pinnedNativeMethods->append( theCompiler->parentNativeMethod );
+    }
+    PinActivationsClosure blk;
+    Processes::process_iterate( &blk );
+
+    // only method nativeMethods can be made zombies (see NativeMethod::makeZombie)
+    GrowableArray<NativeMethod *> *candidates = new GrowableArray<NativeMethod *>( max( numberOfNativeMethods(), 10 ) );
+    FOR_ALL_NMETHODS( p ) {
+        if ( p->is_method() and not p->isZombie() and not pinnedNativeMethods->contains( p ) )
+            candidates->append( p );
+    }
+    candidates->sort( &compareRetentionScores );
+
+    std::int32_t reclaimed = 0;
+    std::int32_t evicted   = 0;
+    for ( std::int32_t i = 0; i < candidates->length() and reclaimed < needed; i++ ) {
+        NativeMethod *nm = candidates->at( i );
+        if ( PrintCodeEviction ) {
+            SPDLOG_INFO( "*evicting NativeMethod 0x{0:x} ({} bytes, {} invocations, idle for {} sweeps, compiled in {} us, score {})", static_cast<const void *>( nm ), nm->size(), nm->invocation_count(), nm->idleSweeps(), nm->compileTime(), nm->retentionScore() );
+        }
+        recordEviction( nm );
+        reclaimed += nm->size();
+        evicted++;
+        nm->makeZombie( true );
+    }
+
+    pinnedNativeMethods = nullptr;
+
+    _evictionRounds++;
+    if ( PrintCodeEviction or PrintCodeReclamation ) {
+        SPDLOG_INFO( "*code cache full: evicted {} of {} nativeMethods ({} bytes, {} needed)", evicted, candidates->length(), reclaimed, needed );
+    }
+    return reclaimed;
+}
+
+
+// evict nativeMethods until at least needed bytes are free; return # bytes freed
+std::int32_t Zone::flushNextMethod( std::int32_t needed ) {
+    std::int32_t freed = findReplCandidates( needed );
+    if ( freed > 0 ) {
+        flushZombies();
+    }
+    return freed;
+}
+
+
+void Zone::recordEviction( NativeMethod *nm ) {
+    EvictionRecord *r = &_evictionHistory[ _evictionHistoryIndex ];
+    r->key.initialize( nm->_lookupKey.klass(), nm->_lookupKey.selector_or_method() );
+    r->evictedAt = _compilationCount;
+    r->backoff   = nm->evictionBackoff();
+    _evictionHistoryIndex = ( _evictionHistoryIndex + 1 ) % evictionHistorySize;
+
+    _evictedNativeMethods++;
+    _evictedBytes += nm->size();
+}
+
+
+void Zone::noteCompilation( NativeMethod *nm ) {
+    _compilationCount++;
+    if ( _evictedNativeMethods == 0 )
+        return;
+
+    for ( std::int32_t i = 0; i < evictionHistorySize; i++ ) {
+        EvictionRecord *r = &_evictionHistory[ i ];
+        if ( r->evictedAt < 0 or not r->key.equal( &nm->_lookupKey ) )
+            continue;
+
+        // the method was evicted before: the sooner it is needed again, the longer it is kept this time
+        std::int32_t distance = _compilationCount - r->evictedAt;
+        std::int32_t bucket   = 0;
+        for ( std::int32_t limit = 16; bucket < evictionHistogramSize - 1 and distance >= limit; limit *= 4 ) {
+            bucket++;
+        }
+        _recompilationDistance[ bucket ]++;
+        _recompiledAfterEviction++;
+
+        if ( distance <= CodeEvictionBackoffWindow ) {
+            _prematureEvictions++;
+            nm->setEvictionBackoff( r->backoff + 1 );
+        } else {
+            nm->setEvictionBackoff( max( r->backoff - 1, 0 ) );
+        }
+        r->evictedAt = -1;
+        return;
+    }
+}
+
+
 void Zone::free( NativeMethod *nm ) {
     verify_if_often();
     if ( LRUhand == nm ) {
         LRUhand = next_nm( nm );
     }
+    if ( nm->isScavengable() ) {
+        removeFromScavengableList( nm );
+    }
     _methodHeap->deallocate( nm, nm->size() );
     verify_if_often();
 }
@@ -386,6 +660,80 @@ void Zone::addToCodeTable( NativeMethod *nm ) {
 }
 
 
+void Zone::addToScavengableList( NativeMethod *nm ) {
+    st_assert( not nm->isScavengable(), "already on the scavengable list" );
+    nm->setScavengable( true );
+    _scavengableNativeMethods->append( nm );
+}
+
+
+void Zone::addToScavengableList( PolymorphicInlineCache *pic ) {
+    _scavengablePICs->append( pic );
+}
+
+
+void Zone::removeFromScavengableList( NativeMethod *nm ) {
+    nm->setScavengable( false );
+    _scavengableNativeMethods->remove( nm );
+}
+
+
+void Zone::removeFromScavengableList( PolymorphicInlineCache *pic ) {
+    if ( _scavengablePICs->contains( pic ) ) {
+        _scavengablePICs->remove( pic );
+    }
+}
+
+
+void Zone::scavengable_oops_do( void f( Oop * ) ) {
+    for ( std::int32_t i = 0; i < _scavengableNativeMethods->length(); i++ ) {
+        _scavengableNativeMethods->at( i )->oops_do( f );
+    }
+
+    for ( std::int32_t i = 0; i < _scavengablePICs->length(); i++ ) {
+        _scavengablePICs->at( i )->oops_do( f );
+    }
+
+    evictionHistory_oops_do( f );
+}
+
+
+void Zone::prune_scavengable_lists() {
+    for ( std::int32_t i = _scavengableNativeMethods->length() - 1; i >= 0; i-- ) {
+        NativeMethod *nm = _scavengableNativeMethods->at( i );
+        if ( not nm->has_new_oops() ) {
+            removeFromScavengableList( nm );
+        }
+    }
+
+    for ( std::int32_t i = _scavengablePICs->length() - 1; i >= 0; i-- ) {
+        PolymorphicInlineCache *pic = _scavengablePICs->at( i );
+        if ( not pic->has_new_oops() ) {
+            _scavengablePICs->remove( pic );
+        }
+    }
+}
+
+
+void Zone::rebuild_scavengable_lists() {
+    _scavengableNativeMethods->clear();
+    _scavengablePICs->clear();
+
+    FOR_ALL_NMETHODS( nm ) {
+        nm->setScavengable( false );
+        if ( nm->has_new_oops() ) {
+            addToScavengableList( nm );
+        }
+    }
+
+    FOR_ALL_PICS( pic ) {
+        if ( pic->has_new_oops() ) {
+            addToScavengableList( pic );
+        }
+    }
+}
+
+
 void Zone::clear_inline_caches() {
     TraceTime   t( "*flushing inline caches...", PrintInlineCacheInvalidation );
     EventMarker em( "flushing inline caches" );
@@ -424,6 +772,12 @@ void Zone::verify() {
     FOR_ALL_NMETHODS( p ) {
         n++;
         p->verify();
+        if ( p->has_new_oops() and not p->isScavengable() )
+            error( "zone: NativeMethod 0x%lx refers to new objects but is not on the scavengable list", p );
+    }
+    FOR_ALL_PICS( pic ) {
+        if ( pic->has_new_oops() and not _scavengablePICs->contains( pic ) )
+            error( "zone: PolymorphicInlineCache 0x%lx refers to new objects but is not on the scavengable list", pic );
     }
     if ( n not_eq numberOfNativeMethods() )
         error( "zone: inconsistent usedIDs value - should be %ld, is %ld", n, numberOfNativeMethods() );
@@ -447,6 +801,17 @@ void Zone::oops_do( void f( Oop * ) ) {
     FOR_ALL_PICS( pic ) {
         pic->oops_do( f );
     }
+
+    evictionHistory_oops_do( f );
+}
+
+
+void Zone::evictionHistory_oops_do( void f( Oop * ) ) {
+    // unused entries are skipped, their keys may refer to objects that are gone
+    for ( std::int32_t i = 0; i < evictionHistorySize; i++ ) {
+        if ( _evictionHistory[ i ].evictedAt >= 0 )
+            _evictionHistory[ i ].key.oops_do( f );
+    }
 }
 
 
@@ -540,6 +905,21 @@ void Zone::print() {
     if ( not nms.isEmpty() ) {
         SPDLOG_INFO( "  Code ({}K, {}%% used)", _methodHeap->capacity() / 1024, ( _methodHeap->usedBytes() * 100 ) / _methodHeap->capacity() );
         nms.print( "live", _methodHeap->capacity() );
+        SPDLOG_INFO( "  {} of {} regions in use, {}K moved by {} incremental compaction steps", _methodHeap->numberOfRegionsUsed(), _methodHeap->numberOfRegions(), _compactedBytes / 1024, _compactionSteps );
+        SPDLOG_INFO( "  {} nativeMethods and {} PICs refer to new objects", _scavengableNativeMethods->length(), _scavengablePICs->length() );
+    }
+    if ( _evictionRounds > 0 ) {
+        SPDLOG_INFO( "  {} nativeMethods ({}K) evicted in {} rounds; {} recompiled later, {} within {} compilations", _evictedNativeMethods, _evictedBytes / 1024, _evictionRounds, _recompiledAfterEviction, _prematureEvictions, CodeEvictionBackoffWindow );
+        std::int32_t limit = 16;
+        for ( std::int32_t i = 0; i < evictionHistogramSize; i++, limit *= 4 ) {
+            if ( _recompilationDistance[ i ] == 0 )
+                continue;
+            if ( i < evictionHistogramSize - 1 ) {
+                SPDLOG_INFO( "    recompiled after < {:6d} compilations: {}", limit, _recompilationDistance[ i ] );
+            } else {
+                SPDLOG_INFO( "    recompiled after >={:6d} compilations: {}", limit / 4, _recompilationDistance[ i ] );
+            }
+        }
     }
     if ( uncommon ) {
         SPDLOG_INFO( "({} live uncommon nativeMethods)", uncommon );
@@ -560,6 +940,9 @@ void Zone::print() {
     if ( n > 0 ) {
         SPDLOG_INFO( "   %3d entries = {}K (hdr %2d%%, inst %2d%%)", n, total / 1024, n * sizeof( PolymorphicInlineCache ) * 100 / total, insts * 100 / total );
     }
+
+    _methodTable->print_stats();
+    jump_table()->print_stats();
 }
 
 
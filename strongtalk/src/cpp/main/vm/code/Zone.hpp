@@ -8,6 +8,7 @@
 #include "vm/code/CodeTable.hpp"
 #include "vm/code/ZoneHeap.hpp"
 #include "vm/code/JumpTable.hpp"
+#include "vm/utility/GrowableArray.hpp"
 
 
 
@@ -24,6 +25,21 @@
 
 class PolymorphicInlineCache;
 
+
+// When the zone is full, the nativeMethods with the lowest retention score (see NativeMethod::retentionScore) are evicted.
+// A short history of evicted lookup keys is kept so that methods recompiled soon after being evicted are evicted less readily.
+
+constexpr std::int32_t evictionHistorySize   = 256;   // # of evicted lookup keys remembered
+constexpr std::int32_t evictionHistogramSize = 6;     // buckets of the eviction -> recompilation distance histogram
+
+
+struct EvictionRecord {
+    LookupKey    key;           // lookup key of the evicted NativeMethod
+    std::int32_t evictedAt;     // compilation count at eviction time, or -1 if the entry is unused
+    std::int32_t backoff;       // eviction backoff of the evicted NativeMethod
+};
+
+
 class Zone : public CHeapAllocatedObject {
 
 public:
@@ -32,6 +48,10 @@ public:
     CodeTable *_methodTable;    // Hash table: LookupKey -> NativeMethod
     JumpTable _jumpTable;       // Contains all jump entries
 
+    // code referring to new objects; scavenges only visit these instead of the whole zone
+    GrowableArray<NativeMethod *>           *_scavengableNativeMethods;
+    GrowableArray<PolymorphicInlineCache *> *_scavengablePICs;
+
 public:
     // returns the optimized method matching the lookup key, otherwise nullptr
     NativeMethod *lookup( const LookupKey *key ) {
@@ -49,6 +69,23 @@ protected:
     std::int32_t compactDuration;   // duration of last compaction
     double       minFreeFrac;       // fraction of free Space needed at compaction time
 
+    // incremental compaction (see compactStep)
+    std::int32_t _compactionRegion;     // region of _methodHeap being evacuated, or -1
+    std::int32_t _skippedRegion;        // last region that could not be emptied (pinned nativeMethods), or -1
+    std::int32_t _compactionSteps;      // # of steps done so far
+    std::int32_t _compactedBytes;       // # of bytes moved so far
+
+    // eviction (see findReplCandidates)
+    EvictionRecord *_evictionHistory;                                   // ring buffer of recently evicted keys
+    std::int32_t   _evictionHistoryIndex;                               // next entry of _evictionHistory to be used
+    std::int32_t   _compilationCount;                                   // # of nativeMethods created (the eviction clock)
+    std::int32_t   _evictionRounds;                                     // # of times the zone was full
+    std::int32_t   _evictedNativeMethods;                               // # of nativeMethods evicted
+    std::int32_t   _evictedBytes;                                       // # of bytes evicted
+    std::int32_t   _recompiledAfterEviction;                            // # of evicted methods that were compiled again
+    std::int32_t   _prematureEvictions;                                 // # of those recompiled within CodeEvictionBackoffWindow
+    std::int32_t   _recompilationDistance[ evictionHistogramSize ];     // histogram of # of compilations between eviction and recompilation
+
 
 public:
     Zone( std::int32_t &size );
@@ -93,8 +130,32 @@ public:
 
     void addToCodeTable( NativeMethod *nm );
 
+    // Called for every new NativeMethod; updates the eviction history
+    void noteCompilation( NativeMethod *nm );
+
+    // Scavengable lists
+    void addToScavengableList( NativeMethod *nm );
+
+    void addToScavengableList( PolymorphicInlineCache *pic );
+
+    void removeFromScavengableList( NativeMethod *nm );
+
+    void removeFromScavengableList( PolymorphicInlineCache *pic );
+
+    // Iterates over the oops of the code on the scavengable lists
+    void scavengable_oops_do( void f( Oop * ) );
+
+    // Drops the code whose oops have all been tenured (call after a scavenge)
+    void prune_scavengable_lists();
+
+    // Recomputes the scavengable lists from scratch (call after a full garbage collection)
+    void rebuild_scavengable_lists();
+
     void compact( bool forced = false );
 
+    // Does one bounded step of incremental compaction: moves a few nativeMethods out of a sparse region (called by the ZoneSweeper)
+    void compactStep();
+
 
     bool needsCompaction() const {
         return _needsCompaction;
@@ -126,6 +187,7 @@ public:
 
     void cleanup_inline_caches();
 
+    // Makes zombies of the nativeMethods with the lowest retention scores until at least needed bytes are covered; returns # bytes
     std::int32_t findReplCandidates( std::int32_t needed );
 
     bool isDeltaPC( void *p ) const;
@@ -202,6 +264,15 @@ protected:
 
     std::int32_t flushNextMethod( std::int32_t needed );
 
+    void recordEviction( NativeMethod *nm );
+
+    // Iterates over the lookup keys of the eviction history
+    void evictionHistory_oops_do( void f( Oop * ) );
+
+    static bool moveNativeMethod( const char *from, char *to, std::int32_t nbytes );
+
+    void redirect_moved_calls();
+
     inline NativeMethod *next_circular_nm( NativeMethod *nm );
 
     friend void moveInsts( const char *from, char *to, std::int32_t size );
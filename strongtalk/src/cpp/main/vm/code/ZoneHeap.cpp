@@ -12,6 +12,8 @@
 #include "vm/utility/EventLog.hpp"
 #include "vm/oop/Oop.hpp"
 #include "vm/memory/util.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+#include "vm/utility/GrowableArray.hpp"
 
 
 // format of chunks in free map: first & last byte hold chunk size
@@ -189,6 +191,10 @@ ZoneHeap::ZoneHeap( std::int32_t s, std::int32_t bs ) :
     _freeList{},
     _bigList{},
     _lastCombine{},
+    _nonEmptyLists{ 0 },
+    _frontier{ nullptr },
+    log2RS{},
+    _regionUsed{},
     _newHeap{},
     _combineOnDeallocation{} {
 
@@ -205,6 +211,15 @@ ZoneHeap::ZoneHeap( std::int32_t s, std::int32_t bs ) :
     }
 
     nfree = 30;
+    st_assert( nfree <= 32, "free list bit mask too small" );
+
+    // regions are a power of 2 in size, and at most as large as the heap
+    std::int32_t rs = max( blockSize, min( CodeRegionSize * 1024, size ) );
+    log2RS = log2BS;
+    while ( ( 2 << log2RS ) <= rs ) {
+        log2RS++;
+    }
+
 //    _base = AllocateHeap( size + blockSize, "zone" );
     _base = os::exec_memory( size + blockSize ); //, "zone");
     base  = (const char *) ( ( std::int32_t( _base ) + blockSize - 1 ) / blockSize * blockSize );
@@ -213,6 +228,7 @@ ZoneHeap::ZoneHeap( std::int32_t s, std::int32_t bs ) :
     // + 2 for sentinels
     _freeList  = new_c_heap_array<FreeList>( nfree );
     _bigList   = new_c_heap_array<FreeList>( 1 );
+    _regionUsed = new_c_heap_array<std::int32_t>( numberOfRegions() );
     _newHeap   = nullptr;
     clear();
 }
@@ -229,14 +245,19 @@ void ZoneHeap::clear() {
         _freeList[ i ].clear();
     }
     _bigList->clear();
+    _nonEmptyLists = 0;
+
+    for ( std::int32_t i = 0; i < numberOfRegions(); i++ ) {
+        _regionUsed[ i ] = 0;
+    }
 
     // initialize the map
     _heapKlass->markUnused( mapSize() );              // mark everything as unused
     heapEnd()->markUsed( 1 );                  // start sentinel
     asChunkKlass( _heapKlass->asByte() - 1 )->markUsed( 1 ); // stop sentinel
 
-    // add whole chunk to free list
-    addToFreeList( _heapKlass );
+    // the whole heap is the frontier
+    setFrontier( _heapKlass );
 
     // set the combine variables
     _combineOnDeallocation = false;
@@ -258,13 +279,19 @@ ZoneHeap::~ZoneHeap() {
     free( _heapKlass - 1 );        // -1 to get rid of sentinel
     free( _freeList );
     free( _bigList );
+    free( _regionUsed );
 }
 
 
 void ZoneHeap::removeFromFreeList( ChunkKlass *m ) {
     m->verify();
+    st_assert( m not_eq _frontier, "frontier is not on a free list" );
     HeapChunk *p = (HeapChunk *) blockAddr( m );
     p->remove();
+    std::int32_t sz = m->size();
+    if ( sz <= nfree and _freeList[ sz - 1 ].isEmpty() ) {
+        _nonEmptyLists &= ~( 1 << ( sz - 1 ) );
+    }
 }
 
 
@@ -274,6 +301,7 @@ bool ZoneHeap::addToFreeList( ChunkKlass *m ) {
     std::int32_t sz = m->size();
     if ( sz <= nfree ) {
         _freeList[ sz - 1 ].append( p );
+        _nonEmptyLists |= 1 << ( sz - 1 );
         return false;
     } else {
         _bigList->append( p );
@@ -283,28 +311,101 @@ bool ZoneHeap::addToFreeList( ChunkKlass *m ) {
 }
 
 
+void ZoneHeap::setFrontier( ChunkKlass *m ) {
+    // the frontier is kept off the free lists (combine() knows about it)
+    st_assert( m == nullptr or m->isUnused(), "frontier must be unused" );
+    _frontier = m;
+}
+
+
+std::int32_t ZoneHeap::frontierBytes() const {
+    return _frontier ? _frontier->size() << log2BS : 0;
+}
+
+
+void *ZoneHeap::allocFromFrontier( std::int32_t wantedBlocks ) {
+    if ( _frontier == nullptr or _frontier->size() < wantedBlocks )
+        return nullptr;
+
+    ChunkKlass   *m    = _frontier;
+    std::int32_t rest  = m->size() - wantedBlocks;
+    m->markUsed( wantedBlocks );
+    if ( rest > 0 ) {
+        ChunkKlass *f = m->next();
+        f->markUnused( rest );
+        setFrontier( f );
+    } else {
+        _frontier = nullptr;
+    }
+    return (void *) blockAddr( m );
+}
+
+
+bool ZoneHeap::refillFrontier( std::int32_t wantedBlocks ) {
+    // use the biggest chunk on the big list as the new frontier (if it is bigger than the current one)
+    HeapChunk *f       = _bigList->anchor();
+    HeapChunk *biggest = nullptr;
+    for ( HeapChunk *c = f->next(); c not_eq f; c = c->next() ) {
+        if ( biggest == nullptr or c->size > biggest->size )
+            biggest = c;
+    }
+    if ( biggest == nullptr or biggest->size < wantedBlocks )
+        return false;
+    if ( _frontier and _frontier->size() >= biggest->size )
+        return false;
+
+    _bigList->remove( biggest );
+    if ( _frontier ) {
+        addToFreeList( _frontier );
+    }
+    setFrontier( mapAddr( biggest ) );
+    return true;
+}
+
+
 void *ZoneHeap::allocFromLists( std::int32_t wantedBytes ) {
     st_assert( wantedBytes % blockSize == 0, "not a multiple of blockSize" );
     std::int32_t wantedBlocks = wantedBytes >> log2BS;
     st_assert( wantedBlocks > 0, "negative alloc size" );
-    std::int32_t blocks = wantedBlocks - 1;
+    std::int32_t blocks = wantedBlocks;
     void         *p     = nullptr;
-    while ( not p and ++blocks <= nfree ) {
-        p = _freeList[ blocks - 1 ].get();
+
+    // 1. exact fit from the segregated lists
+    if ( wantedBlocks <= nfree ) {
+        p = _freeList[ wantedBlocks - 1 ].get();
+        if ( p and _freeList[ wantedBlocks - 1 ].isEmpty() )
+            _nonEmptyLists &= ~( 1 << ( wantedBlocks - 1 ) );
     }
+
+    // 2. bump the frontier
     if ( not p ) {
-        HeapChunk *f = _bigList->anchor();
-        HeapChunk *c = f->next();
-        for ( ; c not_eq f and c->size < wantedBlocks; c = c->next() );
-        if ( c == f ) {
-            if ( not _combineOnDeallocation and combineAll() >= wantedBlocks )
-                return allocFromLists( wantedBytes );
-        } else {
-            p      = (void *) c;
-            blocks = c->size;
-            _bigList->remove( c );
+        p = allocFromFrontier( wantedBlocks );
+        if ( p )
+            return p;
+    }
+
+    // 3. split the smallest bigger chunk (the bit mask tells us which lists are non-empty)
+    if ( not p and wantedBlocks < nfree ) {
+        std::uint32_t candidates = _nonEmptyLists & ~nthMask( wantedBlocks );
+        if ( candidates ) {
+            std::int32_t i = 0;
+            while ( not( candidates & ( 1 << i ) ) )
+                i++;
+            blocks = i + 1;
+            p      = _freeList[ i ].get();
+            if ( _freeList[ i ].isEmpty() )
+                _nonEmptyLists &= ~( 1 << i );
         }
     }
+
+    // 4. make the biggest chunk on the big list the new frontier (the current one is too small)
+    if ( not p ) {
+        if ( refillFrontier( wantedBlocks ) )
+            return allocFromFrontier( wantedBlocks );
+        if ( not _combineOnDeallocation and combineAll() >= wantedBlocks )
+            return allocFromLists( wantedBytes );
+    }
+
     if ( p ) {
         ChunkKlass *m = mapAddr( p );
         st_assert( m->size() == blocks, "inconsistent sizes" );
@@ -335,6 +436,7 @@ void *ZoneHeap::allocate( std::int32_t wantedBytes ) {
         _bytesUsed += rounded;
         _total += rounded;
         _ifrag += rounded - wantedBytes;
+        _regionUsed[ regionOf( p ) ] += rounded;
     }
     if ( VerifyZoneOften ) {
         verify();
@@ -349,11 +451,12 @@ void ZoneHeap::deallocate( void *p, std::int32_t bytes ) {
     std::int32_t blockedBytes = myChunkSize << log2BS;
     _bytesUsed -= blockedBytes;
     _ifrag -= blockedBytes - bytes;
+    _regionUsed[ regionOf( p ) ] -= blockedBytes;
     m->markUnused( myChunkSize );
     bool      big = addToFreeList( m );
     HeapChunk *c  = (HeapChunk *) p;
-    if ( _combineOnDeallocation or big )
-        combine( c );    // always keep bigList combined
+    if ( _combineOnDeallocation or big or m->next() == _frontier )
+        combine( c );    // always keep bigList combined, and give chunks below the frontier back to it
 
     if ( VerifyZoneOften ) {
         verify();
@@ -395,11 +498,13 @@ const char *ZoneHeap::compact( void move( const char *from, char *to, std::int32
         _freeList[ i ].clear();
 
     _bigList->clear();
+    _nonEmptyLists = 0;
     std::int32_t freeBlocks = end->asByte() - freeChunk->asByte();
     freeChunk->markUnused( freeBlocks );
-    addToFreeList( freeChunk );
+    setFrontier( freeChunk );
     st_assert( freeBlocks * blockSize == capacity() - usedBytes(), "usage info inconsistent" );
     _lastCombine = _heapKlass;
+    recomputeRegionUsage();
 
     return blockAddr( freeChunk );
 }
@@ -413,6 +518,7 @@ std::int32_t ZoneHeap::combine( HeapChunk *&c ) {
     st_assert( cm < heapEnd(), "beyond heap" );
     ChunkKlass *cmnext = cm->next();
     ChunkKlass *cm1;
+    bool       absorbedFrontier = false;    // the combined block becomes the frontier if it contains it
     if ( cm == _heapKlass ) {
         cm1 = cm;
     } else {
@@ -420,7 +526,11 @@ std::int32_t ZoneHeap::combine( HeapChunk *&c ) {
         while ( cm1->isUnused() ) {        // will terminate because of sentinel
             ChunkKlass *free = cm1;
             cm1              = free->prev();
-            removeFromFreeList( free );
+            if ( free == _frontier ) {
+                absorbedFrontier = true;
+            } else {
+                removeFromFreeList( free );
+            }
             free->invalidate();        // make sure it doesn't look valid
         }
         cm1 = cm1->next();
@@ -429,7 +539,11 @@ std::int32_t ZoneHeap::combine( HeapChunk *&c ) {
     while ( cm2->isUnused() ) {        // will terminate because of sentinel
         ChunkKlass *free = cm2;
         cm2 = cm2->next();
-        removeFromFreeList( free );
+        if ( free == _frontier ) {
+            absorbedFrontier = true;
+        } else {
+            removeFromFreeList( free );
+        }
         free->invalidate();            // make sure it doesn't look valid
     }
 
@@ -441,7 +555,11 @@ std::int32_t ZoneHeap::combine( HeapChunk *&c ) {
         removeFromFreeList( cm );
         cm->invalidate();
         cm1->markUnused( cm2->asByte() - cm1->asByte() );
-        addToFreeList( cm1 );
+        if ( absorbedFrontier ) {
+            setFrontier( cm1 );
+        } else {
+            addToFreeList( cm1 );
+        }
         _lastCombine = cm1;
     }
     st_assert( cm1 >= _heapKlass and cm2 <= heapEnd() and cm1 < cm2, "just checkin'" );
@@ -470,6 +588,103 @@ std::int32_t ZoneHeap::combineAll() {
 }
 
 
+void ZoneHeap::recomputeRegionUsage() {
+    for ( std::int32_t i = 0; i < numberOfRegions(); i++ ) {
+        _regionUsed[ i ] = 0;
+    }
+    for ( ChunkKlass *m = _heapKlass; m < heapEnd(); m = m->next() ) {
+        if ( m->isUsed() )
+            _regionUsed[ regionOf( blockAddr( m ) ) ] += m->size() << log2BS;
+    }
+}
+
+
+std::int32_t ZoneHeap::numberOfRegionsUsed() const {
+    std::int32_t n = 0;
+    for ( std::int32_t i = 0; i < numberOfRegions(); i++ ) {
+        if ( _regionUsed[ i ] )
+            n++;
+    }
+    return n;
+}
+
+
+std::int32_t ZoneHeap::findEvacuationCandidate( std::int32_t maxOccupancy, std::int32_t excludedRegion ) const {
+    if ( _frontier == nullptr )
+        return -1;
+
+    // only regions entirely below the frontier qualify, so that nothing is moved into the region being evacuated
+    std::int32_t limit = ( blockAddr( _frontier ) - base ) >> log2RS;
+    std::int32_t best  = -1;
+    for ( std::int32_t i = 0; i < limit; i++ ) {
+        std::int32_t used = _regionUsed[ i ];
+        if ( i == excludedRegion or used == 0 or used > frontierBytes() )
+            continue;
+        if ( used * 100 < regionSize() * maxOccupancy and ( best < 0 or used < _regionUsed[ best ] ) )
+            best = i;
+    }
+    return best;
+}
+
+
+std::int32_t ZoneHeap::evacuate( std::int32_t region, std::int32_t maxBytes, bool move( const char *from, char *to, std::int32_t nbytes ), bool &done ) {
+    st_assert( region >= 0 and region < numberOfRegions(), "no such region" );
+    ResourceMark resourceMark;
+
+    // the sources are freed after the walk; freeing them right away could combine them with the chunk we look at next
+    GrowableArray<ChunkKlass *> *moved = new GrowableArray<ChunkKlass *>( 16 );
+    std::int32_t                movedBytes = 0;
+    const char                  *regionStart = base + ( region << log2RS );
+    const char                  *regionEnd   = min( regionStart + regionSize(), endAddr() );
+
+    ChunkKlass *m = _heapKlass;
+    while ( m < heapEnd() and blockAddr( m ) < regionStart )
+        m = m->next();
+
+    done = false;
+    for ( ; m < heapEnd() and blockAddr( m ) < regionEnd; m = m->next() ) {
+        if ( m->isUnused() )
+            continue;
+        std::int32_t blocks = m->size();
+        std::int32_t bytes  = blocks << log2BS;
+        if ( movedBytes > 0 and movedBytes + bytes > maxBytes )
+            break;
+
+        char *to = (char *) allocFromFrontier( blocks );
+        if ( to == nullptr )
+            break;
+
+        if ( move( blockAddr( m ), to, bytes ) ) {
+            _bytesUsed += bytes;
+            _regionUsed[ regionOf( to ) ] += bytes;
+            moved->append( m );
+            movedBytes += bytes;
+        } else {
+            // pinned; give the blocks back to the frontier
+            ChunkKlass   *t    = mapAddr( to );
+            std::int32_t total = blocks + ( _frontier ? _frontier->size() : 0 );
+            if ( _frontier ) {
+                if ( _lastCombine == _frontier )
+                    _lastCombine = t;
+                _frontier->invalidate();
+            }
+            t->markUnused( total );
+            setFrontier( t );
+        }
+    }
+    if ( m >= heapEnd() or blockAddr( m ) >= regionEnd )
+        done = true;
+
+    // the internal fragmentation moves along with the chunk, so free the whole chunk
+    for ( std::int32_t i = 0; i < moved->length(); i++ ) {
+        ChunkKlass *c = moved->at( i );
+        deallocate( (void *) blockAddr( c ), c->size() << log2BS );
+    }
+
+    return movedBytes;
+}
+
+
 const void *ZoneHeap::firstUsed() const {
     if ( usedBytes() == 0 )
         return nullptr;
@@ -594,6 +809,14 @@ void ZoneHeap::verify() const {
     if ( not _lastCombine->verify() )
         error( " chunkState::invalid lastCombine in heap 0x{0:x}", this );
 
+    // verify the free list bit mask and the frontier
+    for ( std::int32_t i = 0; i < nfree; i++ ) {
+        if ( _freeList[ i ].isEmpty() == ( ( _nonEmptyLists & ( 1 << i ) ) not_eq 0 ) )
+            error( "free list bit mask out of date for list %ld in heap 0x%lx", i, this );
+    }
+    if ( _frontier and ( not _frontier->verify() or _frontier->isUsed() ) )
+        error( "invalid frontier 0x%lx in heap 0x%lx", _frontier, this );
+
 }
 
 
@@ -608,4 +831,6 @@ void ZoneHeap::print() const {
     for ( std::size_t i = 0; i < nfree; i++ )
         SPDLOG_INFO( "%ld ", _freeList[ i ].length() );
     SPDLOG_INFO( "; %ld", _bigList->length() );
+    printIndent();
+    SPDLOG_INFO( "  frontier {} bytes; {} of {} regions ({}K) in use", frontierBytes(), numberOfRegionsUsed(), numberOfRegions(), regionSize() / 1024 );
 }
@@ -15,6 +15,11 @@
 // Basic heap management
 // maintains a map of the heap + free lists to reduce fragmentation
 // allocations are in multiples of block size (2**k)
+//
+// Allocation first tries the free list for the exact size (one list per size up to nfree blocks), then bumps the
+// frontier, a large unused chunk (initially the whole heap) kept off the free lists, and only then splits larger free chunks.
+// For incremental compaction the heap is divided into regions; the used bytes of every region are tracked so that sparse
+// regions can be evacuated (moved to the frontier) a few chunks at a time.
 
 //class HeapChunk;
 //
@@ -270,6 +275,12 @@ protected:
     FreeList   *_bigList;       // list of all big free blocks
     ChunkKlass *_lastCombine;   // result of last block combination
 
+    std::uint32_t _nonEmptyLists;   // bit i is set iff _freeList[i] is not empty
+    ChunkKlass    *_frontier;       // unused chunk allocations are bumped from (not on any free list), or nullptr
+
+    std::int32_t log2RS;            // log2(region size)
+    std::int32_t *_regionUsed;      // used bytes per region (a chunk counts for the region it starts in)
+
 public:
     ZoneHeap *_newHeap;                 // only set when growing a heap (i.e. replacing it)
     bool     _combineOnDeallocation;    // do eager block combination on deallocs?
@@ -295,6 +306,31 @@ public:
     // Compaction
     const char *compact( void move( const char *from, char *to, std::int32_t nbytes ) );    // returns first free byte
 
+    // Incremental compaction
+    std::int32_t regionSize() const {
+        return 1 << log2RS;
+    }
+
+
+    std::int32_t numberOfRegions() const {
+        return ( size + regionSize() - 1 ) >> log2RS;
+    }
+
+
+    std::int32_t usedBytesInRegion( std::int32_t region ) const {
+        return _regionUsed[ region ];
+    }
+
+
+    std::int32_t frontierBytes() const;
+
+    // Returns the sparsest region (below the frontier) that is less than maxOccupancy percent used, or -1.
+    std::int32_t findEvacuationCandidate( std::int32_t maxOccupancy, std::int32_t excludedRegion ) const;
+
+    // Moves up to maxBytes of the used chunks of region to the frontier; move returns false if a chunk cannot be moved.
+    // Sets done if the whole region has been visited. Returns the number of bytes moved.
+    std::int32_t evacuate( std::int32_t region, std::int32_t maxBytes, bool move( const char *from, char *to, std::int32_t nbytes ), bool &done );
+
     // Sizes
     std::int32_t capacity() const {
         return size;
@@ -311,6 +347,9 @@ public:
     }
 
 
+    std::int32_t numberOfRegionsUsed() const;
+
+
     // Fragmentation
     double intFrag() const {
         return usedBytes() ? (float) _ifrag / usedBytes() : 0;
@@ -374,6 +413,11 @@ protected:
     }
 
 
+    std::int32_t regionOf( const void *p ) const {
+        return ( (const char *) p - base ) >> log2RS;
+    }
+
+
     // Free list management
     void *allocFromLists( std::int32_t wantedBytes );
 
@@ -381,6 +425,14 @@ protected:
 
     void removeFromFreeList( ChunkKlass *m );
 
+    void *allocFromFrontier( std::int32_t wantedBlocks );
+
+    bool refillFrontier( std::int32_t wantedBlocks );
+
+    void setFrontier( ChunkKlass *m );
+
+    void recomputeRegionUsage();
+
     std::int32_t combineAll();
 
     std::int32_t combine( HeapChunk *&m );
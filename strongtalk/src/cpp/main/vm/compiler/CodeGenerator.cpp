@@ -256,11 +256,32 @@ void CodeGenerator::jmp( Node *from, Node *to, bool to_maybe_nontrivial ) {
         st_assert( not to->hasMapping(), "more than one predecessor?" );
         to->setMapping( _currentMapping );
     }
+    if ( GenerateLoopSafepoints and from not_eq nullptr and to->_label.is_bound() ) {
+        // backward jump => loop back-edge
+        loopSafepoint( from, to );
+    }
     _masm->jmp( to->_label );
     setMapping( nullptr );
 }
 
 
+void CodeGenerator::loopSafepoint( Node *from, Node *to ) {
+    // The active stack limit is raised above any stack address to preempt the active process
+    // (see DeltaProcess::preempt_active), so the common case is a single compare and jump back
+    // to the loop head. Otherwise all registers are saved (the process may be suspended and a GC
+    // happen) and reloaded according to the loop head mapping after the call.
+    _masm->cmpl( esp, Address( std::int32_t( active_stack_limit() ), RelocationInformation::RelocationType::external_word_type ) );
+    _masm->jcc( Assembler::Condition::greaterEqual, to->_label );
+    setMapping( new PseudoRegisterMapping( _currentMapping ) );
+    _currentMapping->saveRegisters();
+    _currentMapping->killRegisters();
+    updateDebuggingInfo( from );
+    _masm->call_C( (const char *) &check_stack_overflow, RelocationInformation::RelocationType::runtime_call_type );
+    _currentMapping->killRegisters();
+    _currentMapping->makeConformant( to->mapping() );
+}
+
+
 void CodeGenerator::jcc( Assembler::Condition cc, Node *from, Node *to, bool to_maybe_nontrivial ) {
     // make mappings conformant if necessary
     if ( to_maybe_nontrivial or ( to->isMergeNode() and not to->isTrivial() ) ) {
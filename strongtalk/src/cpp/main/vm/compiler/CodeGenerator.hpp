@@ -58,6 +58,8 @@ private:
 
     void bindLabel( Node *node );
 
+    void loopSafepoint( Node *from, Node *to );
+
     void inlineCache( Node *call, MergeNode *nlrTestPoint, std::int32_t flags = 0 );
 
     void updateDebuggingInfo( Node *node );
@@ -63,6 +63,7 @@ Compiler::Compiler( LookupKey *k, MethodOop m, CompiledInlineCache *i ) :
     _nextLevel{},
     _hasInlinableSendsRemaining{},
     _uses_inlining_database{},
+    _compileTime{},
     key{ k },
     ic{ i },
     parentNativeMethod{ nullptr },
@@ -103,6 +104,7 @@ Compiler::Compiler( RecompilationScope *scope ) :
     _nextLevel{},
     _hasInlinableSendsRemaining{},
     _uses_inlining_database{},
+    _compileTime{},
     key{ scope->key() },
     ic{ nullptr },
     parentNativeMethod{ nullptr },
@@ -143,6 +145,7 @@ Compiler::Compiler( BlockClosureOop blk, NonInlinedBlockScopeDescriptor *scope )
     _nextLevel{},
     _hasInlinableSendsRemaining{},
     _uses_inlining_database{},
+    _compileTime{},
     key{},
     ic{ nullptr },
     parentNativeMethod{ nullptr },
@@ -173,7 +176,7 @@ Compiler::Compiler( BlockClosureOop blk, NonInlinedBlockScopeDescriptor *scope )
     std::int32_t   sub_index;
     parentNativeMethod = e->parent_nativeMethod( sub_index );
 
-    std::int16_t main_index = parentNativeMethod->_mainId.is_block() ? parentNativeMethod->_promotedId.major() : parentNativeMethod->_mainId.major();
+    std::uint32_t main_index = parentNativeMethod->_mainId.is_block() ? parentNativeMethod->_promotedId.major() : parentNativeMethod->_mainId.major();
 
     main_jumpTable_id     = JumpTableID( main_index, sub_index );
     promoted_jumpTable_id = JumpTableID();
@@ -477,6 +480,9 @@ NativeMethod *Compiler::compile() {
     bool      should_trace = _uses_inlining_database ? PrintInliningDatabaseCompilation : PrintCompilation;
     TraceTime t( compiling, should_trace );
 
+    ElapsedTimer compileTimer;
+    compileTimer.start();
+
     if ( should_trace or PrintCode ) {
         print_key( _console );
         if ( PrintCode or PrintInlining ) {
@@ -596,6 +602,8 @@ NativeMethod *Compiler::compile() {
     }
 
     rec->generate();            // write debugging info
+    compileTimer.stop();
+    _compileTime = std::int32_t( compileTimer.seconds() * 1000000 );
     NativeMethod *nm = new_nativeMethod( this );    // construct new NativeMethod
     em.event.args[ 1 ] = nm;
 
@@ -40,6 +40,7 @@ private:
     std::int32_t                  _nextLevel;                          // optimization level for NativeMethod being created
     bool                          _hasInlinableSendsRemaining;         // no inlinable sends remaining?
     bool                          _uses_inlining_database;             // tells whether the compilation is base on inlinine database information.
+    std::int32_t                  _compileTime;                        // time spent compiling (in microseconds; used by the zone's eviction policy)
 
 public:
     LookupKey                               *key;
@@ -185,6 +186,12 @@ public:
 
     std::int32_t estimatedSize() const;
 
+
+    std::int32_t compile_time() const {
+        return _compileTime;
+    }
+
+
     InlinedScope *currentScope() const;            // scope currently being compiled
     void enterScope( InlinedScope *s );
 
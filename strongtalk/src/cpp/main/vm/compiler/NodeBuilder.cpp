@@ -27,6 +27,7 @@
 #include "vm/oop/DoubleOopDescriptor.hpp"
 #include "vm/oop/ContextOopDescriptor.hpp"
 #include "vm/compiler/NodeFactory.hpp"
+#include "vm/interpreter/BranchProfile.hpp"
 
 
 // Class variables
@@ -215,6 +216,50 @@ TypeTestNode *NodeBuilder::makeTestNode( bool cond, PseudoRegister *r ) {
 }
 
 
+void NodeBuilder::one_sided_if_node( IfNode *node, Expression *condition, bool then_part ) {
+    // the interpreter never executed one part of the if: only the other part is compiled,
+    // the test for the never executed part becomes an uncommon trap (resuming at the if)
+    std::int32_t   resultByteCodeIndex = node->begin_byteCodeIndex();
+    MethodInterval *code               = then_part ? node->then_code() : node->else_code();
+    TypeTestNode   *test               = makeTestNode( then_part ? not node->is_ifTrue() : node->is_ifTrue(), condition->pseudoRegister() );
+    append( test );
+    test->append( 1, NodeFactory::UncommonNode( copyCurrentExprStack(), byteCodeIndex() ) );
+    if ( code == nullptr ) {
+        // no else branch and the then branch is never executed
+        st_assert( not node->produces_result(), "inconsistency - else branch required" );
+        MergeNode *endOfIf = NodeFactory::createAndRegisterNode<MergeNode>( node->end_byteCodeIndex() );
+        test->append( 2, endOfIf );
+        splitMergeExpression( condition, test );
+        setCurrent( endOfIf );
+        comment( "end of if" );
+        return;
+    }
+
+    MergeNode *branch = NodeFactory::createAndRegisterNode<MergeNode>( code->begin_byteCodeIndex() );
+    test->append( 2, branch );
+    splitMergeExpression( condition, test );
+    setCurrent( branch );
+    generate_subinterval( code, node->produces_result() );
+    if ( node->produces_result() ) {
+        // as in constant_if_node: the result need not be materialized since it isn't merged
+        Expression *res = exprStack()->top();
+        scope()->setExprForByteCodeIndex( resultByteCodeIndex, res );      // for debugging info
+        st_assert( not res->isNoResultExpression() or is_in_dead_code(), "no result should imply in_dead_code" );
+        abortIfDead( res );
+    } else {
+        if ( is_in_dead_code() )
+            abort();
+    }
+    comment( "end of if" );
+}
+
+
+static bool never_executed( std::uint32_t count, std::uint32_t other_count ) {
+    // a part of an if is treated as never executed only if the other part has been executed often enough
+    return count == 0 and other_count >= static_cast<std::uint32_t>( ColdBranchLimit );
+}
+
+
 void NodeBuilder::if_node( IfNode *node ) {
 
     Expression   *cond               = exprStack()->pop();
@@ -229,7 +274,20 @@ void NodeBuilder::if_node( IfNode *node ) {
         constant_if_node( node, (ConstantExpression *) cond );
     } else {
         // non-constant condition
-        TypeTestNode *test = makeTestNode( node->is_ifTrue(), cond->pseudoRegister() );
+        // The interpreter's counts for the jump (if still in the branch profile) tell which part is likely
+        // (the then part is the fall through of the jump). The likely part is the last successor of the test,
+        // so it is laid out right after it.
+        std::uint32_t thenCount = 0;
+        std::uint32_t elseCount = 0;
+        const bool    profiled  = BranchProfile::lookup( node->method(), node->begin_byteCodeIndex(), thenCount, elseCount );
+        if ( profiled and theCompiler->useUncommonTraps ) {
+            if ( never_executed( thenCount, elseCount ) or never_executed( elseCount, thenCount ) ) {
+                one_sided_if_node( node, cond, thenCount not_eq 0 );
+                return;
+            }
+        }
+        const bool   thenIsLikely = profiled and thenCount > elseCount;
+        TypeTestNode *test        = makeTestNode( thenIsLikely ? not node->is_ifTrue() : node->is_ifTrue(), cond->pseudoRegister() );
         append( test );
         if ( node->else_code() not_eq nullptr ) {
             // with else branch
@@ -239,8 +297,8 @@ void NodeBuilder::if_node( IfNode *node ) {
             MergeNode                    *ifBranch   = NodeFactory::createAndRegisterNode<MergeNode>( node->then_code()->begin_byteCodeIndex() );
             MergeNode                    *elseBranch = NodeFactory::createAndRegisterNode<MergeNode>( node->else_code()->begin_byteCodeIndex() );
             MergeNode                    *endOfIf    = NodeFactory::createAndRegisterNode<MergeNode>( node->end_byteCodeIndex() );
-            test->append( 1, ifBranch );
-            test->append( 2, elseBranch );
+            test->append( 1, thenIsLikely ? elseBranch : ifBranch );
+            test->append( 2, thenIsLikely ? ifBranch : elseBranch );
             splitMergeExpression( cond, test );
             // then branch
             setCurrent( ifBranch );
@@ -286,8 +344,8 @@ void NodeBuilder::if_node( IfNode *node ) {
             st_assert( not node->produces_result(), "inconsistency - else branch required" );
             MergeNode *ifBranch = NodeFactory::createAndRegisterNode<MergeNode>( node->then_code()->begin_byteCodeIndex() );
             MergeNode *endOfIf  = NodeFactory::createAndRegisterNode<MergeNode>( node->end_byteCodeIndex() );
-            test->append( 1, ifBranch );
-            test->append( 2, endOfIf );
+            test->append( 1, thenIsLikely ? endOfIf : ifBranch );
+            test->append( 2, thenIsLikely ? ifBranch : endOfIf );
             splitMergeExpression( cond, test );
             // then branch
             setCurrent( ifBranch );
@@ -373,7 +431,36 @@ void NodeBuilder::cond_node( CondNode *node ) {
 }
 
 
+void NodeBuilder::never_entered_while_node( WhileNode *node ) {
+    // the interpreter always left the loop right after the first test of the condition: only the condition is
+    // compiled, repeating the loop becomes an uncommon trap (so there is no loop at all)
+    MergeNode *exit = NodeFactory::createAndRegisterNode<MergeNode>( node->end_byteCodeIndex() );
+    generate_subinterval( node->expr_code(), true );
+    Expression *cond = exprStack()->pop();
+    if ( abortIfDead( cond ) ) {
+        return;
+    }
+    TypeTestNode *test = makeTestNode( node->is_whileTrue(), cond->pseudoRegister() );
+    append( test );
+    test->append( 1, NodeFactory::UncommonNode( copyCurrentExprStack(), byteCodeIndex() ) );
+    test->append( 2, exit );
+    splitMergeExpression( cond, test );
+    setCurrent( exit );
+    comment( "end of never entered while" );
+}
+
+
 void NodeBuilder::while_node( WhileNode *node ) {
+    // the interpreter's counts for the loop jump tell whether the loop was ever repeated
+    std::uint32_t repeatCount = 0;
+    std::uint32_t exitCount   = 0;
+    if ( theCompiler->useUncommonTraps and BranchProfile::lookup( node->method(), node->jump_byteCodeIndex(), repeatCount, exitCount ) ) {
+        if ( never_executed( repeatCount, exitCount ) ) {
+            never_entered_while_node( node );
+            return;
+        }
+    }
+
     std::int32_t   loop_byteCodeIndex = node->body_code() not_eq nullptr ? node->body_code()->begin_byteCodeIndex() : node->expr_code()->begin_byteCodeIndex();
     CompiledLoop   *wloop             = _scope->addLoop();
     LoopHeaderNode *header            = NodeFactory::createAndRegisterNode<LoopHeaderNode>();
@@ -81,6 +81,8 @@ private:
     bool abortIfDead( Expression *e );                        // helper function for dead code handling
     void generate_subinterval( MethodInterval *m, bool produces_result );    // generate subinterval (e.g., code in then branch)
     void constant_if_node( IfNode *node, ConstantExpression *condition );        // code for if with const condition
+    void one_sided_if_node( IfNode *node, Expression *condition, bool then_part ); // code for if with one part never executed
+    void never_entered_while_node( WhileNode *node );                                // code for loop whose body was never executed
     TypeTestNode *makeTestNode( bool cond, PseudoRegister *r );            // make boolean type test node
 
     // for Inliner
@@ -709,6 +709,70 @@ Expression *PrimitiveInliner::array_at_put_ifFail( ArrayAtPutNode::AccessType ac
 }
 
 
+static bool is_byte_string( Expression *e ) {
+    if ( not e->hasKlass() )
+        return false;
+    Klass::Format format = e->klass()->klass_part()->format();
+    return format == Klass::Format::byte_array_klass or format == Klass::Format::symbol_klass;
+}
+
+
+static bool is_double_byte_string( Expression *e ) {
+    return e->hasKlass() and e->klass()->klass_part()->format() == Klass::Format::double_byte_array_klass;
+}
+
+
+Expression *PrimitiveInliner::string_kernel( bool string_argument ) {
+    assert_failure_block();
+    assert_receiver();
+
+    // The string kernel primitives only fail if an argument has the wrong type or the start index
+    // is below 1. If the compiler can rule out both, the primitive is called without failure code;
+    // otherwise it is called as usual (returns nullptr).
+    Expression *receiver = parameter( 0 );
+    Expression *argument = parameter( 1 );
+    bool       double_byte = is_double_byte_string( receiver );
+    if ( not double_byte and not is_byte_string( receiver ) )
+        return nullptr;
+
+    if ( string_argument ) {
+        if ( not is_byte_string( argument ) and not is_double_byte_string( argument ) )
+            return nullptr;
+    } else if ( not argument->isSmallIntegerOop() ) {
+        return nullptr;
+    }
+
+    if ( number_of_parameters() == 3 ) {
+        // startingAt:, substrings must be of the same kind as the receiver
+        if ( string_argument and is_double_byte_string( argument ) not_eq double_byte )
+            return nullptr;
+        Expression *start = parameter( 2 );
+        if ( not start->isConstantExpression() or not start->constant()->isSmallIntegerOop() or SmallIntegerOop( start->constant() )->value() < 1 )
+            return nullptr;
+    }
+
+    return genCall( false );
+}
+
+
+Expression *PrimitiveInliner::array_copy_size() {
+    assert_failure_block();
+    assert_receiver();
+
+    // The bulk copy only fails if an argument has the wrong type, from or start is below 1 or the
+    // size is negative. If constant arguments rule this out, the primitive is called without
+    // failure code; otherwise it is called as usual (returns nullptr).
+    for ( std::int32_t i = 1; i <= 3; i++ ) {
+        Expression   *argument = parameter( i );
+        std::int32_t minimum   = i == 3 ? 0 : 1;
+        if ( not argument->isConstantExpression() or not argument->constant()->isSmallIntegerOop() or SmallIntegerOop( argument->constant() )->value() < minimum )
+            return nullptr;
+    }
+
+    return genCall( false );
+}
+
+
 Expression *PrimitiveInliner::obj_new() {
     // replace generic allocation primitive by size-specific primitive, if possible
     Expression *receiver = parameter( 0 );
@@ -1003,6 +1067,10 @@ Expression *PrimitiveInliner::tryInline() {
                 res = array_at_put_ifFail( ArrayAtPutNode::object_at_put );
                 break;
             }
+            if ( equal( name, "primitiveIndexedObjectCopyFrom:startingAt:size:ifFail:" ) ) {
+                res = array_copy_size();
+                break;
+            }
             break;
         case PrimitiveGroup::ByteArrayPrimitive:
             if ( equal( name, "primitiveIndexedByteSize" ) ) {
@@ -1017,6 +1085,26 @@ Expression *PrimitiveInliner::tryInline() {
                 res = array_at_put_ifFail( ArrayAtPutNode::byte_at_put );
                 break;
             }
+            if ( equal( name, "primitiveIndexedByteEqual:ifFail:" ) ) {
+                res = string_kernel( true );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedByteCaseInsensitiveCompare:ifFail:" ) ) {
+                res = string_kernel( true );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedByteIndexOf:startingAt:ifFail:" ) ) {
+                res = string_kernel( false );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedByteIndexOfSubstring:startingAt:ifFail:" ) ) {
+                res = string_kernel( true );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedByteOccurrencesOf:ifFail:" ) ) {
+                res = string_kernel( false );
+                break;
+            }
             break;
         case PrimitiveGroup::DoubleByteArrayPrimitive:
             if ( equal( name, "primitiveIndexedDoubleByteSize" ) ) {
@@ -1035,6 +1123,26 @@ Expression *PrimitiveInliner::tryInline() {
                 res = array_at_put_ifFail( ArrayAtPutNode::double_byte_at_put );
                 break;
             }
+            if ( equal( name, "primitiveIndexedDoubleByteEqual:ifFail:" ) ) {
+                res = string_kernel( true );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedDoubleByteCaseInsensitiveCompare:ifFail:" ) ) {
+                res = string_kernel( true );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedDoubleByteIndexOf:startingAt:ifFail:" ) ) {
+                res = string_kernel( false );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedDoubleByteIndexOfSubstring:startingAt:ifFail:" ) ) {
+                res = string_kernel( true );
+                break;
+            }
+            if ( equal( name, "primitiveIndexedDoubleByteOccurrencesOf:ifFail:" ) ) {
+                res = string_kernel( false );
+                break;
+            }
             break;
         case PrimitiveGroup::BlockPrimitive:
             if ( strncmp( name, "primitiveValue", 14 ) == 0 ) {
@@ -84,6 +84,10 @@ private:
 
     Expression *array_at_put_ifFail( ArrayAtPutNode::AccessType access_type );
 
+    Expression *string_kernel( bool string_argument );
+
+    Expression *array_copy_size();
+
     Expression *obj_new();
 
     Expression *obj_shallowCopy();
@@ -0,0 +1,87 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/interpreter/BranchProfile.hpp"
+#include "vm/interpreter/CodeIterator.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <array>
+
+
+static_assert( ( branch_profile_size & ( branch_profile_size - 1 ) ) == 0, "branch_profile_size must be a power of 2" );
+static_assert( sizeof( BranchProfileEntry ) == ( 1 << BranchProfileEntry::size_log2 ), "the interpreter relies on the entry size" );
+
+static std::array<BranchProfileEntry, branch_profile_size> entries;
+
+
+address_t BranchProfile::table_address() {
+    return address_t( &entries[ 0 ] );
+}
+
+
+BranchProfileEntry *BranchProfile::entry_for( const std::uint8_t *hp ) {
+    // must match the index computation in InterpreterGenerator::profile_branch
+    return &entries[ std::uint32_t( hp ) & ( branch_profile_size - 1 ) ];
+}
+
+
+bool BranchProfile::lookup( const std::uint8_t *hp, std::uint32_t &fallThroughs, std::uint32_t &jumps ) {
+    BranchProfileEntry *e = entry_for( hp );
+    if ( e->_hp not_eq hp )
+        return false;
+    fallThroughs = e->_fallThroughs;
+    jumps        = e->_jumps;
+    return true;
+}
+
+
+bool BranchProfile::lookup( MethodOop method, std::int32_t byteCodeIndex, std::uint32_t &fallThroughs, std::uint32_t &jumps ) {
+    return lookup( method->codes( byteCodeIndex ), fallThroughs, jumps );
+}
+
+
+bool BranchProfile::is_profiled( ByteCodes::Code code ) {
+    switch ( code ) {
+        case ByteCodes::Code::ifTrue_byte:
+        case ByteCodes::Code::ifTrue_word:
+        case ByteCodes::Code::ifFalse_byte:
+        case ByteCodes::Code::ifFalse_word:
+        case ByteCodes::Code::whileTrue_byte:
+        case ByteCodes::Code::whileTrue_word:
+        case ByteCodes::Code::whileFalse_byte:
+        case ByteCodes::Code::whileFalse_word:
+            return true;
+        default:
+            return false;
+    }
+}
+
+
+void BranchProfile::flush_jump( const std::uint8_t *hp ) {
+    BranchProfileEntry *e = entry_for( hp );
+    if ( e->_hp == hp )
+        e->clear();
+}
+
+
+void BranchProfile::flush( MethodOop method ) {
+    // only the entries the jumps of the method map to can belong to it
+    CodeIterator c( method );
+    do {
+        if ( is_profiled( c.code() ) )
+            flush_jump( c.hp() );
+
+        MethodOop block_method = c.block_method();
+        if ( block_method )
+            flush( block_method );
+    } while ( c.advance() );
+}
+
+
+void BranchProfile::flush() {
+    for ( std::size_t i = 0; i < branch_profile_size; i++ )
+        entries[ i ].clear();
+}
+
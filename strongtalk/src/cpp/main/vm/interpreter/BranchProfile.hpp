@@ -0,0 +1,95 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/system/asserts.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/MethodOopDescriptor.hpp"
+#include "vm/interpreter/ByteCodes.hpp"
+
+
+// The branch profile records the outcome of the conditional jumps of ifs and loops (ifTrue/ifFalse/whileTrue/whileFalse)
+// executed by the interpreter, so that the compiler can defer never-taken branches as uncommon and lay out the likely
+// path first. The jumps of and/or are not profiled.
+//
+// It is a direct-mapped table indexed by the address of the jump bytecode. An entry is owned by one jump; it is only
+// taken over by another jump mapping to the same entry after BranchProfileClaimLimit executions of other jumps without
+// an execution of the owner. So storage is effectively allocated once a branch gets warm, and cold code never
+// displaces hot code.
+//
+// Entries of a method are dropped when the method is compiled; the whole table is flushed when old space is compacted
+// (the jump addresses change).
+
+constexpr std::int32_t branch_profile_size = 4 * 1024;     // # of entries (must be a power of 2)
+
+
+class BranchProfileEntry {
+
+public:
+    std::uint8_t  *_hp;             // address of the owning jump bytecode (nullptr if unused)
+    std::uint32_t _fallThroughs;    // # of times the condition held (if: the then part was executed, while: the loop repeated)
+    std::uint32_t _jumps;           // # of times it did not (if: the else part was executed, while: the loop was left)
+    std::uint32_t _misses;          // # of executions of other jumps mapping to this entry since the owner was last executed
+
+    void clear() {
+        _hp           = nullptr;
+        _fallThroughs = 0;
+        _jumps        = 0;
+        _misses       = 0;
+    }
+
+
+    // Used by the interpreter
+    static std::int32_t hp_byte_offset() {
+        return 0 * sizeof( std::int32_t );
+    }
+
+
+    static std::int32_t fall_throughs_byte_offset() {
+        return 1 * sizeof( std::int32_t );
+    }
+
+
+    static std::int32_t jumps_byte_offset() {
+        return 2 * sizeof( std::int32_t );
+    }
+
+
+    static std::int32_t misses_byte_offset() {
+        return 3 * sizeof( std::int32_t );
+    }
+
+
+    static constexpr std::int32_t size_log2 = 4;    // entries are 16 bytes
+};
+
+
+class BranchProfile : AllStatic {
+
+private:
+    static BranchProfileEntry *entry_for( const std::uint8_t *hp );
+
+    static void flush_jump( const std::uint8_t *hp );
+
+    static address_t table_address();
+
+public:
+    static bool is_profiled( ByteCodes::Code code );
+
+    // Returns true and the counts if the jump at hp has been profiled.
+    static bool lookup( const std::uint8_t *hp, std::uint32_t &fallThroughs, std::uint32_t &jumps );
+
+    // Convenience for the compiler
+    static bool lookup( MethodOop method, std::int32_t byteCodeIndex, std::uint32_t &fallThroughs, std::uint32_t &jumps );
+
+    // Flushing
+    static void flush( MethodOop method );    // drops the entries of method (and its blocks)
+
+    static void flush();
+
+    friend class InterpreterGenerator;
+};
@@ -25,6 +25,8 @@ ByteCodes::ArgumentSpec     ByteCodes::_argument_spec[static_cast<std::int32_t>(
 ByteCodes::SendType         ByteCodes::_send_type[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
 bool                        ByteCodes::_single_step[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
 bool                        ByteCodes::_pop_tos[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
+ByteCodes::Code             ByteCodes::_generic_code[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
+ByteCodes::Code             ByteCodes::_second_component[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
 
 
 void ByteCodes::def( Code code ) {
@@ -92,6 +94,40 @@ void ByteCodes::def( Code code, const char *name, Format format, CodeType code_t
     _send_type[ static_cast<std::int32_t>(code) ]     = send_type;
     _single_step[ static_cast<std::int32_t>(code) ]   = single_step;
     _pop_tos[ static_cast<std::int32_t>(code) ]       = pop_tos;
+    _generic_code[ static_cast<std::int32_t>(code) ]     = code;
+    _second_component[ static_cast<std::int32_t>(code) ] = ByteCodes::Code::halt;
+}
+
+
+void ByteCodes::def_superinstruction( Code code, const char *name, Code first, Code second ) {
+    st_assert( format( first ) == ByteCodes::Format::B and format( second ) not_eq ByteCodes::Format::UNDEFINED, "components must be defined" );
+    st_assert( not is_send_code( first ) and not is_send_code( second ), "sends cannot be fused" );
+    st_assert( not is_superinstruction( first ) and not is_superinstruction( second ), "superinstructions cannot be nested" );
+
+    // the superinstruction looks like its first component to everybody but the interpreter;
+    // it is intercepted on single step if either component is (stepping over it executes both)
+    def( code, name, format( first ), code_type( first ), single_step( first ) or single_step( second ), argument_spec( first ), send_type( first ), pop_tos( first ) );
+    _generic_code[ static_cast<std::int32_t>(code) ]     = first;
+    _second_component[ static_cast<std::int32_t>(code) ] = second;
+}
+
+
+void ByteCodes::def_quick_primitive_call( Code code, const char *name, Code generic ) {
+    st_assert( code_type( generic ) == ByteCodes::CodeType::PRIMITIVE_CALL and format( generic ) not_eq ByteCodes::Format::BO and format( generic ) not_eq ByteCodes::Format::BOL, "generic form must be a patched primitive call" );
+
+    def( code, name, format( generic ), code_type( generic ), single_step( generic ), argument_spec( generic ), send_type( generic ), pop_tos( generic ) );
+    _generic_code[ static_cast<std::int32_t>(code) ] = generic;
+}
+
+
+ByteCodes::Code ByteCodes::superinstruction_for( Code first, Code second ) {
+    for ( std::size_t i = 0; i < static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES); i++ ) {
+        const Code code = Code( i );
+        if ( is_superinstruction( code ) and generic_code_for( code ) == first and second_component_of( code ) == second ) {
+            return code;
+        }
+    }
+    return first;
 }
 
 
@@ -156,14 +192,7 @@ void ByteCodes::init() {
     def( ByteCodes::Code::push_true, "push_true", ByteCodes::Format::B, ByteCodes::CodeType::MISCELLANEOUS, no_sst );
     def( ByteCodes::Code::push_false, "push_false", ByteCodes::Format::B, ByteCodes::CodeType::MISCELLANEOUS, no_sst );
 
-    def( ByteCodes::Code::unimplemented_20 );
-    def( ByteCodes::Code::unimplemented_21 );
-    def( ByteCodes::Code::unimplemented_22 );
-    def( ByteCodes::Code::unimplemented_23 );
-    def( ByteCodes::Code::unimplemented_24 );
-    def( ByteCodes::Code::unimplemented_25 );
-    def( ByteCodes::Code::unimplemented_26 );
-    def( ByteCodes::Code::unimplemented_27 );
+    // 0x20 - 0x27: superinstructions, defined below
 
     def( ByteCodes::Code::return_instVar_name, "return_instVar_name", ByteCodes::Format::BO, ByteCodes::CodeType::INSTANCE_VARIABLE_ACCESS, no_sst );
     def( ByteCodes::Code::push_classVar, "push_classVar", ByteCodes::Format::BO, ByteCodes::CodeType::CLASS_VARIABLE_ACCESS, no_sst );
@@ -184,10 +213,7 @@ void ByteCodes::init() {
     def( ByteCodes::Code::float_unary_op_to_oop, "float_unary_op_to_oop", ByteCodes::Format::BBB, ByteCodes::CodeType::FLOAT_OPERATION, no_sst );
     def( ByteCodes::Code::float_binary_op_to_oop, "float_binary_op_to_oop", ByteCodes::Format::BBB, ByteCodes::CodeType::FLOAT_OPERATION, no_sst );
 
-    def( ByteCodes::Code::unimplemented_39 );
-    def( ByteCodes::Code::unimplemented_3a );
-    def( ByteCodes::Code::unimplemented_3b );
-    def( ByteCodes::Code::unimplemented_3c );
+    // 0x39 - 0x3c: superinstructions, defined below
 
     def( ByteCodes::Code::push_instVar_name, "push_instVar_name", ByteCodes::Format::BO, ByteCodes::CodeType::INSTANCE_VARIABLE_ACCESS, no_sst );
     def( ByteCodes::Code::store_instVar_pop_name, "store_instVar_pop_name", ByteCodes::Format::BO, ByteCodes::CodeType::INSTANCE_VARIABLE_ACCESS, no_sst, pop );
@@ -319,12 +345,12 @@ void ByteCodes::init() {
     def( ByteCodes::Code::dll_call_sync, "dll_call_sync", ByteCodes::Format::BOOLB, ByteCodes::CodeType::DLL_CALL, do_sst );
     def( ByteCodes::Code::primitive_call_self, "primitive_call_self", ByteCodes::Format::BL, ByteCodes::CodeType::PRIMITIVE_CALL, do_sst );
     def( ByteCodes::Code::primitive_call_self_failure, "primitive_call_self_failure", ByteCodes::Format::BLL, ByteCodes::CodeType::PRIMITIVE_CALL, do_sst );
-    def( ByteCodes::Code::unimplemented_b7 );
+    // 0xb7: quick primitive call, defined below
     def( ByteCodes::Code::access_send_self, "access_send_self", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::ACCESSOR_SEND );
     def( ByteCodes::Code::primitive_send_0, "primitive_send_0", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::recv_0_args, ByteCodes::SendType::PRIMITIVE_SEND );
     def( ByteCodes::Code::primitive_send_super, "primitive_send_super", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::PRIMITIVE_SEND );
     def( ByteCodes::Code::primitive_send_super_pop, "primitive_send_super_pop", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::PRIMITIVE_SEND, pop );
-    def( ByteCodes::Code::unimplemented_bc );
+    // 0xbc: quick primitive call, defined below
     def( ByteCodes::Code::primitive_send_1, "primitive_send_1", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::recv_1_args, ByteCodes::SendType::PRIMITIVE_SEND );
     def( ByteCodes::Code::primitive_send_2, "primitive_send_2", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::recv_2_args, ByteCodes::SendType::PRIMITIVE_SEND );
     def( ByteCodes::Code::primitive_send_n, "primitive_send_n", ByteCodes::Format::BBOO, ByteCodes::ArgumentSpec::recv_n_args, ByteCodes::SendType::PRIMITIVE_SEND );
@@ -336,12 +362,12 @@ void ByteCodes::init() {
     def( ByteCodes::Code::dll_call_async, "dll_call_async", ByteCodes::Format::BOOLB, ByteCodes::CodeType::DLL_CALL, do_sst );
     def( ByteCodes::Code::primitive_call_self_lookup, "primitive_call_self_lookup", ByteCodes::Format::BO, ByteCodes::CodeType::PRIMITIVE_CALL, no_sst );
     def( ByteCodes::Code::primitive_call_self_failure_lookup, "primitive_call_self_failure_lookup", ByteCodes::Format::BOL, ByteCodes::CodeType::PRIMITIVE_CALL, no_sst );
-    def( ByteCodes::Code::unimplemented_c7 );
+    // 0xc7: quick primitive call, defined below
     def( ByteCodes::Code::access_send_0, "access_send_0", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::recv_0_args, ByteCodes::SendType::ACCESSOR_SEND );
     def( ByteCodes::Code::primitive_send_0_pop, "primitive_send_0_pop", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::recv_0_args, ByteCodes::SendType::PRIMITIVE_SEND, pop );
     def( ByteCodes::Code::primitive_send_self, "primitive_send_self", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::PRIMITIVE_SEND );
     def( ByteCodes::Code::primitive_send_self_pop, "primitive_send_self_pop", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::PRIMITIVE_SEND, pop );
-    def( ByteCodes::Code::unimplemented_cc );
+    // 0xcc: quick primitive call, defined below
     def( ByteCodes::Code::primitive_send_1_pop, "primitive_send_1_pop", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::recv_1_args, ByteCodes::SendType::PRIMITIVE_SEND, pop );
     def( ByteCodes::Code::primitive_send_2_pop, "primitive_send_2_pop", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::recv_2_args, ByteCodes::SendType::PRIMITIVE_SEND, pop );
     def( ByteCodes::Code::primitive_send_n_pop, "primitive_send_n_pop", ByteCodes::Format::BBOO, ByteCodes::ArgumentSpec::recv_n_args, ByteCodes::SendType::PRIMITIVE_SEND, pop );
@@ -358,7 +384,7 @@ void ByteCodes::init() {
     def( ByteCodes::Code::megamorphic_send_self_pop, "megamorphic_send_self_pop", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::MEGAMORPHIC_SEND, pop );
     def( ByteCodes::Code::megamorphic_send_super, "megamorphic_send_super", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::MEGAMORPHIC_SEND );
     def( ByteCodes::Code::megamorphic_send_super_pop, "megamorphic_send_super_pop", ByteCodes::Format::BOO, ByteCodes::ArgumentSpec::args_only, ByteCodes::SendType::MEGAMORPHIC_SEND, pop );
-    def( ByteCodes::Code::unimplemented_dc );
+    // 0xdc: quick primitive call, defined below
     def( ByteCodes::Code::special_primitive_send_1_hint, "special_primitive_send_1_hint", ByteCodes::Format::BB, ByteCodes::CodeType::MISCELLANEOUS, no_sst );
     def( ByteCodes::Code::unimplemented_de );
     def( ByteCodes::Code::unimplemented_df );
@@ -397,6 +423,27 @@ void ByteCodes::init() {
     def( ByteCodes::Code::unimplemented_fe );
     def( ByteCodes::Code::halt, "halt", ByteCodes::Format::B, ByteCodes::CodeType::CONTROL_STRUCTURE, no_sst );
 
+    // superinstructions (after their components)
+    def_superinstruction( ByteCodes::Code::push_temp_0_return_tos_pop_0, "push_temp_0+return_tos_pop_0", ByteCodes::Code::push_temp_0, ByteCodes::Code::return_tos_pop_0 );
+    def_superinstruction( ByteCodes::Code::push_temp_1_return_tos_pop_0, "push_temp_1+return_tos_pop_0", ByteCodes::Code::push_temp_1, ByteCodes::Code::return_tos_pop_0 );
+    def_superinstruction( ByteCodes::Code::push_self_push_temp_0, "push_self+push_temp_0", ByteCodes::Code::push_self, ByteCodes::Code::push_temp_0 );
+    def_superinstruction( ByteCodes::Code::push_self_push_arg_1, "push_self+push_arg_1", ByteCodes::Code::push_self, ByteCodes::Code::push_arg_1 );
+    def_superinstruction( ByteCodes::Code::push_self_push_literal, "push_self+push_literal", ByteCodes::Code::push_self, ByteCodes::Code::push_literal );
+    def_superinstruction( ByteCodes::Code::push_temp_0_push_temp_1, "push_temp_0+push_temp_1", ByteCodes::Code::push_temp_0, ByteCodes::Code::push_temp_1 );
+    def_superinstruction( ByteCodes::Code::push_temp_0_push_literal, "push_temp_0+push_literal", ByteCodes::Code::push_temp_0, ByteCodes::Code::push_literal );
+    def_superinstruction( ByteCodes::Code::push_arg_1_push_arg_2, "push_arg_1+push_arg_2", ByteCodes::Code::push_arg_1, ByteCodes::Code::push_arg_2 );
+    def_superinstruction( ByteCodes::Code::push_arg_1_return_tos_pop_1, "push_arg_1+return_tos_pop_1", ByteCodes::Code::push_arg_1, ByteCodes::Code::return_tos_pop_1 );
+    def_superinstruction( ByteCodes::Code::push_nil_return_tos_pop_0, "push_nil+return_tos_pop_0", ByteCodes::Code::push_nil, ByteCodes::Code::return_tos_pop_0 );
+    def_superinstruction( ByteCodes::Code::push_true_return_tos_pop_0, "push_true+return_tos_pop_0", ByteCodes::Code::push_true, ByteCodes::Code::return_tos_pop_0 );
+    def_superinstruction( ByteCodes::Code::push_false_return_tos_pop_0, "push_false+return_tos_pop_0", ByteCodes::Code::push_false, ByteCodes::Code::return_tos_pop_0 );
+
+    // quick primitive calls (after their generic forms)
+    def_quick_primitive_call( ByteCodes::Code::primitive_call_self_indexable_size, "primitive_call_self_indexable_size", ByteCodes::Code::primitive_call_self );
+    def_quick_primitive_call( ByteCodes::Code::primitive_call_self_objectArray_at, "primitive_call_self_objectArray_at", ByteCodes::Code::primitive_call_self_failure );
+    def_quick_primitive_call( ByteCodes::Code::primitive_call_self_objectArray_at_put, "primitive_call_self_objectArray_at_put", ByteCodes::Code::primitive_call_self_failure );
+    def_quick_primitive_call( ByteCodes::Code::primitive_call_self_byteArray_at, "primitive_call_self_byteArray_at", ByteCodes::Code::primitive_call_self_failure );
+    def_quick_primitive_call( ByteCodes::Code::primitive_call_self_byteArray_at_put, "primitive_call_self_byteArray_at_put", ByteCodes::Code::primitive_call_self_failure );
+
     // check if all bytecodes have been initialized
     for ( std::size_t i = 0; i < static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES); i++ ) {
         st_assert( _name[ static_cast<std::int32_t>( Code( i ) ) ] not_eq nullptr, "bytecode table not fully initialized" );
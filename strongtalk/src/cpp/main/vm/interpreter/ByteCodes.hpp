@@ -185,40 +185,40 @@ public:
         push_false       = 0x1f, //
 
         // row 0x02
-        unimplemented_20    = 0x20, //
-        unimplemented_21    = 0x21, //
-        unimplemented_22    = 0x22, //
-        unimplemented_23    = 0x23, //
-        unimplemented_24    = 0x24, //
-        unimplemented_25    = 0x25, //
-        unimplemented_26    = 0x26, //
-        unimplemented_27    = 0x27, //
-        return_instVar_name = 0x28, //
-        push_classVar       = 0x29, //
-        store_classVar_pop  = 0x2a, //
-        store_classVar      = 0x2b, //
-        return_instVar      = 0x2c, //
-        push_instVar        = 0x2d, //
-        store_instVar_pop   = 0x2e, //
-        store_instVar       = 0x2f, //
+        push_temp_0_return_tos_pop_0 = 0x20, // superinstruction
+        push_temp_1_return_tos_pop_0 = 0x21, // superinstruction
+        push_self_push_temp_0        = 0x22, // superinstruction
+        push_self_push_arg_1         = 0x23, // superinstruction
+        push_self_push_literal       = 0x24, // superinstruction
+        push_temp_0_push_temp_1      = 0x25, // superinstruction
+        push_temp_0_push_literal     = 0x26, // superinstruction
+        push_arg_1_push_arg_2        = 0x27, // superinstruction
+        return_instVar_name          = 0x28, //
+        push_classVar                = 0x29, //
+        store_classVar_pop           = 0x2a, //
+        store_classVar               = 0x2b, //
+        return_instVar               = 0x2c, //
+        push_instVar                 = 0x2d, //
+        store_instVar_pop            = 0x2e, //
+        store_instVar                = 0x2f, //
 
         // row 0x03
-        float_allocate         = 0x30, //
-        float_floatify_pop     = 0x31, //
-        float_move             = 0x32, //
-        float_set              = 0x33, //
-        float_nullary_op       = 0x34, //
-        float_unary_op         = 0x35, //
-        float_binary_op        = 0x36, //
-        float_unary_op_to_oop  = 0x37, //
-        float_binary_op_to_oop = 0x38, //
-        unimplemented_39       = 0x39, //
-        unimplemented_3a       = 0x3a, //
-        unimplemented_3b       = 0x3b, //
-        unimplemented_3c       = 0x3c, //
-        push_instVar_name      = 0x3d, //
-        store_instVar_pop_name = 0x3e, //
-        store_instVar_name     = 0x3f, //
+        float_allocate              = 0x30, //
+        float_floatify_pop          = 0x31, //
+        float_move                  = 0x32, //
+        float_set                   = 0x33, //
+        float_nullary_op            = 0x34, //
+        float_unary_op              = 0x35, //
+        float_binary_op             = 0x36, //
+        float_unary_op_to_oop       = 0x37, //
+        float_binary_op_to_oop      = 0x38, //
+        push_arg_1_return_tos_pop_1 = 0x39, // superinstruction
+        push_nil_return_tos_pop_0   = 0x3a, // superinstruction
+        push_true_return_tos_pop_0  = 0x3b, // superinstruction
+        push_false_return_tos_pop_0 = 0x3c, // superinstruction
+        push_instVar_name           = 0x3d, //
+        store_instVar_pop_name      = 0x3e, //
+        store_instVar_name          = 0x3f, //
 
         // row 0x04
         push_temp_0_context_0        = 0x40, //
@@ -347,58 +347,58 @@ public:
         non_local_return_self_pop_n = 0xaf, //
 
         // row 0x0b
-        prim_call                      = 0xb0, //
-        predict_primitive_call         = 0xb1, //
-        primitive_call_failure         = 0xb2, //
-        predict_primitive_call_failure = 0xb3, //
-        dll_call_sync                  = 0xb4, //
-        primitive_call_self            = 0xb5, //
-        primitive_call_self_failure    = 0xb6, //
-        unimplemented_b7               = 0xb7, //
-        access_send_self               = 0xb8, //
-        primitive_send_0               = 0xb9, //
-        primitive_send_super           = 0xba, //
-        primitive_send_super_pop       = 0xbb, //
-        unimplemented_bc               = 0xbc, //
-        primitive_send_1               = 0xbd, //
-        primitive_send_2               = 0xbe, //
-        primitive_send_n               = 0xbf, //
+        prim_call                          = 0xb0, //
+        predict_primitive_call             = 0xb1, //
+        primitive_call_failure             = 0xb2, //
+        predict_primitive_call_failure     = 0xb3, //
+        dll_call_sync                      = 0xb4, //
+        primitive_call_self                = 0xb5, //
+        primitive_call_self_failure        = 0xb6, //
+        primitive_call_self_indexable_size = 0xb7, // quick primitive call
+        access_send_self                   = 0xb8, //
+        primitive_send_0                   = 0xb9, //
+        primitive_send_super               = 0xba, //
+        primitive_send_super_pop           = 0xbb, //
+        primitive_call_self_objectArray_at = 0xbc, // quick primitive call
+        primitive_send_1                   = 0xbd, //
+        primitive_send_2                   = 0xbe, //
+        primitive_send_n                   = 0xbf, //
 
         // row 0x0c
-        primitive_call_lookup                 = 0xc0, //
-        predict_primitive_call_lookup         = 0xc1, //
-        primitive_call_failure_lookup         = 0xc2, //
-        predict_primitive_call_failure_lookup = 0xc3, //
-        dll_call_async                        = 0xc4, //
-        primitive_call_self_lookup            = 0xc5, //
-        primitive_call_self_failure_lookup    = 0xc6, //
-        unimplemented_c7                      = 0xc7, //
-        access_send_0                         = 0xc8, //
-        primitive_send_0_pop                  = 0xc9, //
-        primitive_send_self                   = 0xca, //
-        primitive_send_self_pop               = 0xcb, //
-        unimplemented_cc                      = 0xcc, //
-        primitive_send_1_pop                  = 0xcd, //
-        primitive_send_2_pop                  = 0xce, //
-        primitive_send_n_pop                  = 0xcf, //
+        primitive_call_lookup                  = 0xc0, //
+        predict_primitive_call_lookup          = 0xc1, //
+        primitive_call_failure_lookup          = 0xc2, //
+        predict_primitive_call_failure_lookup  = 0xc3, //
+        dll_call_async                         = 0xc4, //
+        primitive_call_self_lookup             = 0xc5, //
+        primitive_call_self_failure_lookup     = 0xc6, //
+        primitive_call_self_objectArray_at_put = 0xc7, // quick primitive call
+        access_send_0                          = 0xc8, //
+        primitive_send_0_pop                   = 0xc9, //
+        primitive_send_self                    = 0xca, //
+        primitive_send_self_pop                = 0xcb, //
+        primitive_call_self_byteArray_at       = 0xcc, // quick primitive call
+        primitive_send_1_pop                   = 0xcd, //
+        primitive_send_2_pop                   = 0xce, //
+        primitive_send_n_pop                   = 0xcf, //
 
         // row 0x0d
-        megamorphic_send_0            = 0xd0, //
-        megamorphic_send_1            = 0xd1, //
-        megamorphic_send_2            = 0xd2, //
-        megamorphic_send_n            = 0xd3, //
-        megamorphic_send_0_pop        = 0xd4, //
-        megamorphic_send_1_pop        = 0xd5, //
-        megamorphic_send_2_pop        = 0xd6, //
-        megamorphic_send_n_pop        = 0xd7, //
-        megamorphic_send_self         = 0xd8, //
-        megamorphic_send_self_pop     = 0xd9, //
-        megamorphic_send_super        = 0xda, //
-        megamorphic_send_super_pop    = 0xdb, //
-        unimplemented_dc              = 0xdc, //
-        special_primitive_send_1_hint = 0xdd, //
-        unimplemented_de              = 0xde, //
-        unimplemented_df              = 0xdf, //
+        megamorphic_send_0                   = 0xd0, //
+        megamorphic_send_1                   = 0xd1, //
+        megamorphic_send_2                   = 0xd2, //
+        megamorphic_send_n                   = 0xd3, //
+        megamorphic_send_0_pop               = 0xd4, //
+        megamorphic_send_1_pop               = 0xd5, //
+        megamorphic_send_2_pop               = 0xd6, //
+        megamorphic_send_n_pop               = 0xd7, //
+        megamorphic_send_self                = 0xd8, //
+        megamorphic_send_self_pop            = 0xd9, //
+        megamorphic_send_super               = 0xda, //
+        megamorphic_send_super_pop           = 0xdb, //
+        primitive_call_self_byteArray_at_put = 0xdc, // quick primitive call
+        special_primitive_send_1_hint        = 0xdd, //
+        unimplemented_de                     = 0xde, //
+        unimplemented_df                     = 0xdf, //
 
         // row 0x0e
         smi_add             = 0xe0, //
@@ -451,6 +451,8 @@ private:
     static SendType     _send_type[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
     static bool         _single_step[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
     static bool         _pop_tos[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
+    static Code         _generic_code[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];          // first component of a superinstruction, generic form of a quick primitive call, the code itself otherwise
+    static Code         _second_component[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];      // second component of a superinstruction, halt otherwise
 
     static void def( Code code );
 
@@ -460,6 +462,10 @@ private:
 
     static void def( Code code, const char *name, Format format, CodeType code_type, bool single_step, ArgumentSpec argument_spec, SendType send_type, bool pop_tos );
 
+    static void def_superinstruction( Code code, const char *name, Code first, Code second );
+
+    static void def_quick_primitive_call( Code code, const char *name, Code generic );
+
 public:
     // Define entry points
     static void set_entry_point( Code code, const char *entry_point );
@@ -530,6 +536,54 @@ public:
 
     static LoopType loop_type( const Code code );
 
+    //
+    // Superinstructions
+    //
+    // A superinstruction fuses a one-byte push with the instruction following it. Only the push byte is
+    // replaced by the superinstruction code, the second instruction stays in place: the layout of the
+    // method does not change and jumps to the second instruction still find it. Everything but the
+    // interpreter sees the first component only (see CodeIterator::code()).
+    //
+    // The set of superinstructions is fixed and hand-picked: the pushes of self, the first temporaries and
+    // arguments and the constants followed by another push or a return, i.e., the pairs of accessors, tests
+    // like isNil and argument setup. CountBytecodePairs prints the pair counts to check the choice against.
+    // Sends are never used as components since their codes are rewritten by inline cache transitions, so the
+    // most frequent pairs of all, a push followed by a send, are not fused.
+    //
+
+    static bool is_superinstruction( const Code code ) {
+        return _second_component[ static_cast<std::int32_t>(code) ] not_eq ByteCodes::Code::halt;
+    }
+
+
+    static Code generic_code_for( const Code code ) {
+        return _generic_code[ static_cast<std::int32_t>(code) ];
+    }
+
+
+    static Code second_component_of( const Code code ) {
+        st_assert( is_superinstruction( code ), "not a superinstruction" );
+        return _second_component[ static_cast<std::int32_t>(code) ];
+    }
+
+
+    // Returns the superinstruction for the pair first, second, or first if there is none
+    static Code superinstruction_for( Code first, Code second );
+
+    //
+    // Quick primitive calls
+    //
+    // A patched primitive call to one of a few frequent primitives is rewritten into a quick form with an
+    // assembly fast path in the interpreter (see Primitives::lookup_and_patch). The layout is the one of the
+    // generic call (the C entry point of the primitive stays in place and is called if the fast path fails),
+    // and everything but the interpreter sees the generic code (see CodeIterator::code()).
+    //
+
+    static bool is_quick_primitive_call( const Code code ) {
+        return generic_code_for( code ) not_eq code and not is_superinstruction( code );
+    }
+
+
     // Helpers for printing
     static const char *format_as_string( Format format );
 
@@ -68,8 +68,9 @@ public:
     }
 
 
+    // superinstructions are reported as their first component
     ByteCodes::Code code() const {
-        return ByteCodes::Code( *_current );
+        return ByteCodes::generic_code_for( ByteCodes::Code( *_current ) );
     }
 
 
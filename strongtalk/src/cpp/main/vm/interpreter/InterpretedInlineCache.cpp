@@ -496,6 +496,11 @@ void InterpretedInlineCache::update_inline_cache( InterpretedInlineCache *ic, Fr
                 // normal interpreted send ==> do not change
                 new_send_code = send_code;
                 st_assert( new_send_code == ByteCodes::original_send_code_for( send_code ), "bytecode should not change" );
+
+                // first execution of the method (through this send) ==> fuse its bytecode pairs
+                if ( UseSuperinstructions and not CountBytecodePairs ) {
+                    method->install_superinstructions();
+                }
             }
             st_assert( new_send_code not_eq ByteCodes::Code::halt, "new_send_code not set" );
             ic->set( new_send_code, method, klass );
@@ -11,6 +11,7 @@
 #include "vm/oop/AssociationOopDescriptor.hpp"
 #include "vm/oop/BlockClosureOopDescriptor.hpp"
 #include "vm/oop/ContextOopDescriptor.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/interpreter/Interpreter.hpp"
 #include "vm/interpreter/DispatchTable.hpp"
 #include "vm/primitive/PrimitivesGenerator.hpp"
@@ -22,6 +23,8 @@
 #include "vm/oop/ProxyOopDescriptor.hpp"
 #include "vm/recompiler/Recompilation.hpp"
 #include "vm/interpreter/InterpretedInlineCache.hpp"
+#include "vm/interpreter/InterpreterStatistics.hpp"
+#include "vm/interpreter/BranchProfile.hpp"
 #include "vm/assembler/x86_mapping.hpp"
 #include "vm/lookup/LookupCache.hpp"
 
@@ -196,13 +199,29 @@ void InterpreterGenerator::generateStopInterpreterAt() {
 }
 
 
-void InterpreterGenerator::jump_ebx() {
+void InterpreterGenerator::count_bytecode_pair() {
+    // counts the pair (previously dispatched bytecode, ebx)
+    _macroAssembler->pushl( ecx );
+    _macroAssembler->movl( ecx, Address( std::int32_t( InterpreterStatistics::last_bytecode_addr() ), RelocationInformation::RelocationType::external_word_type ) );
+    _macroAssembler->shll( ecx, 8 );
+    _macroAssembler->orl( ecx, ebx );
+    _macroAssembler->incl( Address( noreg, ecx, Address::ScaleFactor::times_4, (std::int32_t) InterpreterStatistics::bytecode_pair_counters() ) );
+    _macroAssembler->movl( Address( std::int32_t( InterpreterStatistics::last_bytecode_addr() ), RelocationInformation::RelocationType::external_word_type ), ebx );
+    _macroAssembler->popl( ecx );
+}
+
+
+void InterpreterGenerator::dispatch_prologue() {
 
     if ( TraceBytecodes or CountBytecodes or StopInterpreterAt > 0 ) {
         _macroAssembler->incl( Address( std::int32_t( &NumberOfBytecodesExecuted ), RelocationInformation::RelocationType::external_word_type ) );
         generateStopInterpreterAt();
     }
 
+    if ( CountBytecodePairs ) {
+        count_bytecode_pair();
+    }
+
     if ( TraceBytecodes ) {
         _macroAssembler->pushl( eax );    // save tos
         call_C( (const char *) Interpreter::trace_bytecode );
@@ -210,6 +229,11 @@ void InterpreterGenerator::jump_ebx() {
         load_ebx();
     }
     check_oop( eax );
+}
+
+
+void InterpreterGenerator::jump_ebx() {
+    dispatch_prologue();
     _macroAssembler->jmp( Address( noreg, ebx, Address::ScaleFactor::times_4, (std::int32_t) DispatchTable::table() ) );
 }
 
@@ -220,20 +244,14 @@ void InterpreterGenerator::load_edi() {
 
 
 void InterpreterGenerator::jump_edi() {
+    dispatch_prologue();
+    _macroAssembler->jmp( edi );
+}
 
-    if ( TraceBytecodes or CountBytecodes or StopInterpreterAt > 0 ) {
-        _macroAssembler->incl( Address( std::int32_t( &NumberOfBytecodesExecuted ), RelocationInformation::RelocationType::external_word_type ) );
-        generateStopInterpreterAt();
-    }
 
-    if ( TraceBytecodes ) {
-        _macroAssembler->pushl( eax );    // save tos
-        call_C( (const char *) Interpreter::trace_bytecode );
-        _macroAssembler->popl( eax );    // restore tos
-        load_ebx();
-    }
-    check_oop( eax );
-    _macroAssembler->jmp( edi );
+void InterpreterGenerator::jump_to( const char *entry ) {
+    dispatch_prologue();
+    _macroAssembler->jmp( entry, RelocationInformation::RelocationType::runtime_call_type );
 }
 
 
@@ -849,6 +867,42 @@ const char *InterpreterGenerator::install_context( std::int32_t nofArgs, bool fo
 // and whileFalse) the jump destination is the current instruction's address - offset.
 //
 
+void InterpreterGenerator::profile_branch( Address cond ) {
+    // counts the outcome of the conditional jump at esi (the condition is in eax); uses ecx
+    Label hit, jumped, miss, done;
+    const std::int32_t table = std::int32_t( BranchProfile::table_address() );
+
+    _macroAssembler->movl( ecx, esi );
+    _macroAssembler->andl( ecx, branch_profile_size - 1 );
+    _macroAssembler->shll( ecx, BranchProfileEntry::size_log2 );
+    _macroAssembler->cmpl( esi, Address( ecx, table + BranchProfileEntry::hp_byte_offset() ) );
+    _macroAssembler->jcc( Assembler::Condition::notEqual, miss );
+
+    _macroAssembler->bind( hit );
+    _macroAssembler->movl( Address( ecx, table + BranchProfileEntry::misses_byte_offset() ), 0 );
+    _macroAssembler->cmpl( eax, cond );
+    _macroAssembler->jcc( Assembler::Condition::notEqual, jumped );
+    _macroAssembler->incl( Address( ecx, table + BranchProfileEntry::fall_throughs_byte_offset() ) );
+    _macroAssembler->jmp( done );
+
+    _macroAssembler->bind( jumped );
+    _macroAssembler->incl( Address( ecx, table + BranchProfileEntry::jumps_byte_offset() ) );
+    _macroAssembler->jmp( done );
+
+    // the entry belongs to another jump (or is unused): take it over only if its owner has gone cold
+    _macroAssembler->bind( miss );
+    _macroAssembler->incl( Address( ecx, table + BranchProfileEntry::misses_byte_offset() ) );
+    _macroAssembler->cmpl( Address( ecx, table + BranchProfileEntry::misses_byte_offset() ), BranchProfileClaimLimit );
+    _macroAssembler->jcc( Assembler::Condition::less, done );
+    _macroAssembler->movl( Address( ecx, table + BranchProfileEntry::hp_byte_offset() ), esi );
+    _macroAssembler->movl( Address( ecx, table + BranchProfileEntry::fall_throughs_byte_offset() ), 0 );
+    _macroAssembler->movl( Address( ecx, table + BranchProfileEntry::jumps_byte_offset() ), 0 );
+    _macroAssembler->jmp( hit );
+
+    _macroAssembler->bind( done );
+}
+
+
 const char *InterpreterGenerator::control_cond( ByteCodes::Code code ) {
 
     bool isByte{ false }, isTrue{ false }, isCond{ false };
@@ -904,6 +958,10 @@ const char *InterpreterGenerator::control_cond( ByteCodes::Code code ) {
 
     const char *ep = entry_point();
 
+    // and/or are not profiled, the compiler does not use the counts for them
+    if ( ProfileBranches and not isCond ) {
+        profile_branch( cond );
+    }
     if ( not isByte ) {
         advance_aligned( codeSize );
     }
@@ -970,6 +1028,9 @@ const char *InterpreterGenerator::control_while( ByteCodes::Code code ) {
 
     const char *ep = entry_point();
 
+    if ( ProfileBranches ) {
+        profile_branch( cond );
+    }
     _macroAssembler->cmpl( eax, cond );                       // if tos # cond
     _macroAssembler->jcc( Assembler::Condition::notEqual, _exit ); // then jump to else part
 
@@ -989,6 +1050,7 @@ const char *InterpreterGenerator::control_while( ByteCodes::Code code ) {
     _macroAssembler->movl( Address( (std::int32_t) &Interpreter::_interpreter_loop_counter, RelocationInformation::RelocationType::external_word_type ), edx );
     _macroAssembler->cmpl( edx, Address( (std::int32_t) &Interpreter::_interpreter_loop_counter_limit, RelocationInformation::RelocationType::external_word_type ) );
     _macroAssembler->jcc( Assembler::Condition::greater, _overflow );
+    safepoint_poll();
     jump_ebx();
 
     _macroAssembler->bind( _exit );
@@ -1313,25 +1375,23 @@ const char *InterpreterGenerator::lookup_primitive() {
 }
 
 
-const char *InterpreterGenerator::call_primitive() {
-    const char *ep = entry_point();
-    advance_aligned( 1 + OOP_SIZE );
-    _macroAssembler->pushl( eax );                // push last argument
-    _macroAssembler->movl( eax, Address( esi, -OOP_SIZE ) );    // get primitive entry point
-    call_C( eax );                    // eax: = primitive call(...)
-    if ( _debug ) {                    // (Pascal calling conv. => args are popped by callee)
-        _macroAssembler->testb( eax, MARK_TAG_BIT );
-        _macroAssembler->jcc( Assembler::Condition::notZero, _primitive_result_wrong );
+void InterpreterGenerator::generic_primitive_call( bool canFail ) {
+    // calls the C entry point stored in the bytecode (esi points to the bytecode)
+    if ( not canFail ) {
+        advance_aligned( 1 + OOP_SIZE );
+        _macroAssembler->pushl( eax );                // push last argument
+        _macroAssembler->movl( eax, Address( esi, -OOP_SIZE ) );    // get primitive entry point
+        call_C( eax );                    // eax: = primitive call(...)
+        if ( _debug ) {                    // (Pascal calling conv. => args are popped by callee)
+            _macroAssembler->testb( eax, MARK_TAG_BIT );
+            _macroAssembler->jcc( Assembler::Condition::notZero, _primitive_result_wrong );
+        }
+        load_ebx();
+        jump_ebx();
+        return;
     }
-    load_ebx();
-    jump_ebx();
-    return ep;
-}
-
 
-const char *InterpreterGenerator::call_primitive_can_fail() {
-    Label      failed;
-    const char *ep = entry_point();
+    Label failed;
     advance_aligned( 1 + 2 * OOP_SIZE );
     _macroAssembler->pushl( eax );                // push last argument
     _macroAssembler->movl( eax, Address( esi, -2 * OOP_SIZE ) );    // get primitive entry point
@@ -1347,6 +1407,137 @@ const char *InterpreterGenerator::call_primitive_can_fail() {
     _macroAssembler->andl( eax, ~MARK_TAG_BIT );        // unmark result
     load_ebx();                    // and execute failure block
     jump_ebx();
+}
+
+
+const char *InterpreterGenerator::call_primitive() {
+    const char *ep = entry_point();
+    generic_primitive_call( false );
+    return ep;
+}
+
+
+const char *InterpreterGenerator::call_primitive_can_fail() {
+    const char *ep = entry_point();
+    generic_primitive_call( true );
+    return ep;
+}
+
+
+//-----------------------------------------------------------------------------------------
+// Quick primitive calls
+//
+// The fast paths below handle the common case of a few frequent primitives without leaving the
+// interpreter. Whenever the fast path doesn't apply (argument of the wrong type, index out of
+// bounds, etc.) the generic call is done, so errors are reported by the C primitive itself.
+// The receiver is trusted to have the right format, as in the C primitives.
+//
+// Registers other than eax, ecx, edx and edi are left alone: ebx in particular must keep its upper
+// 24 bits clear, as load_ebx only reloads the low byte.
+//
+// Stack at entry (eax is the last argument):
+//
+//   size:      eax = receiver
+//   at:        [esp] = receiver, eax = index
+//   at:put:    [esp + 4] = receiver, [esp] = index, eax = value
+
+void InterpreterGenerator::load_length_addr( Register obj, Register dst ) {
+    // dst := (untagged) address of the length field of the indexable obj
+    _macroAssembler->movl( dst, Address( obj, MemOopDescriptor::klass_byte_offset() ) );
+    _macroAssembler->movl( dst, Address( dst, KlassOopDescriptor::nonIndexableSizeOffset() ) );    // small_int_t, i.e. the byte offset
+    _macroAssembler->leal( dst, Address( obj, dst, Address::ScaleFactor::times_1, -MEMOOP_TAG ) );
+}
+
+
+void InterpreterGenerator::check_index( Register index, Register length_addr, Label &slow ) {
+    // index must be a small_int_t in [1..length]
+    _macroAssembler->testl( index, MEMOOP_TAG );
+    _macroAssembler->jcc( Assembler::Condition::notZero, slow );
+    _macroAssembler->cmpl( index, 0 );
+    _macroAssembler->jcc( Assembler::Condition::lessEqual, slow );
+    _macroAssembler->cmpl( index, Address( length_addr ) );    // both are small_int_ts
+    _macroAssembler->jcc( Assembler::Condition::greater, slow );
+}
+
+
+void InterpreterGenerator::quick_primitive_call_succeeded( bool canFail ) {
+    // result in eax, arguments popped
+    advance_aligned( 1 + ( canFail ? 2 : 1 ) * OOP_SIZE );
+    if ( canFail ) {
+        _macroAssembler->movl( ecx, Address( esi, -OOP_SIZE ) );    // get jump offset
+        _macroAssembler->addl( esi, ecx );            // jump over failure block
+    }
+    load_ebx();
+    jump_ebx();
+}
+
+
+const char *InterpreterGenerator::quick_primitive_call( ByteCodes::Code code ) {
+    Label      slow;
+    const bool canFail = ByteCodes::format( code ) == ByteCodes::Format::BLL;
+    const char *ep     = entry_point();
+
+    switch ( code ) {
+        case ByteCodes::Code::primitive_call_self_indexable_size:
+            // the length field is the same for all indexables
+            load_length_addr( eax, ecx );
+            _macroAssembler->movl( eax, Address( ecx ) );
+            break;
+
+        case ByteCodes::Code::primitive_call_self_objectArray_at:
+            _macroAssembler->movl( edx, Address( esp ) );            // get receiver
+            load_length_addr( edx, ecx );
+            check_index( eax, ecx, slow );
+            _macroAssembler->movl( eax, Address( ecx, eax, Address::ScaleFactor::times_1 ) );    // objs(index) = length_addr + index * OOP_SIZE
+            _macroAssembler->popl( edx );                // pop receiver
+            break;
+
+        case ByteCodes::Code::primitive_call_self_objectArray_at_put:
+            _macroAssembler->movl( ecx, Address( esp ) );            // get index
+            _macroAssembler->movl( edx, Address( esp, OOP_SIZE ) );  // get receiver
+            load_length_addr( edx, edi );                // not ebx: load_ebx only reloads its low byte
+            check_index( ecx, edi, slow );
+            _macroAssembler->leal( ecx, Address( edi, ecx, Address::ScaleFactor::times_1 ) );
+            _macroAssembler->movl( Address( ecx ), eax );
+            _macroAssembler->store_check( ecx, edi );
+            _macroAssembler->movl( eax, edx );                // result is the receiver
+            _macroAssembler->addl( esp, 2 * OOP_SIZE );        // pop receiver & index
+            break;
+
+        case ByteCodes::Code::primitive_call_self_byteArray_at:
+            _macroAssembler->movl( edx, Address( esp ) );            // get receiver
+            load_length_addr( edx, ecx );
+            check_index( eax, ecx, slow );
+            _macroAssembler->sarl( eax, TAG_SIZE );
+            _macroAssembler->movl( edx, eax );
+            _macroAssembler->xorl( eax, eax );
+            _macroAssembler->movb( eax, Address( ecx, edx, Address::ScaleFactor::times_1, OOP_SIZE - 1 ) );    // bytes(index)
+            _macroAssembler->shll( eax, TAG_SIZE );
+            _macroAssembler->popl( edx );                // pop receiver
+            break;
+
+        case ByteCodes::Code::primitive_call_self_byteArray_at_put:
+            _macroAssembler->testl( eax, MEMOOP_TAG );
+            _macroAssembler->jcc( Assembler::Condition::notZero, slow );
+            _macroAssembler->cmpl( eax, 0xFF << TAG_SIZE );        // value must be a byte
+            _macroAssembler->jcc( Assembler::Condition::above, slow );
+            _macroAssembler->movl( ecx, Address( esp ) );            // get index
+            _macroAssembler->movl( edx, Address( esp, OOP_SIZE ) );  // get receiver
+            load_length_addr( edx, edi );                // not ebx: load_ebx only reloads its low byte
+            check_index( ecx, edi, slow );
+            _macroAssembler->sarl( ecx, TAG_SIZE );
+            _macroAssembler->sarl( eax, TAG_SIZE );
+            _macroAssembler->movb( Address( edi, ecx, Address::ScaleFactor::times_1, OOP_SIZE - 1 ), eax );
+            _macroAssembler->movl( eax, edx );                // result is the receiver
+            _macroAssembler->addl( esp, 2 * OOP_SIZE );        // pop receiver & index
+            break;
+
+        default: ShouldNotReachHere();
+    }
+    quick_primitive_call_succeeded( canFail );
+
+    _macroAssembler->bind( slow );
+    generic_primitive_call( canFail );
     return ep;
 }
 
@@ -1726,6 +1917,33 @@ void check_stack_overflow();                 //
 }
 
 
+// Safepoints
+//
+// A process is preempted by setting the active stack limit above any stack address (see
+// DeltaProcess::preempt_active), so the stack limit check done at method entries and loop
+// back-edges doubles as the safepoint poll. The poll is taken between instructions, with
+// eax, ebx and esi set up for the next instruction.
+
+void InterpreterGenerator::safepoint_poll() {
+    _macroAssembler->cmpl( esp, Address( std::int32_t( active_stack_limit() ), RelocationInformation::RelocationType::external_word_type ) );
+    _macroAssembler->jcc( Assembler::Condition::lessEqual, _safepoint );
+}
+
+
+void InterpreterGenerator::generate_safepoint_code() {
+    st_assert( not _safepoint.is_bound(), "code has been generated before" );
+
+    // the tos is pushed before call_C records the last Delta frame, so that the
+    // expression stack seen at the safepoint is complete
+    _macroAssembler->bind( _safepoint );
+    _macroAssembler->pushl( eax );    // save tos
+    call_C( (const char *) &check_stack_overflow );
+    _macroAssembler->popl( eax );    // restore tos
+    load_ebx();
+    jump_ebx();
+}
+
+
 void InterpreterGenerator::generate_method_entry_code() {
 
     // This generates the code sequence called to activate methodOop execution.
@@ -1736,7 +1954,7 @@ void InterpreterGenerator::generate_method_entry_code() {
     const std::int32_t code_offset    = MethodOopDescriptor::codes_byte_offset();
 
     st_assert( not _method_entry.is_bound(), "code has been generated before" );
-    Label start_setup, counter_overflow, start_execution, handle_counter_overflow, is_interpreted, handle_stack_overflow, continue_from_stack_overflow;
+    Label start_setup, counter_overflow, start_execution, handle_counter_overflow, is_interpreted;
 
     // eax: receiver
     // ebx: 000000xx
@@ -1765,9 +1983,7 @@ void InterpreterGenerator::generate_method_entry_code() {
     _macroAssembler->jcc( Assembler::Condition::aboveEqual, counter_overflow );             // treat invocation counter overflow
     _macroAssembler->bind( start_execution );                                               // continuation point after overflow
     _macroAssembler->movl( eax, edi );                                                      // initialize temp0
-    _macroAssembler->cmpl( esp, Address( std::int32_t( active_stack_limit() ), RelocationInformation::RelocationType::external_word_type ) );
-    _macroAssembler->jcc( Assembler::Condition::lessEqual, handle_stack_overflow );         //
-    _macroAssembler->bind( continue_from_stack_overflow );                                  //
+    safepoint_poll();                                                                       // the frame is complete (temp0 is in eax)
     jump_ebx();                                                                             // start execution
 
     // invocation counter overflow
@@ -1824,15 +2040,6 @@ void InterpreterGenerator::generate_method_entry_code() {
     // edi: context (= initial value for temp0)
     // parameters on stack
     _macroAssembler->jmp( start_setup );
-
-    _macroAssembler->bind( handle_stack_overflow );
-    _macroAssembler->pushl( eax );
-    // _masm->call_C((char*)&check_stack_overflow, RelocationInformation::RelocationType::external_word_type);
-    _macroAssembler->popl( eax );
-    restore_esi();
-    restore_ebx();
-    load_ebx();
-    _macroAssembler->jmp( continue_from_stack_overflow );
 }
 
 
@@ -2784,6 +2991,81 @@ const char *InterpreterGenerator::halt() {
     return ep;
 }
 
+//-----------------------------------------------------------------------------------------
+// Superinstructions
+//
+// A superinstruction pushes the value of its first component and continues directly
+// with the code of its second component, saving one indirect dispatch. esi and ebx are
+// set up as if the second instruction had been dispatched normally.
+
+Address InterpreterGenerator::push_source( ByteCodes::Code code ) {
+    switch ( code ) {
+        case ByteCodes::Code::push_temp_0:
+            return temp_addr( 0 );
+        case ByteCodes::Code::push_temp_1:
+            return temp_addr( 1 );
+        case ByteCodes::Code::push_temp_2:
+            return temp_addr( 2 );
+        case ByteCodes::Code::push_temp_3:
+            return temp_addr( 3 );
+        case ByteCodes::Code::push_temp_4:
+            return temp_addr( 4 );
+        case ByteCodes::Code::push_temp_5:
+            return temp_addr( 5 );
+        case ByteCodes::Code::push_arg_1:
+            return arg_addr( 1 );
+        case ByteCodes::Code::push_arg_2:
+            return arg_addr( 2 );
+        case ByteCodes::Code::push_arg_3:
+            return arg_addr( 3 );
+        case ByteCodes::Code::push_self:
+            return self_addr();
+        case ByteCodes::Code::push_nil:
+            return nil_addr();
+        case ByteCodes::Code::push_true:
+            return true_addr();
+        case ByteCodes::Code::push_false:
+            return false_addr();
+        default: ShouldNotReachHere();
+    }
+    return Address();
+}
+
+
+const char *InterpreterGenerator::superinstruction( ByteCodes::Code code ) {
+    ByteCodes::Code second = ByteCodes::second_component_of( code );
+    const char      *next  = ByteCodes::entry_point( second );
+    st_assert( next not_eq nullptr, "second component not generated yet" );
+
+    const char *ep = entry_point();
+    _macroAssembler->pushl( eax );
+    _macroAssembler->movl( eax, push_source( ByteCodes::generic_code_for( code ) ) );
+    _macroAssembler->incl( esi );
+    _macroAssembler->movl( ebx, static_cast<std::int32_t>( second ) );
+    jump_to( next );
+    return ep;
+}
+
+
+void InterpreterGenerator::generate_superinstructions() {
+    for ( std::size_t i = 0; i < static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES); i++ ) {
+        const ByteCodes::Code code = ByteCodes::Code( i );
+        if ( not ByteCodes::is_superinstruction( code ) ) {
+            continue;
+        }
+
+        const char *start = _macroAssembler->pc();
+        const char *entry = superinstruction( code );
+        ByteCodes::set_entry_point( code, entry );
+        if ( PrintInterpreter ) {
+            std::size_t length = _macroAssembler->pc() - start;
+            SPDLOG_INFO( "bytecode # [0x%02x], address[0x{0:x}], size [0x%04x], name[{}]", i, entry, length, ByteCodes::name( code ) );
+            _macroAssembler->code()->decode();
+            _console->cr();
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------------------
 // Instruction generator
 
@@ -3004,6 +3286,17 @@ const char *InterpreterGenerator::generate_instruction( ByteCodes::Code code ) {
         case ByteCodes::Code::primitive_call_self_failure:
             return call_primitive_can_fail();
 
+        case ByteCodes::Code::primitive_call_self_indexable_size:
+            [[fallthrough]];
+        case ByteCodes::Code::primitive_call_self_objectArray_at:
+            [[fallthrough]];
+        case ByteCodes::Code::primitive_call_self_objectArray_at_put:
+            [[fallthrough]];
+        case ByteCodes::Code::primitive_call_self_byteArray_at:
+            [[fallthrough]];
+        case ByteCodes::Code::primitive_call_self_byteArray_at_put:
+            return quick_primitive_call( code );
+
         case ByteCodes::Code::primitive_call_lookup:
             [[fallthrough]];
         case ByteCodes::Code::primitive_call_self_lookup:
@@ -3348,48 +3641,36 @@ const char *InterpreterGenerator::generate_instruction( ByteCodes::Code code ) {
         case ByteCodes::Code::store_classVar_name:
             [[fallthrough]];
 
-            // unimplemented
-        case ByteCodes::Code::unimplemented_06:
-            [[fallthrough]];
-
-        case ByteCodes::Code::unimplemented_20:
-            [[fallthrough]];
-        case ByteCodes::Code::unimplemented_21:
+            // superinstructions (generated by generate_superinstructions once their components exist)
+        case ByteCodes::Code::push_temp_0_return_tos_pop_0:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_22:
+        case ByteCodes::Code::push_temp_1_return_tos_pop_0:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_23:
+        case ByteCodes::Code::push_self_push_temp_0:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_24:
+        case ByteCodes::Code::push_self_push_arg_1:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_25:
+        case ByteCodes::Code::push_self_push_literal:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_26:
+        case ByteCodes::Code::push_temp_0_push_temp_1:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_27:
+        case ByteCodes::Code::push_temp_0_push_literal:
             [[fallthrough]];
-
-        case ByteCodes::Code::unimplemented_39:
-            [[fallthrough]];
-        case ByteCodes::Code::unimplemented_3a:
-            [[fallthrough]];
-        case ByteCodes::Code::unimplemented_3b:
+        case ByteCodes::Code::push_arg_1_push_arg_2:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_3c:
+        case ByteCodes::Code::push_arg_1_return_tos_pop_1:
             [[fallthrough]];
-
-        case ByteCodes::Code::unimplemented_b7:
+        case ByteCodes::Code::push_nil_return_tos_pop_0:
             [[fallthrough]];
-        case ByteCodes::Code::unimplemented_bc:
+        case ByteCodes::Code::push_true_return_tos_pop_0:
             [[fallthrough]];
+        case ByteCodes::Code::push_false_return_tos_pop_0:
+            return nullptr;
 
-        case ByteCodes::Code::unimplemented_c7:
-            [[fallthrough]];
-        case ByteCodes::Code::unimplemented_cc:
+            // unimplemented
+        case ByteCodes::Code::unimplemented_06:
             [[fallthrough]];
 
-        case ByteCodes::Code::unimplemented_dc:
-            [[fallthrough]];
         case ByteCodes::Code::unimplemented_de:
             [[fallthrough]];
         case ByteCodes::Code::unimplemented_df:
@@ -3451,6 +3732,9 @@ void InterpreterGenerator::generate_all() {
     generate_nonlocal_return_code();
     info( "non-local return code" );
 
+    generate_safepoint_code();
+    info( "safepoint code" );
+
     generate_method_entry_code();
     info( "method entry code" );
 
@@ -3495,6 +3779,9 @@ void InterpreterGenerator::generate_all() {
 
     }
 
+    generate_superinstructions();
+    info( "superinstructions" );
+
     _macroAssembler->finalize();
     Interpreter::_code_end_addr = _macroAssembler->pc();
 }
@@ -29,6 +29,19 @@ constexpr std::int32_t max_nof_floats = 256;
 
 
 // The InterpreterGenerator contains the functionality to generate the interpreter during the system initialization phase.
+//
+// Register usage between instructions:
+//
+// eax   top of expression stack (always cached, the rest of the expression stack is in memory at esp)
+// ebx   current bytecode (upper 24 bits are 0)
+// esi   current instruction pointer (bcp)
+// ebp   frame pointer
+//
+// The interpreter has a single cache state: eax always holds the top of stack, so a push is
+// "pushl eax; movl eax, value" and a pop is "popl eax" and there is one dispatch table. Whenever
+// control leaves the interpreter (sends, C calls, primitives) eax is pushed first, so frames
+// seen at safepoints (Frame, VirtualFrame, GC stack scanning) always have the complete
+// expression stack in memory.
 
 class InterpreterGenerator : StackAllocatedObject {
 
@@ -45,6 +58,7 @@ private:
     Label _issue_NonLocalReturn;            // the starting point for NonLocalReturns in interpreted code
     Label _nlr_testpoint;                   // the return point for NonLocalReturns in interpreted sends
     Label _C_nlr_testpoint;                 // the return point for NonLocalReturns in C
+    Label _safepoint;                       // preemption/stack overflow check at loop back-edges
 
     Label _boolean_expected;                // boolean expected error
     Label _float_expected;                  // float expected error
@@ -99,6 +113,12 @@ private:
 
     void jump_edi();
 
+    void jump_to( const char *entry );
+
+    void dispatch_prologue();
+
+    void count_bytecode_pair();
+
     const char *entry_point();
 
 
@@ -171,6 +191,11 @@ private:
 
     void call_C( Register entry );
 
+    // Safepoints
+    void safepoint_poll();
+
+    void generate_safepoint_code();
+
     // Parameter passing/returns
     void load_recv( ByteCodes::ArgumentSpec arg_spec );
 
@@ -250,6 +275,17 @@ private:
 
     const char *call_primitive_can_fail();
 
+    void generic_primitive_call( bool canFail );
+
+    // Quick primitive calls
+    void load_length_addr( Register obj, Register dst );
+
+    void check_index( Register index, Register length_addr, Label &slow );
+
+    void quick_primitive_call_succeeded( bool canFail );
+
+    const char *quick_primitive_call( ByteCodes::Code code );
+
     const char *call_DLL( bool async );
 
     void call_method();
@@ -278,6 +314,8 @@ private:
 
     const char *normal_send( ByteCodes::Code code, bool allow_methodOop, bool allow_nativeMethod, bool primitive_send = false );
 
+    void profile_branch( Address cond );
+
     const char *control_cond( ByteCodes::Code code );
 
     const char *control_while( ByteCodes::Code code );
@@ -335,6 +373,13 @@ private:
 
     const char *nonlocal_return_self();
 
+    // Superinstructions
+    Address push_source( ByteCodes::Code code );
+
+    const char *superinstruction( ByteCodes::Code code );
+
+    void generate_superinstructions();
+
 
 public:
     InterpreterGenerator( CodeBuffer *code, bool debug );
@@ -7,12 +7,18 @@
 
 #include "vm/interpreter/InterpreterStatistics.hpp"
 #include "vm/interpreter/ByteCodes.hpp"
+#include "vm/runtime/ResourceArea.hpp"
+#include "vm/runtime/ResourceMark.hpp"
 
 #include <array>
+#include <algorithm>
 
 std::array<std::uint32_t, static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)> InterpreterStatistics::_bytecode_counters;
 std::array<std::int32_t, static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)>  InterpreterStatistics::_bytecode_generation_order;
 
+std::uint32_t InterpreterStatistics::_bytecode_pair_counters[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES) * static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
+std::int32_t  InterpreterStatistics::_last_bytecode{ static_cast<std::int32_t>(ByteCodes::Code::halt) };
+
 bool InterpreterStatistics::_is_initialized{ false };
 
 
@@ -42,10 +48,55 @@ void InterpreterStatistics::initialize() {
     }
     reset_bytecode_counters();
     reset_bytecode_generation_order();
+    reset_bytecode_pair_counters();
     _is_initialized = true;
 }
 
 
+std::uint32_t InterpreterStatistics::bytecode_pair_count( ByteCodes::Code first, ByteCodes::Code second ) {
+    return _bytecode_pair_counters[ static_cast<std::int32_t>(first) * static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES) + static_cast<std::int32_t>(second) ];
+}
+
+
+void InterpreterStatistics::reset_bytecode_pair_counters() {
+    for ( auto &x : _bytecode_pair_counters ) {
+        x = 0;
+    }
+    _last_bytecode = static_cast<std::int32_t>(ByteCodes::Code::halt);
+}
+
+
+void InterpreterStatistics::print_bytecode_pairs( std::int32_t n ) {
+    constexpr std::int32_t nofPairs = static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES) * static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES);
+
+    std::uint64_t total = 0;
+    for ( std::int32_t i = 0; i < nofPairs; i++ ) {
+        total += _bytecode_pair_counters[ i ];
+    }
+    if ( total == 0 ) {
+        return;
+    }
+
+    // sort the pair indices by descending count
+    ResourceMark resourceMark;
+    std::int32_t *pairs = new_resource_array<std::int32_t>( nofPairs );
+    for ( std::int32_t i = 0; i < nofPairs; i++ ) {
+        pairs[ i ] = i;
+    }
+    n = std::min( n, nofPairs );
+    std::partial_sort( pairs, pairs + n, pairs + nofPairs, []( std::int32_t a, std::int32_t b ) {
+        return _bytecode_pair_counters[ a ] > _bytecode_pair_counters[ b ];
+    } );
+
+    SPDLOG_INFO( "bytecode pairs: {} dispatches, {} most frequent pairs:", total, n );
+    for ( std::int32_t i = 0; i < n and _bytecode_pair_counters[ pairs[ i ] ] > 0; i++ ) {
+        const ByteCodes::Code first  = ByteCodes::Code( pairs[ i ] / static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES) );
+        const ByteCodes::Code second = ByteCodes::Code( pairs[ i ] % static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES) );
+        SPDLOG_INFO( "  {:10d} {:5.2f}%  {} {}", _bytecode_pair_counters[ pairs[ i ] ], 100.0 * _bytecode_pair_counters[ pairs[ i ] ] / total, ByteCodes::name( first ), ByteCodes::name( second ) );
+    }
+}
+
+
 bool InterpreterStatistics::is_initialized() {
     return _is_initialized;
 }
@@ -23,6 +23,10 @@ private:
     static std::array<std::uint32_t, static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)> _bytecode_counters;
     static std::array<std::int32_t, static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)>  _bytecode_generation_order;
 
+    // bytecode pairs (CountBytecodePairs); the counter for (first, second) is at index first * NUMBER_OF_CODES + second
+    static std::uint32_t _bytecode_pair_counters[static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES) * static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES)];
+    static std::int32_t  _last_bytecode;                                                          // last bytecode dispatched
+
     static void reset_bytecode_counters();
 
     static void reset_bytecode_generation_order();
@@ -35,4 +39,21 @@ public:
     static ByteCodes::Code ith_bytecode_to_generate( std::int32_t i );
 
     static void initialize();
+
+    // Bytecode pairs
+    static std::uint32_t *bytecode_pair_counters() {
+        return _bytecode_pair_counters;
+    }
+
+
+    static std::int32_t *last_bytecode_addr() {
+        return &_last_bytecode;
+    }
+
+
+    static std::uint32_t bytecode_pair_count( ByteCodes::Code first, ByteCodes::Code second );
+
+    static void reset_bytecode_pair_counters();
+
+    static void print_bytecode_pairs( std::int32_t n );    // prints the n most frequent pairs
 };
@@ -169,29 +169,22 @@ void MethodIterator::dispatch( MethodClosure *blk ) {
             case ByteCodes::Code::push_false:
                 blk->push_literal( falseObject );
                 break;
-            case ByteCodes::Code::unimplemented_20:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_20) );
-                break;
-            case ByteCodes::Code::unimplemented_21:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_21) );
-                break;
-            case ByteCodes::Code::unimplemented_22:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_22) );
-                break;
-            case ByteCodes::Code::unimplemented_23:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_23) );
-                break;
-            case ByteCodes::Code::unimplemented_24:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_24) );
-                break;
-            case ByteCodes::Code::unimplemented_25:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_25) );
-                break;
-            case ByteCodes::Code::unimplemented_26:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_26) );
-                break;
-            case ByteCodes::Code::unimplemented_27:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_27) );
+            case ByteCodes::Code::push_temp_0_return_tos_pop_0:
+                [[fallthrough]];
+            case ByteCodes::Code::push_temp_1_return_tos_pop_0:
+                [[fallthrough]];
+            case ByteCodes::Code::push_self_push_temp_0:
+                [[fallthrough]];
+            case ByteCodes::Code::push_self_push_arg_1:
+                [[fallthrough]];
+            case ByteCodes::Code::push_self_push_literal:
+                [[fallthrough]];
+            case ByteCodes::Code::push_temp_0_push_temp_1:
+                [[fallthrough]];
+            case ByteCodes::Code::push_temp_0_push_literal:
+                [[fallthrough]];
+            case ByteCodes::Code::push_arg_1_push_arg_2:
+                ShouldNotReachHere(); // superinstructions are reported as their first component by CodeIterator::code()
                 break;
             case ByteCodes::Code::return_instVar_name: {
                 SymbolOop name = SymbolOop( iter.oop_at( 1 ) );
@@ -273,17 +266,14 @@ void MethodIterator::dispatch( MethodClosure *blk ) {
             case ByteCodes::Code::float_binary_op_to_oop:
                 blk->float_binaryToOop( Floats::Function( iter.byte_at( 2 ) ), blk->float_at( iter.byte_at( 1 ) ) );
                 break;
-            case ByteCodes::Code::unimplemented_39:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_39) );
-                break;
-            case ByteCodes::Code::unimplemented_3a:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_3a) );
-                break;
-            case ByteCodes::Code::unimplemented_3b:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_3b) );
-                break;
-            case ByteCodes::Code::unimplemented_3c:
-                unknown_code( static_cast<std::uint8_t>(ByteCodes::Code::unimplemented_3c) );
+            case ByteCodes::Code::push_arg_1_return_tos_pop_1:
+                [[fallthrough]];
+            case ByteCodes::Code::push_nil_return_tos_pop_0:
+                [[fallthrough]];
+            case ByteCodes::Code::push_true_return_tos_pop_0:
+                [[fallthrough]];
+            case ByteCodes::Code::push_false_return_tos_pop_0:
+                ShouldNotReachHere(); // superinstructions are reported as their first component by CodeIterator::code()
                 break;
             case ByteCodes::Code::push_instVar_name: {
                 SymbolOop name = SymbolOop( iter.oop_at( 1 ) );
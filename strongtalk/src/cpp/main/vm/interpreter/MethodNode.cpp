@@ -57,10 +57,11 @@ SymbolOop OrNode::selector() const {
 WhileNode::WhileNode( MethodOop method, MethodInterval *parent, std::int32_t begin_byteCodeIndex, std::int32_t next_byteCodeIndex, std::int32_t cond_offset, std::int32_t end_offset ) :
     InlineSendNode( method, parent, begin_byteCodeIndex ),
     _cond{ false },
+    _jump_byteCodeIndex{ next_byteCodeIndex + cond_offset + end_offset },
     _expr_code{ nullptr },
     _body_code{ nullptr } {
 
-    CodeIterator c( method, next_byteCodeIndex + cond_offset + end_offset );
+    CodeIterator c( method, _jump_byteCodeIndex );
     switch ( c.code() ) {
         case ByteCodes::Code::whileTrue_byte:
         case ByteCodes::Code::whileTrue_word:
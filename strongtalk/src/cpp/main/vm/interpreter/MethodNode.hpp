@@ -126,6 +126,7 @@ public:
 class WhileNode : public InlineSendNode {
 protected:
     bool           _cond;
+    std::int32_t   _jump_byteCodeIndex;
     MethodInterval *_expr_code;
     MethodInterval *_body_code;
 
@@ -166,6 +167,12 @@ public:
     bool is_whileFalse() const {
         return not _cond;
     }
+
+
+    // the conditional jump at the end of the loop condition
+    std::int32_t jump_byteCodeIndex() const {
+        return _jump_byteCodeIndex;
+    }
 };
 
 
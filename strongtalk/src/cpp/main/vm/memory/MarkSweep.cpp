@@ -19,6 +19,7 @@
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/memory/WaterMark.hpp"
+#include "vm/interpreter/BranchProfile.hpp"
 
 typedef struct {
     Oop anOop;
@@ -148,7 +149,11 @@ Oop MarkSweep::collect( Oop p ) {
     // clear the remember set; we have no pointers from old to new
     Universe::remembered_set->clear();
 
+    // objects referred to by code may have moved between generations
+    Universe::code->rebuild_scavengable_lists();
+
     LookupCache::flush();
+    BranchProfile::flush();    // methods may have moved
 
     if ( VerifyAfterScavenge or VerifyAfterGC ) {
         Universe::verify();
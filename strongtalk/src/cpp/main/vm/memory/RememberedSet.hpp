@@ -9,6 +9,8 @@
 #include "vm/system/asserts.hpp"
 #include "allocation.hpp"
 
+#include <cstring>
+
 
 // remembered set for GC, implemented as a card-marking byte array with one byte per card
 // Card size is 512 bytes
@@ -74,6 +76,15 @@ public:
     }
 
 
+    // dirties the cards of the oops in [start, end[ with a single memset, for bulk stores
+    void record_multistores( void *start, void *end ) {
+        if ( start < end ) {
+            char *first = byte_for( start );
+            std::memset( first, 0, byte_for( (char *) end - 1 ) - first + 1 );
+        }
+    }
+
+
     bool is_dirty( void *p ) const {
         return *byte_for( p ) == 0;
     }
@@ -7,6 +7,7 @@
 #include "vm/klass/SymbolKlass.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/memory/MarkSweep.hpp"
+#include "vm/utility/StringHash.hpp"
 
 #define FOR_ALL_ENTRIES( entry ) \
   for (entry = firstBucket(); entry <= lastBucket(); entry ++)
@@ -25,6 +26,11 @@
 
 std::uint32_t hash( const char *name, std::int32_t len ) {
 
+    if ( StringHash::version() == StringHash::Version::full_contents ) {
+        // the full hash uses all 32 bits, bucketFor takes the hash as a non-negative std::int32_t
+        return StringHash::full_hash( reinterpret_cast<const std::uint8_t *>( name ), len ) & 0x7fffffff;
+    }
+
     // hash on at most 32 characters, evenly spaced
     std::uint32_t increment;
 
@@ -248,6 +254,9 @@ bool SymbolTableEntry::verify( std::int32_t i ) {
         if ( not get_symbol()->isSymbol() ) {
             error( "entry 0x{0:x} in symbol table isn't a symbol", get_symbol() );
             flag = false;
+        } else if ( std::int32_t( hash( reinterpret_cast<const char *>( get_symbol()->bytes() ), get_symbol()->length() ) ) % symbol_table_size not_eq i ) {
+            error( "entry 0x{0:x} in symbol table has wrong hash value", get_symbol() );
+            flag = false;
         }
     } else {
         if ( get_link() ) {
@@ -288,7 +297,7 @@ bool SymbolTableLink::verify( std::int32_t i ) {
             error( "entry 0x{0:x} in symbol table isn't a symbol", l->_symbol );
             flag = false;
 
-        } else if ( hash( reinterpret_cast<const char *>( l->_symbol->bytes() ), l->_symbol->length() ) % symbol_table_size not_eq i ) {
+        } else if ( std::int32_t( hash( reinterpret_cast<const char *>( l->_symbol->bytes() ), l->_symbol->length() ) ) % symbol_table_size not_eq i ) {
             error( "entry 0x{0:x} in symbol table has wrong hash value", l->_symbol );
             flag = false;
 
@@ -33,6 +33,7 @@
 #include "vm/memory/WaterMark.hpp"
 #include "vm/runtime/Processes.hpp"
 #include "vm/runtime/DeltaProcess.hpp"
+#include "vm/runtime/IOPoller.hpp"
 #include "vm/runtime/VMProcess.hpp"
 
 
@@ -672,6 +673,8 @@ void Universe::oops_do( void f( Oop * ) ) {
     Handles::oops_do( f );
     // Iterate over the oops in the inlining database
     InliningDatabase::oops_do( f );
+    // Iterate over the waiters of the I/O poller
+    IOPoller::oops_do( f );
 }
 
 
@@ -819,9 +822,12 @@ void Universe::scavenge( Oop *p ) {
             SCAVENGE_TEMPLATE( p );
         }
 
-        Universe::oops_do( scavenge_oop );
-        //Universe::roots_do(scavenge_oop);
-        //Handles::oops_do(scavenge_oop);
+        // same as Universe::oops_do, but only the code referring to new objects is visited
+        Universe::roots_do( scavenge_oop );
+        code->scavengable_oops_do( scavenge_oop );
+        Handles::oops_do( scavenge_oop );
+        InliningDatabase::oops_do( scavenge_oop );
+        IOPoller::oops_do( scavenge_oop );
 
         {
             FOR_EACH_OLD_SPACE( s ) {
@@ -841,6 +847,9 @@ void Universe::scavenge( Oop *p ) {
 
         WeakArrayRegister::check_and_scavenge_contents();
 
+        // code whose objects have all been tenured needn't be visited anymore
+        code->prune_scavengable_lists();
+
         new_gen.swap_spaces();
 
         // Set the desired survivor size to half the real survivor Space
@@ -14,6 +14,8 @@
 #include "vm/compiler/Node.hpp"
 #include "vm/oop/DoubleByteArrayOopDescriptor.hpp"
 #include "vm/oop/ByteArrayOopDescriptor.hpp"
+#include "vm/utility/StringHash.hpp"
+#include "vm/utility/StringKernels.hpp"
 
 
 bool ByteArrayOopDescriptor::verify() {
@@ -131,81 +133,18 @@ void ByteArrayOopDescriptor::bootstrap_object( Bootstrap *bootstrap ) {
 }
 
 
-static std::int32_t sub_sign( std::int32_t a, std::int32_t b ) {
-    if ( a < b )
-        return -1;
-
-    if ( a > b )
-        return 1;
-
-    return 0;
-}
-
-
-std::int32_t compare_as_bytes( const std::uint8_t *a, const std::uint8_t *b ) {
-    // machine dependent code; little endian code
-    if ( a[ 0 ] - b[ 0 ] )
-        return sub_sign( a[ 0 ], b[ 0 ] );
-    if ( a[ 1 ] - b[ 1 ] )
-        return sub_sign( a[ 1 ], b[ 1 ] );
-    if ( a[ 2 ] - b[ 2 ] )
-        return sub_sign( a[ 2 ], b[ 2 ] );
-
-    return sub_sign( a[ 3 ], b[ 3 ] );
-}
-
-
 std::int32_t ByteArrayOopDescriptor::compare( ByteArrayOop arg ) {
-    // Get the addresses of the length fields
-    const std::uint32_t *a = (std::uint32_t *) length_addr();
-    const std::uint32_t *b = (std::uint32_t *) arg->length_addr();
-
-    // Get the word sizes of the arays
-    std::int32_t a_size = roundTo( SmallIntegerOop( *a++ )->value() * sizeof( char ), sizeof( std::int32_t ) ) / sizeof( std::int32_t );
-    std::int32_t b_size = roundTo( SmallIntegerOop( *b++ )->value() * sizeof( char ), sizeof( std::int32_t ) ) / sizeof( std::int32_t );
-
-    const std::uint32_t *a_end = a + min( a_size, b_size );
-    while ( a < a_end ) {
-        if ( *b++ not_eq *a++ )
-            return compare_as_bytes( (const std::uint8_t *) ( a - 1 ), (const std::uint8_t *) ( b - 1 ) );
-    }
-    return sub_sign( a_size, b_size );
+    return StringKernels::compare( bytes(), length(), arg->bytes(), arg->length() );
 }
 
 
 std::int32_t ByteArrayOopDescriptor::compare_doubleBytes( DoubleByteArrayOop arg ) {
-    // %not optimized
-    std::int32_t s1 = length();
-    std::int32_t s2 = arg->length();
-    std::int32_t n  = s1 < s2 ? s1 : s2;
-
-    for ( std::size_t i = 1; i <= n; i++ ) {
-        std::int32_t result = sub_sign( byte_at( i ), arg->doubleByte_at( i ) );
-        if ( result not_eq 0 )
-            return result;
-    }
-    return sub_sign( s1, s2 );
+    return StringKernels::compare( bytes(), length(), arg->doubleBytes(), arg->length() );
 }
 
 
 std::int32_t ByteArrayOopDescriptor::hash_value() {
-    std::int32_t len = length();
-    std::int32_t result;
-
-    if ( len == 0 ) {
-        result = 1;
-    } else if ( len == 1 ) {
-        result = byte_at( 1 );
-    } else {
-        std::uint32_t val;
-        val    = byte_at( 1 );
-        val    = ( val << 3 ) ^ ( byte_at( 2 ) ^ val );
-        val    = ( val << 3 ) ^ ( byte_at( len ) ^ val );
-        val    = ( val << 3 ) ^ ( byte_at( len - 1 ) ^ val );
-        val    = ( val << 3 ) ^ ( byte_at( len / 2 + 1 ) ^ val );
-        val    = ( val << 3 ) ^ ( len ^ val );
-        result = MarkOopDescriptor::masked_hash( val );
-    }
+    std::int32_t result = MarkOopDescriptor::masked_hash( StringHash::hash( bytes(), length() ) );
     return result == 0 ? 1 : result;
 }
 
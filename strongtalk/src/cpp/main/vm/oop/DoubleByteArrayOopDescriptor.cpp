@@ -7,6 +7,8 @@
 #include "vm/klass/DoubleByteArrayKlass.hpp"
 #include "vm/oop/DoubleByteArrayOopDescriptor.hpp"
 #include "vm/runtime/ResourceArea.hpp"
+#include "vm/utility/StringHash.hpp"
+#include "vm/utility/StringKernels.hpp"
 
 
 bool DoubleByteArrayOopDescriptor::verify() {
@@ -33,84 +35,13 @@ void DoubleByteArrayOopDescriptor::bootstrap_object( Bootstrap *stream ) {
 }
 
 
-static std::int32_t sub_sign( std::int32_t a, std::int32_t b ) {
-    if ( a < b )
-        return -1;
-
-    if ( a > b )
-        return 1;
-
-    return 0;
-}
-
-
-std::int32_t compare_as_doubleBytes( const std::uint16_t *a, const std::uint16_t *b ) {
-    // machine dependent code; little endian code
-    if ( a[ 0 ] - b[ 0 ] )
-        return sub_sign( a[ 0 ], b[ 0 ] );
-
-    return sub_sign( a[ 1 ], b[ 1 ] );
-}
-
-
 std::int32_t DoubleByteArrayOopDescriptor::compare( DoubleByteArrayOop arg ) {
-    // Get the addresses of the length fields
-    const std::uint32_t *a = (const std::uint32_t *) length_addr();
-    const std::uint32_t *b = (const std::uint32_t *) arg->length_addr();
-
-    // Get the word sizes of the arays
-    std::int32_t a_size = roundTo( SmallIntegerOop( *a++ )->value() * sizeof( std::uint16_t ), sizeof( std::int32_t ) ) / sizeof( std::int32_t );
-    std::int32_t b_size = roundTo( SmallIntegerOop( *b++ )->value() * sizeof( std::uint16_t ), sizeof( std::int32_t ) ) / sizeof( std::int32_t );
-
-    const std::uint32_t *a_end = a + min( a_size, b_size );
-    while ( a < a_end ) {
-        if ( *b++ not_eq *a++ )
-            return compare_as_doubleBytes( (const std::uint16_t *) ( a - 1 ), (const std::uint16_t *) ( b - 1 ) );
-    }
-    return sub_sign( a_size, b_size );
+    return StringKernels::compare( doubleBytes(), length(), arg->doubleBytes(), arg->length() );
 }
 
 
-/*
-std::int32_t doubleByteArrayOopDescriptor::compare(doubleByteArrayOop arg) {
-  // Get the addresses of the length fields
-  std::int32_t         len_a = length();
-  std::uint16_t* a     = doubleBytes();
-
-  std::int32_t         len_b = arg->length();
-  std::uint16_t* b     = arg->doubleBytes();
-
-  std::uint16_t* end = len_a <= len_b ? a + len_a : b + len_b;
-
-  while(a < end) {
-    std::int32_t result = *a++ - *b++;
-    if (result not_eq 0) {
-      if (result < 0) return -1;
-      if (result > 0) return  1;
-    }
-  }
-  return sub_sign(len_a, len_b);
-}
-*/
-
 std::int32_t DoubleByteArrayOopDescriptor::hash_value() {
-    std::int32_t len = length();
-    std::int32_t result;
-
-    if ( len == 0 ) {
-        result = 1;
-    } else if ( len == 1 ) {
-        result = doubleByte_at( 1 );
-    } else {
-        std::uint32_t val;
-        val    = doubleByte_at( 1 );
-        val    = ( val << 3 ) ^ ( doubleByte_at( 2 ) ^ val );
-        val    = ( val << 3 ) ^ ( doubleByte_at( len ) ^ val );
-        val    = ( val << 3 ) ^ ( doubleByte_at( len - 1 ) ^ val );
-        val    = ( val << 3 ) ^ ( doubleByte_at( len / 2 + 1 ) ^ val );
-        val    = ( val << 3 ) ^ ( len ^ val );
-        result = MarkOopDescriptor::masked_hash( val );
-    }
+    std::int32_t result = MarkOopDescriptor::masked_hash( StringHash::hash( doubleBytes(), length() ) );
     return result == 0 ? 1 : result;
 }
 
@@ -902,6 +902,34 @@ void MethodOopDescriptor::customize_for( KlassOop klass, MixinOop mixin ) {
 }
 
 
+void MethodOopDescriptor::install_superinstructions() {
+    if ( has_superinstructions() )
+        return;
+
+    std::uint8_t *end = codes() + size_of_codes() * OOP_SIZE;
+    CodeIterator c( this );
+    do {
+        MethodOop block_method = c.block_method();
+        if ( block_method ) {
+            block_method->install_superinstructions();
+        }
+
+        // the pair is fused in place: only the first byte changes, the second instruction stays where it is
+        std::uint8_t *next = c.next_hp();
+        if ( next < end ) {
+            ByteCodes::Code first = ByteCodes::Code( *c.hp() );
+            ByteCodes::Code fused = ByteCodes::superinstruction_for( first, ByteCodes::Code( *next ) );
+            if ( fused not_eq first ) {
+                c.set_code( fused );
+            }
+        }
+    } while ( c.advance() );
+
+    std::int32_t new_flags = addNthBit( flags(), hasSuperinstructionsFlag );
+    set_size_and_flags( size_of_codes(), nofArgs(), new_flags );
+}
+
+
 void MethodOopDescriptor::uncustomize_for( MixinOop mixin ) {
 
     if ( not is_customized() )
@@ -344,7 +344,10 @@ public:
 
         // block specific flags (overlapping with method specific flags)
         blockInfoFlags = methodInfoFlags,       //
-        blockInfoSize  = methodInfoSize         //
+        blockInfoSize  = methodInfoSize,        //
+
+        // interpreter flags
+        hasSuperinstructionsFlag = methodInfoFlags + methodInfoSize //
     };
 
     // Flags for inlining
@@ -444,6 +447,15 @@ public:
 
     void uncustomize_for( MixinOop mixin );
 
+    // Superinstructions (see ByteCodes)
+    bool has_superinstructions() const {
+        return isBitSet( flags(), hasSuperinstructionsFlag );
+    }
+
+
+    // Rewrites the fusable bytecode pairs of the method and its blocks into superinstructions
+    void install_superinstructions();
+
     // Uplevel accesses via contexts
     std::int32_t lexicalDistance( std::int32_t contextNo );    // for uplevel accesses; see comment in .c file
     std::int32_t contextNo( std::int32_t lexicalDistance );    // inverse of lexicalDistance()
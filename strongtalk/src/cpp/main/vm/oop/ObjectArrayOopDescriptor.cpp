@@ -6,6 +6,9 @@
 
 #include "vm/oop/ObjectArrayOopDescriptor.hpp"
 #include "vm/memory/OopFactory.hpp"
+#include "vm/memory/util.hpp"
+
+#include <cstring>
 
 
 bool ObjectArrayOopDescriptor::verify() {
@@ -102,38 +105,39 @@ ObjectArrayOop ObjectArrayOopDescriptor::copy_add_two( Oop a, Oop b ) {
 
 
 void ObjectArrayOopDescriptor::replace_from_to( std::int32_t from, std::int32_t to, ObjectArrayOop source, std::int32_t start ) {
-    std::int32_t other_index = start;
-    if ( start < to ) {
-        // copy up
-        for ( std::size_t i = from; i <= to; i++ ) {
-            source->obj_at_put( other_index++, obj_at( i ) );
-        }
-    } else {
-        // copy down
-        for ( std::size_t i = to; i >= from; i-- ) {
-            source->obj_at_put( other_index--, obj_at( i ) );
-        }
-    }
+    // self[from..to] := source[start..start + to - from]; source may be self with overlapping ranges
+    std::int32_t count = to - from + 1;
+    if ( count <= 0 )
+        return;
+    Oop *destination = objs( from );
+    std::memmove( destination, source->objs( start ), count * sizeof( Oop ) );
+    store_check_range( destination, count );
 }
 
 
 void ObjectArrayOopDescriptor::replace_and_fill( std::int32_t from, std::int32_t start, ObjectArrayOop source ) {
+    std::int32_t len = length();
+
     // Fill the first part
-    for ( std::size_t i = 1; i < from; i++ ) {
-        obj_at_put( i, nilObject );
-    }
+    std::int32_t head = min( from - 1, len );
+    set_oops( objs( 1 ), head, nilObject );
 
     // Fill the middle part
-    std::int32_t to = min( source->length() - start + 1, length() );
-
-    for ( std::size_t i = from; i <= to; i++ ) {
-        obj_at_put( i, source->obj_at( start + i - from ) );
-    }
+    std::int32_t to    = min( source->length() - start + 1, len );
+    std::int32_t count = max( to - from + 1, 0 );
+    std::memmove( objs( from ), source->objs( start ), count * sizeof( Oop ) );
+    store_check_range( objs( from ), count );
 
     // Fill the last part
-    for ( std::size_t i = to + 1; i <= length(); i++ ) {
-        obj_at_put( i, nilObject );
-    }
+    set_oops( objs( head + count + 1 ), len - head - count, nilObject );
+}
+
+
+void ObjectArrayOopDescriptor::store_check_range( Oop *p, std::int32_t count ) {
+    // one memset over the card range instead of a card mark per element; stores into new space
+    // need no card marks
+    if ( count > 0 and is_old() )
+        Universe::remembered_set->record_multistores( p, p + count );
 }
 
 
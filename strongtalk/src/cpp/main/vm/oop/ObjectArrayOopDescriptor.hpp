@@ -103,6 +103,9 @@ public:
 
     void replace_and_fill( std::int32_t from, std::int32_t start, ObjectArrayOop source );
 
+    // marks the cards of count elements starting at p after a bulk store into this array
+    void store_check_range( Oop *p, std::int32_t count );
+
     friend class objectArrayKlass;
 
 private:
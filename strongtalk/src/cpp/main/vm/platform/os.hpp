@@ -45,6 +45,8 @@ public:
 
     static void add_exception_handler( void handler( void *fp, void *sp, void *pc ) );
 
+    static void add_stack_fault_handler( bool handler( void *addr ) );    // handler returns whether it resolved the fault
+
     // We must call updateTimes before calling userTime or currentTime.
     static std::int32_t updateTimes();
 
@@ -98,6 +100,28 @@ public:
 
     static const char *exec_memory( std::int32_t size );
 
+    // OS interface to memory mapped files - used for file aliens
+    enum class MemoryAdvice {
+        normal     = 0, // no special treatment
+        random     = 1, // expect page references in random order
+        sequential = 2, // expect page references in sequential order
+        will_need  = 3, // expect access in the near future
+        dont_need  = 4  // do not expect access in the near future
+    };
+
+    // the offset of a mapping must be a multiple of the granularity
+    static std::int32_t file_mapping_granularity();
+
+    // maps size bytes of the file starting at offset, or the rest of the file if size is 0 (size is
+    // set to the size mapped). The mapping is read-only, or copy-on-write: the pages can be written
+    // but the changes are private to the mapping. Returns nullptr if the file cannot be mapped.
+    static const char *map_file( const char *name, std::int64_t offset, std::int32_t &size, bool copy_on_write );
+
+    static bool unmap_file( const char *addr, std::int32_t size );
+
+    // a hint how the pages of [addr, addr + size) will be used
+    static bool advise_memory( const char *addr, std::int32_t size, MemoryAdvice advice );
+
     // OS interface to C memory routines - used for small allocations
     static void *malloc( std::int32_t size );
 
@@ -110,6 +134,10 @@ public:
 
     static Thread *create_thread( std::int32_t main( void *parameter ), void *parameter, std::int32_t *id_addr );
 
+    static Thread *current_thread( std::int32_t *id_addr );
+
+    static bool supports_user_mode_process_switching();    // see Process::switch_to
+
     static Event *create_event( bool initial_state );
 
     static void *stack_limit( Thread *thread );
@@ -5,7 +5,12 @@
 
 #ifdef __linux__
 
+#include <cerrno>
 #include <signal.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "vm/system/posix.hpp"
 #include "vm/system/asserts.hpp"
@@ -49,6 +54,23 @@ bool Event::waitFor() {
 }
 
 
+bool Event::waitFor( std::int32_t timeout_in_ms ) {
+    Lock mark( &_mutex );
+    if ( !_signalled and timeout_in_ms > 0 ) {
+        struct timespec deadline{};
+        clock_gettime( CLOCK_REALTIME, &deadline );
+        deadline.tv_sec += timeout_in_ms / 1000;
+        deadline.tv_nsec += ( timeout_in_ms % 1000 ) * 1000000L;
+        if ( deadline.tv_nsec >= 1000000000L ) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while ( !_signalled and pthread_cond_timedwait( &_notifier, &_mutex, &deadline ) not_eq ETIMEDOUT );
+    }
+    return _signalled;
+}
+
+
 Event::Event( bool state ) {
     _signalled = state;
     pthread_mutex_init( &_mutex, nullptr );
@@ -146,6 +168,7 @@ typedef struct {
 
     void * parameter;
     char * stackLimit;
+    Thread * thread;
 
 } thread_args_t;
 
@@ -162,15 +185,24 @@ char * calcStackLimit() {
 }
 
 
+void install_alternate_signal_stack();
+
+void remove_alternate_signal_stack();
+
+
 void * mainWrapper( void * args ) {
     thread_args_t * targs = ( thread_args_t * ) args;
     targs->stackLimit = calcStackLimit();
+    // register the thread before it runs, so os::current_thread finds it
+    targs->thread = new Thread( pthread_self(), targs->stackLimit );
+    install_alternate_signal_stack();
 
     std::int32_t (* threadMain)( void * ) = targs->main;
     void    * parameter = targs->parameter;
     std::int32_t * result    = ( std::int32_t * ) malloc( sizeof( std::int32_t ) );
     threadCreated->signal();
     *result = threadMain( parameter );
+    remove_alternate_signal_stack();
     return ( void * ) result;
 }
 
@@ -195,12 +227,24 @@ Thread * os::create_thread( std::int32_t threadStart( void * parameter ), void *
         }
     }
     threadCreated->waitFor();
-    Thread * thread = new Thread( threadId, threadArgs.stackLimit );
+    Thread * thread = threadArgs.thread;
     *id_addr = thread->_thread_index;
     return thread;
 }
 
 
+Thread * os::current_thread( std::int32_t * id_addr ) {
+    Thread * thread = Thread::find( pthread_self() );
+    *id_addr = thread == nullptr ? -1 : thread->_thread_index;
+    return thread;
+}
+
+
+bool os::supports_user_mode_process_switching() {
+    return true;
+}
+
+
 void * os::stack_limit( Thread * thread ) {
     return thread->_stackLimit;
 }
@@ -319,7 +363,8 @@ void os::timerPrintBuffer() {
 
 
 char * os::reserve_memory( std::int32_t size ) {
-    return ( char * ) mmap( 0, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0 );
+    void * addr = mmap( 0, size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    return addr == MAP_FAILED ? nullptr : ( char * ) addr;
 }
 
 
@@ -349,7 +394,60 @@ void * os::malloc( std::int32_t size ) {
 
 
 const char * os::exec_memory( std::int32_t size ) {
-    return ( const char * ) mmap( 0, size, PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, 0, 0 );
+    void * addr = mmap( 0, size, PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    return addr == MAP_FAILED ? nullptr : ( const char * ) addr;
+}
+
+
+std::int32_t os::file_mapping_granularity() {
+    return vm_page_size();
+}
+
+
+const char * os::map_file( const char * name, std::int64_t offset, std::int32_t & size, bool copy_on_write ) {
+    if ( offset < 0 or offset % file_mapping_granularity() not_eq 0 or size < 0 or static_cast<off_t>( offset ) not_eq offset )
+        return nullptr;
+
+    std::int32_t fd = ::open( name, O_RDONLY );
+    if ( fd < 0 )
+        return nullptr;
+
+    struct stat status;
+    if ( fstat( fd, &status ) not_eq 0 or offset >= status.st_size ) {
+        ::close( fd );
+        return nullptr;
+    }
+
+    // pages beyond the end of the file cannot be accessed, so the mapping must lie within the file
+    std::int64_t available = status.st_size - offset;
+    if ( size == 0 ) {
+        if ( available > INT32_MAX ) {
+            ::close( fd );
+            return nullptr;
+        }
+        size = static_cast<std::int32_t>( available );
+    } else if ( size > available ) {
+        ::close( fd );
+        return nullptr;
+    }
+
+    void * addr = mmap( nullptr, size, copy_on_write ? PROT_READ | PROT_WRITE : PROT_READ, copy_on_write ? MAP_PRIVATE : MAP_SHARED, fd, static_cast<off_t>( offset ) );
+    ::close( fd ); // the mapping keeps the file open
+    return addr == MAP_FAILED ? nullptr : ( const char * ) addr;
+}
+
+
+bool os::unmap_file( const char * addr, std::int32_t size ) {
+    return munmap( const_cast<char *>( addr ), size ) == 0;
+}
+
+
+bool os::advise_memory( const char * addr, std::int32_t size, MemoryAdvice advice ) {
+    static const std::int32_t advices[] = { POSIX_MADV_NORMAL, POSIX_MADV_RANDOM, POSIX_MADV_SEQUENTIAL, POSIX_MADV_WILLNEED, POSIX_MADV_DONTNEED };
+
+    // the range must start at a page boundary
+    std::int32_t misalignment = reinterpret_cast<std::uintptr_t>( addr ) % vm_page_size();
+    return posix_madvise( const_cast<char *>( addr - misalignment ), size + misalignment, advices[ static_cast<std::int32_t>( advice ) ] ) == 0;
 }
 
 
@@ -426,8 +524,9 @@ void os::signal_event( Event * event ) {
 }
 
 
+// like WaitForSingleObject on win32, true means the wait timed out
 bool os::wait_for_event_or_timer( Event * event, std::int32_t timeout_in_ms ) {
-    return false;
+    return !event->waitFor( timeout_in_ms );
 }
 
 
@@ -570,10 +669,15 @@ void install_dummy_handler() {
 void trace_stack( std::int32_t thread_id );
 
 void (* userHandler)( void * fp, void * sp, void * pc ) = nullptr;
+bool (* stackFaultHandler)( void * addr ) = nullptr;
 
 
 static void handler( std::int32_t signum, siginfo_t * info, void * context ) {
 
+    // a fault on the guard page of a growable stack is resolved by growing the stack (see Process::grow_stack)
+    if ( signum == SIGSEGV and stackFaultHandler and stackFaultHandler( info->si_addr ) )
+        return;
+
     install_dummy_handler();
     trace_stack( os::current_thread_id() );
 
@@ -594,6 +698,51 @@ void os::add_exception_handler( void newHandler( void * fp, void * sp, void * pc
 }
 
 
+void os::add_stack_fault_handler( bool newHandler( void * addr ) ) {
+    stackFaultHandler = newHandler;
+}
+
+
+// Signals are handled on a stack of their own, as a stack fault leaves no room on the faulting stack.
+static thread_local void * alternate_signal_stack = nullptr;
+
+
+void install_alternate_signal_stack() {
+    stack_t ss;
+    ss.ss_sp    = ::malloc( SIGSTKSZ );
+    ss.ss_size  = SIGSTKSZ;
+    ss.ss_flags = 0;
+    if ( ss.ss_sp == nullptr ) {
+        SPDLOG_ERROR( "cannot allocate the alternate signal stack, stack faults of this thread cannot be handled" );
+        return;
+    }
+    if ( sigaltstack( &ss, nullptr ) == -1 ) {
+        SPDLOG_ERROR( "sigaltstack failed (errno {}), stack faults of this thread cannot be handled", errno );
+        ::free( ss.ss_sp );
+        return;
+    }
+    alternate_signal_stack = ss.ss_sp;
+}
+
+
+// Called when a thread ends; signals of the thread are handled on its own stack again.
+void remove_alternate_signal_stack() {
+    if ( alternate_signal_stack == nullptr )
+        return;
+
+    stack_t ss;
+    ss.ss_sp    = nullptr;
+    ss.ss_size  = 0;
+    ss.ss_flags = SS_DISABLE;
+    if ( sigaltstack( &ss, nullptr ) == -1 ) {
+        SPDLOG_ERROR( "sigaltstack failed (errno {})", errno );
+        return;
+    }
+    ::free( alternate_signal_stack );
+    alternate_signal_stack = nullptr;
+}
+
+
 void install_signal_handlers() {
     struct sigaction sa;
 
@@ -604,7 +753,7 @@ void install_signal_handlers() {
         SPDLOG_INFO( "SIGUSR1\n" );
     }
 
-    sa.sa_flags |= SA_SIGINFO;
+    sa.sa_flags |= SA_SIGINFO | SA_ONSTACK;
     sa.sa_sigaction = handler;
     if ( sigaction( SIGSEGV, &sa, nullptr ) == -1 ) {
         SPDLOG_INFO( "SIGSEGV\n" );
@@ -620,6 +769,7 @@ void os_init() {
     ThreadCritical::intialize();
 
     install_signal_handlers();
+    install_alternate_signal_stack();
     os::initialize_system_info();
 
     pthread_setconcurrency( 1 );
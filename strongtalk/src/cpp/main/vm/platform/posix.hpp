@@ -62,6 +62,10 @@ class Event : public CHeapAllocatedObject {
         bool waitFor();
 
 
+        // waits at most timeout_in_ms for the event, tells whether it is signalled
+        bool waitFor( std::int32_t timeout_in_ms );
+
+
         Event( bool state );
 
 
@@ -133,6 +137,7 @@ class Thread : CHeapAllocatedObject {
 
 
         friend class os;
+        friend void * mainWrapper( void * args );
 };
 
 
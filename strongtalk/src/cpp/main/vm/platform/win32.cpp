@@ -111,6 +111,18 @@ Thread *os::create_thread( std::int32_t main( void *parameter ), void *parameter
 }
 
 
+Thread *os::current_thread( std::int32_t *id_addr ) {
+    *id_addr = GetCurrentThreadId();
+    return Thread::findThread( *id_addr );
+}
+
+
+bool os::supports_user_mode_process_switching() {
+    // switching stacks behind the back of Windows would corrupt the thread's exception handler chain and stack bounds
+    return false;
+}
+
+
 void *os::stack_limit( Thread *thread ) {
     return thread->stack_limit;
 }
@@ -420,6 +432,65 @@ const char *os::exec_memory( std::int32_t size ) {
 }
 
 
+std::int32_t os::file_mapping_granularity() {
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo( &systemInfo );
+    return systemInfo.dwAllocationGranularity;
+}
+
+
+const char *os::map_file( const char *name, std::int64_t offset, std::int32_t &size, bool copy_on_write ) {
+    if ( offset < 0 or offset % file_mapping_granularity() not_eq 0 or size < 0 )
+        return nullptr;
+
+    HANDLE file = CreateFileA( name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+    if ( file == INVALID_HANDLE_VALUE )
+        return nullptr;
+
+    // the mapping must lie within the file
+    LARGE_INTEGER file_size;
+    if ( not GetFileSizeEx( file, &file_size ) or offset >= file_size.QuadPart ) {
+        CloseHandle( file );
+        return nullptr;
+    }
+    std::int64_t available = file_size.QuadPart - offset;
+    if ( size == 0 ) {
+        if ( available > INT32_MAX ) {
+            CloseHandle( file );
+            return nullptr;
+        }
+        size = static_cast<std::int32_t>( available );
+    } else if ( size > available ) {
+        CloseHandle( file );
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingA( file, nullptr, copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr );
+    CloseHandle( file );
+    if ( mapping == nullptr )
+        return nullptr;
+
+    void *addr = MapViewOfFile( mapping, copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, static_cast<DWORD>( offset >> 32 ), static_cast<DWORD>( offset ), size );
+    CloseHandle( mapping ); // the view keeps the mapping open
+    return reinterpret_cast<const char *>( addr );
+}
+
+
+bool os::unmap_file( const char *addr, std::int32_t size ) {
+    st_unused( size ); // unused
+    return UnmapViewOfFile( addr ) ? true : false;
+}
+
+
+bool os::advise_memory( const char *addr, std::int32_t size, MemoryAdvice advice ) {
+    // only the prefetch hints have a Windows equivalent, the others are accepted and ignored
+    if ( advice not_eq MemoryAdvice::will_need )
+        return true;
+    WIN32_MEMORY_RANGE_ENTRY range = { const_cast<char *>( addr ), static_cast<SIZE_T>( size ) };
+    return PrefetchVirtualMemory( GetCurrentProcess(), 1, &range, 0 ) ? true : false;
+}
+
+
 void *os::malloc( std::int32_t size ) {
     if ( not ThreadCritical::initialized() ) {
         return ::malloc( size );
@@ -633,6 +704,12 @@ void os::add_exception_handler( void new_handler( void *fp, void *sp, void *pc )
 }
 
 
+void os::add_stack_fault_handler( bool new_handler( void *addr ) ) {
+    // no growable stacks: processes run on thread stacks, which Windows grows itself
+    st_unused( new_handler );
+}
+
+
 std::int32_t os::error_code() {
     return GetLastError();
 }
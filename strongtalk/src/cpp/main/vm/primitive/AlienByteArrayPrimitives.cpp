@@ -21,6 +21,7 @@
 #include "vm/code/StubRoutines.hpp"
 #include "vm/primitive/primitive_tracing.hpp"
 #include "vm/primitive/alien_macros.hpp"
+#include "vm/utility/GrowableArray.hpp"
 
 
 PersistentHandle *_largeIntegerClass = nullptr;
@@ -58,6 +59,62 @@ Oop unsafeContents( Oop unsafeAlien ) {
 }
 
 
+// The file mappings made by alienMapFile; only these are unmapped by alienUnmap.
+
+class MappedFile : public CHeapAllocatedObject {
+public:
+    const char   *_address;
+    std::int32_t _size;
+    bool         _read_only;    // mapped shared without write access: a write would fault
+
+
+    MappedFile( const char *address, std::int32_t size, bool read_only ) :
+        _address{ address },
+        _size{ size },
+        _read_only{ read_only } {
+    }
+};
+
+static GrowableArray<MappedFile *> *mapped_files       = nullptr;
+static std::int32_t                read_only_mappings = 0;
+
+
+static MappedFile *find_mapped_file( const void *address ) {
+    if ( mapped_files == nullptr )
+        return nullptr;
+    for ( std::int32_t index = 0; index < mapped_files->length(); index++ ) {
+        if ( mapped_files->at( index )->_address == address )
+            return mapped_files->at( index );
+    }
+    return nullptr;
+}
+
+
+// does [address, address + count) overlap a read-only file mapping? Checked before every write
+// through an alien, so the count of read-only mappings keeps the common case to a single compare.
+bool in_read_only_mapping( const void *address, std::int32_t count ) {
+    if ( read_only_mappings == 0 or count <= 0 )
+        return false;
+    const char *first = (const char *) address;
+    for ( std::int32_t index = 0; index < mapped_files->length(); index++ ) {
+        MappedFile *file = mapped_files->at( index );
+        if ( file->_read_only and first < file->_address + file->_size and file->_address < first + count )
+            return true;
+    }
+    return false;
+}
+
+
+// is the argument laid out as an alien: a byte array (but not a Symbol or LargeInteger) holding the
+// size and, for direct aliens, the contents, or else the address?
+static bool is_alien( Oop argument ) {
+    if ( not argument->isByteArray() or argument->isSymbol() or MemOop( argument )->klass() == largeIntegerClass() )
+        return false;
+    std::int32_t length = ByteArrayOop( argument )->length();
+    return length >= 8 and alienSize( argument ) <= length - (std::int32_t) sizeof( std::int32_t );
+}
+
+
 TRACE_FUNC( TraceByteArrayPrims, "byteArray" )
 
 
@@ -74,6 +131,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienUnsignedByteAtPut, Oop receiver, Oop argu
     PROLOGUE_3( "alienUnsignedByteAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, std::uint8_t );
+    checkAlienWritable( receiver, argument1, std::uint8_t );
     checkAlienAtPutValue( receiver, argument2, std::uint8_t, 0, 255 );
 
     alienAt( receiver, argument1, std::uint8_t ) = SmallIntegerOop( argument2 )->value();
@@ -95,6 +153,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienSignedByteAtPut, Oop receiver, Oop argume
     PROLOGUE_3( "alienSignedByteAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, char );
+    checkAlienWritable( receiver, argument1, char );
     checkAlienAtPutValue( receiver, argument2, char, -128, 127 );
 
     alienAt( receiver, argument1, char ) = SmallIntegerOop( argument2 )->value();
@@ -116,6 +175,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienUnsignedShortAtPut, Oop receiver, Oop arg
     PROLOGUE_3( "alienUnsignedShortAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, std::uint16_t );
+    checkAlienWritable( receiver, argument1, std::uint16_t );
     checkAlienAtPutValue( receiver, argument2, std::uint16_t, 0, 65535 );
 
     alienAt( receiver, argument1, std::uint16_t ) = SmallIntegerOop( argument2 )->value();
@@ -137,6 +197,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienSignedShortAtPut, Oop receiver, Oop argum
     PROLOGUE_3( "alienSignedShortAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, std::int16_t );
+    checkAlienWritable( receiver, argument1, std::int16_t );
     checkAlienAtPutValue( receiver, argument2, std::int16_t, -32768, 32767 );
 
     alienAt( receiver, argument1, std::int16_t ) = SmallIntegerOop( argument2 )->value();
@@ -166,6 +227,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienUnsignedLongAtPut, Oop receiver, Oop argu
     PROLOGUE_3( "alienUnsignedLongAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, std::uint32_t );
+    checkAlienWritable( receiver, argument1, std::uint32_t );
     if ( not argument2->isSmallIntegerOop() and not argument2->isByteArray() )
         return markSymbol( vmSymbols::second_argument_has_wrong_type() );
 
@@ -205,6 +267,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienSignedLongAtPut, Oop receiver, Oop argume
     PROLOGUE_3( "alienSignedLongAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, std::int32_t );
+    checkAlienWritable( receiver, argument1, std::int32_t );
     if ( not argument2->isSmallIntegerOop() and not argument2->isByteArray() )
         return markSymbol( vmSymbols::second_argument_has_wrong_type() );
 
@@ -241,6 +304,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienDoubleAtPut, Oop receiver, Oop argument1,
     PROLOGUE_3( "alienDoubleAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, double );
+    checkAlienWritable( receiver, argument1, double );
     if ( not argument2->isDouble() )
         return markSymbol( vmSymbols::second_argument_has_wrong_type() );
 
@@ -266,6 +330,7 @@ PRIM_DECL_3( ByteArrayPrimitives::alienFloatAtPut, Oop receiver, Oop argument1,
     PROLOGUE_3( "alienFloatAtPut", receiver, argument1, argument2 );
     checkAlienAtReceiver( receiver );
     checkAlienAtPutIndex( receiver, argument1, float );
+    checkAlienWritable( receiver, argument1, float );
     if ( not argument2->isDouble() )
         return markSymbol( vmSymbols::second_argument_has_wrong_type() );
 
@@ -353,6 +418,8 @@ typedef void ( __CALLING_CONVENTION *call_out_func_7 )( void *, void *, void *,
 
 typedef void ( __CALLING_CONVENTION *call_out_func_args)( void *, void *, Oop, Oop * );
 
+typedef void ( __CALLING_CONVENTION *call_out_func_signature)( void *, void *, Oop * );
+
 
 void break_on_error( void *address, Oop result ) {
     if ( false )
@@ -564,3 +631,231 @@ PRIM_DECL_3( ByteArrayPrimitives::alienCallResultWithArguments, Oop receiver, Oo
     delete resultHandle;
     return result;
 }
+
+
+// does argument have the type given by a signature character (see StubRoutines::alien_call_entry)?
+static bool matches_signature( char type, Oop argument ) {
+    switch ( type ) {
+        case 'i':
+            return argument->isSmallIntegerOop();
+        case 'p':
+            return ( argument->isByteArray() and MemOop( argument )->klass() not_eq largeIntegerClass() ) or isUnsafe( argument );
+        case 'd':
+        case 'f':
+            return argument->isDouble();
+        default:
+            return false;
+    }
+}
+
+
+PRIM_DECL_4( ByteArrayPrimitives::alienCallResultWithSignature, Oop receiver, Oop argument1, Oop argument2, Oop argument3 ) {
+    PROLOGUE_4( "alienCallResultWithSignature", receiver, argument1, argument2, argument3 );
+    checkAlienCalloutReceiver( receiver );
+    checkAlienCalloutResultArgs( argument1 );
+    if ( not argument2->isByteArray() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+    if ( not argument3->isObjectArray() )
+        return markSymbol( vmSymbols::third_argument_has_wrong_type() );
+
+    const char   *signature = ByteArrayOop( argument2 )->chars();
+    std::int32_t length     = ByteArrayOop( argument2 )->length();
+    std::int32_t args       = StubRoutines::alien_signature_args( signature, length );
+    if ( args < 0 or args not_eq ObjectArrayOop( argument3 )->length() )
+        return markSymbol( vmSymbols::argument_is_invalid() );
+
+    for ( std::int32_t index = 0; index < args; index++ ) {
+        if ( not matches_signature( signature[ index ], ObjectArrayOop( argument3 )->obj_at( index + 1 ) ) )
+            return markSymbol( vmSymbols::argument_has_wrong_type() );
+    }
+
+    // a float result is stored as a whole, so a direct result alien must be large enough
+    char result_type = StubRoutines::alien_signature_result( signature, length );
+    if ( result_type not_eq 'i' and argument1 not_eq nilObject and alienSize( argument1 ) > 0 and alienSize( argument1 ) < ( result_type == 'd' ? 8 : 4 ) )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    call_out_func_signature entry = call_out_func_signature( StubRoutines::alien_call_entry( signature, length ) );
+    if ( entry == nullptr )
+        return markSymbol( vmSymbols::illegal_state() );
+
+    PersistentHandle *resultHandle = new PersistentHandle( argument1 );
+
+    void *address = alienAddress( receiver );
+    entry( address, alienResult2( resultHandle ), ObjectArrayOop( argument3 )->objs( 1 ) );
+    Oop result = resultHandle->as_oop();
+    break_on_error( address, result );
+    delete resultHandle;
+    return result;
+}
+
+
+PRIM_DECL_5( ByteArrayPrimitives::alienMapFile, Oop receiver, Oop name, Oop offset, Oop size, Oop copy ) {
+    PROLOGUE_5( "alienMapFile", receiver, name, offset, size, copy );
+    checkAlienReceiver( receiver );
+    // an alien that already points somewhere must be unmapped (or freed) first
+    if ( ByteArrayOop( receiver )->length() < 8 or alienSize( receiver ) > 0 or alienAddress( receiver ) not_eq nullptr )
+        return markSymbol( vmSymbols::illegal_state() );
+    if ( not name->isByteArray() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+    if ( not offset->isSmallIntegerOop() and not( offset->isByteArray() and MemOop( offset )->klass() == largeIntegerClass() ) )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+    if ( not size->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::third_argument_has_wrong_type() );
+    if ( copy not_eq trueObject and copy not_eq falseObject )
+        return markSymbol( vmSymbols::fourth_argument_has_wrong_type() );
+
+    // offsets beyond 2^31 are LargeIntegers, exactly representable as doubles up to 2^53
+    std::int64_t fileOffset;
+    if ( offset->isSmallIntegerOop() ) {
+        fileOffset = SmallIntegerOop( offset )->value();
+    } else {
+        bool   ok;
+        double value = ByteArrayOop( offset )->number().as_double( ok );
+        if ( not ok or value >= 9007199254740992.0 )
+            return markSymbol( vmSymbols::argument_is_invalid() );
+        fileOffset = static_cast<std::int64_t>( value );
+    }
+    std::int32_t mapSize = SmallIntegerOop( size )->value();
+    if ( fileOffset < 0 or fileOffset % os::file_mapping_granularity() not_eq 0 or mapSize < 0 )
+        return markSymbol( vmSymbols::argument_is_invalid() );
+
+    ResourceMark resourceMark;
+    std::int32_t length    = ByteArrayOop( name )->length();
+    char         *fileName = new_resource_array<char>( length + 1 );
+    ByteArrayOop( name )->copy_null_terminated( fileName, length + 1 );
+
+    const char *address = os::map_file( fileName, fileOffset, mapSize, copy == trueObject );
+    if ( address == nullptr )
+        return markSymbol( vmSymbols::not_found() );
+
+    if ( mapped_files == nullptr ) {
+        mapped_files = new( true ) GrowableArray<MappedFile *>( 8, true );
+    }
+    mapped_files->append( new MappedFile( address, mapSize, copy not_eq trueObject ) );
+    if ( copy not_eq trueObject )
+        read_only_mappings++;
+
+    alienSize( receiver )    = -mapSize;
+    alienAddress( receiver ) = (void *) address;
+    return receiver;
+}
+
+
+PRIM_DECL_1( ByteArrayPrimitives::alienUnmap, Oop receiver ) {
+    PROLOGUE_1( "alienUnmap", receiver );
+    checkAlienReceiver( receiver );
+    if ( alienSize( receiver ) > 0 )
+        return markSymbol( vmSymbols::illegal_state() );
+
+    MappedFile *file = find_mapped_file( alienAddress( receiver ) );
+    if ( file == nullptr )
+        return markSymbol( vmSymbols::illegal_state() );
+
+    os::unmap_file( file->_address, file->_size );
+    mapped_files->remove( file );
+    if ( file->_read_only )
+        read_only_mappings--;
+    delete file;
+
+    alienSize( receiver )    = 0;
+    alienAddress( receiver ) = nullptr;
+    return receiver;
+}
+
+
+// is from..to (1-based, inclusive, possibly empty) within the contents of the alien? Pointer
+// aliens have no size, so any range is accepted.
+static bool alien_range_valid( Oop alien, Oop from, Oop to ) {
+    if ( not from->isSmallIntegerOop() or not to->isSmallIntegerOop() )
+        return false;
+    std::int32_t first = SmallIntegerOop( from )->value();
+    std::int32_t last  = SmallIntegerOop( to )->value();
+    return first >= 1 and last >= first - 1 and ( alienSize( alien ) == 0 or last <= std::abs( alienSize( alien ) ) );
+}
+
+
+// are count bytes from start (1-based) within the byte array?
+static bool bytes_range_valid( Oop bytes, Oop start, std::int32_t count ) {
+    if ( not start->isSmallIntegerOop() )
+        return false;
+    std::int32_t first = SmallIntegerOop( start )->value();
+    return first >= 1 and first - 1 + count <= ByteArrayOop( bytes )->length();
+}
+
+
+PRIM_DECL_4( ByteArrayPrimitives::alienAdvise, Oop receiver, Oop advice, Oop from, Oop to ) {
+    PROLOGUE_4( "alienAdvise", receiver, advice, from, to );
+    checkAlienAtReceiver( receiver );
+    if ( not advice->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+    std::int32_t value = SmallIntegerOop( advice )->value();
+    if ( value < static_cast<std::int32_t>( os::MemoryAdvice::normal ) or value > static_cast<std::int32_t>( os::MemoryAdvice::dont_need ) )
+        return markSymbol( vmSymbols::argument_is_invalid() );
+    if ( not alien_range_valid( receiver, from, to ) )
+        return markSymbol( vmSymbols::out_of_bounds() );
+
+    std::int32_t count = SmallIntegerOop( to )->value() - SmallIntegerOop( from )->value() + 1;
+    if ( count > 0 ) {
+        // only a hint: a failure is of no consequence to the caller
+        os::advise_memory( (const char *) alienContents( receiver ) + SmallIntegerOop( from )->value() - 1, count, static_cast<os::MemoryAdvice>( value ) );
+    }
+    return receiver;
+}
+
+
+PRIM_DECL_5( ByteArrayPrimitives::alienReplaceFromToWithBytes, Oop receiver, Oop from, Oop to, Oop source, Oop start ) {
+    PROLOGUE_5( "alienReplaceFromToWithBytes", receiver, from, to, source, start );
+    checkAlienAtReceiver( receiver );
+    if ( not source->isByteArray() )
+        return markSymbol( vmSymbols::third_argument_has_wrong_type() );
+    if ( not alien_range_valid( receiver, from, to ) )
+        return markSymbol( vmSymbols::out_of_bounds() );
+
+    std::int32_t count = SmallIntegerOop( to )->value() - SmallIntegerOop( from )->value() + 1;
+    if ( not bytes_range_valid( source, start, count ) )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    if ( in_read_only_mapping( (char *) alienContents( receiver ) + SmallIntegerOop( from )->value() - 1, count ) )
+        return markSymbol( vmSymbols::illegal_state() );
+
+    std::memmove( (char *) alienContents( receiver ) + SmallIntegerOop( from )->value() - 1, ByteArrayOop( source )->bytes() + SmallIntegerOop( start )->value() - 1, count );
+    return receiver;
+}
+
+
+PRIM_DECL_5( ByteArrayPrimitives::alienReplaceFromToWithAlien, Oop receiver, Oop from, Oop to, Oop source, Oop start ) {
+    PROLOGUE_5( "alienReplaceFromToWithAlien", receiver, from, to, source, start );
+    checkAlienAtReceiver( receiver );
+    if ( not is_alien( source ) )
+        return markSymbol( vmSymbols::third_argument_has_wrong_type() );
+    if ( alienSize( source ) <= 0 and alienAddress( source ) == nullptr )
+        return markSymbol( vmSymbols::illegal_state() );
+    if ( not alien_range_valid( receiver, from, to ) or not start->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::out_of_bounds() );
+
+    std::int32_t count = SmallIntegerOop( to )->value() - SmallIntegerOop( from )->value() + 1;
+    std::int32_t first = SmallIntegerOop( start )->value();
+    if ( first < 1 or ( alienSize( source ) not_eq 0 and first - 1 + count > std::abs( alienSize( source ) ) ) )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    if ( in_read_only_mapping( (char *) alienContents( receiver ) + SmallIntegerOop( from )->value() - 1, count ) )
+        return markSymbol( vmSymbols::illegal_state() );
+
+    std::memmove( (char *) alienContents( receiver ) + SmallIntegerOop( from )->value() - 1, (char *) alienContents( source ) + first - 1, count );
+    return receiver;
+}
+
+
+PRIM_DECL_5( ByteArrayPrimitives::alienCopyFromToIntoBytes, Oop receiver, Oop from, Oop to, Oop target, Oop start ) {
+    PROLOGUE_5( "alienCopyFromToIntoBytes", receiver, from, to, target, start );
+    checkAlienAtReceiver( receiver );
+    if ( not target->isByteArray() or target->isSymbol() )
+        return markSymbol( vmSymbols::third_argument_has_wrong_type() );
+    if ( not alien_range_valid( receiver, from, to ) )
+        return markSymbol( vmSymbols::out_of_bounds() );
+
+    std::int32_t count = SmallIntegerOop( to )->value() - SmallIntegerOop( from )->value() + 1;
+    if ( not bytes_range_valid( target, start, count ) )
+        return markSymbol( vmSymbols::out_of_bounds() );
+
+    std::memmove( ByteArrayOop( target )->bytes() + SmallIntegerOop( start )->value() - 1, (char *) alienContents( receiver ) + SmallIntegerOop( from )->value() - 1, count );
+    return target;
+}
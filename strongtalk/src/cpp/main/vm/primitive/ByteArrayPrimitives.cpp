@@ -19,6 +19,7 @@
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/platform/os.hpp"
 #include "vm/code/StubRoutines.hpp"
+#include "vm/utility/StringKernels.hpp"
 
 
 
@@ -170,6 +171,108 @@ PRIM_DECL_2( ByteArrayPrimitives::compare, Oop receiver, Oop argument ) {
 }
 
 
+PRIM_DECL_2( ByteArrayPrimitives::equal, Oop receiver, Oop argument ) {
+    PROLOGUE_2( "equal", receiver, argument );
+    ASSERT_RECEIVER;
+
+    ByteArrayOop s = ByteArrayOop( receiver );
+
+    if ( argument->isByteArray() )
+        return StringKernels::equal( s->bytes(), s->length(), ByteArrayOop( argument )->bytes(), ByteArrayOop( argument )->length() ) ? trueObject : falseObject;
+
+    if ( argument->isDoubleByteArray() )
+        return StringKernels::equal( s->bytes(), s->length(), DoubleByteArrayOop( argument )->doubleBytes(), DoubleByteArrayOop( argument )->length() ) ? trueObject : falseObject;
+
+    return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+}
+
+
+PRIM_DECL_2( ByteArrayPrimitives::compareIgnoringCase, Oop receiver, Oop argument ) {
+    PROLOGUE_2( "compareIgnoringCase", receiver, argument );
+    ASSERT_RECEIVER;
+
+    ByteArrayOop s = ByteArrayOop( receiver );
+
+    if ( argument->isByteArray() )
+        return smiOopFromValue( StringKernels::compare_ignoring_case( s->bytes(), s->length(), ByteArrayOop( argument )->bytes(), ByteArrayOop( argument )->length() ) );
+
+    if ( argument->isDoubleByteArray() )
+        return smiOopFromValue( StringKernels::compare_ignoring_case( s->bytes(), s->length(), DoubleByteArrayOop( argument )->doubleBytes(), DoubleByteArrayOop( argument )->length() ) );
+
+    return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+}
+
+
+PRIM_DECL_3( ByteArrayPrimitives::indexOf, Oop receiver, Oop c, Oop index ) {
+    PROLOGUE_3( "indexOf", receiver, c, index );
+    ASSERT_RECEIVER;
+
+    // check argument types
+    if ( not c->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    if ( not index->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+
+    // check index value; starting right after the last byte finds nothing
+    ByteArrayOop s     = ByteArrayOop( receiver );
+    std::int32_t start = SmallIntegerOop( index )->value();
+    if ( start < 1 )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    if ( start > s->length() )
+        return smiOopFromValue( 0 );
+
+    // characters beyond the byte range are never found
+    std::int32_t value = SmallIntegerOop( c )->value();
+    if ( value < 0 or value > 0xFF )
+        return smiOopFromValue( 0 );
+
+    std::int32_t i = StringKernels::index_of( s->bytes() + start - 1, s->length() - start + 1, value );
+    return smiOopFromValue( i < 0 ? 0 : start + i );
+}
+
+
+PRIM_DECL_3( ByteArrayPrimitives::indexOfSubstring, Oop receiver, Oop argument, Oop index ) {
+    PROLOGUE_3( "indexOfSubstring", receiver, argument, index );
+    ASSERT_RECEIVER;
+
+    // check argument types
+    if ( not argument->isByteArray() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    if ( not index->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+
+    // check index value
+    ByteArrayOop s     = ByteArrayOop( receiver );
+    ByteArrayOop sub   = ByteArrayOop( argument );
+    std::int32_t start = SmallIntegerOop( index )->value();
+    if ( start < 1 )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    if ( start > s->length() + 1 )
+        return smiOopFromValue( 0 );
+
+    std::int32_t i = StringKernels::index_of_substring( s->bytes() + start - 1, s->length() - start + 1, sub->bytes(), sub->length() );
+    return smiOopFromValue( i < 0 ? 0 : start + i );
+}
+
+
+PRIM_DECL_2( ByteArrayPrimitives::occurrencesOf, Oop receiver, Oop c ) {
+    PROLOGUE_2( "occurrencesOf", receiver, c );
+    ASSERT_RECEIVER;
+
+    // check argument type
+    if ( not c->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    std::int32_t value = SmallIntegerOop( c )->value();
+    if ( value < 0 or value > 0xFF )
+        return smiOopFromValue( 0 );
+
+    return smiOopFromValue( StringKernels::occurrences_of( ByteArrayOop( receiver )->bytes(), ByteArrayOop( receiver )->length(), value ) );
+}
+
+
 PRIM_DECL_1( ByteArrayPrimitives::intern, Oop receiver ) {
     PROLOGUE_1( "intern", receiver );
     ASSERT_RECEIVER;
@@ -275,6 +378,8 @@ PRIM_DECL_3( ByteArrayPrimitives::largeIntegerFromString, Oop receiver, Oop argu
         return markSymbol( vmSymbols::first_argument_has_wrong_type() );
     if ( not base->isSmallIntegerOop() )
         return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+    if ( SmallIntegerOop( base )->value() < 2 or SmallIntegerOop( base )->value() > DIGITS_BASE )
+        return markSymbol( vmSymbols::out_of_bounds() );
 
     BlockScavenge bs;
 
@@ -495,6 +600,8 @@ PRIM_DECL_2( ByteArrayPrimitives::largeIntegerToString, Oop receiver, Oop base )
     // Check argument
     if ( not base->isSmallIntegerOop() )
         return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+    if ( SmallIntegerOop( base )->value() < 2 or SmallIntegerOop( base )->value() > DIGITS_BASE )
+        return markSymbol( vmSymbols::out_of_bounds() );
 
     BlockScavenge bs;
 
@@ -93,6 +93,58 @@ public:
     //%
     static PRIM_DECL_2( compare, Oop receiver, Oop argument );
 
+    // The following primitives are built on the StringKernels; they fail only on arguments of the wrong type
+    // or on a start index below 1, and are called directly from compiled code if that cannot happen.
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveIndexedByteEqual: str       <String>
+    //                      ifFail: failBlock <PrimFailBlock> ^<Boolean> =
+    //   Internal { flags = #(Function IndexedByte LastDeltaFrameNotNeeded)
+    //              name  = 'ByteArrayPrimitives::equal' }
+    //%
+    static PRIM_DECL_2( equal, Oop receiver, Oop argument );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveIndexedByteCaseInsensitiveCompare: str       <String>
+    //                                       ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { flags = #(Function IndexedByte LastDeltaFrameNotNeeded)
+    //              name  = 'ByteArrayPrimitives::compareIgnoringCase' }
+    //%
+    static PRIM_DECL_2( compareIgnoringCase, Oop receiver, Oop argument );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveIndexedByteIndexOf: c         <SmallInteger>
+    //                    startingAt: index     <SmallInteger>
+    //                        ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedByte LastDeltaFrameNotNeeded)
+    //              name  = 'ByteArrayPrimitives::indexOf' }
+    //%
+    static PRIM_DECL_3( indexOf, Oop receiver, Oop c, Oop index );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveIndexedByteIndexOfSubstring: str       <String>
+    //                             startingAt: index     <SmallInteger>
+    //                                 ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedByte LastDeltaFrameNotNeeded)
+    //              name  = 'ByteArrayPrimitives::indexOfSubstring' }
+    //%
+    static PRIM_DECL_3( indexOfSubstring, Oop receiver, Oop argument, Oop index );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveIndexedByteOccurrencesOf: c         <SmallInteger>
+    //                              ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { flags = #(Function IndexedByte LastDeltaFrameNotNeeded)
+    //              name  = 'ByteArrayPrimitives::occurrencesOf' }
+    //%
+    static PRIM_DECL_2( occurrencesOf, Oop receiver, Oop c );
+
     //%prim
     // <IndexedByteInstanceVariables>
     //   primitiveIndexedByteInternIfFail: failBlock <PrimFailBlock> ^<CompressedSymbol> =
@@ -601,4 +653,95 @@ public:
     //              name  = 'ByteArrayPrimitives::alienCallResultWithArguments' }
     //%
     static PRIM_DECL_3( alienCallResultWithArguments, Oop receiver, Oop argument1, Oop argument2 );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveAlienCallResult: result     <IndexedByteInstanceVariables>
+    //                  signature: signature  <IndexedByteInstanceVariables>
+    //              withArguments: arguments  <IndexedInstanceVariables>
+    //                     ifFail: failBlock  <PrimFailBlock> ^<Integer> =
+    //   Internal { flags = #(Function IndexedByte)
+    //              name  = 'ByteArrayPrimitives::alienCallResultWithSignature' }
+    //%
+    static PRIM_DECL_4( alienCallResultWithSignature, Oop receiver, Oop argument1, Oop argument2, Oop argument3 );
+
+    // Memory mapped files and bulk copies
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveAlienMapFile: name       <String>
+    //                  offset: offset     <Integer>
+    //                    size: size       <SmallInteger>
+    //             copyOnWrite: copy       <Boolean>
+    //                  ifFail: failBlock  <PrimFailBlock> ^<IndexedByteInstanceVariables> =
+    //   Internal { doc   = 'Map size bytes of the file (the rest of the file if size is 0) into the receiver, an indirect alien.'
+    //              error = #(NotFound)
+    //              flags = #(Function IndexedByte)
+    //              name  = 'ByteArrayPrimitives::alienMapFile' }
+    //%
+    static PRIM_DECL_5( alienMapFile, Oop receiver, Oop name, Oop offset, Oop size, Oop copy );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveAlienUnmapIfFail: failBlock <PrimFailBlock> ^<IndexedByteInstanceVariables> =
+    //   Internal { doc   = 'Unmap the file mapped into the receiver by primitiveAlienMapFile:'
+    //              flags = #(Function IndexedByte)
+    //              name  = 'ByteArrayPrimitives::alienUnmap' }
+    //%
+    static PRIM_DECL_1( alienUnmap, Oop receiver );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveAlienAdvise: advice     <SmallInteger>
+    //                   from: from       <SmallInteger>
+    //                     to: to         <SmallInteger>
+    //                 ifFail: failBlock  <PrimFailBlock> ^<IndexedByteInstanceVariables> =
+    //   Internal { doc   = 'Hint how the bytes from..to will be used: 0 normal, 1 random, 2 sequential, 3 will need, 4 do not need.'
+    //              error = #(OutOfBounds)
+    //              flags = #(Function IndexedByte)
+    //              name  = 'ByteArrayPrimitives::alienAdvise' }
+    //%
+    static PRIM_DECL_4( alienAdvise, Oop receiver, Oop advice, Oop from, Oop to );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveAlienReplaceFrom: from       <SmallInteger>
+    //                          to: to         <SmallInteger>
+    //                   withBytes: source     <IndexedByteInstanceVariables>
+    //                  startingAt: start      <SmallInteger>
+    //                      ifFail: failBlock  <PrimFailBlock> ^<IndexedByteInstanceVariables> =
+    //   Internal { doc   = 'Copy the bytes of source (not an alien) into the contents of the receiver.'
+    //              error = #(OutOfBounds)
+    //              flags = #(Function IndexedByte)
+    //              name  = 'ByteArrayPrimitives::alienReplaceFromToWithBytes' }
+    //%
+    static PRIM_DECL_5( alienReplaceFromToWithBytes, Oop receiver, Oop from, Oop to, Oop source, Oop start );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveAlienReplaceFrom: from       <SmallInteger>
+    //                          to: to         <SmallInteger>
+    //                   withAlien: source     <IndexedByteInstanceVariables>
+    //                  startingAt: start      <SmallInteger>
+    //                      ifFail: failBlock  <PrimFailBlock> ^<IndexedByteInstanceVariables> =
+    //   Internal { doc   = 'Copy the contents of the alien source into the contents of the receiver; the ranges may overlap.'
+    //              error = #(OutOfBounds)
+    //              flags = #(Function IndexedByte)
+    //              name  = 'ByteArrayPrimitives::alienReplaceFromToWithAlien' }
+    //%
+    static PRIM_DECL_5( alienReplaceFromToWithAlien, Oop receiver, Oop from, Oop to, Oop source, Oop start );
+
+    //%prim
+    // <IndexedByteInstanceVariables>
+    //   primitiveAlienCopyFrom: from       <SmallInteger>
+    //                       to: to         <SmallInteger>
+    //                intoBytes: target     <IndexedByteInstanceVariables>
+    //               startingAt: start      <SmallInteger>
+    //                   ifFail: failBlock  <PrimFailBlock> ^<IndexedByteInstanceVariables> =
+    //   Internal { doc   = 'Copy the contents of the receiver into the bytes of target (not an alien); answers target.'
+    //              error = #(OutOfBounds)
+    //              flags = #(Function IndexedByte)
+    //              name  = 'ByteArrayPrimitives::alienCopyFromToIntoBytes' }
+    //%
+    static PRIM_DECL_5( alienCopyFromToIntoBytes, Oop receiver, Oop from, Oop to, Oop target, Oop start );
 };
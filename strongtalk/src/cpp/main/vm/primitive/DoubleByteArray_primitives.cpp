@@ -11,6 +11,7 @@
 #include "vm/oop/DoubleByteArrayOopDescriptor.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/memory/SymbolTable.hpp"
+#include "vm/utility/StringKernels.hpp"
 
 
 TRACE_FUNC( TraceDoubleByteArrayPrims, "doubleByteArray" )
@@ -149,6 +150,107 @@ PRIM_DECL_2( DoubleByteArrayPrimitives::compare, Oop receiver, Oop argument ) {
 }
 
 
+PRIM_DECL_2( DoubleByteArrayPrimitives::equal, Oop receiver, Oop argument ) {
+    PROLOGUE_2( "equal", receiver, argument );
+    ASSERT_RECEIVER;
+
+    DoubleByteArrayOop s = DoubleByteArrayOop( receiver );
+
+    if ( argument->isDoubleByteArray() )
+        return StringKernels::equal( s->doubleBytes(), s->length(), DoubleByteArrayOop( argument )->doubleBytes(), DoubleByteArrayOop( argument )->length() ) ? trueObject : falseObject;
+
+    if ( argument->isByteArray() )
+        return StringKernels::equal( s->doubleBytes(), s->length(), ByteArrayOop( argument )->bytes(), ByteArrayOop( argument )->length() ) ? trueObject : falseObject;
+
+    return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+}
+
+
+PRIM_DECL_2( DoubleByteArrayPrimitives::compareIgnoringCase, Oop receiver, Oop argument ) {
+    PROLOGUE_2( "compareIgnoringCase", receiver, argument );
+    ASSERT_RECEIVER;
+
+    DoubleByteArrayOop s = DoubleByteArrayOop( receiver );
+
+    if ( argument->isDoubleByteArray() )
+        return smiOopFromValue( StringKernels::compare_ignoring_case( s->doubleBytes(), s->length(), DoubleByteArrayOop( argument )->doubleBytes(), DoubleByteArrayOop( argument )->length() ) );
+
+    if ( argument->isByteArray() )
+        return smiOopFromValue( StringKernels::compare_ignoring_case( s->doubleBytes(), s->length(), ByteArrayOop( argument )->bytes(), ByteArrayOop( argument )->length() ) );
+
+    return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+}
+
+
+PRIM_DECL_3( DoubleByteArrayPrimitives::indexOf, Oop receiver, Oop c, Oop index ) {
+    PROLOGUE_3( "indexOf", receiver, c, index );
+    ASSERT_RECEIVER;
+
+    // check argument types
+    if ( not c->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    if ( not index->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+
+    // check index value; starting right after the last character finds nothing
+    DoubleByteArrayOop s     = DoubleByteArrayOop( receiver );
+    std::int32_t       start = SmallIntegerOop( index )->value();
+    if ( start < 1 )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    if ( start > s->length() )
+        return smiOopFromValue( 0 );
+
+    std::int32_t value = SmallIntegerOop( c )->value();
+    if ( value < 0 or value > 0xFFFF )
+        return smiOopFromValue( 0 );
+
+    std::int32_t i = StringKernels::index_of( s->doubleBytes() + start - 1, s->length() - start + 1, value );
+    return smiOopFromValue( i < 0 ? 0 : start + i );
+}
+
+
+PRIM_DECL_3( DoubleByteArrayPrimitives::indexOfSubstring, Oop receiver, Oop argument, Oop index ) {
+    PROLOGUE_3( "indexOfSubstring", receiver, argument, index );
+    ASSERT_RECEIVER;
+
+    // check argument types
+    if ( not argument->isDoubleByteArray() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    if ( not index->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+
+    // check index value
+    DoubleByteArrayOop s     = DoubleByteArrayOop( receiver );
+    DoubleByteArrayOop sub   = DoubleByteArrayOop( argument );
+    std::int32_t       start = SmallIntegerOop( index )->value();
+    if ( start < 1 )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    if ( start > s->length() + 1 )
+        return smiOopFromValue( 0 );
+
+    std::int32_t i = StringKernels::index_of_substring( s->doubleBytes() + start - 1, s->length() - start + 1, sub->doubleBytes(), sub->length() );
+    return smiOopFromValue( i < 0 ? 0 : start + i );
+}
+
+
+PRIM_DECL_2( DoubleByteArrayPrimitives::occurrencesOf, Oop receiver, Oop c ) {
+    PROLOGUE_2( "occurrencesOf", receiver, c );
+    ASSERT_RECEIVER;
+
+    // check argument type
+    if ( not c->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    std::int32_t value = SmallIntegerOop( c )->value();
+    if ( value < 0 or value > 0xFFFF )
+        return smiOopFromValue( 0 );
+
+    return smiOopFromValue( StringKernels::occurrences_of( DoubleByteArrayOop( receiver )->doubleBytes(), DoubleByteArrayOop( receiver )->length(), value ) );
+}
+
+
 PRIM_DECL_1( DoubleByteArrayPrimitives::intern, Oop receiver ) {
     PROLOGUE_1( "intern", receiver );
     ASSERT_RECEIVER;
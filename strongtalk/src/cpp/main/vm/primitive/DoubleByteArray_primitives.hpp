@@ -82,6 +82,58 @@ public:
     //%
     static PRIM_DECL_2( compare, Oop receiver, Oop argumentw );
 
+    // The following primitives are built on the StringKernels; they fail only on arguments of the wrong type
+    // or on a start index below 1, and are called directly from compiled code if that cannot happen.
+
+    //%prim
+    // <IndexedDoubleByteInstanceVariables>
+    //   primitiveIndexedDoubleByteEqual: str       <String>
+    //                            ifFail: failBlock <PrimFailBlock> ^<Boolean> =
+    //   Internal { flags = #(Function IndexedDoubleByte LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleByteArrayPrimitives::equal' }
+    //%
+    static PRIM_DECL_2( equal, Oop receiver, Oop argument );
+
+    //%prim
+    // <IndexedDoubleByteInstanceVariables>
+    //   primitiveIndexedDoubleByteCaseInsensitiveCompare: str       <String>
+    //                                             ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { flags = #(Function IndexedDoubleByte LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleByteArrayPrimitives::compareIgnoringCase' }
+    //%
+    static PRIM_DECL_2( compareIgnoringCase, Oop receiver, Oop argument );
+
+    //%prim
+    // <IndexedDoubleByteInstanceVariables>
+    //   primitiveIndexedDoubleByteIndexOf: c         <SmallInteger>
+    //                          startingAt: index     <SmallInteger>
+    //                              ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedDoubleByte LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleByteArrayPrimitives::indexOf' }
+    //%
+    static PRIM_DECL_3( indexOf, Oop receiver, Oop c, Oop index );
+
+    //%prim
+    // <IndexedDoubleByteInstanceVariables>
+    //   primitiveIndexedDoubleByteIndexOfSubstring: str       <String>
+    //                                   startingAt: index     <SmallInteger>
+    //                                       ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedDoubleByte LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleByteArrayPrimitives::indexOfSubstring' }
+    //%
+    static PRIM_DECL_3( indexOfSubstring, Oop receiver, Oop argument, Oop index );
+
+    //%prim
+    // <IndexedDoubleByteInstanceVariables>
+    //   primitiveIndexedDoubleByteOccurrencesOf: c         <SmallInteger>
+    //                                    ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { flags = #(Function IndexedDoubleByte LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleByteArrayPrimitives::occurrencesOf' }
+    //%
+    static PRIM_DECL_2( occurrencesOf, Oop receiver, Oop c );
+
     //%prim
     // <IndexedDoubleByteInstanceVariables>
     //   primitiveIndexedDoubleByteInternIfFail: failBlock <PrimFailBlock> ^<CompressedSymbol> =
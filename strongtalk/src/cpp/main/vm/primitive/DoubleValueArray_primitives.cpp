@@ -9,6 +9,9 @@
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/oop/DoubleOopDescriptor.hpp"
 #include "vm/memory/OopFactory.hpp"
+#include "vm/utility/DoubleKernels.hpp"
+
+#include <cstring>
 
 
 TRACE_FUNC( TraceDoubleValueArrayPrims, "doubleValueArray" )
@@ -94,3 +97,194 @@ PRIM_DECL_3( DoubleValueArrayPrimitives::atPut, Oop receiver, Oop index, Oop val
     DoubleValueArrayOop( receiver )->double_at_put( SmallIntegerOop( index )->value(), DoubleOop( value )->value() );
     return receiver;
 }
+
+
+// nullptr if other is a double value array of the receiver's length, the failure symbol otherwise
+static Oop check_same_shape( Oop receiver, Oop other ) {
+    if ( not other->isDoubleValueArray() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+    if ( DoubleValueArrayOop( other )->length() not_eq DoubleValueArrayOop( receiver )->length() )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    return nullptr;
+}
+
+
+PRIM_DECL_1( DoubleValueArrayPrimitives::sum, Oop receiver ) {
+    PROLOGUE_1( "sum", receiver );
+    ASSERT_RECEIVER;
+
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    return OopFactory::new_double( DoubleKernels::sum( array->double_start(), array->length() ) );
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::dot, Oop receiver, Oop other ) {
+    PROLOGUE_2( "dot", receiver, other );
+    ASSERT_RECEIVER;
+
+    Oop error = check_same_shape( receiver, other );
+    if ( error not_eq nullptr )
+        return error;
+
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    return OopFactory::new_double( DoubleKernels::dot( array->double_start(), DoubleValueArrayOop( other )->double_start(), array->length() ) );
+}
+
+
+PRIM_DECL_3( DoubleValueArrayPrimitives::axpy, Oop receiver, Oop other, Oop factor ) {
+    PROLOGUE_3( "axpy", receiver, other, factor );
+    ASSERT_RECEIVER;
+
+    Oop error = check_same_shape( receiver, other );
+    if ( error not_eq nullptr )
+        return error;
+
+    // check factor type
+    if ( not factor->isDouble() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+
+    // do the operation: self := self + (factor * other)
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    DoubleKernels::axpy( array->double_start(), DoubleOop( factor )->value(), DoubleValueArrayOop( other )->double_start(), array->length() );
+    return receiver;
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::scale, Oop receiver, Oop factor ) {
+    PROLOGUE_2( "scale", receiver, factor );
+    ASSERT_RECEIVER;
+
+    // check factor type
+    if ( not factor->isDouble() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    DoubleKernels::scale( array->double_start(), DoubleOop( factor )->value(), array->length() );
+    return receiver;
+}
+
+
+// self := self op other, element-wise
+static Oop elementwise( Oop receiver, Oop other, void (*op)( double *z, const double *x, const double *y, std::int32_t n ) ) {
+    Oop error = check_same_shape( receiver, other );
+    if ( error not_eq nullptr )
+        return error;
+
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    op( array->double_start(), array->double_start(), DoubleValueArrayOop( other )->double_start(), array->length() );
+    return receiver;
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::add, Oop receiver, Oop other ) {
+    PROLOGUE_2( "add", receiver, other );
+    ASSERT_RECEIVER;
+    return elementwise( receiver, other, &DoubleKernels::add );
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::subtract, Oop receiver, Oop other ) {
+    PROLOGUE_2( "subtract", receiver, other );
+    ASSERT_RECEIVER;
+    return elementwise( receiver, other, &DoubleKernels::subtract );
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::multiply, Oop receiver, Oop other ) {
+    PROLOGUE_2( "multiply", receiver, other );
+    ASSERT_RECEIVER;
+    return elementwise( receiver, other, &DoubleKernels::multiply );
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::divide, Oop receiver, Oop other ) {
+    PROLOGUE_2( "divide", receiver, other );
+    ASSERT_RECEIVER;
+    return elementwise( receiver, other, &DoubleKernels::divide );
+}
+
+
+PRIM_DECL_1( DoubleValueArrayPrimitives::min_index, Oop receiver ) {
+    PROLOGUE_1( "min_index", receiver );
+    ASSERT_RECEIVER;
+
+    // 1-based, 0 for an empty array
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    return smiOopFromValue( DoubleKernels::min_index( array->double_start(), array->length() ) + 1 );
+}
+
+
+PRIM_DECL_1( DoubleValueArrayPrimitives::max_index, Oop receiver ) {
+    PROLOGUE_1( "max_index", receiver );
+    ASSERT_RECEIVER;
+
+    // 1-based, 0 for an empty array
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    return smiOopFromValue( DoubleKernels::max_index( array->double_start(), array->length() ) + 1 );
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::at_all_put, Oop receiver, Oop value ) {
+    PROLOGUE_2( "at_all_put", receiver, value );
+    ASSERT_RECEIVER;
+
+    // check value type
+    if ( not value->isDouble() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    DoubleValueArrayOop array = DoubleValueArrayOop( receiver );
+    DoubleKernels::fill( array->double_start(), DoubleOop( value )->value(), array->length() );
+    return receiver;
+}
+
+
+PRIM_DECL_5( DoubleValueArrayPrimitives::replace_from_to, Oop receiver, Oop from, Oop to, Oop source, Oop start ) {
+    PROLOGUE_5( "replace_from_to", receiver, from, to, source, start );
+    ASSERT_RECEIVER;
+
+    // check from type
+    if ( not from->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    // check to type
+    if ( not to->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+
+    // check source type
+    if ( not source->isDoubleValueArray() )
+        return markSymbol( vmSymbols::third_argument_has_wrong_type() );
+
+    // check start type
+    if ( not start->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::fourth_argument_has_wrong_type() );
+
+    small_int_t f = SmallIntegerOop( from )->value();
+    small_int_t t = SmallIntegerOop( to )->value();
+    small_int_t s = SmallIntegerOop( start )->value();
+
+    // check 0 < from <= to <= self size, 0 < start and start + (to - from) <= source size
+    if ( f <= 0 or f > t or t > DoubleValueArrayOop( receiver )->length() )
+        return markSymbol( vmSymbols::out_of_bounds() );
+    if ( s <= 0 or s + ( t - f ) > DoubleValueArrayOop( source )->length() )
+        return markSymbol( vmSymbols::out_of_bounds() );
+
+    // the ranges may overlap if source is the receiver
+    std::memmove( DoubleValueArrayOop( receiver )->double_at_addr( f ), DoubleValueArrayOop( source )->double_at_addr( s ), ( t - f + 1 ) * sizeof( double ) );
+    return receiver;
+}
+
+
+PRIM_DECL_2( DoubleValueArrayPrimitives::equal, Oop receiver, Oop other ) {
+    PROLOGUE_2( "equal", receiver, other );
+    ASSERT_RECEIVER;
+
+    if ( not other->isDoubleValueArray() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    // element-wise =, so arrays containing NaNs are never equal
+    DoubleValueArrayOop array  = DoubleValueArrayOop( receiver );
+    std::int32_t        length = array->length();
+    if ( DoubleValueArrayOop( other )->length() not_eq length )
+        return falseObject;
+    return DoubleKernels::mismatch( array->double_start(), DoubleValueArrayOop( other )->double_start(), length ) == length ? trueObject : falseObject;
+}
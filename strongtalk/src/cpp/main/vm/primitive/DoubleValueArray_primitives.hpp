@@ -12,6 +12,9 @@
 
 
 // Primitives for double value arrays
+//
+// The bulk primitives (sum, dot, element-wise arithmetic, ...) work on the unboxed doubles with
+// the DoubleKernels; the element-wise ones update the receiver in place and do not allocate.
 
 class DoubleValueArrayPrimitives : AllStatic {
 private:
@@ -62,4 +65,129 @@ public:
     //%
     static PRIM_DECL_3( atPut, Oop receiver, Oop index, Oop value );
 
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueSum ^<Float> =
+    //   Internal { flags = #(Function IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::sum' }
+    //%
+    static PRIM_DECL_1( sum, Oop receiver );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueDot: other     <IndexedFloatValueInstanceVariables>
+    //                          ifFail: failBlock <PrimFailBlock> ^<Float> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue)
+    //              name  = 'DoubleValueArrayPrimitives::dot' }
+    //%
+    static PRIM_DECL_2( dot, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueAdd: other     <IndexedFloatValueInstanceVariables>
+    //                           times: factor    <Float>
+    //                          ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::axpy' }
+    //%
+    static PRIM_DECL_3( axpy, Oop receiver, Oop other, Oop factor );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueScaleBy: factor    <Float>
+    //                              ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::scale' }
+    //%
+    static PRIM_DECL_2( scale, Oop receiver, Oop factor );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueAdd: other     <IndexedFloatValueInstanceVariables>
+    //                          ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::add' }
+    //%
+    static PRIM_DECL_2( add, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueSubtract: other     <IndexedFloatValueInstanceVariables>
+    //                               ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::subtract' }
+    //%
+    static PRIM_DECL_2( subtract, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueMultiply: other     <IndexedFloatValueInstanceVariables>
+    //                               ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::multiply' }
+    //%
+    static PRIM_DECL_2( multiply, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueDivide: other     <IndexedFloatValueInstanceVariables>
+    //                             ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::divide' }
+    //%
+    static PRIM_DECL_2( divide, Oop receiver, Oop other );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueMinIndex ^<SmallInteger> =
+    //   Internal { flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::min_index' }
+    //%
+    static PRIM_DECL_1( min_index, Oop receiver );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueMaxIndex ^<SmallInteger> =
+    //   Internal { flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::max_index' }
+    //%
+    static PRIM_DECL_1( max_index, Oop receiver );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueAtAllPut: value     <Float>
+    //                               ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::at_all_put' }
+    //%
+    static PRIM_DECL_2( at_all_put, Oop receiver, Oop value );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueReplaceFrom: from      <SmallInteger>
+    //                                      to: to        <SmallInteger>
+    //                                    with: source    <IndexedFloatValueInstanceVariables>
+    //                              startingAt: start     <SmallInteger>
+    //                                  ifFail: failBlock <PrimFailBlock> ^<Self> =
+    //   Internal { error = #(OutOfBounds)
+    //              flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::replace_from_to' }
+    //%
+    static PRIM_DECL_5( replace_from_to, Oop receiver, Oop from, Oop to, Oop source, Oop start );
+
+    //%prim
+    // <IndexedFloatValueInstanceVariables>
+    //   primitiveIndexedFloatValueEqual: other     <IndexedFloatValueInstanceVariables>
+    //                            ifFail: failBlock <PrimFailBlock> ^<Boolean> =
+    //   Internal { flags = #(Function IndexedFloatValue LastDeltaFrameNotNeeded)
+    //              name  = 'DoubleValueArrayPrimitives::equal' }
+    //%
+    static PRIM_DECL_2( equal, Oop receiver, Oop other );
+
 };
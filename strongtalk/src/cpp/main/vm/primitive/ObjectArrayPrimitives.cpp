@@ -135,16 +135,10 @@ PRIM_DECL_2( ObjectArrayPrimitives::at_all_put, Oop receiver, Oop obj ) {
     PROLOGUE_2( "at_all_put", receiver, obj );
     ASSERT_RECEIVER;
 
-    std::size_t length = ObjectArrayOop( receiver )->length();
-    if ( obj->is_new() and receiver->is_old() ) {
-        // Do store checks
-        for ( std::size_t i = 1; i <= length; i++ ) {
-            ObjectArrayOop( receiver )->obj_at_put( i, obj );
-        }
-    } else {
-        // Ignore store check for speed
-        set_oops( ObjectArrayOop( receiver )->objs( 1 ), length, obj );
-    }
+    std::int32_t length = ObjectArrayOop( receiver )->length();
+    set_oops( ObjectArrayOop( receiver )->objs( 1 ), length, obj );
+    if ( obj->is_new() )
+        ObjectArrayOop( receiver )->store_check_range( ObjectArrayOop( receiver )->objs( 1 ), length );
     return receiver;
 }
 
@@ -181,11 +175,15 @@ PRIM_DECL_5( ObjectArrayPrimitives::replace_from_to, Oop receiver, Oop from, Oop
     if ( SmallIntegerOop( from )->value() > SmallIntegerOop( to )->value() )
         return markSymbol( vmSymbols::out_of_bounds() );
 
-    // check if source is big enough
-    if ( SmallIntegerOop( start )->value() + ( SmallIntegerOop( to )->value() - SmallIntegerOop( from )->value() + 1 ) > ObjectArrayOop( source )->length() )
+    // check start > 0
+    if ( SmallIntegerOop( start )->value() <= 0 )
+        return markSymbol( vmSymbols::out_of_bounds() );
+
+    // check if source is big enough (the last element copied is at start + to - from)
+    if ( SmallIntegerOop( start )->value() + ( SmallIntegerOop( to )->value() - SmallIntegerOop( from )->value() ) > ObjectArrayOop( source )->length() )
         return markSymbol( vmSymbols::out_of_bounds() );
 
-    // Dispatch the operation to the array
+    // Dispatch the operation to the array (a bulk copy, the ranges may overlap if source is the receiver)
     ObjectArrayOop( receiver )->replace_from_to( SmallIntegerOop( from )->value(), SmallIntegerOop( to )->value(), ObjectArrayOop( source ), SmallIntegerOop( start )->value() );
 
     return receiver;
@@ -88,7 +88,7 @@ public:
     //                          startingAt: start     <SmallInteger>
     //                              ifFail: failBlock <PrimFailBlock> ^<Self> =
     //   Internal { error = #(OutOfBounds)
-    //              flags = #(IndexedObject)
+    //              flags = #(Function IndexedObject LastDeltaFrameNotNeeded)
     //              name  = 'ObjectArrayPrimitives::replace_from_to' }
     //%
     static PRIM_DECL_5( replace_from_to, Oop receiver, Oop from, Oop to, Oop source, Oop start );
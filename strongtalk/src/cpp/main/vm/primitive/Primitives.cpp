@@ -117,6 +117,32 @@ void Primitives::print_table() {
 }
 
 
+// Primitives with a quick call form in the interpreter (see ByteCodes::is_quick_primitive_call).
+// They were chosen from the primitive counters (printPrimitiveCounters) of interpreted code.
+static const struct {
+    const char      *_name;
+    ByteCodes::Code _code;
+} quick_primitive_calls[] = {
+    { "primitiveIndexedObjectSize",           ByteCodes::Code::primitive_call_self_indexable_size },
+    { "primitiveIndexedByteSize",             ByteCodes::Code::primitive_call_self_indexable_size },
+    { "primitiveIndexedObjectAt:ifFail:",     ByteCodes::Code::primitive_call_self_objectArray_at },
+    { "primitiveIndexedObjectAt:put:ifFail:", ByteCodes::Code::primitive_call_self_objectArray_at_put },
+    { "primitiveIndexedByteAt:ifFail:",       ByteCodes::Code::primitive_call_self_byteArray_at },
+    { "primitiveIndexedByteAt:put:ifFail:",   ByteCodes::Code::primitive_call_self_byteArray_at_put },
+};
+
+
+static ByteCodes::Code quick_primitive_call_code_for( ByteCodes::Code code, PrimitiveDescriptor *pdesc ) {
+    if ( not UseQuickPrimitiveCalls )
+        return code;
+    for ( const auto &quick : quick_primitive_calls ) {
+        if ( ByteCodes::generic_code_for( quick._code ) == code and strcmp( pdesc->name(), quick._name ) == 0 )
+            return quick._code;
+    }
+    return code;
+}
+
+
 void Primitives::lookup_and_patch() {
 
     // get primitive call info
@@ -131,7 +157,7 @@ void Primitives::lookup_and_patch() {
     PrimitiveDescriptor *pdesc = Primitives::lookup( sel );
     if ( pdesc not_eq nullptr and not pdesc->is_internal() ) {
         // primitive found => patch bytecode & cache
-        *f.hp()        = std::uint8_t( ByteCodes::primitive_call_code_for( ByteCodes::Code( *f.hp() ) ) );
+        *f.hp()        = std::uint8_t( quick_primitive_call_code_for( ByteCodes::primitive_call_code_for( ByteCodes::Code( *f.hp() ) ), pdesc ) );
         *selector_addr = Oop( pdesc->fn() );
     } else {
         // advance hp so that it points to the next instruction
@@ -6,6 +6,7 @@
 
 #include "vm/primitive/ProcessOopPrimitives.hpp"
 #include "vm/runtime/Process.hpp"
+#include "vm/runtime/AsyncDLLPool.hpp"
 #include "vm/runtime/Frame.hpp"
 #include "vm/runtime/ErrorHandler.hpp"
 #include "vm/runtime/VirtualFrame.hpp"
@@ -13,6 +14,7 @@
 #include "vm/code/StubRoutines.hpp"
 #include "vm/interpreter/DispatchTable.hpp"
 #include "vm/memory/util.hpp"
+#include "vm/memory/Closure.hpp"
 #include "vm/memory/Universe.hpp"
 #include "vm/oop/DoubleOopDescriptor.hpp"
 #include "vm/oop/ProcessOopDescriptor.hpp"
@@ -339,3 +341,33 @@ PRIM_DECL_2( ProcessOopPrimitives::stack, Oop receiver, Oop limit ) {
 
     return OopFactory::new_objectArray( stack );
 }
+
+
+class CollectCompletedProcessesClosure : public ProcessClosure {
+private:
+    GrowableArray<Oop> *_processes;
+
+public:
+    CollectCompletedProcessesClosure( GrowableArray<Oop> *processes ) :
+        _processes{ processes } {
+    }
+
+
+    void do_process( DeltaProcess *p ) {
+        _processes->push( p->processObject() );
+    }
+};
+
+
+PRIM_DECL_0( ProcessOopPrimitives::completed_async_calls ) {
+    PROLOGUE_0( "completed_async_calls" );
+
+    ResourceMark  rm;
+    BlockScavenge bs;
+
+    GrowableArray<Oop>               *processes = new GrowableArray<Oop>( 10 );
+    CollectCompletedProcessesClosure blk( processes );
+    AsyncDLLPool::completed_iterate( &blk );
+
+    return OopFactory::new_objectArray( processes );
+}
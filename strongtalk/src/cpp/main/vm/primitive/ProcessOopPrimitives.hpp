@@ -130,7 +130,7 @@ public:
     //%prim
     // <Process> primitiveProcessSchedulerWait: milliseconds <SmallInteger>
     //                                  ifFail: failBlock <PrimFailBlock> ^<Boolean> =
-    //   Internal { doc   = 'Waits until timer has expired or a asynchronous dll call has returned.'
+    //   Internal { doc   = 'Waits until timer has expired, a asynchronous dll call has returned or a file descriptor armed in the I/O poller is ready.'
     //              doc   = 'Returns whether the timer expired.'
     //              name  = 'ProcessOopPrimitives::scheduler_wait' }
     //%
@@ -193,4 +193,12 @@ public:
     //%
     static PRIM_DECL_2( stack, Oop receiver, Oop limit );
 
+    //%prim
+    // <NoReceiver> primitiveProcessCompletedAsyncCalls ^<IndexedInstanceVariables> =
+    //   Internal { doc   = 'Returns the processes whose asynchronous dll calls completed,'
+    //              doc   = 'in completion order.'
+    //              name  = 'ProcessOopPrimitives::completed_async_calls' }
+    //%
+    static PRIM_DECL_0( completed_async_calls );
+
 };
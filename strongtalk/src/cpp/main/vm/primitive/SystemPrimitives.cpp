@@ -22,6 +22,7 @@
 #include "vm/system/dll.hpp"
 #include "vm/runtime/FlatProfiler.hpp"
 #include "vm/klass/WeakArrayKlass.hpp"
+#include "vm/runtime/IOPoller.hpp"
 #include "vm/code/InliningDatabase.hpp"
 #include "vm/compiler/RecompilationScope.hpp"
 #include "vm/runtime/SlidingSystemAverage.hpp"
@@ -29,6 +30,7 @@
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/memory/Scavenge.hpp"
 #include "vm/oop/SmallIntegerOopDescriptor.hpp"
+#include "vm/utility/StringHash.hpp"
 
 
 TRACE_FUNC( TraceSystemPrims, "system" )
@@ -200,6 +202,12 @@ PRIM_DECL_0( SystemPrimitives::expansions ) {
 }
 
 
+PRIM_DECL_0( SystemPrimitives::stringHashVersion ) {
+    PROLOGUE_0( "stringHashVersion" )
+    return smiOopFromValue( static_cast<std::int32_t>( StringHash::version() ) );
+}
+
+
 PRIM_DECL_0( SystemPrimitives::breakpoint ) {
     PROLOGUE_0( "breakpoint" )
     {
@@ -541,6 +549,67 @@ PRIM_DECL_1( SystemPrimitives::hadNearDeathExperience, Oop value ) {
 }
 
 
+PRIM_DECL_3( SystemPrimitives::ioPollerArm, Oop fd, Oop events, Oop waiter ) {
+    PROLOGUE_3( "ioPollerArm", fd, events, waiter );
+
+    if ( not fd->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+    if ( not events->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::second_argument_has_wrong_type() );
+
+    if ( not IOPoller::is_supported() )
+        return markSymbol( vmSymbols::not_yet_implemented() );
+
+    std::int32_t e = SmallIntegerOop( events )->value();
+    if ( SmallIntegerOop( fd )->value() < 0 or e < IOPoller::readable or e > ( IOPoller::readable | IOPoller::writable ) )
+        return markSymbol( vmSymbols::value_out_of_range() );
+
+    if ( IOPoller::is_armed_for_another( SmallIntegerOop( fd )->value(), waiter ) )
+        return markSymbol( vmSymbols::illegal_state() );
+    if ( not IOPoller::arm( SmallIntegerOop( fd )->value(), e, waiter ) )
+        return markSymbol( vmSymbols::failed() );
+    return waiter;
+}
+
+
+PRIM_DECL_1( SystemPrimitives::ioPollerRemove, Oop fd ) {
+    PROLOGUE_1( "ioPollerRemove", fd );
+
+    if ( not fd->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    if ( not IOPoller::remove( SmallIntegerOop( fd )->value() ) )
+        return markSymbol( vmSymbols::is_absent() );
+    return fd;
+}
+
+
+PRIM_DECL_1( SystemPrimitives::ioPollerReadyEvents, Oop fd ) {
+    PROLOGUE_1( "ioPollerReadyEvents", fd );
+
+    if ( not fd->isSmallIntegerOop() )
+        return markSymbol( vmSymbols::first_argument_has_wrong_type() );
+
+    std::int32_t events = IOPoller::ready_events( SmallIntegerOop( fd )->value() );
+    if ( events < 0 )
+        return markSymbol( vmSymbols::is_absent() );
+    return smiOopFromValue( events );
+}
+
+
+PRIM_DECL_0( SystemPrimitives::ioPollerPoll ) {
+    PROLOGUE_0( "ioPollerPoll" );
+    IOPoller::poll( 0 );
+    return smiOopFromValue( IOPoller::take_queued() );
+}
+
+
+PRIM_DECL_0( SystemPrimitives::ioPollerArmed ) {
+    PROLOGUE_0( "ioPollerArmed" );
+    return smiOopFromValue( IOPoller::number_of_armed() );
+}
+
+
 PRIM_DECL_2( SystemPrimitives::dll_setup, Oop receiver, Oop selector ) {
     PROLOGUE_2( "dll_setup", receiver, selector );
 
@@ -126,6 +126,13 @@ public:
     //%
     static PRIM_DECL_0( expansions );
 
+    //%prim
+    // <NoReceiver> primitiveStringHashVersion ^<SmallInteger> =
+    //   Internal { name  = 'SystemPrimitives::stringHashVersion'
+    //              doc   = 'Returns the version of the string hash in use (1 sampled, 2 full contents)' }
+    //%
+    static PRIM_DECL_0( stringHashVersion );
+
     //%prim
     // <NoReceiver> primitiveBreakpoint ^<Object> =
     //   Internal { name  = 'systemPrimitives::breakpoint' }
@@ -383,6 +390,55 @@ public:
     //%
     static PRIM_DECL_1( hadNearDeathExperience, Oop value );
 
+
+    // SUPPORT FOR I/O POLLING (see IOPoller)
+
+    //%prim
+    // <NoReceiver> primitiveIOPollerArm: fd     <SmallInteger>
+    //                            events: events <SmallInteger>
+    //                            waiter: waiter <Object>
+    //                            ifFail: failBlock <PrimFailBlock> ^<Object> =
+    //   Internal { doc   = 'Arms the file descriptor fd for the events (1 = readable, 2 = writable).'
+    //              doc   = 'The waiter is appended to the notification queue once fd becomes ready.'
+    //              doc   = 'Fails with IllegalState if fd is armed for another waiter.'
+    //              error = #(NotYetImplemented ValueOutOfRange IllegalState Failed)
+    //              name  = 'systemPrimitives::ioPollerArm' }
+    //%
+    static PRIM_DECL_3( ioPollerArm, Oop fd, Oop events, Oop waiter );
+
+    //%prim
+    // <NoReceiver> primitiveIOPollerRemove: fd <SmallInteger>
+    //                               ifFail: failBlock <PrimFailBlock> ^<Object> =
+    //   Internal { doc   = 'Removes the registration of the file descriptor fd.'
+    //              error = #(IsAbsent)
+    //              name  = 'systemPrimitives::ioPollerRemove' }
+    //%
+    static PRIM_DECL_1( ioPollerRemove, Oop fd );
+
+    //%prim
+    // <NoReceiver> primitiveIOPollerReadyEvents: fd <SmallInteger>
+    //                                    ifFail: failBlock <PrimFailBlock> ^<SmallInteger> =
+    //   Internal { doc   = 'Returns the events fd was ready for (4 = hang up or error), 0 while it is armed.'
+    //              error = #(IsAbsent)
+    //              name  = 'systemPrimitives::ioPollerReadyEvents' }
+    //%
+    static PRIM_DECL_1( ioPollerReadyEvents, Oop fd );
+
+    //%prim
+    // <NoReceiver> primitiveIOPollerPoll ^<SmallInteger> =
+    //   Internal { doc   = 'Queues the waiters of the ready file descriptors, without waiting.'
+    //              doc   = 'Returns the number of waiters queued since the last call (including those queued by the scheduler wait).'
+    //              name  = 'systemPrimitives::ioPollerPoll' }
+    //%
+    static PRIM_DECL_0( ioPollerPoll );
+
+    //%prim
+    // <NoReceiver> primitiveIOPollerArmed ^<SmallInteger> =
+    //   Internal { doc   = 'Returns the number of armed file descriptors.'
+    //              name  = 'systemPrimitives::ioPollerArmed' }
+    //%
+    static PRIM_DECL_0( ioPollerArmed );
+
     // DLL support
 
     //%prim
@@ -81,6 +81,11 @@
       (alienSize(receiver) not_eq 0 and ((std::uint32_t)alienIndex(argument)) > abs(alienSize(receiver)) - sizeof(type) + 1)) \
     return markSymbol(vmSymbols::index_not_valid())
 
+// writes to a read-only file mapping would fault
+#define checkAlienWritable( receiver, argument, type ) \
+  if (in_read_only_mapping(((char*)alienContents(receiver)) + alienIndex(argument) - 1, sizeof(type))) \
+    return markSymbol(vmSymbols::illegal_state())
+
 #define checkAlienAtPutValue( receiver, argument, type, min, max ) \
   if (not argument->isSmallIntegerOop()) \
     return markSymbol(vmSymbols::second_argument_has_wrong_type()); \
@@ -0,0 +1,279 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/runtime/AsyncDLLPool.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+#include "vm/oop/ProcessOopDescriptor.hpp"
+#include "vm/runtime/Safepoint.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/memory/Closure.hpp"
+#include "vm/system/ThreadCritical.hpp"
+#include "vm/platform/os.hpp"
+
+
+class AsyncDLLWorker : public CHeapAllocatedObject {
+public:
+    Thread          *_thread;
+    std::int32_t    _thread_id;
+    Event           *_event;      // signalled when the bound process comes back after a call back
+    DeltaProcess    *_process;    // bound process, or nullptr
+    bool            _running;     // running (or about to run) the dll call on the stack of _process
+    bool            _abandoned;   // _process was terminated while _running, its stack is released when the call returns
+    bool            _delete;      // the abandoned _process is deleted as well (see delete_when_returned)
+
+
+    AsyncDLLWorker() :
+        _thread{ nullptr },
+        _thread_id{ -1 },
+        _event{ os::create_event( false ) },
+        _process{ nullptr },
+        _running{ false },
+        _abandoned{ false },
+        _delete{ false } {
+    }
+};
+
+
+DeltaProcess   *AsyncDLLPool::_pending_head      = nullptr;
+DeltaProcess   *AsyncDLLPool::_pending_tail      = nullptr;
+DeltaProcess   *AsyncDLLPool::_completed_head    = nullptr;
+DeltaProcess   *AsyncDLLPool::_completed_tail    = nullptr;
+std::int32_t   AsyncDLLPool::_number_of_workers  = 0;
+std::int32_t   AsyncDLLPool::_number_of_pending  = 0;
+std::int32_t   AsyncDLLPool::_idle_workers       = 0;
+Event          *AsyncDLLPool::_work_event        = nullptr;
+
+
+void AsyncDLLPool::append( DeltaProcess **head, DeltaProcess **tail, DeltaProcess *process ) {
+    st_assert( process->_next_async_dll == nullptr, "already queued" );
+    if ( *tail == nullptr ) {
+        *head = process;
+    } else {
+        ( *tail )->_next_async_dll = process;
+    }
+    *tail = process;
+}
+
+
+bool AsyncDLLPool::unlink( DeltaProcess **head, DeltaProcess **tail, DeltaProcess *process ) {
+    DeltaProcess *previous = nullptr;
+    for ( DeltaProcess *p = *head; p not_eq nullptr; previous = p, p = p->_next_async_dll ) {
+        if ( p == process ) {
+            if ( previous == nullptr ) {
+                *head = p->_next_async_dll;
+            } else {
+                previous->_next_async_dll = p->_next_async_dll;
+            }
+            if ( *tail == p ) {
+                *tail = previous;
+            }
+            p->_next_async_dll = nullptr;
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void AsyncDLLPool::submit( DeltaProcess *process ) {
+    bool start_new_worker = false;
+    {
+        ThreadCritical tc;
+
+        AsyncDLLWorker *worker = process->_dll_worker;
+        if ( worker not_eq nullptr ) {
+            // back from a call back, or a call made by the call back: continue on the thread running the dll call
+            os::signal_event( worker->_event );
+            return;
+        }
+
+        append( &_pending_head, &_pending_tail, process );
+        _number_of_pending++;
+        start_new_worker = _number_of_pending > _idle_workers and _number_of_workers < AsyncDLLPoolSize;
+        if ( start_new_worker ) {
+            _number_of_workers++;
+        }
+        os::signal_event( _work_event );
+    }
+
+    if ( start_new_worker ) {
+        start_worker();
+    }
+}
+
+
+void AsyncDLLPool::start_worker() {
+    AsyncDLLWorker *worker = new AsyncDLLWorker();
+    worker->_thread = os::create_thread( (std::int32_t ( * )( void * )) &worker_main, (void *) worker, &worker->_thread_id );
+
+    if ( TraceProcessEvents ) {
+        SPDLOG_INFO( "async dll pool: started worker #{}", _number_of_workers );
+    }
+}
+
+
+DeltaProcess *AsyncDLLPool::take( AsyncDLLWorker *worker ) {
+    while ( true ) {
+        {
+            ThreadCritical tc;
+            DeltaProcess *process = _pending_head;
+            if ( process not_eq nullptr ) {
+                unlink( &_pending_head, &_pending_tail, process );
+                _number_of_pending--;
+                if ( _pending_head == nullptr ) {
+                    os::reset_event( _work_event );
+                }
+                // bind the process to the worker for the duration of the dll call
+                process->_dll_worker    = worker;
+                process->_dll_thread_id = worker->_thread_id;
+                worker->_process        = process;
+                worker->_running        = true;
+                return process;
+            }
+            os::reset_event( _work_event );
+            _idle_workers++;
+        }
+        os::wait_for_event( _work_event );
+        {
+            ThreadCritical tc;
+            _idle_workers--;
+        }
+    }
+}
+
+
+std::int32_t AsyncDLLPool::worker_main( AsyncDLLWorker *worker ) {
+    while ( true ) {
+        DeltaProcess *process = take( worker );
+
+        while ( process not_eq nullptr ) {
+            // run the process until it waits for control again
+            DeltaProcess::switch_stacks( &process->_dll_thread_sp, process->_saved_sp );
+
+            bool abandoned      = false;
+            bool delete_process = false;
+            {
+                ThreadCritical tc;
+                worker->_running = false;
+                if ( worker->_abandoned ) {
+                    abandoned               = true;
+                    delete_process          = worker->_delete;
+                    worker->_abandoned      = false;
+                    worker->_delete         = false;
+                    worker->_process        = nullptr;
+                    process->_dll_worker    = nullptr;
+                    process->_dll_thread_id = -1;
+                }
+            }
+            if ( abandoned ) {
+                // the process was terminated during the call (see terminated); we are off its stack now
+                ThreadInVM tiv;
+                process->release_stack();
+                if ( delete_process ) {
+                    delete process;
+                }
+                break;
+            }
+
+            // The process is switched out, so the scheduler may switch to it from now on.
+            // A completed call made by a call back leaves the worker with the call the call back came from.
+            const bool call_completed = process->_dll_call_completed and process->_async_dll_calls == 0;
+            {
+                ThreadInVM tiv;
+                if ( call_completed ) {
+                    ThreadCritical tc;
+                    process->_dll_worker    = nullptr;
+                    process->_dll_thread_id = -1;
+                    worker->_process        = nullptr;
+                }
+                process->set_state( ProcessState::yielded_after_async_dll );
+                completed( process );
+                DeltaProcess::async_dll_call_completed();
+            }
+            if ( call_completed )
+                break;
+
+            // The dll code called back into Delta (or a call made by the call back has completed). The process
+            // comes back to this thread for further calls of the call back and once the call back returns
+            // (see submit), unless it is terminated meanwhile.
+            os::wait_for_event( worker->_event );
+            os::reset_event( worker->_event );
+            ThreadCritical tc;
+            process          = worker->_process;
+            worker->_running = process not_eq nullptr;
+        }
+    }
+    return 0;
+}
+
+
+void AsyncDLLPool::completed( DeltaProcess *process ) {
+    ThreadCritical tc;
+    append( &_completed_head, &_completed_tail, process );
+}
+
+
+void AsyncDLLPool::remove( DeltaProcess *process ) {
+    ThreadCritical tc;
+    unlink( &_completed_head, &_completed_tail, process );
+}
+
+
+bool AsyncDLLPool::terminated( DeltaProcess *process ) {
+    ThreadCritical tc;
+    unlink( &_completed_head, &_completed_tail, process );
+    if ( unlink( &_pending_head, &_pending_tail, process ) ) {
+        _number_of_pending--;
+    }
+
+    AsyncDLLWorker *worker = process->_dll_worker;
+    if ( worker == nullptr ) {
+        return false;
+    }
+
+    if ( worker->_running ) {
+        // the dll call is still running on the stack of the process: the worker releases the stack when the call returns
+        worker->_abandoned = true;
+        return true;
+    }
+
+    // the worker waits for the process to come back from a call back;
+    // the native frames of the dll call go away with the stack of the process
+    process->_dll_worker    = nullptr;
+    process->_dll_thread_id = -1;
+    worker->_process        = nullptr;
+    os::signal_event( worker->_event );
+    return false;
+}
+
+
+bool AsyncDLLPool::delete_when_returned( DeltaProcess *process ) {
+    ThreadCritical tc;
+    AsyncDLLWorker *worker = process->_dll_worker;
+    if ( worker == nullptr or not worker->_abandoned ) {
+        return false;
+    }
+
+    // the Delta process object forgets the process now, the worker deletes it once the call has returned
+    worker->_delete = true;
+    process->processObject()->set_process( nullptr );
+    process->set_processObject( nullptr );
+    return true;
+}
+
+
+void AsyncDLLPool::completed_iterate( ProcessClosure *blk ) {
+    ThreadCritical tc;
+    for ( DeltaProcess *p = _completed_head; p not_eq nullptr; p = p->_next_async_dll ) {
+        blk->do_process( p );
+    }
+}
+
+
+void asyncDLLPool_init() {
+    SPDLOG_INFO( "system-init:  asyncDLLPool_init" );
+
+    AsyncDLLPool::_work_event = os::create_event( false );
+}
@@ -0,0 +1,83 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+
+
+class Event;
+class DeltaProcess;
+class ProcessClosure;
+class AsyncDLLWorker;
+
+// The AsyncDLLPool continues the asynchronous dll calls of user-mode processes on a bounded
+// set of worker threads (at most AsyncDLLPoolSize). A process handed off by the carrier thread
+// (see DeltaProcess::transfer_and_continue) is run by the next idle worker, new workers are only
+// started while all existing ones are busy; beyond the bound, calls wait in the pending queue.
+//
+// A worker stays with its process until the dll call completes, so that the native code sees
+// the same thread across call backs into Delta. Asynchronous calls made by a call back run on
+// that worker as well, and their completion leaves it bound to the process.
+//
+// Processes whose calls completed are kept in a completion queue (in completion order) until
+// the scheduler transfers control to them. This includes processes with threads of their own.
+
+class AsyncDLLPool : AllStatic {
+
+private:
+    static DeltaProcess   *_pending_head;       // processes waiting for a worker (fifo)
+    static DeltaProcess   *_pending_tail;       //
+    static DeltaProcess   *_completed_head;     // processes whose dll call completed (fifo)
+    static DeltaProcess   *_completed_tail;     //
+    static std::int32_t   _number_of_workers;   //
+    static std::int32_t   _number_of_pending;   //
+    static std::int32_t   _idle_workers;        // workers waiting for pending processes
+    static Event          *_work_event;         // signalled while there are pending processes
+
+    static void start_worker();
+
+    static DeltaProcess *take( AsyncDLLWorker *worker );
+
+    static void append( DeltaProcess **head, DeltaProcess **tail, DeltaProcess *process );
+
+    static bool unlink( DeltaProcess **head, DeltaProcess **tail, DeltaProcess *process );
+
+    static std::int32_t worker_main( AsyncDLLWorker *worker );
+
+    friend void asyncDLLPool_init();
+
+public:
+    // Continues the dll call of the (switched out) process on a worker.
+    static void submit( DeltaProcess *process );
+
+    // Completion queue
+    static void completed( DeltaProcess *process );
+
+    static void remove( DeltaProcess *process );      // called when the scheduler transfers control to the process
+
+    // Called when the process is terminated; also returns a worker bound to the process to the pool.
+    // Returns true if a worker is still running the dll call of the process on its stack: the worker
+    // then releases the stack (see Process::release_stack) when the call returns.
+    static bool terminated( DeltaProcess *process );
+
+    // For a process whose stack is still in use (see terminated): lets the worker delete the process
+    // as well. Returns false if the call has returned already and the process can be deleted now.
+    static bool delete_when_returned( DeltaProcess *process );
+
+
+    static bool has_completed() {
+        return _completed_head not_eq nullptr;
+    }
+
+
+    // iterates over the completion queue in completion order
+    static void completed_iterate( ProcessClosure *blk );
+
+    static std::int32_t number_of_workers() {
+        return _number_of_workers;
+    }
+};
@@ -11,6 +11,7 @@
 #include "vm/oop/MemOopDescriptor.hpp"
 #include "vm/platform/os.hpp"
 #include "vm/memory/SymbolTable.hpp"
+#include "vm/utility/StringHash.hpp"
 #include "vm/klass/KlassKlass.hpp"
 #include "vm/klass/SmallIntegerKlass.hpp"
 #include "vm/klass/DoubleByteArrayKlass.hpp"
@@ -216,6 +217,14 @@ void Bootstrap::read_oop( Oop *oop_addr ) {
 
 void Bootstrap::check_version() {
 
+    // images written with the full contents string hash add another 100 (see Dumper>>fileOut)
+    if ( _version_number > 200 ) {
+        StringHash::select_version( StringHash::Version::full_contents );
+        _version_number -= 100;
+    } else {
+        StringHash::select_version( StringHash::Version::sampled );
+    }
+
     if ( _version_number > 100 ) {
         _new_format = true;
         _version_number -= 100;
@@ -102,7 +102,7 @@ extern "C" volatile void *handleCallBack( std::int32_t index, std::int32_t param
         //   remove warning when it has been tested
         proc = Processes::find_from_thread_id( os::current_thread_id() );
         st_assert( proc, "process must be present" );
-        DLLs::exit_async_call( &proc );
+        DLLs::enter_call_back( &proc );
     }
 
     DeltaProcess::active()->setIsCallback( true );
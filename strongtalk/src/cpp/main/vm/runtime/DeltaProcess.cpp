@@ -17,17 +17,22 @@
 #include "vm/oop/ProcessOopDescriptor.hpp"
 #include "vm/platform/os.hpp"
 #include "vm/primitive/InterpretedPrimitiveCache.hpp"
+#include "vm/runtime/AsyncDLLPool.hpp"
 #include "vm/runtime/Delta.hpp"
 #include "vm/runtime/DeltaProcess.hpp"
 #include "vm/runtime/ErrorHandler.hpp"
 #include "vm/runtime/flags.hpp"
+#include "vm/runtime/IOPoller.hpp"
 #include "vm/runtime/Processes.hpp"
 #include "vm/runtime/ResourceMark.hpp"
+#include "vm/runtime/Safepoint.hpp"
 #include "vm/runtime/StackChunkBuilder.hpp"
 #include "vm/runtime/VMOperation.hpp"
 #include "vm/runtime/VMProcess.hpp"
 #include "vm/runtime/VMSymbol.hpp"
 
+#include <atomic>
+
 
 
 // The tricky part is to restore the original return address of the primitive before the delta call.
@@ -58,6 +63,7 @@ volatile char *DeltaProcess::_active_stack_limit         = nullptr;
 DeltaProcess  *DeltaProcess::_scheduler_process          = nullptr;
 bool          DeltaProcess::_is_idle                     = false;
 volatile bool DeltaProcess::_interrupt                   = false;
+volatile std::int32_t DeltaProcess::_time_slice_ticks      = 0;
 volatile bool DeltaProcess::_process_has_terminated      = false;
 ProcessState  DeltaProcess::_state_of_terminated_process = ProcessState::initialized;
 
@@ -162,6 +168,9 @@ ProcessState DeltaProcess::transfer_to( DeltaProcess *destination ) {
     if ( destination->state() == ProcessState::in_async_dll )
         return destination->state();
 
+    if ( destination->state() == ProcessState::yielded_after_async_dll )
+        AsyncDLLPool::remove( destination );
+
     transfer( ProcessState::yielded, destination );
     if ( process_has_terminated() ) {
         return state_of_terminated_process();
@@ -191,6 +200,10 @@ void DeltaProcess::transfer_to_vm() {
 void DeltaProcess::suspend_at_creation() {
     // This is called as soon a DeltaProcess is created
     // Let's wait until we're given the torch.
+    if ( _user_mode ) {
+        // a user-mode process is only entered when it has the torch
+        return;
+    }
     SPDLOG_INFO( "status-delta-process-suspend-at-creation: thread_id [{}] waiting for event", this->thread_id() );
     os::wait_for_event( _event );
 }
@@ -225,7 +238,20 @@ void DeltaProcess::transfer_and_continue() {
         }
     }
 
-    os::transfer_and_continue( _thread, _event, scheduler()->_thread, scheduler()->_event );
+    if ( _user_mode ) {
+        // The carrier thread continues with the scheduler, the dll call continues on a worker of the AsyncDLLPool.
+        // The process is submitted by the scheduler, once our registers have been saved (see complete_handoff).
+        _handoff = this;
+        switch_stacks( &_saved_sp, scheduler()->_saved_sp );
+        // now running on the worker
+    } else {
+        os::transfer_and_continue( _thread, _event, scheduler()->_thread, scheduler()->_event );
+    }
+}
+
+
+void DeltaProcess::hand_off() {
+    AsyncDLLPool::submit( this );
 }
 
 
@@ -240,12 +266,22 @@ bool DeltaProcess::wait_for_async_dll( std::int32_t timeout_in_ms ) {
         return true;
     }
 
+    if ( IOPoller::poll( 0 ) > 0 ) {
+        return false;
+    }
+
     if ( TraceProcessEvents ) {
         SPDLOG_INFO( "Waiting for async {} ms", timeout_in_ms );
     }
 
     _is_idle = true;
-    bool result = os::wait_for_event_or_timer( _async_dll_completion_event, timeout_in_ms );
+    bool result;
+    if ( IOPoller::number_of_armed() > 0 ) {
+        // wait for the file descriptors as well, a completing dll call wakes the poller up
+        result = IOPoller::poll( timeout_in_ms ) == 0 and os::wait_for_event_or_timer( _async_dll_completion_event, 0 );
+    } else {
+        result = os::wait_for_event_or_timer( _async_dll_completion_event, timeout_in_ms );
+    }
     _is_idle = false;
 
     if ( not result ) {
@@ -267,18 +303,30 @@ void DeltaProcess::initialize_async_dll_event() {
 
 void DeltaProcess::async_dll_call_completed() {
     os::signal_event( _async_dll_completion_event );
+    IOPoller::wake();
 }
 
 
-void DeltaProcess::wait_for_control() {
+void DeltaProcess::wait_for_control( bool call_completed ) {
 
     if ( TraceProcessEvents ) {
         _console->print( "*" );
     }
 
-    set_state( ProcessState::yielded_after_async_dll );
-    async_dll_call_completed();
-    os::wait_for_event( _event );
+    if ( _user_mode ) {
+        // back to the worker, which reports the completion (see AsyncDLLPool::worker_main)
+        _dll_call_completed = call_completed;
+        switch_stacks( &_saved_sp, _dll_thread_sp );
+        // now running on the carrier thread
+    } else {
+        {
+            ThreadInVM tiv;
+            set_state( ProcessState::yielded_after_async_dll );
+            AsyncDLLPool::completed( this );
+            async_dll_call_completed();
+        }
+        os::wait_for_event( _event );
+    }
     if ( is_terminating() ) {
         ErrorHandler::abort_current_process();
     }
@@ -339,6 +387,17 @@ std::int32_t DeltaProcess::launch_delta( DeltaProcess *process ) {
 }
 
 
+// Code entry point for a Delta process switched in user mode (see Process::allocate_stack)
+void DeltaProcess::launch_user_mode() {
+    complete_handoff();
+
+    DeltaProcess *process = active();
+    process->_thread = os::current_thread( &process->_thread_id );
+    launch_delta( process );
+    ShouldNotReachHere();
+}
+
+
 DeltaProcess::DeltaProcess( Oop receiver, SymbolOop selector, bool createThread ) :
     _receiver{ receiver },
     _selector{ selector },
@@ -354,14 +413,27 @@ DeltaProcess::DeltaProcess( Oop receiver, SymbolOop selector, bool createThread
     _isCallback{ false },
     stopping{ false },
     _unwind_head{ nullptr },
-    _firstHandle{ nullptr } {
-
-    _event  = os::create_event( false );
-    _thread = createThread
-              ? os::create_thread( (std::int32_t ( * )( void * )) &launch_delta, (void *) this, &_thread_id )
-              : os::starting_thread( &_thread_id );
+    _firstHandle{ nullptr },
+    _dll_worker{ nullptr },
+    _dll_thread_id{ -1 },
+    _dll_thread_sp{ nullptr },
+    _dll_call_completed{ true },
+    _async_dll_calls{ 0 },
+    _next_async_dll{ nullptr } {
+
+    if ( createThread and use_user_mode_switching() and _carrier_event not_eq nullptr ) {
+        // runs on the carrier thread on a stack of its own; the thread is known once it runs (see launch_user_mode)
+        _user_mode = true;
+        _event     = _carrier_event;
+        allocate_stack( &launch_user_mode );
+    } else {
+        _event  = os::create_event( false );
+        _thread = createThread
+                  ? os::create_thread( (std::int32_t ( * )( void * )) &launch_delta, (void *) this, &_thread_id )
+                  : os::starting_thread( &_thread_id );
 
-    _stack_limit = (char *) os::stack_limit( _thread );
+        _stack_limit = (char *) os::stack_limit( _thread );
+    }
     SPDLOG_INFO( "stack limit is [{}] bytes", _stack_limit );
 
     SPDLOG_INFO( "creating DeltaProcess 0x{0:x}", static_cast<const void *>( this ) );
@@ -405,6 +477,12 @@ static std::int32_t interruptions = 0;
 
 void DeltaProcess::check_stack_overflow() {
 
+    if ( Safepoint::is_requested() ) {
+        Safepoint::run_requested_operation();
+        if ( not _interrupt )
+            return;
+    }
+
     bool isInterrupted = false;
     if ( EnableProcessPreemption ) {
         ThreadCritical tc;
@@ -415,12 +493,12 @@ void DeltaProcess::check_stack_overflow() {
     if ( isInterrupted ) {
         st_assert( EnableProcessPreemption, "Should not be interrupted unless preemption enabled" );
         interruptions++;
-        _active_stack_limit = active()->_stack_limit;
+        disarm_safepoint_poll();
         if ( interruptions % 1000 == 0 )
-            SPDLOG_WARN( "Interruptions: %d", interruptions );
+            SPDLOG_WARN( "Interruptions: {}", interruptions );
         if ( DeltaProcess::active()->is_scheduler() )
             return;
-        active()->suspend( ProcessState::yielded );
+        active()->suspend( ProcessState::preempted );
     } else if ( not active()->is_scheduler() ) {
         active()->suspend( ProcessState::stack_overflow );
     } else {
@@ -435,7 +513,9 @@ extern "C" void check_stack_overflow() {
 
 
 DeltaProcess::~DeltaProcess() {
-    processObject()->set_process( nullptr );
+    if ( processObject() not_eq nullptr ) {
+        processObject()->set_process( nullptr );
+    }
     if ( Processes::includes( this ) ) {
         Processes::remove( this );
     }
@@ -444,11 +524,34 @@ DeltaProcess::~DeltaProcess() {
 
 void DeltaProcess::preempt_active() {
     st_assert( EnableProcessPreemption, "Should not preempt active process when preemption not enabled" );
-    _interrupt          = true;
+    ThreadCritical tc;  // see disarm_safepoint_poll
+    _interrupt = true;
+    arm_safepoint_poll();
+}
+
+
+void DeltaProcess::arm_safepoint_poll() {
     _active_stack_limit = (char *) 0x7fffffff;
 }
 
 
+void DeltaProcess::disarm_safepoint_poll() {
+    ThreadCritical tc;
+    if ( not _interrupt and not Safepoint::is_requested() ) {
+        _active_stack_limit = active()->_stack_limit;
+    }
+}
+
+
+void DeltaProcess::time_slice_tick() {
+    // the scheduler is never preempted, its processes are (at the next safepoint) once their time slice is used up
+    if ( _active_delta_process == nullptr or _active_delta_process->is_scheduler() )
+        return;
+    if ( ++_time_slice_ticks >= ProcessTimeSlice )
+        preempt_active();
+}
+
+
 void DeltaProcess::print() {
 
     switch ( state() ) {
@@ -1176,6 +1279,14 @@ bool DeltaProcess::in_vm_operation() const {
 void DeltaProcess::set_active( DeltaProcess *p ) {
     _active_delta_process = p;
     _active_stack_limit   = p->_stack_limit;
+    _time_slice_ticks     = 0;
+
+    // Safepoint::request arms the poll after publishing the request, so a request that raced with the
+    // store above is seen here (the fence keeps the load from being done before the store).
+    std::atomic_thread_fence( std::memory_order_seq_cst );
+    if ( Safepoint::is_requested() ) {
+        arm_safepoint_poll();
+    }
 
     if ( _active_delta_process->state() not_eq ProcessState::uncommon ) {
         _active_delta_process->set_state( ProcessState::running );
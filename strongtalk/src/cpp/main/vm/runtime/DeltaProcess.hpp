@@ -9,6 +9,8 @@
 #include "vm/runtime/Process.hpp"
 
 
+class AsyncDLLWorker;
+
 //
 class DeltaProcess : public Process {
 
@@ -194,7 +196,30 @@ public:
     // asynchronous dll support
     void transfer_and_continue();
 
-    void wait_for_control();
+    // call_completed is false when leaving the dll code for a call back into Delta
+    void wait_for_control( bool call_completed = true );
+
+
+    // native thread id of the worker running the current asynchronous dll call of a user-mode process (-1 if none)
+    std::int32_t dll_thread_id() const {
+        return _dll_thread_id;
+    }
+
+
+    // asynchronous dll calls in progress; more than one while a call back makes asynchronous calls of its own
+    void enter_async_dll_call() {
+        _async_dll_calls++;
+    }
+
+
+    void exit_async_dll_call() {
+        _async_dll_calls--;
+    }
+
+
+    std::int32_t async_dll_calls() const {
+        return _async_dll_calls;
+    }
 
     // transfers control from the scheduler.
     ProcessState transfer_to( DeltaProcess *target );
@@ -237,12 +262,21 @@ public:
 
     static void initialize_async_dll_event();
 
-    // Waits for a completed async call or timeout.
+    // Waits for a completed async call, a ready file descriptor (see IOPoller) or timeout.
     // Returns whether the timer expired.
     static bool wait_for_async_dll( std::int32_t timeout_in_ms );
 
     static void preempt_active();
 
+    // Makes the active process stop at the next safepoint poll (see Safepoint)
+    static void arm_safepoint_poll();
+
+    static void disarm_safepoint_poll();
+
+    // Called every millisecond by the ProcessPreemptionTask, preempts the active process
+    // at the next safepoint (method entry or loop back-edge) once its time slice is used up.
+    static void time_slice_tick();
+
     // create and run the main process - ie. the process for the initial thread
     static void createMainProcess();
 
@@ -260,12 +294,25 @@ private:
 
     void transfer( ProcessState reason, DeltaProcess *destination );
 
+    // User-mode switching (see Process::switch_to)
+    AsyncDLLWorker *_dll_worker;         // worker continuing the current asynchronous dll call (see AsyncDLLPool)
+    std::int32_t   _dll_thread_id;       //
+    void           *_dll_thread_sp;      // stack pointer of the worker while the process is not running on it
+    bool           _dll_call_completed;  // false while the dll code calls back into Delta
+    std::int32_t   _async_dll_calls;     // see enter_async_dll_call
+    DeltaProcess   *_next_async_dll;     // link in the queues of the AsyncDLLPool
+
+    void hand_off();
+
+    static void launch_user_mode();
+
     static DeltaProcess  *_active_delta_process;
     static DeltaProcess  *_main_process;
     static DeltaProcess  *_scheduler_process;
     static bool          _is_idle;
     static volatile char *_active_stack_limit;    //
     static volatile bool _interrupt;              //
+    static volatile std::int32_t _time_slice_ticks; // milliseconds the active process has been running
 
     // The launch function for a new thread
     static std::int32_t launch_delta( DeltaProcess *process );
@@ -286,4 +333,5 @@ private:
     friend void check_stack_overflow();
 
     friend class StackHandle;
+    friend class AsyncDLLPool;
 };
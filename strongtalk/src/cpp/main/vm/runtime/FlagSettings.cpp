@@ -16,13 +16,21 @@ auto _ActivationShowExpressionStack       = _flag<bool>( "ActivationShowExpressi
 auto _ActivationShowFrame                 = _flag<bool>( "ActivationShowFrame", false, "Show frame for activation" );
 auto _ActivationShowNameDescs             = _flag<bool>( "ActivationShowNameDescs", false, "Show name desc in the printed code" );
 auto _AlwaysFlushVMMessages               = _flag<bool>( "AlwaysFlushVMMessages", true, "Flush VM message log after every line" );
+auto _AsyncDLLPoolSize                    = _flag<std::int32_t>( "AsyncDLLPoolSize", 8, "Max. number of threads running asynchronous dll calls" );
 auto _BlockArgAdditionalAllowedInlineCost = _flag<std::int32_t>( "BlockArgAdditionalAllowedInlineCost", 35, "additional allowed cost for each block arg" );
 auto _BlockArgAdditionalInstrSize         = _flag<std::int32_t>( "BlockArgAdditionalInstrSize", 150, "extra allowance (in instr bytes) for each block arg" );
+auto _BranchProfileClaimLimit             = _flag<std::int32_t>( "BranchProfileClaimLimit", 16, "min. misses of a branch profile entry before another jump takes it over" );
 auto _BreakAtWarning                      = _flag<bool>( "BreakAtWarning", false, "Interrupt execution at warning?" );
 auto _BruteForcePropagate                 = _flag<bool>( "BruteForcePropagate", false, "Perform brute-force global copy propagation (UNSAFE  -Urs 5/3/96)" );
+auto _CodeCompactionMaxOccupancy          = _flag<std::int32_t>( "CodeCompactionMaxOccupancy", 50, "(in %) only evacuate code cache regions less occupied than this" );
+auto _CodeCompactionStepSize              = _flag<std::int32_t>( "CodeCompactionStepSize", 16, "max. Kbytes moved per incremental code compaction step" );
+auto _CodeEvictionBackoffWindow           = _flag<std::int32_t>( "CodeEvictionBackoffWindow", 1000, "back off eviction of methods recompiled within this many compilations" );
+auto _CodeEvictionFraction                = _flag<std::int32_t>( "CodeEvictionFraction", 10, "(in %) min. fraction of the code cache freed when evicting" );
 auto _CodeForP6                           = _flag<bool>( "CodeForP6", false, "Minimize use of byte registers in code generation for P6" );
+auto _CodeRegionSize                      = _flag<std::int32_t>( "CodeRegionSize", 64, "size (in Kbytes) of code cache regions for incremental compaction" );
 auto _CodeSize                            = _flag<std::int32_t>( "CodeSize", 20 * 1024, "size of code cache (in Kbytes)" );
 auto _CodeSizeImpactsInlining             = _flag<bool>( "CodeSizeImpactsInlining", true, "code size is used as parameter to guide inlining" );
+auto _ColdBranchLimit                     = _flag<std::int32_t>( "ColdBranchLimit", 100, "min. executions of a conditional jump before a never-taken branch is uncommon" );
 auto _CompiledCodeOnly                    = _flag<bool>( "CompiledCodeOnly", false, "Use compiled code only" );
 auto _CompilerDebug                       = _flag<bool>( "CompilerDebug", false, "Make compiler debugging easier" );
 auto _CompilerInstrsSize                  = _flag<std::int32_t>( "CompilerInstrsSize", 50 * 1024, "max. size of NativeMethod instrs" );
@@ -30,9 +38,10 @@ auto _CompilerPCsSize                     = _flag<std::int32_t>( "CompilerPCsSiz
 auto _CompilerScopesSize                  = _flag<std::int32_t>( "CompilerScopesSize", 50 * 1024, "max. size of debugging info per NativeMethod" );
 auto _CompressProgramCounterDescriptors   = _flag<bool>( "CompressProgramCounterDescriptors", true, "ScopeDescriptorRecorder: Compress ProgramCounterDescriptors by ignoring multiple entries at same offset" );
 auto _ConstantFoldPrims                   = _flag<bool>( "ConstantFoldPrims", true, "Constant-fold primitive calls" );
+auto _CountBytecodePairs                  = _flag<bool>( "CountBytecodePairs", false, "Count pairs of dispatched bytecodes (printed at exit)" );
 auto _CountBytecodes                      = _flag<bool>( "CountBytecodes", false, "Count number of bytecodes executed" );
 auto _CountParentLinksAsOne               = _flag<bool>( "CountParentLinksAsOne", true, "Count going up to parent frame as 1 when checking MaxInterpretedSearchLength during recompilee search" );
-auto _CounterHalfLifeTime                 = _flag<std::int32_t>( "CounterHalfLifeTime", 30, "time (in seconds) in which invocation counters decay by half" );
+auto _CounterHalfLifeTime                 = _flag<std::int32_t>( "CounterHalfLifeTime", 30, "time (in seconds) in which method invocation counters decay by half (0 = never)" );
 auto _CreateScopeDescInfo                 = _flag<bool>( "CreateScopeDescInfo", true, "Create ScopeDescriptor info for new backend code" );
 auto _DebugPerformance                    = _flag<bool>( "DebugPerformance", false, "Print info useful for performance debugging" );
 auto _DeferUncommonBranches               = _flag<bool>( "DeferUncommonBranches", true, "Don't generate code for uncommon cases" );
@@ -49,14 +58,16 @@ auto _GenTraceCalls                       = _flag<bool>( "GenTraceCalls", false,
 auto _GenerateFullDebugInfo               = _flag<bool>( "GenerateFullDebugInfo", false, "Generate debugging info for each byte code and not only for sends/traps" );
 auto _GenerateHTML                        = _flag<bool>( "GenerateHTML", false, "Generate HTML output for documentation" );
 auto _GenerateLiteScopeDescs              = _flag<bool>( "GenerateLiteScopeDescs", false, "generate lite scope descs" );
+auto _GenerateLoopSafepoints              = _flag<bool>( "GenerateLoopSafepoints", true, "Poll for preemption at loop back-edges in compiled code" );
 auto _GenerateSmalltalk                   = _flag<bool>( "GenerateSmalltalk", false, "Generate Smalltalk output for file_in" );
 auto _GlobalCopyPropagate                 = _flag<bool>( "GlobalCopyPropagate", true, "Perform global copy propagation" );
 auto _HeapSweeperInterval                 = _flag<std::int32_t>( "HeapSweeperInterval", 120, "Time interval (sec) between starting heap sweep" );
+auto _IOPollerEventsPerWait               = _flag<std::int32_t>( "IOPollerEventsPerWait", 256, "Max. number of ready file descriptors taken per wait of the I/O poller" );
 auto _Inline                              = _flag<bool>( "Inline", true, "Inline message sends" );
 auto _InlinePrims                         = _flag<bool>( "InlinePrims", true, "Inline some primitive calls" );
 auto _InliningDatabasePruningLimit        = _flag<std::int32_t>( "InliningDatabasePruningLimit", 3, "Min. number of nodes in inlining structure to qualify for database" );
 auto _InvocationCounterLimit              = _flag<std::int32_t>( "InvocationCounterLimit", 10000, "max. number of method invocations before (re-)compiling" );
-auto _JumpTableSize                       = _flag<std::int32_t>( "JumpTableSize", 8 * 1024, "size of jump table" );
+auto _JumpTableSize                       = _flag<std::int32_t>( "JumpTableSize", 8 * 1024, "size of jump table blocks (the table grows by this many entries)" );
 auto _LRUDecayFactor                      = _flag<std::int32_t>( "LRUDecayFactor", 2, "LRUDecayFactor" );
 auto _LocalCopyPropagate                  = _flag<bool>( "LocalCopyPropagate", true, "Perform local copy propagation" );
 auto _LogVMMessages                       = _flag<bool>( "LogVMMessages", true, "Log all vm messages to a file" );
@@ -79,6 +90,7 @@ auto _MinBlockCostFraction                = _flag<std::int32_t>( "MinBlockCostFr
 auto _MinInvocationsBeforeTrust           = _flag<std::int32_t>( "MinInvocationsBeforeTrust", 100, "min. number of invocations required before trusting NativeMethod's PICs" );
 auto _MinSendsBeforeRecompile             = _flag<std::int32_t>( "MinSendsBeforeRecompile", 2000, "min number of sends a method must have performed before being recompiled" );
 auto _NativeMethodAgeLimit                = _flag<std::int32_t>( "NativeMethodAgeLimit", 2, "min. number of sweeps before NativeMethod becomes old" );
+auto _NativeMethodCounterHalfLifeTime     = _flag<std::int32_t>( "NativeMethodCounterHalfLifeTime", 30, "time (in seconds) in which NativeMethod invocation counters decay by half (0 = never)" );
 auto _NumberOfBlockAllocations            = _flag<std::int32_t>( "NumberOfBlockAllocations", 0, "Number of allocated blocks" );
 auto _NumberOfBytecodesExecuted           = _flag<std::int32_t>( "NumberOfBytecodesExecuted", 0, "Number of bytecodes executed by interpreter (if tracing)" );
 auto _NumberOfContextAllocations          = _flag<std::int32_t>( "NumberOfContextAllocations", 0, "Number of allocated block contexts" );
@@ -90,6 +102,7 @@ auto _PICSize                             = _flag<std::int32_t>( "PICSize", 128,
 auto _PrintAssemblyCode                   = _flag<bool>( "PrintAssemblyCode", false, "Print assembly code" );
 auto _PrintCode                           = _flag<bool>( "PrintCode", false, "Print intermediate code" );
 auto _PrintCodeCompaction                 = _flag<bool>( "PrintCodeCompaction", false, "Print code compaction" );
+auto _PrintCodeEviction                   = _flag<bool>( "PrintCodeEviction", false, "Print code cache evictions" );
 auto _PrintCodeGeneration                 = _flag<bool>( "PrintCodeGeneration", false, "Print code generation with new backend" );
 auto _PrintCodeReclamation                = _flag<bool>( "PrintCodeReclamation", false, "Print code reclamation" );
 auto _PrintCodeSweep                      = _flag<bool>( "PrintCodeSweep", false, "Print sweeps through zone/methods" );
@@ -128,6 +141,7 @@ auto _PrintRegAlloc                       = _flag<bool>( "PrintRegAlloc", false,
 auto _PrintRegTargeting                   = _flag<bool>( "PrintRegTargeting", false, "Print info about register targeting" );
 auto _PrintResourceAllocation             = _flag<bool>( "PrintResourceAllocation", false, "Print each resource area allocation" );
 auto _PrintResourceChunkAllocation        = _flag<bool>( "PrintResourceChunkAllocation", false, "Print each resource area chunk allocation" );
+auto _PrintSafepointStatistics            = _flag<bool>( "PrintSafepointStatistics", false, "Print safepoint statistics at exit" );
 auto _PrintScavenge                       = _flag<bool>( "PrintScavenge", false, "Print message at scavenge" );
 auto _PrintSplitting                      = _flag<bool>( "PrintSplitting", false, "Print info about boolean splitting" );
 auto _PrintStackAfterUnpacking            = _flag<bool>( "PrintStackAfterUnpacking", false, "Print stack after unpacking deoptimized frames" );
@@ -135,6 +149,9 @@ auto _PrintStackAtScavenge                = _flag<bool>( "PrintStackAtScavenge",
 auto _PrintStubRoutines                   = _flag<bool>( "PrintStubRoutines", false, "Prints the stub routine's code" );
 auto _PrintUncommonBranches               = _flag<bool>( "PrintUncommonBranches", false, "Print message upon encountering uncommon case" );
 auto _PrintVMMessages                     = _flag<bool>( "PrintVMMessages", true, "Print vm messages on _console" );
+auto _ProcessStackCommitSize              = _flag<std::int32_t>( "ProcessStackCommitSize", 16, "Size (in 1024) of process stack committed initially and per growth" );
+auto _ProcessTimeSlice                    = _flag<std::int32_t>( "ProcessTimeSlice", 10, "Time slice (in ms) of a preemptable Smalltalk process" );
+auto _ProfileBranches                     = _flag<bool>( "ProfileBranches", true, "Count the outcome of conditional jumps in the interpreter" );
 auto _ProfilerNumberOfCompiledMethods     = _flag<std::int32_t>( "ProfilerNumberOfCompiledMethods", 10, "Max. number of compiled methods to print" );
 auto _ProfilerNumberOfInterpreterMethods  = _flag<std::int32_t>( "ProfilerNumberOfInterpreterMethods", 10, "Max. number of interpreter methods to print" );
 auto _ProfilerShowMethodHolder            = _flag<bool>( "ProfilerShowMethodHolder", true, "Show method holder for method" );
@@ -146,6 +163,7 @@ auto _ShowMessageBoxOnError               = _flag<bool>( "ShowMessageBoxOnError"
 auto _Splitting                           = _flag<bool>( "Splitting", true, "Perform message splitting" );
 auto _StackPrintLimit                     = _flag<std::int32_t>( "StackPrintLimit", 64, "Number of stack frames to print in VM-level stack dump" );
 auto _StopInterpreterAt                   = _flag<std::int32_t>( "StopInterpreterAt", 0, "Stops interpreter execution at specified bytecode number" );
+auto _StringHashVersion                   = _flag<std::int32_t>( "StringHashVersion", 0, "String hash: 1 sampled, 2 full contents, 0 as in image" );
 auto _SurvivorSize                        = _flag<std::int32_t>( "SurvivorSize", 64, "size of survivor spaces (in Kbytes)" );
 auto _SweeperUseTimer                     = _flag<bool>( "SweeperUseTimer", true, "Tells whether the sweeper should use timer interrupts or compile events" );
 auto _ThreadStackSize                     = _flag<std::int32_t>( "ThreadStackSize", 512, "Size (in 1024) of each thread's stack" );
@@ -183,6 +201,7 @@ auto _TraceProcessEvents                  = _flag<bool>( "TraceProcessEvents", f
 auto _TraceProcessPrims                   = _flag<bool>( "TraceProcessPrims", false, "Trace process primitives" );
 auto _TraceProxyPrims                     = _flag<bool>( "TraceProxyPrims", false, "Trace Proxy primitives" );
 auto _TraceResults                        = _flag<bool>( "TraceResults", false, "Trace NativeMethod results" );
+auto _TraceSafepoints                     = _flag<bool>( "TraceSafepoints", false, "Trace the time taken to reach each safepoint" );
 auto _TraceSmiPrims                       = _flag<bool>( "TraceSmiPrims", false, "Trace SmallInteger primitives" );
 auto _TraceSystemPrims                    = _flag<bool>( "TraceSystemPrims", false, "Trace system primitives" );
 auto _TraceVMOperation                    = _flag<bool>( "TraceVMOperation", false, "Trace vm operations" );
@@ -195,9 +214,12 @@ auto _TypePredictArrays                   = _flag<bool>( "TypePredictArrays", fa
 auto _UncommonAgeBackoffFactor            = _flag<std::int32_t>( "UncommonAgeBackoffFactor", 4, "for exponential back-off of UncommonAgeLimit based on NativeMethod version" );
 auto _UncommonInvocationLimit             = _flag<std::int32_t>( "UncommonInvocationLimit", 10000, "min. number of invocations uncommon NativeMethod before recompiling it again" );
 auto _UncommonRecompileLimit              = _flag<std::int32_t>( "UncommonRecompileLimit", 5, "min. number of uncommon traps before recompiling" );
+auto _UncommonTrapCounterHalfLifeTime     = _flag<std::int32_t>( "UncommonTrapCounterHalfLifeTime", 30, "time (in seconds) in which uncommon trap counters decay by half (0 = never)" );
 auto _UseAccessMethods                    = _flag<bool>( "UseAccessMethods", true, "Use access methods" );
+auto _UseCodeEviction                     = _flag<bool>( "UseCodeEviction", true, "Evict the nativeMethods least worth keeping when the code cache is full" );
 auto _UseFPUStack                         = _flag<bool>( "UseFPUStack", false, "Use FPU stack for floats (unsafe)" );
 auto _UseGlobalFlatProfiling              = _flag<bool>( "UseGlobalFlatProfiling", true, "Include all processes when flat-profiling" );
+auto _UseIncrementalCodeCompaction        = _flag<bool>( "UseIncrementalCodeCompaction", true, "Evacuate sparse code cache regions a few nativeMethods at a time" );
 auto _UseInlineCaching                    = _flag<bool>( "UseInlineCaching", true, "Use inline caching in compiled code" );
 auto _UseInliningDatabase                 = _flag<bool>( "UseInliningDatabase", false, "Use the inlining database for recompilation" );
 auto _UseInliningDatabaseEagerly          = _flag<bool>( "UseInliningDatabaseEagerly", false, "Use the inlining database eagerly at lookup" );
@@ -208,9 +230,15 @@ auto _UseNewBackend                       = _flag<bool>( "UseNewBackend", false,
 auto _UseNewMakeConformant                = _flag<bool>( "UseNewMakeConformant", true, "Use new makeConformant function" );
 auto _UsePredictedMethods                 = _flag<bool>( "UsePredictedMethods", true, "Use predicted methods" );
 auto _UsePrimitiveMethods                 = _flag<bool>( "UsePrimitiveMethods", false, "Use primitive methods" );
+auto _UseQuickPrimitiveCalls              = _flag<bool>( "UseQuickPrimitiveCalls", true, "Rewrite calls of frequent primitives into quick forms with fast paths" );
 auto _UseRecompilation                    = _flag<bool>( "UseRecompilation", true, "Automatically (re-)compile frequently-used methods" );
+auto _UseSIMDDigitKernels                 = _flag<bool>( "UseSIMDDigitKernels", true, "Use the carry flag/SSE2 digit kernels of IntegerOps if supported" );
+auto _UseSIMDDoubleKernels                = _flag<bool>( "UseSIMDDoubleKernels", true, "Use the SSE2/AVX kernels of the DoubleValueArray primitives if supported" );
+auto _UseSIMDStringKernels                = _flag<bool>( "UseSIMDStringKernels", true, "Use the SSE2/AVX2 string kernels if supported" );
 auto _UseSlidingSystemAverage             = _flag<bool>( "UseSlidingSystemAverage", true, "Compute sliding system average on the fly" );
+auto _UseSuperinstructions                = _flag<bool>( "UseSuperinstructions", true, "Rewrite frequent bytecode pairs into superinstructions" );
 auto _UseTimers                           = _flag<bool>( "UseTimers", true, "Tells whether the VM should use timers (only used at startup)" );
+auto _UseUserModeProcessSwitching         = _flag<bool>( "UseUserModeProcessSwitching", true, "Switch Delta processes in user mode on the VM thread" );
 auto _VerifyAfterGC                       = _flag<bool>( "VerifyAfterGC", false, "Verify system after garbage collect" );
 auto _VerifyAfterScavenge                 = _flag<bool>( "VerifyAfterScavenge", false, "Verify system after scavenge" );
 auto _VerifyBeforeGC                      = _flag<bool>( "VerifyBeforeGC", false, "Verify system before garbage collect" );
@@ -0,0 +1,260 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/runtime/IOPoller.hpp"
+#include "vm/runtime/ResourceArea.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/runtime/init.hpp"
+#include "vm/klass/WeakArrayKlass.hpp"
+
+#if defined( __linux__ )
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+
+IOPoller::Entry *IOPoller::_entries          = nullptr;
+std::int32_t    IOPoller::_capacity          = 0;
+std::int32_t    IOPoller::_number_of_armed   = 0;
+std::int32_t    IOPoller::_number_of_queued  = 0;
+std::int32_t    IOPoller::_poll_fd           = -1;
+std::int32_t    IOPoller::_wake_fd           = -1;
+
+#if defined( __linux__ )
+
+static struct epoll_event *ready_list = nullptr;   // IOPollerEventsPerWait entries
+
+
+static std::uint32_t as_epoll_events( std::int32_t events ) {
+    std::uint32_t result = 0;
+    if ( events & IOPoller::readable )
+        result |= EPOLLIN | EPOLLRDHUP;
+    if ( events & IOPoller::writable )
+        result |= EPOLLOUT;
+    return result;
+}
+
+
+static std::int32_t from_epoll_events( std::uint32_t events ) {
+    std::int32_t result = 0;
+    if ( events & EPOLLIN )
+        result |= IOPoller::readable;
+    if ( events & EPOLLOUT )
+        result |= IOPoller::writable;
+    if ( events & ( EPOLLERR | EPOLLHUP | EPOLLRDHUP ) )
+        result |= IOPoller::hang_up;
+    return result;
+}
+
+#endif
+
+
+IOPoller::Entry *IOPoller::entry_at( std::int32_t fd ) {
+    return fd >= 0 and fd < _capacity ? &_entries[ fd ] : nullptr;
+}
+
+
+void IOPoller::grow( std::int32_t fd ) {
+    if ( fd < _capacity )
+        return;
+
+    std::int32_t new_capacity = _capacity == 0 ? 64 : _capacity;
+    while ( new_capacity <= fd )
+        new_capacity *= 2;
+
+    Entry *new_entries = new_c_heap_array<Entry>( new_capacity );
+    for ( std::int32_t i = 0; i < new_capacity; i++ ) {
+        new_entries[ i ] = i < _capacity ? _entries[ i ] : Entry{ nullptr, 0, 0, false, false };
+    }
+    if ( _entries not_eq nullptr )
+        FreeHeap( _entries );
+    _entries  = new_entries;
+    _capacity = new_capacity;
+}
+
+
+bool IOPoller::arm( std::int32_t fd, std::int32_t events, Oop waiter ) {
+    if ( not is_supported() or fd < 0 or fd == _wake_fd or ( events & ( readable | writable ) ) == 0 )
+        return false;
+    if ( is_armed_for_another( fd, waiter ) )
+        return false;
+
+#if defined( __linux__ )
+    grow( fd );
+    Entry *entry = entry_at( fd );
+
+    struct epoll_event event{};
+    event.events  = as_epoll_events( events ) | EPOLLONESHOT;
+    event.data.fd = fd;
+    if ( epoll_ctl( _poll_fd, entry->_registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, fd, &event ) not_eq 0 ) {
+        // the descriptor may have been closed (and reused) since it was registered
+        if ( not entry->_registered or errno not_eq ENOENT or epoll_ctl( _poll_fd, EPOLL_CTL_ADD, fd, &event ) not_eq 0 )
+            return false;
+    }
+
+    if ( not entry->_armed )
+        _number_of_armed++;
+    entry->_waiter     = waiter;
+    entry->_events     = events;
+    entry->_ready      = 0;
+    entry->_registered = true;
+    entry->_armed      = true;
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+bool IOPoller::is_armed_for_another( std::int32_t fd, Oop waiter ) {
+    Entry *entry = entry_at( fd );
+    return entry not_eq nullptr and entry->_armed and entry->_waiter not_eq waiter;
+}
+
+
+bool IOPoller::remove( std::int32_t fd ) {
+    Entry *entry = entry_at( fd );
+    if ( entry == nullptr or not entry->_registered )
+        return false;
+
+#if defined( __linux__ )
+    // fails harmlessly if the descriptor has been closed already, closing removes it from the epoll set
+    epoll_ctl( _poll_fd, EPOLL_CTL_DEL, fd, nullptr );
+#endif
+
+    if ( entry->_armed )
+        _number_of_armed--;
+    *entry = Entry{ nullptr, 0, 0, false, false };
+    return true;
+}
+
+
+std::int32_t IOPoller::ready_events( std::int32_t fd ) {
+    Entry *entry = entry_at( fd );
+    if ( entry == nullptr or not entry->_registered )
+        return -1;
+    return entry->_ready;
+}
+
+
+std::int32_t IOPoller::poll( std::int32_t timeout_in_ms ) {
+    if ( not is_supported() )
+        return 0;
+
+    std::int32_t queued = 0;
+#if defined( __linux__ )
+    std::int32_t n = epoll_wait( _poll_fd, ready_list, IOPollerEventsPerWait, timeout_in_ms );
+    for ( std::int32_t i = 0; i < n; i++ ) {
+        std::int32_t fd = ready_list[ i ].data.fd;
+        if ( fd == _wake_fd ) {
+            std::uint64_t count;
+            while ( read( _wake_fd, &count, sizeof( count ) ) > 0 );
+            continue;
+        }
+
+        // stale events of descriptors that are no longer armed are dropped
+        Entry *entry = entry_at( fd );
+        if ( entry == nullptr or not entry->_armed )
+            continue;
+
+        queue( entry, from_epoll_events( ready_list[ i ].events ) );
+        queued++;
+    }
+    if ( n == 0 and timeout_in_ms not_eq 0 )
+        queued += queue_closed();
+#endif
+    _number_of_queued += queued;
+    return queued;
+}
+
+
+// disarms the entry and queues its waiter
+void IOPoller::queue( Entry *entry, std::int32_t ready ) {
+    entry->_ready = ready;
+    entry->_armed = false;
+    _number_of_armed--;
+    NotificationQueue::put( entry->_waiter );
+    entry->_waiter = nullptr;
+}
+
+
+// Closing a descriptor drops it from the epoll set without an event, so an armed descriptor closed
+// without remove() would keep its waiter (and the count of armed descriptors) forever. Only done
+// when poll() times out, as it takes a system call per armed descriptor. A descriptor number that
+// has been reused by then is not noticed.
+std::int32_t IOPoller::queue_closed() {
+    std::int32_t queued = 0;
+#if defined( __linux__ )
+    std::int32_t armed = _number_of_armed;
+    for ( std::int32_t fd = 0; fd < _capacity and armed > 0; fd++ ) {
+        Entry *entry = &_entries[ fd ];
+        if ( not entry->_armed )
+            continue;
+        armed--;
+        if ( fcntl( fd, F_GETFD ) < 0 and errno == EBADF ) {
+            queue( entry, hang_up );
+            queued++;
+        }
+    }
+#endif
+    return queued;
+}
+
+
+std::int32_t IOPoller::take_queued() {
+    std::int32_t result = _number_of_queued;
+    _number_of_queued = 0;
+    return result;
+}
+
+
+void IOPoller::wake() {
+#if defined( __linux__ )
+    if ( _wake_fd >= 0 ) {
+        std::uint64_t one = 1;
+        if ( write( _wake_fd, &one, sizeof( one ) ) < 0 ) {
+            // the counter is saturated, a wake up is pending anyway
+        }
+    }
+#endif
+}
+
+
+void IOPoller::oops_do( void f( Oop * ) ) {
+    for ( std::int32_t i = 0; i < _capacity; i++ ) {
+        if ( _entries[ i ]._waiter not_eq nullptr )
+            f( &_entries[ i ]._waiter );
+    }
+}
+
+
+void ioPoller_init() {
+    SPDLOG_INFO( "system-init:  ioPoller_init" );
+
+#if defined( __linux__ )
+    IOPoller::_poll_fd = epoll_create1( EPOLL_CLOEXEC );
+    IOPoller::_wake_fd = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+    if ( IOPoller::_poll_fd < 0 or IOPoller::_wake_fd < 0 ) {
+        SPDLOG_INFO( "I/O poller not available (errno {})", errno );
+        if ( IOPoller::_poll_fd >= 0 )
+            close( IOPoller::_poll_fd );
+        if ( IOPoller::_wake_fd >= 0 )
+            close( IOPoller::_wake_fd );
+        IOPoller::_poll_fd = -1;
+        IOPoller::_wake_fd = -1;
+        return;
+    }
+
+    struct epoll_event event{};
+    event.events  = EPOLLIN;
+    event.data.fd = IOPoller::_wake_fd;
+    epoll_ctl( IOPoller::_poll_fd, EPOLL_CTL_ADD, IOPoller::_wake_fd, &event );
+
+    ready_list = new_c_heap_array<struct epoll_event>( IOPollerEventsPerWait );
+#endif
+}
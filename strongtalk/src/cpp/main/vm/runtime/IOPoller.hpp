@@ -0,0 +1,107 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/oop/Oop.hpp"
+
+
+// The IOPoller lets Delta processes wait for file descriptors without holding an OS thread.
+//
+// A file descriptor is armed with an interest set and a waiter object. When the descriptor
+// becomes ready the waiter is appended to the NotificationQueue (and sent #notify by the
+// Smalltalk side, which signals the semaphore the waiting process is blocked on). Registrations
+// are one-shot: after the waiter has been queued the descriptor stays registered but disarmed,
+// and the waiter is dropped, until it is armed again.
+//
+// A descriptor is armed for one waiter at a time. A descriptor closed while armed leaves the
+// epoll set without an event; poll() finds it when it times out and queues its waiter as hung up.
+//
+// Ready descriptors are collected by poll(), which the scheduler calls at the start of each
+// round and, with a timeout, instead of waiting for asynchronous dll calls when it is idle
+// (see DeltaProcess::wait_for_async_dll). A completing asynchronous dll call wakes a waiting
+// poll() through wake().
+//
+// The poller is built on Linux epoll; on other platforms is_supported() is false and nothing
+// can be armed.
+
+class IOPoller : AllStatic {
+
+public:
+    // interest sets and ready events
+    enum {
+        readable = 1,   //
+        writable = 2,   //
+        hang_up  = 4    // errors and hang ups, always reported
+    };
+
+private:
+    struct Entry {
+        Oop          _waiter;       // nullptr unless armed
+        std::int32_t _events;       // interest set
+        std::int32_t _ready;        // ready events when the waiter was queued
+        bool         _registered;   //
+        bool         _armed;        //
+    };
+
+    static Entry        *_entries;              // indexed by file descriptor
+    static std::int32_t _capacity;              //
+    static std::int32_t _number_of_armed;       //
+    static std::int32_t _number_of_queued;      // waiters queued since the last take_queued()
+    static std::int32_t _poll_fd;               // the epoll instance, or -1
+    static std::int32_t _wake_fd;               // eventfd written by wake(), or -1
+
+    static Entry *entry_at( std::int32_t fd );
+
+    static void grow( std::int32_t fd );
+
+    static void queue( Entry *entry, std::int32_t ready );
+
+    static std::int32_t queue_closed();
+
+    friend void ioPoller_init();
+
+public:
+    static bool is_supported() {
+        return _poll_fd >= 0;
+    }
+
+
+    // Arms fd with the interest set events (readable | writable) and the waiter, replacing an
+    // earlier registration of fd. Returns false if fd cannot be polled or is armed for another
+    // waiter.
+    static bool arm( std::int32_t fd, std::int32_t events, Oop waiter );
+
+    // Is fd armed for a waiter other than waiter?
+    static bool is_armed_for_another( std::int32_t fd, Oop waiter );
+
+    // Removes the registration of fd; false if fd is not registered.
+    static bool remove( std::int32_t fd );
+
+    // The events fd was ready for when its waiter was queued, 0 while armed, -1 if not registered.
+    static std::int32_t ready_events( std::int32_t fd );
+
+    static std::int32_t number_of_armed() {
+        return _number_of_armed;
+    }
+
+
+    // Queues the waiters of the descriptors that are ready, waiting at most timeout_in_ms
+    // (0 = do not wait, -1 = forever) until one is or wake() is called. On a timeout the waiters
+    // of armed descriptors that have been closed are queued as well. Returns the number of
+    // waiters queued.
+    static std::int32_t poll( std::int32_t timeout_in_ms );
+
+    // Returns the number of waiters queued since the last call.
+    static std::int32_t take_queued();
+
+    // Wakes up a waiting poll(); may be called from any thread.
+    static void wake();
+
+    // Memory management
+    static void oops_do( void f( Oop * ) );
+};
@@ -9,6 +9,7 @@
 #include "vm/memory/Universe.hpp"
 #include "vm/platform/os.hpp"
 #include "vm/runtime/PeriodicTask.hpp"
+#include "vm/runtime/Safepoint.hpp"
 
 std::int32_t           num_tasks = 0;
 constexpr std::int32_t max_tasks = 10;
@@ -34,6 +35,11 @@ void real_time_tick( std::int32_t delay_time ) {
         return;
     }
 
+    // The tasks may touch the heap, so they wait for the end of a safepoint operation (the tick is lost)
+    if ( Safepoint::is_active() ) {
+        return;
+    }
+
     // bail out if nothing to do
     if ( not pending_tasks( delay_time ) ) {
         SPDLOG_INFO( "pending_tasks() returned false" );
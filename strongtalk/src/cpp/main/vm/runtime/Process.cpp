@@ -25,6 +25,8 @@
 #include "vm/code/StubRoutines.hpp"
 #include "vm/oop/ContextOopDescriptor.hpp"
 
+#include <algorithm>
+
 
 std::int32_t CurrentHash = 23;
 
@@ -52,11 +54,127 @@ void Process::basic_transfer( Process *target ) {
         target->print();
         _console->cr();
     }
-    os::transfer( _thread, _event, target->_thread, target->_event );
+    if ( _user_mode and target->_user_mode ) {
+        switch_to( target );
+    } else {
+        os::transfer( _thread, _event, target->_thread, target->_event );
+        // The carrier thread is woken up in the context of the process that blocked it,
+        // so switch to the process which has been given the torch if that is another one.
+        if ( _user_mode and current() not_eq this ) {
+            switch_to( current() );
+        }
+    }
     applyStepping();
 }
 
 
+Event   *Process::_carrier_event = nullptr;
+Process *Process::_handoff       = nullptr;
+
+
+bool Process::use_user_mode_switching() {
+    return UseUserModeProcessSwitching and os::supports_user_mode_process_switching();
+}
+
+
+static std::int32_t round_to_page( std::int32_t size ) {
+    const std::int32_t page_size = os::vm_page_size();
+    return ( size + page_size - 1 ) / page_size * page_size;
+}
+
+
+void Process::allocate_stack( void entry() ) {
+    st_assert( _stack == nullptr, "stack already allocated" );
+
+    // Only the top of the stack is committed, it grows on faults below the committed part (see grow_stack).
+    const std::int32_t page_size   = os::vm_page_size();
+    _stack_size = round_to_page( ThreadStackSize * 1024 );
+    const std::int32_t commit_size = std::min( round_to_page( ProcessStackCommitSize * 1024 ), _stack_size - page_size );
+
+    _stack     = os::reserve_memory( _stack_size );
+    _committed = _stack + _stack_size - commit_size;
+    if ( _stack == nullptr or not os::commit_memory( _committed, commit_size ) ) {
+        st_fatal( "cannot allocate process stack" );
+    }
+
+    // the lowest page is never committed; keep the same headroom above it as for thread stacks
+    _stack_limit = _stack + 3 * page_size;
+
+    // build the frame switch_stacks returns through; entry is entered with an aligned stack and never returns
+    std::int32_t *sp = (std::int32_t *) ( _stack + _stack_size );
+    *--sp = 0;                      // return address of entry
+    *--sp = std::int32_t( entry );  // return address of switch_stacks
+    *--sp = 0;                      // ebp
+    *--sp = 0;                      // ebx
+    *--sp = 0;                      // esi
+    *--sp = 0;                      // edi
+    _saved_sp = sp;
+}
+
+
+void Process::release_stack() {
+    if ( _stack == nullptr )
+        return;
+    os::release_memory( _stack, _stack_size );
+    _stack       = nullptr;
+    _stack_size  = 0;
+    _committed   = nullptr;
+    _stack_limit = nullptr;
+    _saved_sp    = nullptr;
+}
+
+
+bool Process::grow_stack( const char *addr ) {
+    // Called from the signal handler: addr is below the committed part of the stack, usually on its guard page.
+    const std::int32_t page_size = os::vm_page_size();
+    if ( addr < _stack + page_size or addr >= _committed )
+        return false;
+
+    // commit down to the faulting page, but at least ProcessStackCommitSize
+    const char *bottom = _committed - round_to_page( ProcessStackCommitSize * 1024 );
+    bottom = std::min<const char *>( bottom, _stack + ( addr - _stack ) / page_size * page_size );
+    bottom = std::max<const char *>( bottom, _stack + page_size );
+
+    if ( not os::commit_memory( bottom, _committed - bottom ) )
+        return false;
+    _committed = const_cast<char *>( bottom );
+    return true;
+}
+
+
+bool Process::handle_stack_fault( void *addr ) {
+    DeltaProcess *p = Processes::find_from_stack_address( (const char *) addr );
+    return p not_eq nullptr and static_cast<Process *>( p )->grow_stack( (const char *) addr );
+}
+
+
+typedef void (switch_stack_func)( void **save_sp, void *new_sp );
+
+
+void Process::switch_stacks( void **save_sp, void *new_sp ) {
+    switch_stack_func *switch_stack = (switch_stack_func *) StubRoutines::switch_stack();
+    switch_stack( save_sp, new_sp );
+}
+
+
+void Process::switch_to( Process *target ) {
+    st_assert( _user_mode and target->_user_mode, "both processes must be switched in user mode" );
+    switch_stacks( &_saved_sp, target->_saved_sp );
+    // we are running again
+    complete_handoff();
+}
+
+
+void Process::complete_handoff() {
+    // The process we came from could not be continued elsewhere before its registers were saved.
+    Process *p = _handoff;
+    if ( p not_eq nullptr ) {
+        _handoff = nullptr;
+        p->hand_off();
+    }
+}
+
+
 VMProcess    *VMProcess::_vm_process   = nullptr;
 VM_Operation *VMProcess::_vm_operation = nullptr;
 
@@ -41,7 +41,12 @@ public:
         _thread{ nullptr },
         _thread_id{ 0 },
         _event{ nullptr },
-        _stack_limit{ nullptr } {
+        _stack_limit{ nullptr },
+        _user_mode{ false },
+        _saved_sp{ nullptr },
+        _stack{ nullptr },
+        _stack_size{ 0 },
+        _committed{ nullptr } {
     }
 
     virtual ~Process() = default;
@@ -92,12 +97,42 @@ public:
     }
 
 
+    // tells whether addr lies in the stack allocated for the process
+    bool stack_contains( const char *addr ) const {
+        return _stack <= addr and addr < _stack + _stack_size;
+    }
+
+
 
 
 protected:
     // transfer to control
     void basic_transfer( Process *target );
 
+    // User-mode switching: the VM process and the Delta processes with stacks of their own all run on the
+    // thread of the VM process (the carrier) and are switched without involving the OS. Only a process in an
+    // asynchronous DLL call continues on an OS thread of its own (see DeltaProcess::transfer_and_continue).
+    static bool use_user_mode_switching();
+
+    void allocate_stack( void entry() );
+
+    void release_stack();
+
+    bool grow_stack( const char *addr );
+
+    static bool handle_stack_fault( void *addr );
+
+    static void switch_stacks( void **save_sp, void *new_sp );
+
+    void switch_to( Process *target );
+
+    // continues a process which has been switched out on a thread of its own (see complete_handoff)
+    virtual void hand_off() {
+    }
+
+
+    static void complete_handoff();
+
     // OS data associated with the process
     Thread         *_thread;            // Native thread
     std::int32_t   _thread_id;          // Native thread id (set by OS when created)
@@ -105,6 +140,15 @@ protected:
     char           *_stack_limit;       // lower limit of stack
     static Process *_current_process;   // active Delta process or vm process
 
+    // User-mode switching
+    bool           _user_mode;          // switched in user mode on the carrier thread
+    void           *_saved_sp;          // stack pointer while switched out (see StubRoutines::generate_switch_stack)
+    char           *_stack;             // stack allocated for the process (nullptr if it runs on the stack of its thread)
+    std::int32_t   _stack_size;         // size of _stack in bytes (reserved)
+    char           *_committed;         // lowest committed address of _stack (the page below is the guard page)
+    static Event   *_carrier_event;     // event of the carrier thread, shared by all user-mode processes
+    static Process *_handoff;           // process to be continued on a thread of its own once switched out
+
 };
 
 
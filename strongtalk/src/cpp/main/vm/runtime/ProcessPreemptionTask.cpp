@@ -13,7 +13,7 @@
 
 void ProcessPreemptionTask::task() {
     if ( EnableProcessPreemption ) {
-        DeltaProcess::preempt_active();
+        DeltaProcess::time_slice_tick();
     }
 }
 
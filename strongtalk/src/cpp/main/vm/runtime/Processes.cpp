@@ -5,6 +5,7 @@
 
 #include "vm/runtime/Process.hpp"
 #include "vm/runtime/Processes.hpp"
+#include "vm/runtime/AsyncDLLPool.hpp"
 #include "vm/code/NativeMethod.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/runtime/StackChunkBuilder.hpp"
@@ -33,7 +34,15 @@ void Processes::add( DeltaProcess *p ) {
 
 DeltaProcess *Processes::find_from_thread_id( std::int32_t id ) {
     for ( DeltaProcess *p = _processList; p; p = p->next() )
-        if ( p->thread_id() == id )
+        if ( p->thread_id() == id or p->dll_thread_id() == id )
+            return p;
+    return nullptr;
+}
+
+
+DeltaProcess *Processes::find_from_stack_address( const char *addr ) {
+    for ( DeltaProcess *p = _processList; p; p = p->next() )
+        if ( p->stack_contains( addr ) )
             return p;
     return nullptr;
 }
@@ -60,11 +69,7 @@ void Processes::verify() {
 
 
 bool Processes::has_completed_async_call() {
-    ALL_PROCESSES( p ) {
-        if ( p->state() == ProcessState::yielded_after_async_dll )
-            return true;
-    }
-    return false;
+    return AsyncDLLPool::has_completed();
 }
 
 
@@ -117,7 +122,10 @@ void Processes::kill_all() {
         DeltaProcess *next = current->next();
         VMProcess::terminate( current );
         current->set_next( nullptr );
-        delete current;
+        // a process still in an asynchronous dll call is deleted by its worker when the call returns
+        if ( not AsyncDLLPool::delete_when_returned( current ) ) {
+            delete current;
+        }
         current = next;
     }
 
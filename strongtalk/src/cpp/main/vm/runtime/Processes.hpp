@@ -27,6 +27,8 @@ public:
 
     static DeltaProcess *find_from_thread_id( std::int32_t id );
 
+    static DeltaProcess *find_from_stack_address( const char *addr );
+
     // Start the vm process
     static void start( VMProcess *p );
 
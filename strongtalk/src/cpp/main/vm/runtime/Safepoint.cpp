@@ -0,0 +1,155 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/runtime/Safepoint.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+#include "vm/runtime/VMProcess.hpp"
+#include "vm/runtime/VMOperation.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/system/ThreadCritical.hpp"
+#include "vm/platform/os.hpp"
+
+#include <algorithm>
+
+
+volatile Safepoint::State Safepoint::_state         = Safepoint::State::not_synchronized;
+volatile std::int32_t     Safepoint::_threads_in_vm = 0;
+Event                     *Safepoint::_end_event    = nullptr;
+
+void (*volatile Safepoint::_requested_operation)() = nullptr;
+double Safepoint::_requested_at = 0.0;
+
+std::int32_t Safepoint::_count                   = 0;
+double       Safepoint::_begin_time              = 0.0;
+double       Safepoint::_total_time_to_safepoint = 0.0;
+double       Safepoint::_max_time_to_safepoint   = 0.0;
+double       Safepoint::_total_time              = 0.0;
+
+
+void Safepoint::begin( double requested_at ) {
+    st_assert( Process::current()->is_vmProcess(), "safepoints are only started in the vm process" );
+    st_assert( not is_active(), "safepoint already in progress" );
+
+    {
+        ThreadCritical tc;
+        _state = State::synchronizing;
+        os::reset_event( _end_event );
+    }
+
+    // Threads leaving native code block in leave_native from now on; wait for the ones
+    // that left it before to get back (they only update process state, so this is short).
+    while ( _threads_in_vm > 0 ) {
+        os::sleep( 0 );
+    }
+    _state = State::synchronized;
+
+    _begin_time = os::elapsedTime();
+    const double time_to_safepoint = requested_at > 0.0 ? _begin_time - requested_at : 0.0;
+    _count++;
+    _total_time_to_safepoint += time_to_safepoint;
+    _max_time_to_safepoint = std::max( _max_time_to_safepoint, time_to_safepoint );
+
+    if ( TraceSafepoints ) {
+        SPDLOG_INFO( "safepoint #{}: reached after {:.3f} ms", _count, time_to_safepoint * 1000.0 );
+    }
+}
+
+
+void Safepoint::end() {
+    st_assert( is_synchronized(), "no safepoint in progress" );
+    _total_time += os::elapsedTime() - _begin_time;
+
+    ThreadCritical tc;
+    _state = State::not_synchronized;
+    os::signal_event( _end_event );
+}
+
+
+void Safepoint::leave_native() {
+    while ( true ) {
+        {
+            ThreadCritical tc;
+            if ( not is_active() ) {
+                _threads_in_vm++;
+                return;
+            }
+        }
+        os::wait_for_event( _end_event );
+    }
+}
+
+
+void Safepoint::enter_native() {
+    ThreadCritical tc;
+    st_assert( _threads_in_vm > 0, "not in vm" );
+    _threads_in_vm--;
+}
+
+
+void Safepoint::request( void operation() ) {
+    ThreadCritical tc;
+    if ( is_requested() )
+        return;
+    _requested_at        = os::elapsedTime();
+    _requested_operation = operation;
+    DeltaProcess::arm_safepoint_poll();
+}
+
+
+class VM_SafepointRequest : public VM_Operation {
+private:
+    void (*_operation)();
+
+public:
+    VM_SafepointRequest( void operation(), double requested_at ) :
+        VM_Operation(),
+        _operation{ operation } {
+        set_requested_at( requested_at );
+    }
+
+
+    void doit() {
+        _operation();
+    }
+
+
+    const char *name() {
+        return "safepoint request";
+    }
+};
+
+
+void Safepoint::run_requested_operation() {
+    void (*operation)();
+    double requested_at;
+    {
+        ThreadCritical tc;
+        operation            = _requested_operation;
+        requested_at         = _requested_at;
+        _requested_operation = nullptr;
+    }
+    DeltaProcess::disarm_safepoint_poll();
+    if ( operation == nullptr )
+        return;
+
+    VM_SafepointRequest op( operation, requested_at );
+    VMProcess::execute( &op );
+}
+
+
+void Safepoint::print_statistics() {
+    SPDLOG_INFO( "safepoints: {}, time to safepoint: {:.3f} ms average, {:.3f} ms max, time in safepoints: {:.3f} ms",
+                 _count,
+                 _count == 0 ? 0.0 : _total_time_to_safepoint * 1000.0 / _count,
+                 _max_time_to_safepoint * 1000.0,
+                 _total_time * 1000.0 );
+}
+
+
+void safepoint_init() {
+    SPDLOG_INFO( "system-init:  safepoint_init" );
+
+    Safepoint::_end_event = os::create_event( true );
+}
@@ -0,0 +1,107 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+
+
+class Event;
+
+// A safepoint stops every thread that might touch the heap, so that VM operations
+// (scavenges, full GCs, deoptimization, code zone compaction) see a consistent system.
+//
+// Delta code only runs on the VM thread (see Process::switch_to), and it only stops at
+// the polls at method entries and loop back-edges: the active stack limit is raised above
+// any stack address to arm them (see DeltaProcess::arm_safepoint_poll). A VM operation
+// asked for by a Delta process runs at the call doing so, which is a safepoint as well;
+// threads that do not run Delta code (e.g. the timer thread) use request() to have an
+// operation run at the next poll.
+//
+// All other threads (the threads continuing asynchronous dll calls) are in native code
+// and never touch the heap there. When leaving native code they wait for a safepoint in
+// progress to end before touching any VM state (leave_native/enter_native).
+
+class Safepoint : AllStatic {
+
+private:
+    enum class State {
+        not_synchronized,       //
+        synchronizing,          // waiting for threads to leave the VM
+        synchronized            // all threads are stopped
+    };
+
+    static volatile State        _state;
+    static volatile std::int32_t _threads_in_vm;         // threads other than the VM thread currently outside native code
+    static Event                 *_end_event;            // signalled while no safepoint is in progress
+
+    static void (*volatile _requested_operation)();     // operation to be run at the next poll, or nullptr
+    static double                _requested_at;          // time of the pending request
+
+    // Statistics
+    static std::int32_t _count;
+    static double       _begin_time;
+    static double       _total_time_to_safepoint;
+    static double       _max_time_to_safepoint;
+    static double       _total_time;
+
+    friend void safepoint_init();
+
+public:
+    // Bracket a VM operation, called in the VM process. requested_at is the time the
+    // operation was asked for, so that the time to reach the safepoint can be recorded.
+    static void begin( double requested_at );
+
+    static void end();
+
+
+    static bool is_synchronizing() {
+        return _state == State::synchronizing;
+    }
+
+
+    static bool is_synchronized() {
+        return _state == State::synchronized;
+    }
+
+
+    static bool is_active() {
+        return _state not_eq State::not_synchronized;
+    }
+
+
+    // Threads other than the VM thread leaving/entering native code
+    static void leave_native();
+
+    static void enter_native();
+
+    // Operations requested by threads not running Delta code, run in the VM process at the next poll
+    static void request( void operation() );
+
+
+    static bool is_requested() {
+        return _requested_operation not_eq nullptr;
+    }
+
+
+    static void run_requested_operation();   // called by the active process at a poll
+
+    static void print_statistics();
+};
+
+
+// RAII helper bracketing VM state changes of a thread that otherwise runs native code
+class ThreadInVM : StackAllocatedObject {
+public:
+    ThreadInVM() {
+        Safepoint::leave_native();
+    }
+
+
+    ~ThreadInVM() {
+        Safepoint::enter_native();
+    }
+};
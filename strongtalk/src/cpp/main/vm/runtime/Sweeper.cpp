@@ -7,11 +7,13 @@
 #include "vm/runtime/Timer.hpp"
 #include "vm/runtime/PeriodicTask.hpp"
 #include "vm/runtime/DeltaProcess.hpp"
+#include "vm/runtime/Safepoint.hpp"
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/oop/MixinOopDescriptor.hpp"
 #include "vm/oop/ObjectArrayOopDescriptor.hpp"
 #include "vm/utility/EventLog.hpp"
 #include "vm/runtime/ResourceMark.hpp"
+#include "vm/platform/os.hpp"
 
 
 // The sweeper run at real_time ticks. We only swep if the interrupted
@@ -120,22 +122,31 @@ void HeapSweeper::task() {
 
 // ---------------- CodeSweeper -----------------
 
-void CodeSweeper::updateInterval() {
-    if ( _oldHalfLifeTime not_eq CounterHalfLifeTime ) {
-        _oldHalfLifeTime     = CounterHalfLifeTime;
-        _codeSweeperInterval = 4;            // for now, use fixed value; could adjust if necessary
-        _fractionPerTask     = 8;
-        const double log2 = 0.69314718055995;   // log(2)
-        _decayFactor = exp( log2 * _codeSweeperInterval * _fractionPerTask / CounterHalfLifeTime );
-        if ( PrintCodeSweep ) {
-            SPDLOG_INFO( "*method sweep: decay factor %f", _decayFactor );
-        }
-    }
+CodeSweeper::CodeSweeper() :
+    _codeSweeperInterval{ 4 },    // for now, use fixed values; could adjust if necessary
+    _decayFactor{ 1 },
+    _lastSweepTime{ os::elapsedTime() },
+    _fractionPerTask{ 8 } {
+}
+
+
+double CodeSweeper::secondsSinceLastSweep() {
+    double now     = os::elapsedTime();
+    double elapsed = now - _lastSweepTime;
+    _lastSweepTime = now;
+    return elapsed;
+}
+
+
+double CodeSweeper::decay_factor( std::int32_t halfLifeTime, double elapsed ) {
+    if ( halfLifeTime <= 0 or elapsed <= 0.0 )
+        return 1.0;    // no decay
+    const double log2 = 0.69314718055995;   // log(2)
+    return exp( log2 * elapsed / halfLifeTime );
 }
 
 
 std::int32_t CodeSweeper::interval() const {
-    ( (CodeSweeper *) this )->updateInterval();
     return _codeSweeperInterval;
 }
 
@@ -240,7 +251,11 @@ void MethodSweeper::task() {
 
 
 void MethodSweeper::activate() {
-    _index = 1;
+    _index       = 1;
+    _decayFactor = decay_factor( CounterHalfLifeTime, secondsSinceLastSweep() );
+    if ( PrintCodeSweep ) {
+        SPDLOG_INFO( "*method sweep: decay factor {:f}", _decayFactor );
+    }
     Sweeper::activate();
 }
 
@@ -248,7 +263,7 @@ void MethodSweeper::activate() {
 
 void ZoneSweeper::nativeMethod_task( NativeMethod *nm ) {
     if ( nm not_eq Sweeper::active_nativeMethod() ) {
-        nm->sweeper_step( _decayFactor );
+        nm->sweeper_step( _decayFactor, _trapDecayFactor );
     } else {
         // Save the NativeMethod for next round
         set_excluded_nativeMethod( Sweeper::active_nativeMethod() );
@@ -289,7 +304,33 @@ void ZoneSweeper::task() {
 }
 
 
+static ZoneSweeper *zoneSweeper;
+
+
+void ZoneSweeper::compaction_step() {
+    // compact between sweeps only, so that next stays valid
+    if ( not zoneSweeper->is_active() ) {
+        Universe::code->compactStep();
+    }
+}
+
+
+void ZoneSweeper::step() {
+    Sweeper::step();
+    // nativeMethods are moved at a safepoint only, never under a running process
+    if ( not is_active() ) {
+        Safepoint::request( &compaction_step );
+    }
+}
+
+
 void ZoneSweeper::activate() {
+    const double elapsed = secondsSinceLastSweep();
+    _decayFactor     = decay_factor( NativeMethodCounterHalfLifeTime, elapsed );
+    _trapDecayFactor = decay_factor( UncommonTrapCounterHalfLifeTime, elapsed );
+    if ( PrintCodeSweep ) {
+        SPDLOG_INFO( "*zone sweep: decay factors {:f} (invocations), {:f} (uncommon traps)", _decayFactor, _trapDecayFactor );
+    }
     if ( Universe::code->numberOfNativeMethods() > 0 ) {
         next                   = Universe::code->first_nm();
         _excluded_nativeMethod = nullptr;
@@ -337,7 +378,7 @@ void sweeper_init() {
     SPDLOG_INFO( "system-init:  sweeper_init" );
 
     Sweeper::add( new HeapSweeper() );
-    Sweeper::add( new ZoneSweeper() );
+    Sweeper::add( zoneSweeper = new ZoneSweeper() );
     Sweeper::add( methodSweeper = new MethodSweeper() );
 
     if ( SweeperUseTimer ) {
@@ -143,17 +143,20 @@ public:
 
 class CodeSweeper : public Sweeper {
 protected:
-    std::int32_t _codeSweeperInterval;    // time interval (sec) between starting zone sweep; computed from half-life time
-    double       _decayFactor;            // decay factor for invocation counts
-    std::int32_t _oldHalfLifeTime;        // old half-life time (to detect changes in half-life setting)
+    std::int32_t _codeSweeperInterval;    // time interval (sec) between starting zone sweep
+    double       _decayFactor;            // decay factor for invocation counts during the current sweep
+    double       _lastSweepTime;          // elapsed time (sec) at the start of the previous sweep
     std::int32_t _fractionPerTask;        // a task invocation does (1 / fractionPerTask) of the entire work
 
-    void updateInterval();          // check for change in half-life setting
+    // Every counter is visited once per sweep, so it is decayed by the time elapsed since the previous sweep started
+    // (rather than by the number of sweeper ticks, which are skipped while idle or in the middle of a C call).
+    // This makes the counters rates: a count of n means about n * ln(2) / half-life invocations per second recently.
+    double secondsSinceLastSweep();
 
-public:
-    CodeSweeper() : _codeSweeperInterval( 1 ), _decayFactor( 1 ), _oldHalfLifeTime( -1 ), _fractionPerTask( -1 ) {
+    static double decay_factor( std::int32_t halfLifeTime, double elapsed );
 
-    }
+public:
+    CodeSweeper();
 
     virtual ~CodeSweeper() {}
 
@@ -215,6 +218,7 @@ class ZoneSweeper : public CodeSweeper {
 private:
     NativeMethod *_excluded_nativeMethod;
     NativeMethod *next;
+    double       _trapDecayFactor;          // decay factor for uncommon trap counts during the current sweep
 
 private:
     NativeMethod *excluded_nativeMethod() {
@@ -229,10 +233,14 @@ private:
 
     void nativeMethod_task( NativeMethod *nm );
 
+    void step();
+
     void task();
 
     void activate();
 
+    static void compaction_step();   // run at a safepoint (see step)
+
 
     const char *name() const {
         return "ZoneSweeper";
@@ -242,7 +250,8 @@ private:
 public:
     ZoneSweeper() :
         _excluded_nativeMethod{ nullptr },
-        next{ nullptr } {
+        next{ nullptr },
+        _trapDecayFactor{ 1 } {
     }
 
     virtual ~ZoneSweeper() = default;
@@ -26,10 +26,12 @@ class VM_Operation : public PrintableStackAllocatedObject {
 
 private:
     DeltaProcess *_calling_process;
+    double       _requested_at;     // elapsed time at which the operation was asked for (see Safepoint)
 
 public:
     VM_Operation() :
-        _calling_process{ nullptr } {
+        _calling_process{ nullptr },
+        _requested_at{ 0.0 } {
     }
 
 
@@ -49,6 +51,16 @@ public:
     }
 
 
+    void set_requested_at( double t ) {
+        _requested_at = t;
+    }
+
+
+    double requested_at() const {
+        return _requested_at;
+    }
+
+
     virtual bool is_scavenge() const {
         return false;
     }
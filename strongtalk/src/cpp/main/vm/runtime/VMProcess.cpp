@@ -11,6 +11,8 @@
 #include "vm/oop/KlassOopDescriptor.hpp"
 #include "vm/runtime/VMOperation.hpp"
 #include "vm/runtime/Sweeper.hpp"
+#include "vm/runtime/Safepoint.hpp"
+#include "vm/runtime/AsyncDLLPool.hpp"
 #include "vm/memory/OopFactory.hpp"
 
 
@@ -24,6 +26,13 @@ VMProcess::VMProcess() {
 
     _thread = os::starting_thread( &_thread_id );
     _event  = os::create_event( true );
+
+    // the thread of the VM process carries all user-mode processes
+    _user_mode = use_user_mode_switching();
+    if ( _user_mode ) {
+        _carrier_event = _event;
+        os::add_stack_fault_handler( &handle_stack_fault );
+    }
 }
 
 
@@ -48,13 +57,26 @@ void VMProcess::terminate( DeltaProcess *proc ) {
 
     st_assert( Process::current()->is_vmProcess(), "can only be called from vm process" );
     st_assert( proc->is_deltaProcess(), "must be deltaProcess" );
-    st_assert( proc->_thread, "thread must be present" );
     st_assert( proc->_event, "event must be present" );
 
-    os::terminate_thread( proc->_thread );
-    proc->_thread = nullptr;
-    os::delete_event( proc->_event );
-    proc->_event = nullptr;
+    const bool stack_in_use = AsyncDLLPool::terminated( proc );
+
+    if ( proc->_user_mode ) {
+        // We are running on the carrier thread, so the stack of the process is not in use by it any more, but
+        // it may be by a worker still running an asynchronous dll call of the process; that worker releases
+        // the stack when the call returns. The event is the carrier's.
+        if ( not stack_in_use ) {
+            proc->release_stack();
+        }
+        proc->_thread = nullptr;
+        proc->_event  = nullptr;
+    } else {
+        st_assert( proc->_thread, "thread must be present" );
+        os::terminate_thread( proc->_thread );
+        proc->_thread = nullptr;
+        os::delete_event( proc->_event );
+        proc->_event = nullptr;
+    }
 
     DeltaProcess::set_terminating_process( proc->state() );
 }
@@ -90,7 +112,9 @@ void VMProcess::loop() {
 
     while ( true ) {
         st_assert( vm_operation(), "A VM_Operation should be present" );
+        Safepoint::begin( vm_operation()->requested_at() );
         vm_operation()->evaluate();
+        Safepoint::end();
 
         // if the process's thread is dead then the stack may already be released
         // in which case the vm_operation is no longer valid, so check for a
@@ -119,6 +143,9 @@ void VMProcess::execute( VM_Operation *op ) {
         op->evaluate();
     } else {
         op->set_calling_process( DeltaProcess::active() );
+        if ( op->requested_at() == 0.0 ) {
+            op->set_requested_at( os::elapsedTime() );
+        }
         _vm_operation = op;
         // Suspend currentProcess and resume vmProcess
         DeltaProcess::active()->transfer_to_vm();
@@ -111,6 +111,8 @@ public:
     develop( CompiledCodeOnly,                    false, "Use compiled code only"                                                      ) \
     develop( UseRecompilation,                     true, "Automatically (re-)compile frequently-used methods"                          ) \
     develop( UseNativeMethodAging,                 true, "Age nativeMethods before recompiling them"                                   ) \
+    develop( UseIncrementalCodeCompaction,         true, "Evacuate sparse code cache regions a few nativeMethods at a time"            ) \
+    develop( UseCodeEviction,                      true, "Evict the nativeMethods least worth keeping when the code cache is full"     ) \
     develop( UseInlineCaching,                     true, "Use inline caching in compiled code"                                         ) \
     develop( EnableTasks,                          true, "Enable periodic tasks to be performed"                                       ) \
     develop( CompressProgramCounterDescriptors,    true, "ScopeDescriptorRecorder: Compress ProgramCounterDescriptors by ignoring multiple entries at same offset" ) \
@@ -132,6 +134,12 @@ public:
     develop( UseTimers,                            true, "Tells whether the VM should use timers (only used at startup)"               ) \
     develop( SweeperUseTimer,                      true, "Tells whether the sweeper should use timer interrupts or compile events"     ) \
     develop( EnableProcessPreemption,             false, "Enables or disables preemption of running Smalltalk processes"               ) \
+    develop( ProcessTimeSlice,                       10, "Time slice (in ms) of a preemptable Smalltalk process"                       ) \
+    develop( AsyncDLLPoolSize,                        8, "Max. number of threads running asynchronous dll calls"                       ) \
+    develop( IOPollerEventsPerWait,                 256, "Max. number of ready file descriptors taken per wait of the I/O poller"       ) \
+    develop( UseUserModeProcessSwitching,          true, "Switch Delta processes in user mode on the VM thread"                        ) \
+    develop( TraceSafepoints,                     false, "Trace the time taken to reach each safepoint"                                ) \
+    develop( PrintSafepointStatistics,            false, "Print safepoint statistics at exit"                                          ) \
  \
  \
     develop( GenTraceCalls,                       false, "Generate code for TraceCalls"                                                ) \
@@ -187,6 +195,10 @@ public:
     develop( PrintInliningDatabaseCompilation,    false, "Print inlining database compilations?"                                       ) \
  \
     develop( CountBytecodes,                      false, "Count number of bytecodes executed"                                          ) \
+    develop( CountBytecodePairs,                  false, "Count pairs of dispatched bytecodes (printed at exit)"                       ) \
+    develop( UseSuperinstructions,                 true, "Rewrite frequent bytecode pairs into superinstructions"                      ) \
+    develop( ProfileBranches,                      true, "Count the outcome of conditional jumps in the interpreter"                   ) \
+    develop( UseQuickPrimitiveCalls,               true, "Rewrite calls of frequent primitives into quick forms with fast paths"       ) \
  \
     develop( ProfilerShowMethodHolder,             true, "Show method holder for method"                                               ) \
  \
@@ -201,6 +213,7 @@ public:
     develop( PrintCodeReclamation,                false, "Print code reclamation"                                                      ) \
     develop( PrintCodeSweep,                      false, "Print sweeps through zone/methods"                                           ) \
     develop( PrintCodeCompaction,                 false, "Print code compaction"                                                       ) \
+    develop( PrintCodeEviction,                   false, "Print code cache evictions"                                                  ) \
     develop( PrintMethodFlushing,                 false, "Print method flushing"                                                       ) \
     develop( MakeBlockMethodZombies,              false, "Make block NativeMethod zombies if needed"                                   ) \
  \
@@ -258,6 +271,7 @@ public:
     develop( PrintMakeConformantCode,             false, "Print code generated by makeConformant"                                      ) \
     develop( CreateScopeDescInfo,                  true, "Create ScopeDescriptor info for new backend code"                            ) \
     develop( GenerateFullDebugInfo,               false, "Generate debugging info for each byte code and not only for sends/traps"     ) \
+    develop( GenerateLoopSafepoints,               true, "Poll for preemption at loop back-edges in compiled code"                     ) \
     develop( UseNewMakeConformant,                 true, "Use new makeConformant function"                                             ) \
 
 
@@ -266,6 +280,10 @@ public:
     develop( EventLogLength,                       1000, "Length of internal event log"                                                ) \
     develop( StackPrintLimit,                        64, "Number of stack frames to print in VM-level stack dump"                      ) \
     develop( MaxElementPrintSize,                    64, "Maximum number of elements to print"                                         ) \
+    develop( StringHashVersion,                       0, "String hash: 1 sampled, 2 full contents, 0 as in image"                      ) \
+    develop( UseSIMDStringKernels,                 true, "Use the SSE2/AVX2 string kernels if supported"                               ) \
+    develop( UseSIMDDigitKernels,                  true, "Use the carry flag/SSE2 digit kernels of IntegerOps if supported"            ) \
+    develop( UseSIMDDoubleKernels,                 true, "Use the SSE2/AVX kernels of the DoubleValueArray primitives if supported"    ) \
  \
     develop( ReservedHeapSize,                  50*1024, "Maximum size for object heap in Kbytes"                                      ) \
     develop( ObjectHeapExpandSize,                  512, "Chunk size (in Kbytes) by which the object heap grows"                       ) \
@@ -274,10 +292,16 @@ public:
     develop( OldSize,                            3*1024, "initial size of oldspace (in Kbytes)"                                        ) \
     develop( ReservedCodeSize,                  10*1024, "Maximum size of code cache (in Kbytes)"                                      ) \
     develop( CodeSize,                          20*1024, "size of code cache (in Kbytes)"                                              ) \
+    develop( CodeRegionSize,                         64, "size (in Kbytes) of code cache regions for incremental compaction"           ) \
+    develop( CodeCompactionStepSize,                 16, "max. Kbytes moved per incremental code compaction step"                      ) \
+    develop( CodeCompactionMaxOccupancy,             50, "(in %) only evacuate code cache regions less occupied than this"             ) \
+    develop( CodeEvictionFraction,                   10, "(in %) min. fraction of the code cache freed when evicting"                  ) \
+    develop( CodeEvictionBackoffWindow,            1000, "back off eviction of methods recompiled within this many compilations"       ) \
     develop( ReservedPICSize,                    4*1024, "Maximum size of PolymorphicInlineCache cache (in Kbytes)"                    ) \
     develop( PICSize,                               128, "size of PolymorphicInlineCache cache (in Kbytes)"                            ) \
-    develop( JumpTableSize,                      8*1024, "size of jump table"                                                          ) \
+    develop( JumpTableSize,                      8*1024, "size of jump table blocks (the table grows by this many entries)"            ) \
     develop( ThreadStackSize,                       512, "Size (in 1024) of each thread's stack"                                       ) \
+    develop( ProcessStackCommitSize,                 16, "Size (in 1024) of process stack committed initially and per growth"          ) \
  \
     develop( CompilerInstrsSize,                50*1024, "max. size of NativeMethod instrs"                                            ) \
     develop( CompilerScopesSize,                50*1024, "max. size of debugging info per NativeMethod"                                ) \
@@ -299,13 +323,17 @@ public:
     develop( MaxRecursionUnroll,                      2, "max. unrolling depth of recursive methods"                                   ) \
     develop( MaxTypeCaseSize,                         3, "max. number of types in typecase-based inlining"                             ) \
     develop( UncommonRecompileLimit,                  5, "min. number of uncommon traps before recompiling"                            ) \
+    develop( ColdBranchLimit,                       100, "min. executions of a conditional jump before a never-taken branch is uncommon" ) \
+    develop( BranchProfileClaimLimit,                16, "min. misses of a branch profile entry before another jump takes it over"    ) \
     develop( UncommonInvocationLimit,             10000, "min. number of invocations uncommon NativeMethod before recompiling it again"      ) \
     develop( UncommonAgeBackoffFactor,                4, "for exponential back-off of UncommonAgeLimit based on NativeMethod version"  ) \
     develop( MinInvocationsBeforeTrust,             100, "min. number of invocations required before trusting NativeMethod's PICs"             ) \
     develop( NativeMethodAgeLimit,                    2, "min. number of sweeps before NativeMethod becomes old"                              ) \
     develop( MaxRecompilationSearchLength,           10, "max. number of real stack frames to traverse searching for recompilee"            ) \
     develop( MaxInterpretedSearchLength,             10, "max. number of interpreted stack frames to traverse searching for recompilee"     ) \
-    develop( CounterHalfLifeTime,                    30, "time (in seconds) in which invocation counters decay by half"                ) \
+    develop( CounterHalfLifeTime,                    30, "time (in seconds) in which method invocation counters decay by half (0 = never)" ) \
+    develop( NativeMethodCounterHalfLifeTime,        30, "time (in seconds) in which NativeMethod invocation counters decay by half (0 = never)" ) \
+    develop( UncommonTrapCounterHalfLifeTime,        30, "time (in seconds) in which uncommon trap counters decay by half (0 = never)" ) \
     develop( MaxCustomization,                       10, "max. number of customized method copies to create"                                   ) \
  \
     develop( StopInterpreterAt,                       0, "Stops interpreter execution at specified bytecode number"                    ) \
@@ -9,6 +9,8 @@
 #include "vm/runtime/init.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/utility/Console.hpp"
+#include "vm/interpreter/InterpreterStatistics.hpp"
+#include "vm/runtime/Safepoint.hpp"
 
 
 void init_globals() {
@@ -23,6 +25,9 @@ void init_globals() {
     primitives_init();
     eventlog_init();
     bytecodes_init();
+    stringKernels_init();
+    digitKernels_init();
+    doubleKernels_init();
     universe_init();
 
     //
@@ -34,6 +39,9 @@ void init_globals() {
     fprofiler_init();
     systemAverage_init();
     preemption_init();
+    safepoint_init();
+    asyncDLLPool_init();
+    ioPoller_init();
     generatedPrimitives_init_after_interpreter();
 
     // compiler
@@ -55,6 +63,14 @@ void exit_globals() {
 
     destructorsCalled = true;
 
+    if ( CountBytecodePairs ) {
+        InterpreterStatistics::print_bytecode_pairs( 50 );
+    }
+
+    if ( PrintSafepointStatistics ) {
+        Safepoint::print_statistics();
+    }
+
     lprintf_exit();
     os_exit();
 
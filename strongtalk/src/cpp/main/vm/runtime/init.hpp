@@ -32,6 +32,12 @@ void eventlog_init();
 
 void bytecodes_init();
 
+void stringKernels_init();
+
+void digitKernels_init();
+
+void doubleKernels_init();
+
 void universe_init();
 
 void generatedPrimitives_init_before_interpreter();
@@ -50,6 +56,12 @@ void systemAverage_init();
 
 void preemption_init();
 
+void safepoint_init();
+
+void asyncDLLPool_init();
+
+void ioPoller_init();
+
 void generatedPrimitives_init_after_interpreter();
 
 //
@@ -155,6 +155,7 @@ dll_func_ptr_t DLLs::lookup_and_patch_Compiled_DLLCache() {
 void DLLs::enter_async_call( DeltaProcess **addr ) {
     DeltaProcess *proc = DeltaProcess::active();
     *addr = proc; // proc will be retrieved in dll_enter_async_call
+    proc->enter_async_dll_call();
     proc->resetStepping();
     proc->transfer_and_continue();
 }
@@ -162,11 +163,19 @@ void DLLs::enter_async_call( DeltaProcess **addr ) {
 
 void DLLs::exit_async_call( DeltaProcess **addr ) {
     DeltaProcess *proc = *addr;
+    proc->exit_async_dll_call();
     proc->wait_for_control();
     proc->applyStepping();
 }
 
 
+void DLLs::enter_call_back( DeltaProcess **addr ) {
+    DeltaProcess *proc = *addr;
+    proc->wait_for_control( false );
+    proc->applyStepping();
+}
+
+
 void DLLs::exit_sync_call( DeltaProcess **addr ) {
     st_unused( addr ); // unused
     // nothing to do here for now
@@ -139,6 +139,7 @@ public:
     static void enter_async_call( DeltaProcess **addr );    // called before each asynchronous DLL call
     static void exit_async_call( DeltaProcess **addr );    // called after each asynchronous DLL call
     static void exit_sync_call( DeltaProcess **addr );    // called after each synchronous DLL call
+    static void enter_call_back( DeltaProcess **addr );    // called when an asynchronous DLL call calls back into Delta
 };
 
 
@@ -0,0 +1,503 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/utility/DigitKernels.hpp"
+#include "vm/utility/IntegerOps.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/memory/util.hpp"
+#include "vm/runtime/init.hpp"
+
+#include <cstring>
+
+#if defined( __i386__ ) or defined( __x86_64__ ) or defined( _M_IX86 ) or defined( _M_X64 )
+#define DIGIT_KERNELS_X86
+#include <immintrin.h>
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+#endif
+
+#if defined( __x86_64__ ) or defined( _M_X64 )
+#define DIGIT_KERNELS_X86_64
+#if defined( __SIZEOF_INT128__ )
+#define DIGIT_KERNELS_INT128
+typedef unsigned __int128 QuadDigit;
+#endif
+#endif
+
+// The SIMD kernels are compiled for their instruction set regardless of the flags the rest of
+// the vm is compiled with; they are only called if the processor supports them.
+#if defined( __GNUC__ )
+#define TARGET_SSE2 __attribute__(( target( "sse2" ) ))
+#else
+#define TARGET_SSE2
+#endif
+
+
+// -----------------------------------------------------------------------------
+// scalar: one digit per step
+
+static Digit scalar_add_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n ) {
+    Digit c = 0;
+    for ( std::int32_t i = 0; i < n; i++ )
+        z[ i ] = IntegerOps::xpy( x[ i ], y[ i ], c );
+    return c;
+}
+
+
+static Digit scalar_sub_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n ) {
+    Digit c = 0;
+    for ( std::int32_t i = 0; i < n; i++ )
+        z[ i ] = IntegerOps::xmy( x[ i ], y[ i ], c );
+    return c;
+}
+
+
+static Digit scalar_mul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    Digit c = 0;
+    for ( std::int32_t i = 0; i < n; i++ )
+        z[ i ] = IntegerOps::axpy( a, x[ i ], 0, c );
+    return c;
+}
+
+
+static Digit scalar_addmul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    Digit c = 0;
+    for ( std::int32_t i = 0; i < n; i++ )
+        z[ i ] = IntegerOps::axpy( a, x[ i ], z[ i ], c );
+    return c;
+}
+
+
+static Digit scalar_submul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    Digit c      = 0;
+    Digit borrow = 0;
+    for ( std::int32_t i = 0; i < n; i++ ) {
+        Digit p = IntegerOps::axpy( a, x[ i ], 0, c );
+        z[ i ] = IntegerOps::xmy( z[ i ], p, borrow );
+    }
+    // c + borrow < B, since the product digit p is 0 if c = B - 1
+    return c + borrow;
+}
+
+
+static Digit scalar_divrem_1( Digit *q, const Digit *x, std::int32_t n, Digit d ) {
+    Digit c = 0;
+    for ( std::int32_t i = n - 1; i >= 0; i-- )
+        q[ i ] = IntegerOps::xdy( x[ i ], d, c );
+    return c;
+}
+
+
+// -----------------------------------------------------------------------------
+// wide: carry flag additions, 64 x 32 bit products and division by a reciprocal
+
+#ifdef DIGIT_KERNELS_X86_64
+
+// two digits as one 64 bit word (little endian)
+static inline std::uint64_t load_pair( const Digit *p ) {
+    std::uint64_t w;
+    std::memcpy( &w, p, sizeof( w ) );
+    return w;
+}
+
+
+static inline void store_pair( Digit *p, std::uint64_t w ) {
+    std::memcpy( p, &w, sizeof( w ) );
+}
+
+#endif
+
+
+static Digit wide_add_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n ) {
+#ifdef DIGIT_KERNELS_X86
+    unsigned char c = 0;
+    std::int32_t  i = 0;
+#ifdef DIGIT_KERNELS_X86_64
+    for ( ; i + 2 <= n; i += 2 ) {
+        unsigned long long s;
+        c = _addcarry_u64( c, load_pair( x + i ), load_pair( y + i ), &s );
+        store_pair( z + i, s );
+    }
+#endif
+    for ( ; i < n; i++ ) {
+        unsigned int s;
+        c = _addcarry_u32( c, x[ i ], y[ i ], &s );
+        z[ i ] = s;
+    }
+    return c;
+#else
+    return scalar_add_n( z, x, y, n );
+#endif
+}
+
+
+static Digit wide_sub_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n ) {
+#ifdef DIGIT_KERNELS_X86
+    unsigned char c = 0;
+    std::int32_t  i = 0;
+#ifdef DIGIT_KERNELS_X86_64
+    for ( ; i + 2 <= n; i += 2 ) {
+        unsigned long long s;
+        c = _subborrow_u64( c, load_pair( x + i ), load_pair( y + i ), &s );
+        store_pair( z + i, s );
+    }
+#endif
+    for ( ; i < n; i++ ) {
+        unsigned int s;
+        c = _subborrow_u32( c, x[ i ], y[ i ], &s );
+        z[ i ] = s;
+    }
+    return c;
+#else
+    return scalar_sub_n( z, x, y, n );
+#endif
+}
+
+
+// On 32 bit hosts the 32 x 32 bit multiplication of the scalar kernels is the widest there is.
+
+static Digit wide_mul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    std::int32_t i = 0;
+    DoubleDigit  c = 0;
+#ifdef DIGIT_KERNELS_INT128
+    for ( ; i + 2 <= n; i += 2 ) {
+        QuadDigit p = QuadDigit( load_pair( x + i ) ) * a + c;
+        store_pair( z + i, std::uint64_t( p ) );
+        c = DoubleDigit( p >> 64 );
+    }
+#endif
+    for ( ; i < n; i++ ) {
+        DoubleDigit p = DoubleDigit( x[ i ] ) * a + c;
+        z[ i ] = Digit( p );
+        c = p >> logB;
+    }
+    return Digit( c );
+}
+
+
+static Digit wide_addmul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    std::int32_t i = 0;
+    DoubleDigit  c = 0;
+#ifdef DIGIT_KERNELS_INT128
+    for ( ; i + 2 <= n; i += 2 ) {
+        // (B^2 - 1) * (B - 1) + 2 * (B^2 - 1) < B^3, the carry is a single digit
+        QuadDigit p = QuadDigit( load_pair( x + i ) ) * a + load_pair( z + i ) + c;
+        store_pair( z + i, std::uint64_t( p ) );
+        c = DoubleDigit( p >> 64 );
+    }
+#endif
+    for ( ; i < n; i++ ) {
+        DoubleDigit p = DoubleDigit( x[ i ] ) * a + z[ i ] + c;
+        z[ i ] = Digit( p );
+        c = p >> logB;
+    }
+    return Digit( c );
+}
+
+
+static Digit wide_submul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    std::int32_t i = 0;
+    DoubleDigit  c = 0;
+#ifdef DIGIT_KERNELS_INT128
+    for ( ; i + 2 <= n; i += 2 ) {
+        QuadDigit     p  = QuadDigit( load_pair( x + i ) ) * a + c;
+        std::uint64_t lo = std::uint64_t( p );
+        std::uint64_t zw = load_pair( z + i );
+        store_pair( z + i, zw - lo );
+        c = DoubleDigit( p >> 64 ) + ( zw < lo );
+    }
+#endif
+    for ( ; i < n; i++ ) {
+        DoubleDigit p  = DoubleDigit( x[ i ] ) * a + c;
+        Digit       lo = Digit( p );
+        Digit       zi = z[ i ];
+        z[ i ] = zi - lo;
+        c = ( p >> logB ) + ( zi < lo );
+    }
+    return Digit( c );
+}
+
+
+static inline std::int32_t leading_zeros( Digit d ) {
+#if defined( _MSC_VER )
+    unsigned long index;
+    _BitScanReverse( &index, d );
+    return logB - 1 - static_cast<std::int32_t>( index );
+#else
+    return __builtin_clz( d );
+#endif
+}
+
+
+// The division of a two digit number by a normalized divisor d (the most significant bit is set)
+// with the reciprocal v = (B^2 - 1) div d - B, after Moller and Granlund, "Improved division by
+// invariant integers" (2011): two multiplications per quotient digit instead of a division, which
+// on 32 bit hosts is a library call for DoubleDigit operands.
+
+static inline Digit reciprocal( Digit d ) {
+    // B^2 - 1 - d*B = ~(d*B)
+    return Digit( ~( DoubleDigit( d ) << logB ) / d );
+}
+
+
+// returns (u1*B + u0) div d and sets r := (u1*B + u0) mod d, for u1 < d
+static inline Digit divide_by_reciprocal( Digit u1, Digit u0, Digit d, Digit v, Digit &r ) {
+    DoubleDigit q  = DoubleDigit( v ) * u1 + ( ( DoubleDigit( u1 ) << logB ) | u0 );
+    Digit       q1 = Digit( q >> logB ) + 1;
+    Digit       q0 = Digit( q );
+    Digit       rr = u0 - q1 * d;
+    // q1 is one too large about half of the time, which a branch would mispredict
+    Digit       mask = -Digit( rr > q0 );
+    q1 += mask;
+    rr += mask & d;
+    if ( rr >= d ) {
+        q1++;
+        rr -= d;
+    }
+    r = rr;
+    return q1;
+}
+
+
+static Digit wide_divrem_1( Digit *q, const Digit *x, std::int32_t n, Digit d ) {
+    st_assert( d not_eq 0, "division by zero" );
+    if ( n == 0 )
+        return 0;
+
+    // divide x * 2^s by d * 2^s, which has the same quotient and the remainder shifted by s
+    const std::int32_t s  = leading_zeros( d );
+    const Digit        dn = d << s;
+    const Digit        v  = reciprocal( dn );
+    Digit              r  = 0;
+    if ( s == 0 ) {
+        for ( std::int32_t i = n - 1; i >= 0; i-- )
+            q[ i ] = divide_by_reciprocal( r, x[ i ], dn, v, r );
+        return r;
+    }
+
+    Digit hi = x[ n - 1 ];
+    r = hi >> ( logB - s );
+    for ( std::int32_t i = n - 1; i > 0; i-- ) {
+        Digit lo = x[ i - 1 ];
+        q[ i ] = divide_by_reciprocal( r, ( hi << s ) | ( lo >> ( logB - s ) ), dn, v, r );
+        hi = lo;
+    }
+    q[ 0 ] = divide_by_reciprocal( r, hi << s, dn, v, r );
+    return r >> s;
+}
+
+
+// the kernels of one level
+struct DigitKernelTable {
+    Digit (*add_n)( Digit *z, const Digit *x, const Digit *y, std::int32_t n );
+    Digit (*sub_n)( Digit *z, const Digit *x, const Digit *y, std::int32_t n );
+    Digit (*mul_1)( Digit *z, const Digit *x, std::int32_t n, Digit a );
+    Digit (*addmul_1)( Digit *z, const Digit *x, std::int32_t n, Digit a );
+    Digit (*submul_1)( Digit *z, const Digit *x, std::int32_t n, Digit a );
+    Digit (*divrem_1)( Digit *q, const Digit *x, std::int32_t n, Digit d );
+};
+
+
+static const DigitKernelTable scalar_kernels = {
+    &scalar_add_n,
+    &scalar_sub_n,
+    &scalar_mul_1,
+    &scalar_addmul_1,
+    &scalar_submul_1,
+    &scalar_divrem_1,
+};
+
+
+static const DigitKernelTable wide_kernels = {
+    &wide_add_n,
+    &wide_sub_n,
+    &wide_mul_1,
+    &wide_addmul_1,
+    &wide_submul_1,
+    &wide_divrem_1,
+};
+
+
+#ifdef DIGIT_KERNELS_X86
+
+// -----------------------------------------------------------------------------
+// SSE2: the products of four digits per step, pmuludq multiplies the even and the odd digits;
+// only the carry propagation remains sequential. The sums a*x[i] + z[i] fit into 64 bits.
+
+#ifndef DIGIT_KERNELS_INT128
+
+TARGET_SSE2 static inline void sse2_products( const Digit *x, const Digit *z, __m128i a, DoubleDigit s[4] ) {
+    __m128i xv   = _mm_loadu_si128( reinterpret_cast<const __m128i *>( x ) );
+    __m128i even = _mm_mul_epu32( xv, a );
+    __m128i odd  = _mm_mul_epu32( _mm_srli_epi64( xv, 32 ), a );
+    if ( z not_eq nullptr ) {
+        __m128i zv = _mm_loadu_si128( reinterpret_cast<const __m128i *>( z ) );
+        even = _mm_add_epi64( even, _mm_and_si128( zv, _mm_set_epi32( 0, -1, 0, -1 ) ) );
+        odd  = _mm_add_epi64( odd, _mm_srli_epi64( zv, 32 ) );
+    }
+    _mm_storeu_si128( reinterpret_cast<__m128i *>( s ), _mm_unpacklo_epi64( even, odd ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i *>( s + 2 ), _mm_unpackhi_epi64( even, odd ) );
+}
+
+
+TARGET_SSE2 static Digit sse2_mul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    const __m128i av = _mm_set1_epi32( static_cast<std::int32_t>( a ) );
+    DoubleDigit   c  = 0;
+    std::int32_t  i  = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        DoubleDigit s[4];
+        sse2_products( x + i, nullptr, av, s );
+        for ( std::int32_t k = 0; k < 4; k++ ) {
+            c += s[ k ];
+            z[ i + k ] = Digit( c );
+            c >>= logB;
+        }
+    }
+    for ( ; i < n; i++ ) {
+        c += DoubleDigit( x[ i ] ) * a;
+        z[ i ] = Digit( c );
+        c >>= logB;
+    }
+    return Digit( c );
+}
+
+
+TARGET_SSE2 static Digit sse2_addmul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    const __m128i av = _mm_set1_epi32( static_cast<std::int32_t>( a ) );
+    DoubleDigit   c  = 0;
+    std::int32_t  i  = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        DoubleDigit s[4];
+        sse2_products( x + i, z + i, av, s );
+        for ( std::int32_t k = 0; k < 4; k++ ) {
+            c += s[ k ];
+            z[ i + k ] = Digit( c );
+            c >>= logB;
+        }
+    }
+    for ( ; i < n; i++ ) {
+        c += DoubleDigit( x[ i ] ) * a + z[ i ];
+        z[ i ] = Digit( c );
+        c >>= logB;
+    }
+    return Digit( c );
+}
+
+#endif
+
+
+// On 64 bit hosts the two digit products of the wide kernels are faster.
+static const DigitKernelTable sse2_kernels = {
+    &wide_add_n,
+    &wide_sub_n,
+#ifdef DIGIT_KERNELS_INT128
+    &wide_mul_1,
+    &wide_addmul_1,
+#else
+    &sse2_mul_1,
+    &sse2_addmul_1,
+#endif
+    &wide_submul_1,
+    &wide_divrem_1,
+};
+
+#endif
+
+
+// -----------------------------------------------------------------------------
+
+DigitKernels::Level           DigitKernels::_level = DigitKernels::Level::scalar;
+static const DigitKernelTable *kernels             = &scalar_kernels;
+
+
+DigitKernels::Level DigitKernels::supported_level() {
+#if defined( DIGIT_KERNELS_X86 ) and defined( _MSC_VER )
+    std::int32_t info[4];
+    __cpuid( info, 1 );
+    if ( ( info[ 3 ] & ( 1 << 26 ) ) not_eq 0 )
+        return Level::sse2;
+#elif defined( DIGIT_KERNELS_X86 )
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "sse2" ) )
+        return Level::sse2;
+#endif
+    return Level::wide;
+}
+
+
+DigitKernels::Level DigitKernels::select( Level level ) {
+    Level supported = supported_level();
+    if ( static_cast<std::int32_t>( level ) > static_cast<std::int32_t>( supported ) )
+        level = supported;
+
+    switch ( level ) {
+#ifdef DIGIT_KERNELS_X86
+        case Level::sse2:
+            kernels = &sse2_kernels;
+            break;
+#endif
+        case Level::wide:
+            kernels = &wide_kernels;
+            break;
+        default:
+            level   = Level::scalar;
+            kernels = &scalar_kernels;
+            break;
+    }
+    _level = level;
+    return level;
+}
+
+
+const char *DigitKernels::level_name( Level level ) {
+    switch ( level ) {
+        case Level::scalar:
+            return "scalar";
+        case Level::wide:
+            return "wide";
+        case Level::sse2:
+            return "sse2";
+    }
+    return "unknown";
+}
+
+
+Digit DigitKernels::add_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n ) {
+    return kernels->add_n( z, x, y, n );
+}
+
+
+Digit DigitKernels::sub_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n ) {
+    return kernels->sub_n( z, x, y, n );
+}
+
+
+Digit DigitKernels::mul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    return kernels->mul_1( z, x, n, a );
+}
+
+
+Digit DigitKernels::addmul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    return kernels->addmul_1( z, x, n, a );
+}
+
+
+Digit DigitKernels::submul_1( Digit *z, const Digit *x, std::int32_t n, Digit a ) {
+    return kernels->submul_1( z, x, n, a );
+}
+
+
+Digit DigitKernels::divrem_1( Digit *q, const Digit *x, std::int32_t n, Digit d ) {
+    return kernels->divrem_1( q, x, n, d );
+}
+
+
+void digitKernels_init() {
+    SPDLOG_INFO( "system-init:  digitKernels_init" );
+
+    DigitKernels::Level level = DigitKernels::select( UseSIMDDigitKernels ? DigitKernels::supported_level() : DigitKernels::Level::scalar );
+    SPDLOG_INFO( "digit kernels: {}", DigitKernels::level_name( level ) );
+}
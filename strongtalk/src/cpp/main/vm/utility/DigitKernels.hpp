@@ -0,0 +1,74 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+#include "vm/utility/Integer.hpp"
+
+
+// DigitKernels are the inner loops of the IntegerOps arithmetic: addition and subtraction of
+// digit vectors, multiplication by a single digit with and without accumulation, and division
+// by a single digit. The digit vectors are in the on-heap format (32 bit digits, least
+// significant digit first); only the way they are processed differs between the levels:
+//
+//  scalar  one digit per step, the carries are computed with DoubleDigit arithmetic
+//  wide    the carry flag of the processor for additions and subtractions (two digits per step
+//          on 64 bit hosts), two digits per 64 x 32 bit product on 64 bit hosts, and division by
+//          a precomputed reciprocal of the divisor instead of a (library) division per digit
+//  sse2    wide, with the multiply-accumulate of four digits per step (pmuludq) on 32 bit hosts
+//
+// digitKernels_init() selects the best level supported by the processor (UseSIMDDigitKernels =
+// false keeps the scalar one). All levels compute the same results.
+//
+// The result vector z may be the same as an operand vector (but not overlap it otherwise),
+// all lengths are >= 0.
+
+class DigitKernels : AllStatic {
+
+public:
+    enum class Level {
+        scalar = 0, //
+        wide   = 1, //
+        sse2   = 2  //
+    };
+
+private:
+    static Level _level;
+
+public:
+    static Level level() {
+        return _level;
+    }
+
+
+    // the best level supported by the processor
+    static Level supported_level();
+
+    // selects the kernels of the given level (at most the supported level); returns the level selected
+    static Level select( Level level );
+
+    static const char *level_name( Level level );
+
+    // z[0..n) := x + y; returns the carry
+    static Digit add_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n );
+
+    // z[0..n) := x - y; returns the borrow
+    static Digit sub_n( Digit *z, const Digit *x, const Digit *y, std::int32_t n );
+
+    // z[0..n) := a * x; returns the carry digit
+    static Digit mul_1( Digit *z, const Digit *x, std::int32_t n, Digit a );
+
+    // z[0..n) += a * x; returns the carry digit
+    static Digit addmul_1( Digit *z, const Digit *x, std::int32_t n, Digit a );
+
+    // z[0..n) -= a * x; returns the borrow digit
+    static Digit submul_1( Digit *z, const Digit *x, std::int32_t n, Digit a );
+
+    // q[0..n) := x div d; returns x mod d. The digits are processed from the most significant one
+    // down, so q may also be x + 1 (the quotient shifted up by one digit).
+    static Digit divrem_1( Digit *q, const Digit *x, std::int32_t n, Digit d );
+};
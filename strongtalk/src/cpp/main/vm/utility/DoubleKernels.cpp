@@ -0,0 +1,768 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/utility/DoubleKernels.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/memory/util.hpp"
+#include "vm/runtime/init.hpp"
+
+#include <limits>
+
+#if defined( __i386__ ) or defined( __x86_64__ ) or defined( _M_IX86 ) or defined( _M_X64 )
+#define DOUBLE_KERNELS_X86
+#include <immintrin.h>
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+#endif
+
+// The SIMD kernels are compiled for their instruction set regardless of the flags the rest of
+// the vm is compiled with; they are only called if the processor supports them.
+#if defined( __GNUC__ )
+#define TARGET_SSE2 __attribute__(( target( "sse2" ) ))
+#define TARGET_AVX __attribute__(( target( "avx" ) ))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX
+#endif
+
+
+// the element-wise operations, for each level
+struct AddOp {
+    static double apply( double a, double b ) {
+        return a + b;
+    }
+
+
+#ifdef DOUBLE_KERNELS_X86
+    TARGET_SSE2 static __m128d apply( __m128d a, __m128d b ) {
+        return _mm_add_pd( a, b );
+    }
+
+
+    TARGET_AVX static __m256d apply( __m256d a, __m256d b ) {
+        return _mm256_add_pd( a, b );
+    }
+#endif
+};
+
+
+struct SubtractOp {
+    static double apply( double a, double b ) {
+        return a - b;
+    }
+
+
+#ifdef DOUBLE_KERNELS_X86
+    TARGET_SSE2 static __m128d apply( __m128d a, __m128d b ) {
+        return _mm_sub_pd( a, b );
+    }
+
+
+    TARGET_AVX static __m256d apply( __m256d a, __m256d b ) {
+        return _mm256_sub_pd( a, b );
+    }
+#endif
+};
+
+
+struct MultiplyOp {
+    static double apply( double a, double b ) {
+        return a * b;
+    }
+
+
+#ifdef DOUBLE_KERNELS_X86
+    TARGET_SSE2 static __m128d apply( __m128d a, __m128d b ) {
+        return _mm_mul_pd( a, b );
+    }
+
+
+    TARGET_AVX static __m256d apply( __m256d a, __m256d b ) {
+        return _mm256_mul_pd( a, b );
+    }
+#endif
+};
+
+
+struct DivideOp {
+    static double apply( double a, double b ) {
+        return a / b;
+    }
+
+
+#ifdef DOUBLE_KERNELS_X86
+    TARGET_SSE2 static __m128d apply( __m128d a, __m128d b ) {
+        return _mm_div_pd( a, b );
+    }
+
+
+    TARGET_AVX static __m256d apply( __m256d a, __m256d b ) {
+        return _mm256_div_pd( a, b );
+    }
+#endif
+};
+
+
+// the partial sums of sum and dot, combined in the same order at every level
+static double combine_lanes( const double lane[8] ) {
+    double t0 = lane[ 0 ] + lane[ 4 ];
+    double t1 = lane[ 1 ] + lane[ 5 ];
+    double t2 = lane[ 2 ] + lane[ 6 ];
+    double t3 = lane[ 3 ] + lane[ 7 ];
+    return ( t0 + t2 ) + ( t1 + t3 );
+}
+
+
+static const double positive_infinity = std::numeric_limits<double>::infinity();
+static const double negative_infinity = -std::numeric_limits<double>::infinity();
+
+
+// -----------------------------------------------------------------------------
+// scalar: one element per step
+
+static double scalar_sum( const double *x, std::int32_t n ) {
+    double       lane[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    std::int32_t i       = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        for ( std::int32_t k = 0; k < 8; k++ )
+            lane[ k ] += x[ i + k ];
+    }
+    double result = combine_lanes( lane );
+    for ( ; i < n; i++ )
+        result += x[ i ];
+    return result;
+}
+
+
+static double scalar_dot( const double *x, const double *y, std::int32_t n ) {
+    double       lane[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    std::int32_t i       = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        for ( std::int32_t k = 0; k < 8; k++ )
+            lane[ k ] += x[ i + k ] * y[ i + k ];
+    }
+    double result = combine_lanes( lane );
+    for ( ; i < n; i++ )
+        result += x[ i ] * y[ i ];
+    return result;
+}
+
+
+static void scalar_axpy( double *y, double a, const double *x, std::int32_t n ) {
+    for ( std::int32_t i = 0; i < n; i++ )
+        y[ i ] += a * x[ i ];
+}
+
+
+static void scalar_scale( double *x, double a, std::int32_t n ) {
+    for ( std::int32_t i = 0; i < n; i++ )
+        x[ i ] *= a;
+}
+
+
+template<typename Op>
+static void scalar_elementwise( double *z, const double *x, const double *y, std::int32_t n ) {
+    for ( std::int32_t i = 0; i < n; i++ )
+        z[ i ] = Op::apply( x[ i ], y[ i ] );
+}
+
+
+static void scalar_fill( double *x, double a, std::int32_t n ) {
+    for ( std::int32_t i = 0; i < n; i++ )
+        x[ i ] = a;
+}
+
+
+// the smallest (largest) element that is not a NaN, or +infinity (-infinity)
+static double scalar_min( const double *x, std::int32_t n ) {
+    double result = positive_infinity;
+    for ( std::int32_t i = 0; i < n; i++ ) {
+        if ( x[ i ] < result )
+            result = x[ i ];
+    }
+    return result;
+}
+
+
+static double scalar_max( const double *x, std::int32_t n ) {
+    double result = negative_infinity;
+    for ( std::int32_t i = 0; i < n; i++ ) {
+        if ( x[ i ] > result )
+            result = x[ i ];
+    }
+    return result;
+}
+
+
+// index of the first element equal to value, or -1
+static std::int32_t scalar_index_of( const double *x, std::int32_t n, double value ) {
+    for ( std::int32_t i = 0; i < n; i++ ) {
+        if ( x[ i ] == value )
+            return i;
+    }
+    return -1;
+}
+
+
+static std::int32_t scalar_mismatch( const double *x, const double *y, std::int32_t n ) {
+    for ( std::int32_t i = 0; i < n; i++ ) {
+        if ( not( x[ i ] == y[ i ] ) )
+            return i;
+    }
+    return n;
+}
+
+
+// the kernels of one level
+struct DoubleKernelTable {
+    double (*sum)( const double *x, std::int32_t n );
+    double (*dot)( const double *x, const double *y, std::int32_t n );
+    void (*axpy)( double *y, double a, const double *x, std::int32_t n );
+    void (*scale)( double *x, double a, std::int32_t n );
+    void (*add)( double *z, const double *x, const double *y, std::int32_t n );
+    void (*subtract)( double *z, const double *x, const double *y, std::int32_t n );
+    void (*multiply)( double *z, const double *x, const double *y, std::int32_t n );
+    void (*divide)( double *z, const double *x, const double *y, std::int32_t n );
+    void (*fill)( double *x, double a, std::int32_t n );
+    double (*min)( const double *x, std::int32_t n );
+    double (*max)( const double *x, std::int32_t n );
+    std::int32_t (*index_of)( const double *x, std::int32_t n, double value );
+    std::int32_t (*mismatch)( const double *x, const double *y, std::int32_t n );
+};
+
+
+static const DoubleKernelTable scalar_kernels = {
+    &scalar_sum,
+    &scalar_dot,
+    &scalar_axpy,
+    &scalar_scale,
+    &scalar_elementwise<AddOp>,
+    &scalar_elementwise<SubtractOp>,
+    &scalar_elementwise<MultiplyOp>,
+    &scalar_elementwise<DivideOp>,
+    &scalar_fill,
+    &scalar_min,
+    &scalar_max,
+    &scalar_index_of,
+    &scalar_mismatch,
+};
+
+
+#ifdef DOUBLE_KERNELS_X86
+
+static inline std::int32_t lowest_bit( std::uint32_t mask ) {
+#if defined( _MSC_VER )
+    unsigned long index;
+    _BitScanForward( &index, mask );
+    return static_cast<std::int32_t>( index );
+#else
+    return __builtin_ctz( mask );
+#endif
+}
+
+
+// -----------------------------------------------------------------------------
+// SSE2: two elements per register, four registers (eight elements) per step in the reductions.
+// The heap only aligns the elements to the oop size, all loads and stores are unaligned.
+
+TARGET_SSE2 static double sse2_sum( const double *x, std::int32_t n ) {
+    __m128d      s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), s2 = _mm_setzero_pd(), s3 = _mm_setzero_pd();
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        s0 = _mm_add_pd( s0, _mm_loadu_pd( x + i ) );
+        s1 = _mm_add_pd( s1, _mm_loadu_pd( x + i + 2 ) );
+        s2 = _mm_add_pd( s2, _mm_loadu_pd( x + i + 4 ) );
+        s3 = _mm_add_pd( s3, _mm_loadu_pd( x + i + 6 ) );
+    }
+    double lane[8];
+    _mm_storeu_pd( lane, s0 );
+    _mm_storeu_pd( lane + 2, s1 );
+    _mm_storeu_pd( lane + 4, s2 );
+    _mm_storeu_pd( lane + 6, s3 );
+    double result = combine_lanes( lane );
+    for ( ; i < n; i++ )
+        result += x[ i ];
+    return result;
+}
+
+
+TARGET_SSE2 static double sse2_dot( const double *x, const double *y, std::int32_t n ) {
+    __m128d      s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), s2 = _mm_setzero_pd(), s3 = _mm_setzero_pd();
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        s0 = _mm_add_pd( s0, _mm_mul_pd( _mm_loadu_pd( x + i ), _mm_loadu_pd( y + i ) ) );
+        s1 = _mm_add_pd( s1, _mm_mul_pd( _mm_loadu_pd( x + i + 2 ), _mm_loadu_pd( y + i + 2 ) ) );
+        s2 = _mm_add_pd( s2, _mm_mul_pd( _mm_loadu_pd( x + i + 4 ), _mm_loadu_pd( y + i + 4 ) ) );
+        s3 = _mm_add_pd( s3, _mm_mul_pd( _mm_loadu_pd( x + i + 6 ), _mm_loadu_pd( y + i + 6 ) ) );
+    }
+    double lane[8];
+    _mm_storeu_pd( lane, s0 );
+    _mm_storeu_pd( lane + 2, s1 );
+    _mm_storeu_pd( lane + 4, s2 );
+    _mm_storeu_pd( lane + 6, s3 );
+    double result = combine_lanes( lane );
+    for ( ; i < n; i++ )
+        result += x[ i ] * y[ i ];
+    return result;
+}
+
+
+TARGET_SSE2 static void sse2_axpy( double *y, double a, const double *x, std::int32_t n ) {
+    __m128d      va = _mm_set1_pd( a );
+    std::int32_t i  = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        _mm_storeu_pd( y + i, _mm_add_pd( _mm_loadu_pd( y + i ), _mm_mul_pd( va, _mm_loadu_pd( x + i ) ) ) );
+        _mm_storeu_pd( y + i + 2, _mm_add_pd( _mm_loadu_pd( y + i + 2 ), _mm_mul_pd( va, _mm_loadu_pd( x + i + 2 ) ) ) );
+    }
+    for ( ; i < n; i++ )
+        y[ i ] += a * x[ i ];
+}
+
+
+TARGET_SSE2 static void sse2_scale( double *x, double a, std::int32_t n ) {
+    __m128d      va = _mm_set1_pd( a );
+    std::int32_t i  = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        _mm_storeu_pd( x + i, _mm_mul_pd( _mm_loadu_pd( x + i ), va ) );
+        _mm_storeu_pd( x + i + 2, _mm_mul_pd( _mm_loadu_pd( x + i + 2 ), va ) );
+    }
+    for ( ; i < n; i++ )
+        x[ i ] *= a;
+}
+
+
+template<typename Op>
+TARGET_SSE2 static void sse2_elementwise( double *z, const double *x, const double *y, std::int32_t n ) {
+    std::int32_t i = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        __m128d a = Op::apply( _mm_loadu_pd( x + i ), _mm_loadu_pd( y + i ) );
+        __m128d b = Op::apply( _mm_loadu_pd( x + i + 2 ), _mm_loadu_pd( y + i + 2 ) );
+        _mm_storeu_pd( z + i, a );
+        _mm_storeu_pd( z + i + 2, b );
+    }
+    for ( ; i < n; i++ )
+        z[ i ] = Op::apply( x[ i ], y[ i ] );
+}
+
+
+TARGET_SSE2 static void sse2_fill( double *x, double a, std::int32_t n ) {
+    __m128d      va = _mm_set1_pd( a );
+    std::int32_t i  = 0;
+    for ( ; i + 2 <= n; i += 2 )
+        _mm_storeu_pd( x + i, va );
+    if ( i < n )
+        x[ i ] = a;
+}
+
+
+// minpd/maxpd( x, m ) yields m if x is a NaN, as the scalar comparison does
+TARGET_SSE2 static double sse2_min( const double *x, std::int32_t n ) {
+    __m128d      m0 = _mm_set1_pd( positive_infinity ), m1 = m0;
+    std::int32_t i  = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        m0 = _mm_min_pd( _mm_loadu_pd( x + i ), m0 );
+        m1 = _mm_min_pd( _mm_loadu_pd( x + i + 2 ), m1 );
+    }
+    double lane[4];
+    _mm_storeu_pd( lane, m0 );
+    _mm_storeu_pd( lane + 2, m1 );
+    double result = positive_infinity;
+    for ( std::int32_t k = 0; k < 4; k++ ) {
+        if ( lane[ k ] < result )
+            result = lane[ k ];
+    }
+    for ( ; i < n; i++ ) {
+        if ( x[ i ] < result )
+            result = x[ i ];
+    }
+    return result;
+}
+
+
+TARGET_SSE2 static double sse2_max( const double *x, std::int32_t n ) {
+    __m128d      m0 = _mm_set1_pd( negative_infinity ), m1 = m0;
+    std::int32_t i  = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        m0 = _mm_max_pd( _mm_loadu_pd( x + i ), m0 );
+        m1 = _mm_max_pd( _mm_loadu_pd( x + i + 2 ), m1 );
+    }
+    double lane[4];
+    _mm_storeu_pd( lane, m0 );
+    _mm_storeu_pd( lane + 2, m1 );
+    double result = negative_infinity;
+    for ( std::int32_t k = 0; k < 4; k++ ) {
+        if ( lane[ k ] > result )
+            result = lane[ k ];
+    }
+    for ( ; i < n; i++ ) {
+        if ( x[ i ] > result )
+            result = x[ i ];
+    }
+    return result;
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_index_of( const double *x, std::int32_t n, double value ) {
+    __m128d      v = _mm_set1_pd( value );
+    std::int32_t i = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        std::uint32_t mask = _mm_movemask_pd( _mm_cmpeq_pd( _mm_loadu_pd( x + i ), v ) ) | ( _mm_movemask_pd( _mm_cmpeq_pd( _mm_loadu_pd( x + i + 2 ), v ) ) << 2 );
+        if ( mask )
+            return i + lowest_bit( mask );
+    }
+    std::int32_t j = scalar_index_of( x + i, n - i, value );
+    return j < 0 ? -1 : i + j;
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_mismatch( const double *x, const double *y, std::int32_t n ) {
+    std::int32_t i = 0;
+    for ( ; i + 4 <= n; i += 4 ) {
+        std::uint32_t mask = _mm_movemask_pd( _mm_cmpneq_pd( _mm_loadu_pd( x + i ), _mm_loadu_pd( y + i ) ) ) | ( _mm_movemask_pd( _mm_cmpneq_pd( _mm_loadu_pd( x + i + 2 ), _mm_loadu_pd( y + i + 2 ) ) ) << 2 );
+        if ( mask )
+            return i + lowest_bit( mask );
+    }
+    return i + scalar_mismatch( x + i, y + i, n - i );
+}
+
+
+static const DoubleKernelTable sse2_kernels = {
+    &sse2_sum,
+    &sse2_dot,
+    &sse2_axpy,
+    &sse2_scale,
+    &sse2_elementwise<AddOp>,
+    &sse2_elementwise<SubtractOp>,
+    &sse2_elementwise<MultiplyOp>,
+    &sse2_elementwise<DivideOp>,
+    &sse2_fill,
+    &sse2_min,
+    &sse2_max,
+    &sse2_index_of,
+    &sse2_mismatch,
+};
+
+
+// -----------------------------------------------------------------------------
+// AVX: four elements per register, two registers (eight elements) per step. The remainder is done
+// here as well (calling the SSE2 kernels would switch between VEX and legacy SSE code). The
+// products are not fused (no FMA), so the results are the same as at the other levels.
+
+TARGET_AVX static double avx_sum( const double *x, std::int32_t n ) {
+    __m256d      s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        s0 = _mm256_add_pd( s0, _mm256_loadu_pd( x + i ) );
+        s1 = _mm256_add_pd( s1, _mm256_loadu_pd( x + i + 4 ) );
+    }
+    double lane[8];
+    _mm256_storeu_pd( lane, s0 );
+    _mm256_storeu_pd( lane + 4, s1 );
+    double result = combine_lanes( lane );
+    for ( ; i < n; i++ )
+        result += x[ i ];
+    return result;
+}
+
+
+TARGET_AVX static double avx_dot( const double *x, const double *y, std::int32_t n ) {
+    __m256d      s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        s0 = _mm256_add_pd( s0, _mm256_mul_pd( _mm256_loadu_pd( x + i ), _mm256_loadu_pd( y + i ) ) );
+        s1 = _mm256_add_pd( s1, _mm256_mul_pd( _mm256_loadu_pd( x + i + 4 ), _mm256_loadu_pd( y + i + 4 ) ) );
+    }
+    double lane[8];
+    _mm256_storeu_pd( lane, s0 );
+    _mm256_storeu_pd( lane + 4, s1 );
+    double result = combine_lanes( lane );
+    for ( ; i < n; i++ )
+        result += x[ i ] * y[ i ];
+    return result;
+}
+
+
+TARGET_AVX static void avx_axpy( double *y, double a, const double *x, std::int32_t n ) {
+    __m256d      va = _mm256_set1_pd( a );
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        _mm256_storeu_pd( y + i, _mm256_add_pd( _mm256_loadu_pd( y + i ), _mm256_mul_pd( va, _mm256_loadu_pd( x + i ) ) ) );
+        _mm256_storeu_pd( y + i + 4, _mm256_add_pd( _mm256_loadu_pd( y + i + 4 ), _mm256_mul_pd( va, _mm256_loadu_pd( x + i + 4 ) ) ) );
+    }
+    for ( ; i < n; i++ )
+        y[ i ] += a * x[ i ];
+}
+
+
+TARGET_AVX static void avx_scale( double *x, double a, std::int32_t n ) {
+    __m256d      va = _mm256_set1_pd( a );
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        _mm256_storeu_pd( x + i, _mm256_mul_pd( _mm256_loadu_pd( x + i ), va ) );
+        _mm256_storeu_pd( x + i + 4, _mm256_mul_pd( _mm256_loadu_pd( x + i + 4 ), va ) );
+    }
+    for ( ; i < n; i++ )
+        x[ i ] *= a;
+}
+
+
+template<typename Op>
+TARGET_AVX static void avx_elementwise( double *z, const double *x, const double *y, std::int32_t n ) {
+    std::int32_t i = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        __m256d a = Op::apply( _mm256_loadu_pd( x + i ), _mm256_loadu_pd( y + i ) );
+        __m256d b = Op::apply( _mm256_loadu_pd( x + i + 4 ), _mm256_loadu_pd( y + i + 4 ) );
+        _mm256_storeu_pd( z + i, a );
+        _mm256_storeu_pd( z + i + 4, b );
+    }
+    for ( ; i < n; i++ )
+        z[ i ] = Op::apply( x[ i ], y[ i ] );
+}
+
+
+TARGET_AVX static void avx_fill( double *x, double a, std::int32_t n ) {
+    __m256d      va = _mm256_set1_pd( a );
+    std::int32_t i  = 0;
+    for ( ; i + 4 <= n; i += 4 )
+        _mm256_storeu_pd( x + i, va );
+    for ( ; i < n; i++ )
+        x[ i ] = a;
+}
+
+
+TARGET_AVX static double avx_min( const double *x, std::int32_t n ) {
+    __m256d      m0 = _mm256_set1_pd( positive_infinity ), m1 = m0;
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        m0 = _mm256_min_pd( _mm256_loadu_pd( x + i ), m0 );
+        m1 = _mm256_min_pd( _mm256_loadu_pd( x + i + 4 ), m1 );
+    }
+    double lane[8];
+    _mm256_storeu_pd( lane, m0 );
+    _mm256_storeu_pd( lane + 4, m1 );
+    double result = positive_infinity;
+    for ( std::int32_t k = 0; k < 8; k++ ) {
+        if ( lane[ k ] < result )
+            result = lane[ k ];
+    }
+    for ( ; i < n; i++ ) {
+        if ( x[ i ] < result )
+            result = x[ i ];
+    }
+    return result;
+}
+
+
+TARGET_AVX static double avx_max( const double *x, std::int32_t n ) {
+    __m256d      m0 = _mm256_set1_pd( negative_infinity ), m1 = m0;
+    std::int32_t i  = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        m0 = _mm256_max_pd( _mm256_loadu_pd( x + i ), m0 );
+        m1 = _mm256_max_pd( _mm256_loadu_pd( x + i + 4 ), m1 );
+    }
+    double lane[8];
+    _mm256_storeu_pd( lane, m0 );
+    _mm256_storeu_pd( lane + 4, m1 );
+    double result = negative_infinity;
+    for ( std::int32_t k = 0; k < 8; k++ ) {
+        if ( lane[ k ] > result )
+            result = lane[ k ];
+    }
+    for ( ; i < n; i++ ) {
+        if ( x[ i ] > result )
+            result = x[ i ];
+    }
+    return result;
+}
+
+
+TARGET_AVX static std::int32_t avx_index_of( const double *x, std::int32_t n, double value ) {
+    __m256d      v = _mm256_set1_pd( value );
+    std::int32_t i = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        std::uint32_t mask = _mm256_movemask_pd( _mm256_cmp_pd( _mm256_loadu_pd( x + i ), v, _CMP_EQ_OQ ) ) | ( _mm256_movemask_pd( _mm256_cmp_pd( _mm256_loadu_pd( x + i + 4 ), v, _CMP_EQ_OQ ) ) << 4 );
+        if ( mask )
+            return i + lowest_bit( mask );
+    }
+    for ( ; i < n; i++ ) {
+        if ( x[ i ] == value )
+            return i;
+    }
+    return -1;
+}
+
+
+TARGET_AVX static std::int32_t avx_mismatch( const double *x, const double *y, std::int32_t n ) {
+    std::int32_t i = 0;
+    for ( ; i + 8 <= n; i += 8 ) {
+        std::uint32_t mask = _mm256_movemask_pd( _mm256_cmp_pd( _mm256_loadu_pd( x + i ), _mm256_loadu_pd( y + i ), _CMP_NEQ_UQ ) ) | ( _mm256_movemask_pd( _mm256_cmp_pd( _mm256_loadu_pd( x + i + 4 ), _mm256_loadu_pd( y + i + 4 ), _CMP_NEQ_UQ ) ) << 4 );
+        if ( mask )
+            return i + lowest_bit( mask );
+    }
+    for ( ; i < n; i++ ) {
+        if ( not( x[ i ] == y[ i ] ) )
+            return i;
+    }
+    return n;
+}
+
+
+static const DoubleKernelTable avx_kernels = {
+    &avx_sum,
+    &avx_dot,
+    &avx_axpy,
+    &avx_scale,
+    &avx_elementwise<AddOp>,
+    &avx_elementwise<SubtractOp>,
+    &avx_elementwise<MultiplyOp>,
+    &avx_elementwise<DivideOp>,
+    &avx_fill,
+    &avx_min,
+    &avx_max,
+    &avx_index_of,
+    &avx_mismatch,
+};
+
+#endif
+
+
+// -----------------------------------------------------------------------------
+
+DoubleKernels::Level           DoubleKernels::_level = DoubleKernels::Level::scalar;
+static const DoubleKernelTable *kernels              = &scalar_kernels;
+
+
+DoubleKernels::Level DoubleKernels::supported_level() {
+#if defined( DOUBLE_KERNELS_X86 ) and defined( _MSC_VER )
+    std::int32_t info[4];
+    __cpuid( info, 1 );
+    const bool sse2    = ( info[ 3 ] & ( 1 << 26 ) ) not_eq 0;
+    const bool osxsave = ( info[ 2 ] & ( 1 << 27 ) ) not_eq 0;
+    const bool avx     = ( info[ 2 ] & ( 1 << 28 ) ) not_eq 0;
+    if ( avx and osxsave and ( _xgetbv( 0 ) & 0x6 ) == 0x6 )     // the os saves the ymm registers
+        return Level::avx;
+    if ( sse2 )
+        return Level::sse2;
+#elif defined( DOUBLE_KERNELS_X86 )
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx" ) )
+        return Level::avx;
+    if ( __builtin_cpu_supports( "sse2" ) )
+        return Level::sse2;
+#endif
+    return Level::scalar;
+}
+
+
+DoubleKernels::Level DoubleKernels::select( Level level ) {
+    Level supported = supported_level();
+    if ( static_cast<std::int32_t>( level ) > static_cast<std::int32_t>( supported ) )
+        level = supported;
+
+    switch ( level ) {
+#ifdef DOUBLE_KERNELS_X86
+        case Level::avx:
+            kernels = &avx_kernels;
+            break;
+        case Level::sse2:
+            kernels = &sse2_kernels;
+            break;
+#endif
+        default:
+            level   = Level::scalar;
+            kernels = &scalar_kernels;
+            break;
+    }
+    _level = level;
+    return level;
+}
+
+
+const char *DoubleKernels::level_name( Level level ) {
+    switch ( level ) {
+        case Level::scalar:
+            return "scalar";
+        case Level::sse2:
+            return "sse2";
+        case Level::avx:
+            return "avx";
+    }
+    return "unknown";
+}
+
+
+double DoubleKernels::sum( const double *x, std::int32_t n ) {
+    return kernels->sum( x, n );
+}
+
+
+double DoubleKernels::dot( const double *x, const double *y, std::int32_t n ) {
+    return kernels->dot( x, y, n );
+}
+
+
+void DoubleKernels::axpy( double *y, double a, const double *x, std::int32_t n ) {
+    kernels->axpy( y, a, x, n );
+}
+
+
+void DoubleKernels::scale( double *x, double a, std::int32_t n ) {
+    kernels->scale( x, a, n );
+}
+
+
+void DoubleKernels::add( double *z, const double *x, const double *y, std::int32_t n ) {
+    kernels->add( z, x, y, n );
+}
+
+
+void DoubleKernels::subtract( double *z, const double *x, const double *y, std::int32_t n ) {
+    kernels->subtract( z, x, y, n );
+}
+
+
+void DoubleKernels::multiply( double *z, const double *x, const double *y, std::int32_t n ) {
+    kernels->multiply( z, x, y, n );
+}
+
+
+void DoubleKernels::divide( double *z, const double *x, const double *y, std::int32_t n ) {
+    kernels->divide( z, x, y, n );
+}
+
+
+void DoubleKernels::fill( double *x, double a, std::int32_t n ) {
+    kernels->fill( x, a, n );
+}
+
+
+std::int32_t DoubleKernels::min_index( const double *x, std::int32_t n ) {
+    if ( n == 0 )
+        return -1;
+    std::int32_t index = kernels->index_of( x, n, kernels->min( x, n ) );
+    return index < 0 ? 0 : index;
+}
+
+
+std::int32_t DoubleKernels::max_index( const double *x, std::int32_t n ) {
+    if ( n == 0 )
+        return -1;
+    std::int32_t index = kernels->index_of( x, n, kernels->max( x, n ) );
+    return index < 0 ? 0 : index;
+}
+
+
+std::int32_t DoubleKernels::mismatch( const double *x, const double *y, std::int32_t n ) {
+    return kernels->mismatch( x, y, n );
+}
+
+
+void doubleKernels_init() {
+    SPDLOG_INFO( "system-init:  doubleKernels_init" );
+
+    DoubleKernels::Level level = DoubleKernels::select( UseSIMDDoubleKernels ? DoubleKernels::supported_level() : DoubleKernels::Level::scalar );
+    SPDLOG_INFO( "double kernels: {}", DoubleKernels::level_name( level ) );
+}
@@ -0,0 +1,85 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+
+
+// DoubleKernels are the loops behind the bulk DoubleValueArray primitives: reductions (sum, dot
+// product, smallest and largest element), element-wise arithmetic, fill and compare, all on the
+// unboxed doubles.
+//
+// The kernels come in a scalar, an SSE2 and an AVX version; doubleKernels_init() selects the
+// best version the processor supports (UseSIMDDoubleKernels = false keeps the scalar one).
+//
+// sum and dot add the elements in eight interleaved partial sums (element i goes to partial sum
+// i mod 8) which are combined in a fixed order, at every level. All levels therefore compute the
+// same results, as long as the compiler does not evaluate the scalar kernels with extended (x87)
+// precision.
+//
+// Indices are 0-based, lengths are >= 0. The result vector z may be the same as an operand
+// vector (but not overlap it otherwise).
+
+class DoubleKernels : AllStatic {
+
+public:
+    enum class Level {
+        scalar = 0, //
+        sse2   = 1, //
+        avx    = 2  //
+    };
+
+private:
+    static Level _level;
+
+public:
+    static Level level() {
+        return _level;
+    }
+
+
+    // the best level supported by the processor
+    static Level supported_level();
+
+    // selects the kernels of the given level (at most the supported level); returns the level selected
+    static Level select( Level level );
+
+    static const char *level_name( Level level );
+
+    // sum of x[0..n)
+    static double sum( const double *x, std::int32_t n );
+
+    // sum of x[i] * y[i]
+    static double dot( const double *x, const double *y, std::int32_t n );
+
+    // y[0..n) += a * x
+    static void axpy( double *y, double a, const double *x, std::int32_t n );
+
+    // x[0..n) *= a
+    static void scale( double *x, double a, std::int32_t n );
+
+    // z[0..n) := x op y
+    static void add( double *z, const double *x, const double *y, std::int32_t n );
+
+    static void subtract( double *z, const double *x, const double *y, std::int32_t n );
+
+    static void multiply( double *z, const double *x, const double *y, std::int32_t n );
+
+    static void divide( double *z, const double *x, const double *y, std::int32_t n );
+
+    // x[0..n) := a
+    static void fill( double *x, double a, std::int32_t n );
+
+    // index of the first smallest (largest) element, NaNs are ignored (0 if all elements are
+    // NaNs); -1 if n = 0
+    static std::int32_t min_index( const double *x, std::int32_t n );
+
+    static std::int32_t max_index( const double *x, std::int32_t n );
+
+    // index of the first position where x[i] = y[i] does not hold (NaNs never compare equal), or n
+    static std::int32_t mismatch( const double *x, const double *y, std::int32_t n );
+};
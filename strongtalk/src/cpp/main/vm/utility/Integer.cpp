@@ -8,6 +8,8 @@
 #include "vm/utility/Integer.hpp"
 #include "vm/utility/IntegerOps.hpp"
 #include "vm/utility/OutputStream.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+#include "vm/runtime/ResourceArea.hpp"
 
 
 std::size_t Integer::length_in_bits() const {
@@ -122,7 +124,8 @@ SmallIntegerOop Integer::as_SmallIntegerOop( bool &ok ) const {
 
 
 void Integer::print() const {
-    char s[100000]; // for the time being - FIX THIS
+    ResourceMark resourceMark;
+    char         *s = new_resource_array<char>( IntegerOps::Integer_to_string_result_size_in_bytes( const_cast<Integer &>( *this ), 10 ) );
     IntegerOps::Integer_to_string( *this, 10, s );
     std::int32_t i = 0;
     while ( s[ i ] not_eq '\x0' ) {
@@ -9,6 +9,10 @@
 #include "vm/runtime/ResourceArea.hpp"
 #include "vm/utility/Integer.hpp"
 #include "vm/utility/IntegerOps.hpp"
+#include "vm/utility/DigitKernels.hpp"
+
+#include <cstring>
+#include <utility>
 
 
 static std::int32_t exponent( double x ) {
@@ -222,12 +226,8 @@ void IntegerOps::unsigned_add( Integer &x, Integer &y, Integer &z ) {
     std::int32_t xl = x.length();
     std::int32_t yl = y.length();
     std::int32_t l  = min( xl, yl );
-    std::int32_t i  = 0;
-    Digit        c  = 0;
-    while ( i < l ) {
-        z[ i ] = xpy( x[ i ], y[ i ], c );
-        i++;
-    }
+    std::int32_t i  = l;
+    Digit        c  = DigitKernels::add_n( z.digits(), x.digits(), y.digits(), l );
     while ( i < xl ) {
         z[ i ] = xpy( x[ i ], 0, c );
         i++;
@@ -247,12 +247,8 @@ void IntegerOps::unsigned_add( Integer &x, Integer &y, Integer &z ) {
 void IntegerOps::unsigned_sub( Integer &x, Integer &y, Integer &z ) {
     std::int32_t xl = x.length();
     std::int32_t yl = y.length();
-    std::int32_t i  = 0;
-    Digit        c  = 0;
-    while ( i < yl ) {
-        z[ i ] = xmy( x[ i ], y[ i ], c );
-        i++;
-    }
+    std::int32_t i  = yl;
+    Digit        c  = DigitKernels::sub_n( z.digits(), x.digits(), y.digits(), yl );
     while ( i < xl ) {
         z[ i ] = xmy( x[ i ], 0, c );
         i++;
@@ -264,143 +260,556 @@ void IntegerOps::unsigned_sub( Integer &x, Integer &y, Integer &z ) {
 }
 
 
-void IntegerOps::unsigned_mul( Integer &x, Integer &y, Integer &z ) {
-    std::int32_t xl = x.length();
-    std::int32_t yl = y.length();
-    // initialize z
-    std::int32_t i  = xl + yl;
-    while ( i > 0 ) {
-        i--;
+// -----------------------------------------------------------------------------
+// Multiplication and division of digit vectors.
+//
+// The operands of the helpers below are digit vectors (least significant digit first) of
+// explicit length; leading zero digits are allowed. Products use the basecase (schoolbook)
+// algorithm for short operands and switch to Karatsuba and then Toom-3 as the operands grow;
+// squares, which only need about half the digit products, have their own crossover points.
+// Long divisions switch from Knuth's algorithm D to the recursive division of Burnikel and
+// Ziegler, which reduces the division to multiplications of the half sized divisor; it only
+// pays off for long divisors and quotients at least as long as the divisor.
+//
+// The thresholds are in digits. They are starting values in the range other 32 bit digit
+// implementations use, not measurements of this code; the crossover benchmarks in IntegerOpsTests
+// (disabled, run them with --gtest_also_run_disabled_tests) measure them. They can be changed at
+// runtime (the recursions need a few digits to make progress, so values below 4 for Karatsuba and
+// Burnikel-Ziegler and 5 for Toom-3 are raised to these).
+
+std::int32_t IntegerOps::karatsuba_threshold        = 56;
+std::int32_t IntegerOps::toom3_threshold            = 240;
+std::int32_t IntegerOps::karatsuba_square_threshold = 96;
+std::int32_t IntegerOps::toom3_square_threshold     = 400;
+std::int32_t IntegerOps::burnikel_ziegler_threshold = 80;
+std::int32_t IntegerOps::burnikel_ziegler_minimum   = 320;
+std::int32_t IntegerOps::radix_conversion_threshold = 30;
+
+
+static inline void clear_digits( Digit *z, std::int32_t length ) {
+    for ( std::int32_t i = 0; i < length; i++ )
         z[ i ] = 0;
+}
+
+
+static inline void copy_digits( Digit *z, const Digit *x, std::int32_t length ) {
+    for ( std::int32_t i = 0; i < length; i++ )
+        z[ i ] = x[ i ];
+}
+
+
+static inline std::int32_t trimmed_length( const Digit *x, std::int32_t length ) {
+    while ( length > 0 and x[ length - 1 ] == 0 )
+        length--;
+    return length;
+}
+
+
+static std::int32_t compare_digits( const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    xl = trimmed_length( x, xl );
+    yl = trimmed_length( y, yl );
+    if ( xl not_eq yl )
+        return xl < yl ? -1 : 1;
+    for ( std::int32_t i = xl - 1; i >= 0; i-- ) {
+        if ( x[ i ] not_eq y[ i ] )
+            return x[ i ] < y[ i ] ? -1 : 1;
     }
-    st_assert( i == 0, "i != 0" );
+    return 0;
+}
 
-    std::int32_t k = 0;
-    while ( i < xl ) {
-        Digit d = x[ i ];
-        if ( d not_eq 0 ) {
-            std::int32_t j = 0;
-            k = i;
-            Digit c = 0;
-            while ( j < yl ) {
-                z[ k ] = axpy( d, y[ j ], z[ k ], c );
-                j++;
-                k++;
-            }
-            if ( c not_eq 0 ) {
-                z[ k ] = c;
-                k++;
-            }
-            i++;
-        }
+
+// z[0..xl) := x + y for xl >= yl; returns the carry. z may be x or y.
+static Digit add_digits( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    Digit        c = DigitKernels::add_n( z, x, y, yl );
+    std::int32_t i = yl;
+    for ( ; i < xl; i++ )
+        z[ i ] = IntegerOps::xpy( x[ i ], 0, c );
+    return c;
+}
+
+
+// z[0..xl) := x - y for xl >= yl; returns the borrow. z may be x or y.
+static Digit sub_digits( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    Digit        c = DigitKernels::sub_n( z, x, y, yl );
+    std::int32_t i = yl;
+    for ( ; i < xl; i++ )
+        z[ i ] = IntegerOps::xmy( x[ i ], 0, c );
+    return c;
+}
+
+
+// z[0..zl) += x[0..xl) for zl >= xl; returns the carry out of z
+static Digit add_to_digits( Digit *z, std::int32_t zl, const Digit *x, std::int32_t xl ) {
+    st_assert( xl <= zl, "addend too long" );
+    Digit        c = DigitKernels::add_n( z, z, x, xl );
+    std::int32_t i = xl;
+    for ( ; c not_eq 0 and i < zl; i++ )
+        z[ i ] = IntegerOps::xpy( z[ i ], 0, c );
+    return c;
+}
+
+
+// z[0..zl) -= x[0..xl) for zl >= xl; returns the borrow out of z
+static Digit sub_from_digits( Digit *z, std::int32_t zl, const Digit *x, std::int32_t xl ) {
+    st_assert( xl <= zl, "subtrahend too long" );
+    Digit        c = DigitKernels::sub_n( z, z, x, xl );
+    std::int32_t i = xl;
+    for ( ; c not_eq 0 and i < zl; i++ )
+        z[ i ] = IntegerOps::xmy( z[ i ], 0, c );
+    return c;
+}
+
+
+// z[0..zl) := (x[0..xl) * B^digits * 2^bits) mod B^zl for 0 <= bits < logB
+static void shift_digits_left( Digit *z, std::int32_t zl, const Digit *x, std::int32_t xl, std::int32_t digits, std::int32_t bits ) {
+    for ( std::int32_t i = 0; i < zl; i++ ) {
+        std::int32_t j  = i - digits;
+        DoubleDigit  hi = 0 <= j and j < xl ? x[ j ] : 0;
+        DoubleDigit  lo = 0 < j and j <= xl ? x[ j - 1 ] : 0;
+        z[ i ] = Digit( ( ( hi << logB ) | lo ) >> ( logB - bits ) );
     }
-    z.set_signed_length( k );
 }
 
 
-Digit IntegerOps::scale( Digit *array, Digit factor, std::size_t length ) {
-// scale multiplies an integer representation stored
-// in array by factor and returns the last carry.
+// z[0..zl) := x[0..xl) div (B^digits * 2^bits) for 0 <= bits < logB
+static void shift_digits_right( Digit *z, std::int32_t zl, const Digit *x, std::int32_t xl, std::int32_t digits, std::int32_t bits ) {
+    for ( std::int32_t i = 0; i < zl; i++ ) {
+        std::int32_t j  = i + digits;
+        DoubleDigit  lo = j < xl ? x[ j ] : 0;
+        DoubleDigit  hi = j + 1 < xl ? x[ j + 1 ] : 0;
+        z[ i ] = Digit( ( ( hi << logB ) | lo ) >> bits );
+    }
+}
 
-    std::int32_t i = 0;
-    Digit        c = 0;
-    while ( i < length ) {
-        array[ i ] = axpy( factor, array[ i ], 0, c );
-        i++;
+
+// z[0..xl+yl) := x * y
+static void basecase_mul( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    if ( xl == 0 ) {
+        clear_digits( z, yl );
+        return;
     }
-    return c;
+    z[ yl ] = DigitKernels::mul_1( z, y, yl, x[ 0 ] );
+    for ( std::int32_t i = 1; i < xl; i++ )
+        z[ i + yl ] = DigitKernels::addmul_1( z + i, y, yl, x[ i ] );
 }
 
 
-Digit *IntegerOps::copyDigits( Digit *source, std::size_t length, std::int32_t toCopy ) {
-    Digit              *x = new_resource_array<Digit>( length );
-    for ( std::int32_t i  = toCopy - 1; i >= 0; i-- )
-        x[ i ] = source[ i ];
-    return x;
+// z[0..2n) := x * x, computing each product x[i]*x[j] (i < j) once
+static void basecase_sqr( Digit *z, const Digit *x, std::int32_t n ) {
+    clear_digits( z, 2 * n );
+    for ( std::int32_t i = 0; i < n; i++ )
+        z[ i + n ] = DigitKernels::addmul_1( z + 2 * i + 1, x + i + 1, n - i - 1, x[ i ] );
+
+    // double the off-diagonal products and add the squares
+    Digit carry = DigitKernels::add_n( z, z, z, 2 * n );
+    Digit c     = 0;
+    for ( std::int32_t i = 0; i < n; i++ ) {
+        Digit hi = 0;
+        Digit lo = IntegerOps::axpy( x[ i ], x[ i ], 0, hi );
+        z[ 2 * i ]     = IntegerOps::xpy( z[ 2 * i ], lo, c );
+        z[ 2 * i + 1 ] = IntegerOps::xpy( z[ 2 * i + 1 ], hi, c );
+    }
+    st_assert( carry == 0 and c == 0, "square overflow" );
 }
 
 
-Digit *IntegerOps::qr_decomposition_single_digit( Digit *x, std::size_t length, Digit divisor ) {
-    Digit              c = 0;
-    for ( std::size_t i = length - 1; i >= 0; i-- )
-        x[ i + 1 ] = xdy( x[ i ], divisor, c );
-    x[ 0 ]         = c;
-    return x;
+static void multiply_digits( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl );
+
+
+// z[0..xl+yl) := x * y for xl >= yl > (xl + 1) / 2
+//
+// With x = x1*B^h + x0 and y = y1*B^h + y0:
+// x*y = z2*B^2h + ((x0 + x1)*(y0 + y1) - z2 - z0)*B^h + z0, where z0 = x0*y0 and z2 = x1*y1
+static void karatsuba_mul( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    const bool         square = x == y and xl == yl;
+    const std::int32_t h      = ( xl + 1 ) / 2;
+    const std::int32_t zl     = xl + yl;
+    st_assert( yl > h, "operands not balanced" );
+
+    ResourceMark resourceMark;
+
+    // z0 and z2 go straight into the (disjoint) low and high halves of z
+    multiply_digits( z, x, h, y, h );
+    multiply_digits( z + 2 * h, x + h, xl - h, y + h, yl - h );
+
+    Digit *sx = new_resource_array<Digit>( h + 1 );
+    sx[ h ] = add_digits( sx, x, h, x + h, xl - h );
+    std::int32_t sxl = trimmed_length( sx, h + 1 );
+    Digit        *sy = sx;
+    std::int32_t syl = sxl;
+    if ( not square ) {
+        sy = new_resource_array<Digit>( h + 1 );
+        sy[ h ] = add_digits( sy, y, h, y + h, yl - h );
+        syl = trimmed_length( sy, h + 1 );
+    }
+
+    std::int32_t tl = sxl + syl;
+    Digit        *t = new_resource_array<Digit>( tl );
+    multiply_digits( t, sx, sxl, sy, syl );
+    Digit borrow = sub_from_digits( t, tl, z, min( 2 * h, tl ) );
+    borrow += sub_from_digits( t, tl, z + 2 * h, trimmed_length( z + 2 * h, zl - 2 * h ) );
+    st_assert( borrow == 0, "negative middle term" );
+
+    Digit carry = add_to_digits( z + h, zl - h, t, trimmed_length( t, tl ) );
+    st_assert( carry == 0, "product overflow" );
+}
+
+
+// Signed values for the evaluation and interpolation of Toom-3: a magnitude of length digits
+// (which may have leading zeros) and a sign.
+struct SignedDigits {
+    Digit        *digits;
+    std::int32_t length;
+    bool         negative;
+};
+
+
+static SignedDigits new_signed_digits( std::int32_t length ) {
+    SignedDigits result{ new_resource_array<Digit>( length ), length, false };
+    clear_digits( result.digits, length );
+    return result;
+}
+
+
+// r := a + b, or a - b if subtract; r may be a or b
+static void signed_add( SignedDigits &r, const SignedDigits &a, const SignedDigits &b, bool subtract ) {
+    std::int32_t al    = trimmed_length( a.digits, a.length );
+    std::int32_t bl    = trimmed_length( b.digits, b.length );
+    bool         a_neg = a.negative;
+    bool         b_neg = b.negative not_eq subtract;
+    std::int32_t l     = max( al, bl );
+    st_assert( l < r.length, "signed digits overflow" );
+
+    if ( a_neg == b_neg ) {
+        r.digits[ l ] = al >= bl ? add_digits( r.digits, a.digits, al, b.digits, bl ) : add_digits( r.digits, b.digits, bl, a.digits, al );
+        l++;
+        r.negative = a_neg;
+    } else if ( compare_digits( a.digits, al, b.digits, bl ) >= 0 ) {
+        sub_digits( r.digits, a.digits, al, b.digits, bl );
+        r.negative = a_neg;
+    } else {
+        sub_digits( r.digits, b.digits, bl, a.digits, al );
+        r.negative = b_neg;
+    }
+    clear_digits( r.digits + l, r.length - l );
+    if ( trimmed_length( r.digits, l ) == 0 )
+        r.negative = false;
+}
+
+
+// r := a * b
+static void signed_mul( SignedDigits &r, const SignedDigits &a, const SignedDigits &b ) {
+    std::int32_t al = trimmed_length( a.digits, a.length );
+    std::int32_t bl = trimmed_length( b.digits, b.length );
+    st_assert( al + bl <= r.length, "signed digits overflow" );
+    multiply_digits( r.digits, a.digits, al, b.digits, bl );
+    clear_digits( r.digits + al + bl, r.length - al - bl );
+    r.negative = al not_eq 0 and bl not_eq 0 and a.negative not_eq b.negative;
 }
 
 
-Digit IntegerOps::qr_estimate_digit_quotient( Digit &xhi, Digit xlo, Digit y ) {
-    if ( xhi == y )
-        return oneB;
-    return xdy( xlo, y, xhi );
+// r := r / d for d in {2, 3}; the division must be exact
+static void signed_divide_exactly( SignedDigits &r, Digit d ) {
+    Digit c = DigitKernels::divrem_1( r.digits, r.digits, r.length, d );
+    st_assert( c == 0, "inexact division" );
 }
 
 
-Digit IntegerOps::qr_calculate_remainder( Digit *qr, Digit *divisor, Digit q, std::int32_t qrStart, std::int32_t stop ) {
-    Digit        c = 0;
-    std::int32_t j = qrStart;
-    std::int32_t k = 0;
-    Digit        b = 0;
-    while ( k < stop ) {
-        qr[ j ]   = xmy( qr[ j ], 0, b );
-        Digit qyk = axpy( q, divisor[ k ], 0, c );
-        Digit c2  = 0;
-        qr[ j ] = xmy( qr[ j ], qyk, c2 );
-        b = xpy( b, c2, c );
-        st_assert( c == 0, "Overflow" );
+// evaluates x = x2*B^2k + x1*B^k + x0 at 1, -1 and -2
+static void toom3_evaluate( const Digit *x, std::int32_t xl, std::int32_t k, SignedDigits &at1, SignedDigits &at_1, SignedDigits &at_2 ) {
+    SignedDigits x0{ const_cast<Digit *>( x ), k, false };
+    SignedDigits x1{ const_cast<Digit *>( x + k ), k, false };
+    SignedDigits x2{ const_cast<Digit *>( x + 2 * k ), xl - 2 * k, false };
+
+    signed_add( at_2, x0, x2, false );          // x0 + x2
+    signed_add( at1, at_2, x1, false );         // x0 + x1 + x2
+    signed_add( at_1, at_2, x1, true );         // x0 - x1 + x2
+    signed_add( at_2, at_1, x2, false );        // x0 - x1 + 2*x2
+    signed_add( at_2, at_2, at_2, false );      // 2*x0 - 2*x1 + 4*x2
+    signed_add( at_2, at_2, x0, true );         // x0 - 2*x1 + 4*x2
+}
+
+
+// z[0..xl+yl) := x * y for xl >= yl > 2 * ceiling(xl / 3)
+//
+// The operands are split into three parts of k digits, the product polynomial is evaluated at
+// 0, 1, -1, -2 and infinity and interpolated with Bodrato's sequence; the products at 0 and
+// infinity go straight into z.
+static void toom3_mul( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    const bool         square = x == y and xl == yl;
+    const std::int32_t k      = ( xl + 2 ) / 3;
+    const std::int32_t zl     = xl + yl;
+    const std::int32_t length = 2 * k + 4;      // enough for the values at 1, -1 and -2 and their products
+    st_assert( yl > 2 * k, "operands not balanced" );
+
+    ResourceMark resourceMark;
 
-        j++;
-        k++;
+    SignedDigits x1  = new_signed_digits( length );
+    SignedDigits x_1 = new_signed_digits( length );
+    SignedDigits x_2 = new_signed_digits( length );
+    toom3_evaluate( x, xl, k, x1, x_1, x_2 );
+    SignedDigits y1  = x1;
+    SignedDigits y_1 = x_1;
+    SignedDigits y_2 = x_2;
+    if ( not square ) {
+        y1  = new_signed_digits( length );
+        y_1 = new_signed_digits( length );
+        y_2 = new_signed_digits( length );
+        toom3_evaluate( y, yl, k, y1, y_1, y_2 );
+    }
+
+    // r0 = x0*y0 and r4 = x2*y2; the middle of z receives r1..r3 later
+    multiply_digits( z, x, k, y, k );
+    clear_digits( z + 2 * k, 2 * k );
+    multiply_digits( z + 4 * k, x + 2 * k, xl - 2 * k, y + 2 * k, yl - 2 * k );
+    SignedDigits r0{ z, 2 * k, false };
+    SignedDigits r4{ z + 4 * k, zl - 4 * k, false };
+
+    SignedDigits r1 = new_signed_digits( length );
+    SignedDigits r2 = new_signed_digits( length );
+    SignedDigits r3 = new_signed_digits( length );
+    signed_mul( r1, x1, y1 );                   // r(1)
+    signed_mul( r2, x_1, y_1 );                 // r(-1)
+    signed_mul( r3, x_2, y_2 );                 // r(-2)
+
+    signed_add( r3, r3, r1, true );             // r3 := (r(-2) - r(1)) / 3
+    signed_divide_exactly( r3, 3 );
+    signed_add( r1, r1, r2, true );             // r1 := (r(1) - r(-1)) / 2
+    signed_divide_exactly( r1, 2 );
+    signed_add( r2, r2, r0, true );             // r2 := r(-1) - r0
+    signed_add( r3, r2, r3, true );             // r3 := (r2 - r3) / 2 + 2 * r4
+    signed_divide_exactly( r3, 2 );
+    signed_add( r3, r3, r4, false );
+    signed_add( r3, r3, r4, false );
+    signed_add( r2, r2, r1, false );            // r2 := r2 + r1 - r4
+    signed_add( r2, r2, r4, true );
+    signed_add( r1, r1, r3, true );             // r1 := r1 - r3
+    st_assert( not r1.negative and not r2.negative and not r3.negative, "negative coefficient" );
+
+    Digit carry = add_to_digits( z + k, zl - k, r1.digits, trimmed_length( r1.digits, r1.length ) );
+    carry += add_to_digits( z + 2 * k, zl - 2 * k, r2.digits, trimmed_length( r2.digits, r2.length ) );
+    carry += add_to_digits( z + 3 * k, zl - 3 * k, r3.digits, trimmed_length( r3.digits, r3.length ) );
+    st_assert( carry == 0, "product overflow" );
+}
+
+
+// z[0..xl+yl) := x * y, with x consisting of pieces of yl digits
+static void unbalanced_mul( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    ResourceMark resourceMark;
+    Digit        *t = new_resource_array<Digit>( 2 * yl );
+    clear_digits( z, xl + yl );
+    for ( std::int32_t i = 0; i < xl; i += yl ) {
+        std::int32_t l = min( yl, xl - i );
+        multiply_digits( t, x + i, l, y, yl );
+        Digit carry = add_to_digits( z + i, xl + yl - i, t, l + yl );
+        st_assert( carry == 0, "product overflow" );
+    }
+}
+
+
+// z[0..xl+yl) := x * y; z must not overlap x or y
+static void multiply_digits( Digit *z, const Digit *x, std::int32_t xl, const Digit *y, std::int32_t yl ) {
+    if ( xl < yl ) {
+        std::swap( x, y );
+        std::swap( xl, yl );
+    }
+
+    if ( x == y and xl == yl ) {
+        if ( xl < max( IntegerOps::karatsuba_square_threshold, 4 ) ) {
+            basecase_sqr( z, x, xl );
+        } else if ( xl < max( IntegerOps::toom3_square_threshold, 5 ) ) {
+            karatsuba_mul( z, x, xl, x, xl );
+        } else {
+            toom3_mul( z, x, xl, x, xl );
+        }
+    } else if ( yl < max( IntegerOps::karatsuba_threshold, 4 ) ) {
+        basecase_mul( z, x, xl, y, yl );
+    } else if ( yl <= ( xl + 1 ) / 2 ) {
+        unbalanced_mul( z, x, xl, y, yl );
+    } else if ( yl < max( IntegerOps::toom3_threshold, 5 ) or yl <= 2 * ( ( xl + 2 ) / 3 ) ) {
+        karatsuba_mul( z, x, xl, y, yl );
+    } else {
+        toom3_mul( z, x, xl, y, yl );
     }
-    return b;
 }
 
 
-Digit IntegerOps::qr_adjust_for_underflow( Digit *qr, Digit *divisor, Digit q, std::int32_t qrStart, std::int32_t stop ) {
-    std::int32_t j = qrStart;
-    std::int32_t k = 0;
-    Digit        c = 0;
-    while ( k < stop ) {
-        qr[ j ] = xpy( qr[ j ], divisor[ k ], c );
-        j++;
-        k++;
+// q[0..al-bl] := a div b, r[0..bl) := a mod b for a normalized divisor (the most significant
+// bit of b[bl-1] is set) of at least two digits (Knuth, algorithm D)
+static void basecase_divide( Digit *q, Digit *r, const Digit *a, std::int32_t al, const Digit *b, std::int32_t bl ) {
+    st_assert( bl >= 2 and al >= bl and ( b[ bl - 1 ] >> ( logB - 1 ) ) == 1, "divisor not normalized" );
+
+    ResourceMark resourceMark;
+    Digit        *u = new_resource_array<Digit>( al + 1 );
+    copy_digits( u, a, al );
+    u[ al ] = 0;
+
+    const DoubleDigit b1 = b[ bl - 1 ];
+    const DoubleDigit b2 = b[ bl - 2 ];
+    for ( std::int32_t j = al - bl; j >= 0; j-- ) {
+        // estimate the quotient digit from the leading digits, it is at most 2 too large
+        DoubleDigit n    = ( DoubleDigit( u[ j + bl ] ) << logB ) | u[ j + bl - 1 ];
+        DoubleDigit qhat = n / b1;
+        DoubleDigit rhat = n % b1;
+        while ( qhat > oneB or qhat * b2 > ( ( rhat << logB ) | u[ j + bl - 2 ] ) ) {
+            qhat--;
+            rhat += b1;
+            if ( rhat > oneB )
+                break;
+        }
+
+        // u[j..j+bl] -= qhat * b, adding back b if that was once too often
+        Digit c      = DigitKernels::submul_1( u + j, b, bl, Digit( qhat ) );
+        Digit borrow = 0;
+        u[ j + bl ] = IntegerOps::xmy( u[ j + bl ], c, borrow );
+        if ( borrow not_eq 0 ) {
+            qhat--;
+            u[ j + bl ] += DigitKernels::add_n( u + j, u + j, b, bl );
+        }
+        q[ j ] = Digit( qhat );
+    }
+    copy_digits( r, u, bl );
+}
+
+
+static void divide_3n_2n( Digit *q, Digit *r, const Digit *a, const Digit *b, std::int32_t n );
+
+
+// the base case size of the recursive division: halving stops before it, so algorithm D always gets divisors of 2 or more digits
+static inline std::int32_t burnikel_ziegler_base() {
+    return max( IntegerOps::burnikel_ziegler_threshold, 4 );
+}
+
+
+// q[0..n) := a div b, r[0..n) := a mod b for a[0..2n) < b * B^n and a normalized b[0..n)
+static void divide_2n_1n( Digit *q, Digit *r, const Digit *a, const Digit *b, std::int32_t n ) {
+    if ( n % 2 not_eq 0 or n < burnikel_ziegler_base() ) {
+        ResourceMark resourceMark;
+        Digit        *t = new_resource_array<Digit>( n + 1 );
+        basecase_divide( t, r, a, 2 * n, b, n );
+        st_assert( t[ n ] == 0, "quotient overflow" );
+        copy_digits( q, t, n );
+        return;
     }
-    st_assert( c == 1, "Should have carry to balance borrow" ); // see Knuth p258 D6
-    return q - 1; // correct estimate
+
+    // a = [a1 a2 a3 a4] in digits of n/2: divide [a1 a2 a3] by b, then [r a4] by b
+    const std::int32_t h = n / 2;
+    ResourceMark       resourceMark;
+    Digit              *t = new_resource_array<Digit>( 3 * h );
+    divide_3n_2n( q + h, t + h, a + h, b, h );
+    copy_digits( t, a, h );
+    divide_3n_2n( q, r, t, b, h );
 }
 
 
-Digit IntegerOps::qr_adjust_for_over_estimate( Digit y1, Digit y2, Digit q, Digit xi, Digit xi2 ) {
-    //check if estimate is too large
-    Digit c   = 0;
-    Digit y2q = axpy( y2, q, 0, c );
-    if ( c > xi or ( c = xi and y2q > xi2 ) ) {
-        q--; // too large by 1
-        Digit c2 = 0;
-        xpy( xi, y1, c2 ); // add back divisor
+// q[0..n) := a div b, r[0..2n) := a mod b for a[0..3n) < b * B^n and a normalized b[0..2n)
+static void divide_3n_2n( Digit *q, Digit *r, const Digit *a, const Digit *b, std::int32_t n ) {
+    // a = [a1 a2 a3] and b = [b1 b2] in digits of n
+    const Digit *a12 = a + n;
+    const Digit *b1  = b + n;
+
+    ResourceMark resourceMark;
+    Digit        *d = new_resource_array<Digit>( 2 * n + 1 );        // [r1 a3], r1 may have n + 1 digits
+
+    if ( compare_digits( a + 2 * n, n, b1, n ) < 0 ) {
+        // q := [a1 a2] div b1, r1 := [a1 a2] mod b1
+        divide_2n_1n( q, d + n, a12, b1, n );
+        d[ 2 * n ] = 0;
+    } else {
+        // a1 = b1: q := B^n - 1, r1 := [a1 a2] - q * b1 = a2 + b1
+        for ( std::int32_t i = 0; i < n; i++ )
+            q[ i ] = oneB;
+        d[ 2 * n ] = add_digits( d + n, a12, n, b1, n );
+    }
+    copy_digits( d, a, n );
+
+    // [r1 a3] - q * b2 is the remainder; while it is negative, q is too large
+    Digit *qb2 = new_resource_array<Digit>( 2 * n );
+    multiply_digits( qb2, q, n, b, n );
+    while ( compare_digits( d, 2 * n + 1, qb2, 2 * n ) < 0 ) {
+        Digit carry = add_to_digits( d, 2 * n + 1, b, 2 * n );
+        st_assert( carry == 0, "remainder overflow" );
+        Digit borrow = 1;
+        for ( std::int32_t i = 0; borrow not_eq 0 and i < n; i++ )
+            q[ i ] = IntegerOps::xmy( q[ i ], 0, borrow );
+    }
+    sub_from_digits( d, 2 * n + 1, qb2, 2 * n );
+    st_assert( d[ 2 * n ] == 0, "remainder too large" );
+    copy_digits( r, d, 2 * n );
+}
+
 
-        if ( not c2 ) {
-            c   = 0;
-            y2q = axpy( y2, q, 0, c );
-            if ( c > xi or ( c = xi and y2q > xi2 ) )
-                q--; // too large by 2
+// q[0..al-bl] := a div b, r[0..bl) := a mod b for al >= bl >= 2
+//
+// Both operands are shifted left so that the divisor is normalized. Long divisions with a long quotient
+// use the recursive division of Burnikel and Ziegler ("Fast Recursive Division"), all others algorithm D.
+static void divide_digits( Digit *q, Digit *r, const Digit *a, std::int32_t al, const Digit *b, std::int32_t bl ) {
+    ResourceMark       resourceMark;
+    const std::int32_t ql        = al - bl + 1;
+    const bool         recursive = bl >= IntegerOps::burnikel_ziegler_minimum and ql >= bl;
+
+    // for the recursive division the divisor is also padded to n = j * 2^m digits with
+    // j < burnikel_ziegler_base(), so that the recursion can halve it down to the base case
+    std::int32_t n = bl;
+    if ( recursive ) {
+        std::int32_t m = 1;
+        while ( bl / m >= burnikel_ziegler_base() )
+            m *= 2;
+        n = ( bl + m - 1 ) / m * m;
+    }
+    const std::int32_t digits = n - bl;
+    const std::int32_t bits   = logB - length_in_bits( b[ bl - 1 ] );
+
+    Digit *bn = new_resource_array<Digit>( n );
+    shift_digits_left( bn, n, b, bl, digits, bits );
+
+    // the shifted dividend gets at least one leading zero bit and (for the recursive division) is split into t >= 2 blocks of n digits
+    const std::int32_t t  = max( ( al + digits + 1 + n - 1 ) / n, 2 );
+    Digit              *an = new_resource_array<Digit>( t * n );
+    shift_digits_left( an, t * n, a, al, digits, bits );
+
+    Digit *qn = new_resource_array<Digit>( ( t - 1 ) * n + 1 );
+    Digit *rn = new_resource_array<Digit>( n );
+    if ( recursive ) {
+        Digit *z = new_resource_array<Digit>( 2 * n );
+        copy_digits( z, an + ( t - 2 ) * n, 2 * n );
+        for ( std::int32_t i = t - 2; i >= 0; i-- ) {
+            divide_2n_1n( qn + i * n, rn, z, bn, n );
+            if ( i > 0 ) {
+                copy_digits( z, an + ( i - 1 ) * n, n );
+                copy_digits( z + n, rn, n );
+            }
         }
+        st_assert( trimmed_length( qn, ( t - 1 ) * n ) <= ql, "quotient too long" );
+    } else {
+        basecase_divide( qn, rn, an, al + 1, bn, bl );
+        st_assert( qn[ ql ] == 0, "quotient too long" );
     }
-    return q;
+
+    copy_digits( q, qn, ql );
+    shift_digits_right( r, bl, rn, n, digits, bits );
 }
 
 
-Digit IntegerOps::qr_scaling_factor( Digit firstDivisorDigit ) {
-    Digit c = 1;
-    return ( firstDivisorDigit == oneB ) ? 1 : xdy( 0, firstDivisorDigit + 1, c ); // d = B/(yn + 1)
+void IntegerOps::unsigned_mul( Integer &x, Integer &y, Integer &z ) {
+    std::int32_t xl = x.length();
+    std::int32_t yl = y.length();
+    multiply_digits( z.digits(), x.digits(), xl, y.digits(), yl );
+    z.set_signed_length( trimmed_length( z.digits(), xl + yl ) );
+}
+
+
+Digit *IntegerOps::copyDigits( Digit *source, std::size_t length, std::int32_t toCopy ) {
+    Digit              *x = new_resource_array<Digit>( length );
+    for ( std::int32_t i  = toCopy - 1; i >= 0; i-- )
+        x[ i ] = source[ i ];
+    return x;
 }
 
 
-void IntegerOps::qr_unscale_remainder( Digit *qr, Digit scalingFactor, std::size_t length ) {
-    Digit              c = 0;
-    for ( std::size_t i = length - 1; i >= 0; i-- )
-        qr[ i ] = xdy( qr[ i ], scalingFactor, c ); // undo scaling to get remainder
-    st_assert( c == 0, "qr scaling broken" );
+Digit *IntegerOps::qr_decomposition_single_digit( Digit *x, std::size_t length, Digit divisor ) {
+    x[ 0 ] = DigitKernels::divrem_1( x + 1, x, length, divisor );
+    return x;
 }
 
 
@@ -430,40 +839,7 @@ Digit *IntegerOps::qr_decomposition( Integer &dividend, Integer &y0 ) {
         return qr_decomposition_single_digit( x, dividendLength, y0._first_digit );
 
     // full division
-    x[ dividendLength ] = 0;
-    Digit *y = y0.digits();
-
-    Digit d = qr_scaling_factor( y[ divisorLength - 1 ] ); // d = B/(yn + 1)
-
-    if ( d > 1 ) {
-        x[ dividendLength ] = scale( x, d, dividendLength );
-        y = copyDigits( y, divisorLength, divisorLength );
-        Digit c = scale( y, d, divisorLength );
-
-        if ( c not_eq 0 ) st_fatal( "qr_decomposition broken" );
-    }
-
-    Digit        y1 = y[ divisorLength - 1 ];
-    Digit        y2 = y[ divisorLength - 2 ];
-    std::int32_t i  = dividendLength;
-    while ( i >= divisorLength ) {
-        Digit xi = x[ i ]; //x[i] gets overwritten by remainder so save it for later
-        Digit q  = qr_estimate_digit_quotient( x[ i ], x[ i - 1 ], y1 ); // estimate q = rem/y
-        //x[i] now contains remainder - used in test below
-        q = qr_adjust_for_over_estimate( y1, y2, q, x[ i ], x[ i - 2 ] );
-
-        Digit b = qr_calculate_remainder( x, y, q, i - divisorLength, divisorLength );
-        xmy( xi, 0, b );
-        if ( b ) { // underflow
-            x[ i ] = qr_adjust_for_underflow( x, y, q, i - divisorLength, divisorLength );
-        } else {
-            x[ i ] = q;
-        }
-        i--;
-    }
-    if ( d not_eq 1 ) {
-        qr_unscale_remainder( x, d, divisorLength );
-    }
+    divide_digits( x + divisorLength, x, dividend.digits(), dividendLength, y0.digits(), divisorLength );
     return x;
 }
 
@@ -631,12 +1007,7 @@ std::int32_t IntegerOps::unsigned_cmp( Integer &x, Integer &y ) {
 
 Digit IntegerOps::last_digit( Integer &x, Digit b ) {
     std::int32_t xl = x.length();
-    std::int32_t i  = xl;
-    Digit        c  = 0;
-    while ( i > 0 ) {
-        i--;
-        x[ i ] = xdy( x[ i ], b, c );
-    }
+    Digit        c  = DigitKernels::divrem_1( x.digits(), x.digits(), xl, b );
     if ( xl > 0 and x[ xl - 1 ] == 0 )
         x.set_signed_length( xl - 1 );
     return c;
@@ -810,25 +1181,16 @@ std::int32_t IntegerOps::double_to_Integer_result_size_in_bytes( double x ) {
 
 
 std::int32_t IntegerOps::string_to_Integer_result_size_in_bytes( const char *s, std::int32_t base ) {
-    // for now: implement for base 10 only, use simple heuristics
-    if ( base == 10 ) {
-        std::int32_t i = 0;
-        while ( s[ i ] not_eq '\x0' )
-            i++;
-        return Integer::length_to_size_in_bytes( i / 9 + 1 );
-    }
-    st_fatal( "string conversion with base not equal to 10" );
-    return -1;
+    st_assert( 2 <= base and base <= DIGITS_BASE, "illegal base" );
+    // a character adds at most length_in_bits(base - 1) bits
+    return Integer::length_to_size_in_bytes( strlen( s ) * ::length_in_bits( base - 1 ) / logB + 1 );
 }
 
 
 std::int32_t IntegerOps::Integer_to_string_result_size_in_bytes( Integer &x, std::int32_t base ) {
-    // for now: implement for base 10 only, use simple heuristics
-    if ( base == 10 ) {
-        return ( x.length() + 1 ) * 10; // add one for sign & zero
-    }
-    st_fatal( "string conversion with base not equal to 10" );
-    return -1;
+    st_assert( 2 <= base and base <= DIGITS_BASE, "illegal base" );
+    // a character takes at least length_in_bits(base) - 1 bits; add one for sign, zero and the terminating null
+    return x.length() * logB / ( ::length_in_bits( base ) - 1 ) + 3;
 }
 
 
@@ -1278,50 +1640,261 @@ void IntegerOps::double_to_Integer( double x, Integer &z ) {
 }
 
 
-void IntegerOps::string_to_Integer( const char *s, std::int32_t base, Integer &z ) {
-    int_to_Integer( 0, z );
-    std::int32_t i = s[ 0 ] == '-';
-    while ( s[ i ] != '\x00' ) {
-        first_digit( z, base, as_Digit( s[ i ] ) );
-        i++;
+// -----------------------------------------------------------------------------
+// Radix conversion.
+//
+// Power of two bases just regroup bits. The other bases convert chars_per_digit characters at a
+// time (big_base = base^chars_per_digit fits into a Digit), and long numbers and strings are split
+// recursively at the powers big_base^(2^i): printing divides by a power and prints quotient and
+// remainder, parsing multiplies the value of the leading characters by a power and adds the value
+// of the trailing ones. With the subquadratic multiplication and division above, both directions
+// are subquadratic. The powers are computed by squaring and cached per base on the C heap.
+
+struct RadixPowers {
+    static constexpr std::int32_t max_levels = 32;
+
+    std::int32_t levels;                    // number of powers computed
+    Digit        *power[max_levels];        // big_base^(2^i)
+    std::int32_t length[max_levels];        // length of power[i] in digits
+};
+
+static RadixPowers radix_powers[DIGITS_BASE + 1];
+
+
+static inline std::int32_t chars_per_digit( std::int32_t base ) {
+    return IntegerOps::max_power( base );
+}
+
+
+// the number of bits per character for power of two bases, 0 for the other bases
+static inline std::int32_t bits_per_char( std::int32_t base ) {
+    return ( base & ( base - 1 ) ) == 0 ? length_in_bits( base ) - 1 : 0;
+}
+
+
+// the powers of base up to big_base^(2^level)
+static const RadixPowers &radix_powers_for( std::int32_t base, std::int32_t level ) {
+    RadixPowers &p = radix_powers[ base ];
+    if ( p.levels == 0 ) {
+        p.power[ 0 ]    = new_c_heap_array<Digit>( 1 );
+        p.power[ 0 ][0] = IntegerOps::power( base, chars_per_digit( base ) );
+        p.length[ 0 ]   = 1;
+        p.levels        = 1;
     }
-    if ( s[ 0 ] == '-' )
-        neg( z );
+    st_assert( level < RadixPowers::max_levels, "number too large" );
+    while ( p.levels <= level ) {
+        std::int32_t i      = p.levels;
+        std::int32_t l      = p.length[ i - 1 ];
+        Digit        *square = new_c_heap_array<Digit>( 2 * l );
+        multiply_digits( square, p.power[ i - 1 ], l, p.power[ i - 1 ], l );
+        p.power[ i ]  = square;
+        p.length[ i ] = trimmed_length( square, 2 * l );
+        p.levels++;
+    }
+    return p;
 }
 
 
-void IntegerOps::Integer_to_string( const Integer &x, std::int32_t base, char *s ) {
+// writes the characters of x to s[0..count), with leading zeros; x < base^count
+static void basecase_to_chars( const Digit *x, std::int32_t xl, std::int32_t base, char *s, std::int32_t count ) {
+    ResourceMark       resourceMark;
+    const std::int32_t m        = chars_per_digit( base );
+    const Digit        big_base = IntegerOps::power( base, m );
+    Digit              *t       = new_resource_array<Digit>( xl + 1 );
+    copy_digits( t, x, xl );
+    std::int32_t tl = trimmed_length( t, xl );
+    std::int32_t i  = count;
+    while ( tl > 0 ) {
+        Digit c = DigitKernels::divrem_1( t, t, tl, big_base );
+        tl = trimmed_length( t, tl );
+        for ( std::int32_t k = 0; k < m and i > 0; k++ ) {
+            s[ --i ] = IntegerOps::as_char( c % base );
+            c /= base;
+        }
+        st_assert( c == 0, "too many characters" );
+    }
+    while ( i > 0 )
+        s[ --i ] = '0';
+}
 
-    st_assert( 2 <= base and base <= DIGITS_BASE, "illegal base" );
-    st_assert( x.size_in_bytes() <= 10001 * sizeof( Digit ), "temporary array too small" );
 
-    Integer t;
-    copy( x, t );
+// writes the chars_per_digit * 2^level characters of x < big_base^(2^level) to s, with leading zeros
+static void digits_to_chars_padded( const Digit *x, std::int32_t xl, std::int32_t base, std::int32_t level, char *s ) {
+    const std::int32_t count = chars_per_digit( base ) << level;
+    xl = trimmed_length( x, xl );
+    if ( level < 2 or xl < max( IntegerOps::radix_conversion_threshold, 4 ) ) {
+        basecase_to_chars( x, xl, base, s, count );
+        return;
+    }
+
+    // x = q * big_base^(2^(level-1)) + r
+    const RadixPowers  &p   = radix_powers_for( base, level - 1 );
+    const Digit        *pd  = p.power[ level - 1 ];
+    const std::int32_t pl   = p.length[ level - 1 ];
+    const std::int32_t half = count / 2;
+    if ( xl < pl ) {
+        basecase_to_chars( x, 0, base, s, half );
+        digits_to_chars_padded( x, xl, base, level - 1, s + half );
+        return;
+    }
+    ResourceMark resourceMark;
+    Digit        *q = new_resource_array<Digit>( xl - pl + 1 );
+    Digit        *r = new_resource_array<Digit>( pl );
+    divide_digits( q, r, x, xl, pd, pl );
+    digits_to_chars_padded( q, xl - pl + 1, base, level - 1, s );
+    digits_to_chars_padded( r, pl, base, level - 1, s + half );
+}
 
-    // convert t into s (destructive)
-    std::int32_t i = 0;
-    do {
-        s[ i ] = as_char( last_digit( t, base ) );
-        i++;
-    } while ( t.is_not_zero() );
 
-    if ( x.is_negative() ) {
-        s[ i ] = '-';
-        i++;
+// writes the characters of x > 0 to s, without leading zeros; returns the end of the characters
+static char *digits_to_chars( const Digit *x, std::int32_t xl, std::int32_t base, char *s ) {
+    xl = trimmed_length( x, xl );
+    ResourceMark resourceMark;
+
+    if ( xl < max( IntegerOps::radix_conversion_threshold, 4 ) ) {
+        const std::int32_t count = xl * ( chars_per_digit( base ) + 1 );
+        char               *t    = new_resource_array<char>( count );
+        basecase_to_chars( x, xl, base, t, count );
+        std::int32_t i = 0;
+        while ( t[ i ] == '0' )
+            i++;
+        while ( i < count )
+            *s++ = t[ i++ ];
+        return s;
+    }
+
+    // split at the largest power with about half the digits of x: x = q * big_base^(2^level) + r
+    std::int32_t level = 1;
+    while ( 2 * radix_powers_for( base, level ).length[ level ] - 1 <= ( xl + 1 ) / 2 )
+        level++;
+    const RadixPowers  &p  = radix_powers_for( base, level );
+    const Digit        *pd = p.power[ level ];
+    const std::int32_t pl  = p.length[ level ];
+    Digit              *q  = new_resource_array<Digit>( xl - pl + 1 );
+    Digit              *r  = new_resource_array<Digit>( pl );
+    divide_digits( q, r, x, xl, pd, pl );
+    s = digits_to_chars( q, xl - pl + 1, base, s );
+    digits_to_chars_padded( r, pl, base, level, s );
+    return s + ( chars_per_digit( base ) << level );
+}
+
+
+// writes the characters of x > 0 for base = 2^bits to s, without leading zeros; returns the end of the characters
+static char *power_of_two_digits_to_chars( const Digit *x, std::int32_t xl, std::int32_t bits, char *s ) {
+    xl = trimmed_length( x, xl );
+    const std::int32_t count = ( ( xl - 1 ) * logB + length_in_bits( x[ xl - 1 ] ) + bits - 1 ) / bits;
+    for ( std::int32_t i = 0; i < count; i++ ) {
+        std::int32_t bit    = ( count - 1 - i ) * bits;
+        std::int32_t j      = bit / logB;
+        DoubleDigit  window = ( j + 1 < xl ? DoubleDigit( x[ j + 1 ] ) << logB : 0 ) | x[ j ];
+        s[ i ] = IntegerOps::as_char( std::int32_t( ( window >> ( bit % logB ) ) & ( ( 1 << bits ) - 1 ) ) );
+    }
+    return s + count;
+}
+
+
+// z := the value of the count characters at s; returns the length of z without leading zeros.
+// z must have room for ceiling(count / chars_per_digit) digits.
+static std::int32_t chars_to_digits( const char *s, std::int32_t count, std::int32_t base, Digit *z ) {
+    const std::int32_t m = chars_per_digit( base );
+
+    if ( count <= m * max( IntegerOps::radix_conversion_threshold, 4 ) ) {
+        // one chunk of m characters (the first one may be shorter) at a time: z := z * base^m + chunk
+        std::int32_t zl = 0;
+        std::int32_t i  = 0;
+        while ( i < count ) {
+            std::int32_t l      = i == 0 and count % m not_eq 0 ? count % m : m;
+            Digit        c      = 0;
+            Digit        factor = 1;
+            for ( std::int32_t k = 0; k < l; k++ ) {
+                c = c * base + IntegerOps::as_Digit( s[ i + k ] );
+                factor *= base;
+            }
+            Digit hi = DigitKernels::mul_1( z, z, zl, factor );
+            for ( std::int32_t j = 0; c not_eq 0 and j < zl; j++ )
+                z[ j ] = IntegerOps::xpy( z[ j ], 0, c );
+            hi += c;
+            if ( hi not_eq 0 )
+                z[ zl++ ] = hi;
+            i += l;
+        }
+        return zl;
     }
 
-    s[ i ] = '\0';
-    // reverse string
-    std::int32_t j = i - 1;
-    i = 0;
-    while ( i < j ) {
-        char c = s[ i ];
-        s[ i ] = s[ j ];
-        s[ j ] = c;
-        i++;
-        j--;
+    // split off the trailing chars_per_digit * 2^level characters, about half of them:
+    // z = high * big_base^(2^level) + low
+    std::int32_t level = 0;
+    while ( ( m << ( level + 1 ) ) <= count / 2 )
+        level++;
+    const std::int32_t low_count  = m << level;
+    const std::int32_t high_count = count - low_count;
+    const std::int32_t zl         = ( count + m - 1 ) / m;
+
+    ResourceMark       resourceMark;
+    const RadixPowers  &p   = radix_powers_for( base, level );
+    const std::int32_t pl   = p.length[ level ];
+    Digit              *high = new_resource_array<Digit>( ( high_count + m - 1 ) / m );
+    std::int32_t       hl    = chars_to_digits( s, high_count, base, high );
+    Digit              *t    = new_resource_array<Digit>( hl + pl );
+    multiply_digits( t, high, hl, p.power[ level ], pl );
+
+    std::int32_t ll = chars_to_digits( s + high_count, low_count, base, z );
+    clear_digits( z + ll, zl - ll );
+    Digit carry = add_to_digits( z, zl, t, trimmed_length( t, hl + pl ) );
+    st_assert( carry == 0, "value overflow" );
+    return trimmed_length( z, zl );
+}
+
+
+// z := the value of the count characters at s for base = 2^bits; returns the length of z without leading zeros.
+// z must have room for ceiling(count * bits / logB) digits.
+static std::int32_t power_of_two_chars_to_digits( const char *s, std::int32_t count, std::int32_t bits, Digit *z ) {
+    const std::int32_t zl = ( count * bits + logB - 1 ) / logB;
+    clear_digits( z, zl );
+    for ( std::int32_t i = 0; i < count; i++ ) {
+        std::int32_t bit   = ( count - 1 - i ) * bits;
+        DoubleDigit  value = DoubleDigit( IntegerOps::as_Digit( s[ i ] ) ) << ( bit % logB );
+        z[ bit / logB ] |= Digit( value );
+        if ( ( value >> logB ) not_eq 0 )
+            z[ bit / logB + 1 ] |= Digit( value >> logB );
     }
+    return trimmed_length( z, zl );
+}
+
 
+void IntegerOps::string_to_Integer( const char *s, std::int32_t base, Integer &z ) {
+    st_assert( 2 <= base and base <= DIGITS_BASE, "illegal base" );
+
+    const bool         negative = s[ 0 ] == '-';
+    const char         *chars   = negative ? s + 1 : s;
+    const std::int32_t count    = strlen( chars );
+    const std::int32_t bits     = bits_per_char( base );
+
+    ResourceMark resourceMark;
+    Digit        *t = new_resource_array<Digit>( count / ( bits not_eq 0 ? logB / bits : chars_per_digit( base ) ) + 1 );
+    std::int32_t l  = bits not_eq 0 ? power_of_two_chars_to_digits( chars, count, bits, t ) : chars_to_digits( chars, count, base, t );
+    copy_digits( z.digits(), t, l );
+    z.set_signed_length( l );
+    if ( negative )
+        neg( z );
+}
+
+
+void IntegerOps::Integer_to_string( const Integer &x, std::int32_t base, char *s ) {
+    st_assert( 2 <= base and base <= DIGITS_BASE, "illegal base" );
+
+    if ( x.is_negative() )
+        *s++ = '-';
+
+    const std::int32_t bits = bits_per_char( base );
+    if ( x.is_zero() ) {
+        *s++ = '0';
+    } else if ( bits not_eq 0 ) {
+        s = power_of_two_digits_to_chars( x.digits(), x.length(), bits, s );
+    } else {
+        s = digits_to_chars( x.digits(), x.length(), base, s );
+    }
+    *s = '\0';
 }
 
 
@@ -28,6 +28,15 @@ constexpr std::int32_t digitBitLength = sizeof( Digit ) * 8;   //
 class IntegerOps : AllStatic {
 
 public:
+    // crossover points (in digits) of the multiplication and division algorithms, see IntegerOps.cpp
+    static std::int32_t karatsuba_threshold;            // Karatsuba instead of basecase multiplication
+    static std::int32_t toom3_threshold;                // Toom-3 instead of Karatsuba
+    static std::int32_t karatsuba_square_threshold;     // the same for squares
+    static std::int32_t toom3_square_threshold;         //
+    static std::int32_t burnikel_ziegler_threshold;     // base case size of the recursive division
+    static std::int32_t burnikel_ziegler_minimum;       // minimal divisor length for recursive division
+    static std::int32_t radix_conversion_threshold;     // recursive conversion to and from strings (except for power of two bases)
+
     static Digit as_Digit( char c );
 
     static char as_char( std::int32_t i );
@@ -71,28 +80,14 @@ public:
 
     static std::int32_t last_non_zero_index( Digit *z, std::int32_t lastIndex );
 
-    static Digit scale( Digit *array, Digit factor, std::size_t length );
-
     static bool sd_all_zero( Digit *digits, std::int32_t start, std::int32_t stop );
 
     static Digit *copyDigits( Digit *source, std::size_t length, std::int32_t toCopy );
 
     static Digit *qr_decomposition( Integer &x, Integer &y );
 
-    static Digit qr_estimate_digit_quotient( Digit &xhi, Digit xlo, Digit y );
-
     static Digit *qr_decomposition_single_digit( Digit *qr, std::size_t length, Digit divisor );
 
-    static Digit qr_calculate_remainder( Digit *qr, Digit *divisor, Digit q, std::int32_t qrStart, std::int32_t stop );
-
-    static Digit qr_adjust_for_underflow( Digit *qr, Digit *divisor, Digit q, std::int32_t qrStart, std::int32_t stop );
-
-    static Digit qr_adjust_for_over_estimate( Digit y1, Digit y2, Digit q, Digit xi, Digit xi2 );
-
-    static Digit qr_scaling_factor( Digit firstDivisorDigit );
-
-    static void qr_unscale_remainder( Digit *qr, Digit scalingFactor, std::size_t length );
-
     static Digit last_digit( Integer &x, Digit b );            // divides x by b and returns x mod b
     static void first_digit( Integer &x, Digit base, Digit carry );        // multiplies x by b and adds c
 
@@ -0,0 +1,212 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/utility/StringHash.hpp"
+#include "vm/runtime/flags.hpp"
+
+#if defined( __SSE2__ ) or ( defined( _M_IX86_FP ) and _M_IX86_FP >= 2 )
+#define STRING_HASH_SSE2
+#include <emmintrin.h>
+#endif
+
+
+StringHash::Version StringHash::_version = StringHash::Version::sampled;
+
+
+void StringHash::select_version( Version recorded ) {
+    switch ( StringHashVersion ) {
+        case 0:
+            _version = recorded;
+            break;
+        case 1:
+            _version = Version::sampled;
+            break;
+        case 2:
+            _version = Version::full_contents;
+            break;
+        default:
+            st_fatal( "StringHashVersion must be 0 (as recorded in the image), 1 or 2" );
+    }
+
+    if ( _version not_eq recorded ) {
+        SPDLOG_WARN( "string hash version {} differs from version {} of the image; hashed collections keyed by strings must be rehashed", static_cast<std::int32_t>( _version ), static_cast<std::int32_t>( recorded ) );
+    }
+}
+
+
+std::uint32_t StringHash::hash( const std::uint8_t *bytes, std::int32_t length ) {
+    return _version == Version::full_contents ? full_hash( bytes, length ) : sampled_hash( bytes, length );
+}
+
+
+std::uint32_t StringHash::hash( const std::uint16_t *chars, std::int32_t length ) {
+    return _version == Version::full_contents ? full_hash( chars, length ) : sampled_hash( chars, length );
+}
+
+
+// -----------------------------------------------------------------------------
+
+template<typename T>
+static std::uint32_t sampled( const T *chars, std::int32_t length ) {
+    if ( length == 0 )
+        return 1;
+    if ( length == 1 )
+        return chars[ 0 ];
+
+    std::uint32_t val;
+    val = chars[ 0 ];
+    val = ( val << 3 ) ^ ( chars[ 1 ] ^ val );
+    val = ( val << 3 ) ^ ( chars[ length - 1 ] ^ val );
+    val = ( val << 3 ) ^ ( chars[ length - 2 ] ^ val );
+    val = ( val << 3 ) ^ ( chars[ length / 2 ] ^ val );
+    val = ( val << 3 ) ^ ( length ^ val );
+    return val;
+}
+
+
+std::uint32_t StringHash::sampled_hash( const std::uint8_t *bytes, std::int32_t length ) {
+    return sampled( bytes, length );
+}
+
+
+std::uint32_t StringHash::sampled_hash( const std::uint16_t *chars, std::int32_t length ) {
+    return sampled( chars, length );
+}
+
+
+// -----------------------------------------------------------------------------
+
+// The full contents hash runs the characters through 8 independent lanes (character i goes to
+// lane i mod 8) with the round function of xxHash32, so that the lanes map onto two SSE2
+// registers of 4 32-bit lanes each. Characters after the last complete block of 8, and all
+// characters of strings shorter than a block, are mixed in one at a time.
+
+static constexpr std::uint32_t prime1 = 2654435761U;
+static constexpr std::uint32_t prime2 = 2246822519U;
+static constexpr std::uint32_t prime3 = 3266489917U;
+static constexpr std::uint32_t prime4 = 668265263U;
+static constexpr std::uint32_t prime5 = 374761393U;
+
+static constexpr std::int32_t number_of_lanes = 8;
+
+
+static inline std::uint32_t rotate_left( std::uint32_t x, std::int32_t bits ) {
+    return ( x << bits ) | ( x >> ( 32 - bits ) );
+}
+
+
+static inline std::uint32_t lane_round( std::uint32_t lane, std::uint32_t c ) {
+    return rotate_left( lane + c * prime2, 13 ) * prime1;
+}
+
+
+static inline void init_lanes( std::uint32_t *lanes ) {
+    for ( std::int32_t j = 0; j < number_of_lanes; j++ ) {
+        lanes[ j ] = prime1 + j * prime2;
+    }
+}
+
+
+static inline std::uint32_t merge_lanes( const std::uint32_t *lanes ) {
+    std::uint32_t h = 0;
+    for ( std::int32_t j = 0; j < number_of_lanes; j++ ) {
+        h = ( h ^ lane_round( 0, lanes[ j ] ) ) * prime1 + prime4;
+    }
+    return h;
+}
+
+
+template<typename T>
+static inline std::uint32_t finish( std::uint32_t h, const T *chars, std::int32_t index, std::int32_t length ) {
+    h += length;
+    for ( ; index < length; index++ ) {
+        h = rotate_left( h + chars[ index ] * prime5, 11 ) * prime1;
+    }
+    h ^= h >> 15;
+    h *= prime2;
+    h ^= h >> 13;
+    h *= prime3;
+    h ^= h >> 16;
+    return h;
+}
+
+
+#ifdef STRING_HASH_SSE2
+
+static inline __m128i multiply_low( __m128i a, __m128i b ) {
+    // SSE2 has no 32-bit multiply keeping the low halves; multiply the even and the odd lanes separately
+    __m128i even = _mm_mul_epu32( a, b );
+    __m128i odd  = _mm_mul_epu32( _mm_srli_epi64( a, 32 ), _mm_srli_epi64( b, 32 ) );
+    return _mm_unpacklo_epi32( _mm_shuffle_epi32( even, _MM_SHUFFLE( 0, 0, 2, 0 ) ), _mm_shuffle_epi32( odd, _MM_SHUFFLE( 0, 0, 2, 0 ) ) );
+}
+
+
+static inline __m128i lane_round( __m128i lanes, __m128i c ) {
+    lanes = _mm_add_epi32( lanes, multiply_low( c, _mm_set1_epi32( static_cast<std::int32_t>( prime2 ) ) ) );
+    lanes = _mm_or_si128( _mm_slli_epi32( lanes, 13 ), _mm_srli_epi32( lanes, 19 ) );
+    return multiply_low( lanes, _mm_set1_epi32( static_cast<std::int32_t>( prime1 ) ) );
+}
+
+
+// widens the next 8 characters to 32 bits, lanes 0-3 into low and lanes 4-7 into high
+static inline void load_block( const std::uint8_t *bytes, __m128i *low, __m128i *high ) {
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i words = _mm_unpacklo_epi8( _mm_loadl_epi64( reinterpret_cast<const __m128i *>( bytes ) ), zero );
+    *low  = _mm_unpacklo_epi16( words, zero );
+    *high = _mm_unpackhi_epi16( words, zero );
+}
+
+
+static inline void load_block( const std::uint16_t *chars, __m128i *low, __m128i *high ) {
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i words = _mm_loadu_si128( reinterpret_cast<const __m128i *>( chars ) );
+    *low  = _mm_unpacklo_epi16( words, zero );
+    *high = _mm_unpackhi_epi16( words, zero );
+}
+
+#endif
+
+
+template<typename T>
+static std::uint32_t full( const T *chars, std::int32_t length ) {
+    if ( length < number_of_lanes ) {
+        return finish( prime5, chars, 0, length );
+    }
+
+    std::uint32_t lanes[number_of_lanes];
+    init_lanes( lanes );
+    std::int32_t index = 0;
+
+#ifdef STRING_HASH_SSE2
+    __m128i low  = _mm_loadu_si128( reinterpret_cast<const __m128i *>( &lanes[ 0 ] ) );
+    __m128i high = _mm_loadu_si128( reinterpret_cast<const __m128i *>( &lanes[ 4 ] ) );
+    for ( ; index + number_of_lanes <= length; index += number_of_lanes ) {
+        __m128i c_low, c_high;
+        load_block( &chars[ index ], &c_low, &c_high );
+        low  = lane_round( low, c_low );
+        high = lane_round( high, c_high );
+    }
+    _mm_storeu_si128( reinterpret_cast<__m128i *>( &lanes[ 0 ] ), low );
+    _mm_storeu_si128( reinterpret_cast<__m128i *>( &lanes[ 4 ] ), high );
+#else
+    for ( ; index + number_of_lanes <= length; index += number_of_lanes ) {
+        for ( std::int32_t j = 0; j < number_of_lanes; j++ ) {
+            lanes[ j ] = lane_round( lanes[ j ], chars[ index + j ] );
+        }
+    }
+#endif
+
+    return finish( merge_lanes( lanes ), chars, index, length );
+}
+
+
+std::uint32_t StringHash::full_hash( const std::uint8_t *bytes, std::int32_t length ) {
+    return full( bytes, length );
+}
+
+
+std::uint32_t StringHash::full_hash( const std::uint16_t *chars, std::int32_t length ) {
+    return full( chars, length );
+}
@@ -0,0 +1,60 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+
+
+// StringHash computes the hash values of byte and double byte strings (ByteArray, Symbol,
+// DoubleByteArray, String) and of the names in the SymbolTable.
+//
+// There are two versions:
+//   sampled         the original hash, mixing only the length and five sampled characters
+//   full_contents   mixes every character; strings sharing their first and last characters
+//                   (e.g. generated keys like 'order-000123-eu') no longer collide
+//
+// Hashes end up in the image (symbols' identity hashes, layouts of hashed collections), so the
+// version in use is the one the image was written with (see Bootstrap::check_version), unless
+// StringHashVersion overrides it.
+//
+// Both versions return the same value for a byte string and a double byte string with the
+// same characters.
+
+class StringHash : AllStatic {
+
+public:
+    enum class Version {
+        sampled       = 1,  //
+        full_contents = 2   //
+    };
+
+private:
+    static Version _version;
+
+public:
+    static Version version() {
+        return _version;
+    }
+
+
+    // called before the image is read, with the version recorded in the image file
+    static void select_version( Version recorded );
+
+    // hash in the selected version
+    static std::uint32_t hash( const std::uint8_t *bytes, std::int32_t length );
+
+    static std::uint32_t hash( const std::uint16_t *chars, std::int32_t length );
+
+    // the individual versions
+    static std::uint32_t sampled_hash( const std::uint8_t *bytes, std::int32_t length );
+
+    static std::uint32_t sampled_hash( const std::uint16_t *chars, std::int32_t length );
+
+    static std::uint32_t full_hash( const std::uint8_t *bytes, std::int32_t length );
+
+    static std::uint32_t full_hash( const std::uint16_t *chars, std::int32_t length );
+};
@@ -0,0 +1,515 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/utility/StringKernels.hpp"
+#include "vm/runtime/flags.hpp"
+#include "vm/memory/util.hpp"
+#include "vm/runtime/init.hpp"
+
+#if defined( __i386__ ) or defined( __x86_64__ ) or defined( _M_IX86 ) or defined( _M_X64 )
+#define STRING_KERNELS_X86
+#include <immintrin.h>
+#if defined( _MSC_VER )
+#include <intrin.h>
+#endif
+#endif
+
+// The SIMD kernels are compiled for their instruction set regardless of the flags the rest of
+// the vm is compiled with; they are only called if the processor supports them.
+#if defined( __GNUC__ )
+#define TARGET_SSE2 __attribute__(( target( "sse2" ) ))
+#define TARGET_AVX2 __attribute__(( target( "avx2" ) ))
+#else
+#define TARGET_SSE2
+#define TARGET_AVX2
+#endif
+
+
+// -----------------------------------------------------------------------------
+
+template<typename A, typename B>
+static std::int32_t scalar_mismatch( const A *a, const B *b, std::int32_t length ) {
+    for ( std::int32_t i = 0; i < length; i++ ) {
+        if ( a[ i ] not_eq b[ i ] )
+            return i;
+    }
+    return length;
+}
+
+
+template<typename T>
+static std::int32_t scalar_mismatch_ignoring_case( const T *a, const T *b, std::int32_t length ) {
+    for ( std::int32_t i = 0; i < length; i++ ) {
+        if ( a[ i ] not_eq b[ i ] and StringKernels::fold( a[ i ] ) not_eq StringKernels::fold( b[ i ] ) )
+            return i;
+    }
+    return length;
+}
+
+
+template<typename T>
+static std::int32_t scalar_index_of( const T *s, std::int32_t length, std::uint16_t c ) {
+    for ( std::int32_t i = 0; i < length; i++ ) {
+        if ( s[ i ] == c )
+            return i;
+    }
+    return -1;
+}
+
+
+template<typename T>
+static std::int32_t scalar_occurrences_of( const T *s, std::int32_t length, std::uint16_t c ) {
+    std::int32_t count = 0;
+    for ( std::int32_t i = 0; i < length; i++ ) {
+        if ( s[ i ] == c )
+            count++;
+    }
+    return count;
+}
+
+
+// the kernels of one level
+struct StringKernelTable {
+    std::int32_t (*mismatch_8_8)( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length );
+    std::int32_t (*mismatch_16_16)( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length );
+    std::int32_t (*mismatch_8_16)( const std::uint8_t *a, const std::uint16_t *b, std::int32_t length );
+    std::int32_t (*mismatch_ignoring_case_8)( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length );
+    std::int32_t (*mismatch_ignoring_case_16)( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length );
+    std::int32_t (*index_of_8)( const std::uint8_t *s, std::int32_t length, std::uint16_t c );
+    std::int32_t (*index_of_16)( const std::uint16_t *s, std::int32_t length, std::uint16_t c );
+    std::int32_t (*occurrences_of_8)( const std::uint8_t *s, std::int32_t length, std::uint16_t c );
+    std::int32_t (*occurrences_of_16)( const std::uint16_t *s, std::int32_t length, std::uint16_t c );
+};
+
+
+static const StringKernelTable scalar_kernels = {
+    &scalar_mismatch<std::uint8_t, std::uint8_t>,
+    &scalar_mismatch<std::uint16_t, std::uint16_t>,
+    &scalar_mismatch<std::uint8_t, std::uint16_t>,
+    &scalar_mismatch_ignoring_case<std::uint8_t>,
+    &scalar_mismatch_ignoring_case<std::uint16_t>,
+    &scalar_index_of<std::uint8_t>,
+    &scalar_index_of<std::uint16_t>,
+    &scalar_occurrences_of<std::uint8_t>,
+    &scalar_occurrences_of<std::uint16_t>,
+};
+
+
+#ifdef STRING_KERNELS_X86
+
+static inline std::int32_t lowest_bit( std::uint32_t mask ) {
+#if defined( _MSC_VER )
+    unsigned long index;
+    _BitScanForward( &index, mask );
+    return static_cast<std::int32_t>( index );
+#else
+    return __builtin_ctz( mask );
+#endif
+}
+
+
+// -----------------------------------------------------------------------------
+// SSE2: 16 bytes or 8 double bytes per step; movemask yields 2 bits per double byte
+
+TARGET_SSE2 static inline __m128i sse2_load( const void *p ) {
+    return _mm_loadu_si128( reinterpret_cast<const __m128i *>( p ) );
+}
+
+
+// sets the bits 0x20 of 'A'..'Z'; after biasing by 128 - 'A' the upper case letters are the
+// signed bytes below -128 + 26, so a single signed compare suffices
+TARGET_SSE2 static inline __m128i sse2_fold_8( __m128i x ) {
+    __m128i biased = _mm_add_epi8( x, _mm_set1_epi8( static_cast<char>( 128 - 'A' ) ) );
+    __m128i upper  = _mm_cmplt_epi8( biased, _mm_set1_epi8( static_cast<char>( -128 + 26 ) ) );
+    return _mm_or_si128( x, _mm_and_si128( upper, _mm_set1_epi8( 0x20 ) ) );
+}
+
+
+TARGET_SSE2 static inline __m128i sse2_fold_16( __m128i x ) {
+    __m128i biased = _mm_add_epi16( x, _mm_set1_epi16( static_cast<std::int16_t>( 0x8000 - 'A' ) ) );
+    __m128i upper  = _mm_cmplt_epi16( biased, _mm_set1_epi16( static_cast<std::int16_t>( -0x8000 + 26 ) ) );
+    return _mm_or_si128( x, _mm_and_si128( upper, _mm_set1_epi16( 0x20 ) ) );
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_mismatch_8_8( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length ) {
+    std::int32_t i = 0;
+    for ( ; i + 16 <= length; i += 16 ) {
+        std::uint32_t differ = ~_mm_movemask_epi8( _mm_cmpeq_epi8( sse2_load( a + i ), sse2_load( b + i ) ) ) & 0xFFFF;
+        if ( differ )
+            return i + lowest_bit( differ );
+    }
+    return i + scalar_mismatch( a + i, b + i, length - i );
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_mismatch_16_16( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length ) {
+    std::int32_t i = 0;
+    for ( ; i + 8 <= length; i += 8 ) {
+        std::uint32_t differ = ~_mm_movemask_epi8( _mm_cmpeq_epi16( sse2_load( a + i ), sse2_load( b + i ) ) ) & 0xFFFF;
+        if ( differ )
+            return i + lowest_bit( differ ) / 2;
+    }
+    return i + scalar_mismatch( a + i, b + i, length - i );
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_mismatch_8_16( const std::uint8_t *a, const std::uint16_t *b, std::int32_t length ) {
+    const __m128i zero = _mm_setzero_si128();
+    std::int32_t  i    = 0;
+    for ( ; i + 8 <= length; i += 8 ) {
+        __m128i       widened = _mm_unpacklo_epi8( _mm_loadl_epi64( reinterpret_cast<const __m128i *>( a + i ) ), zero );
+        std::uint32_t differ  = ~_mm_movemask_epi8( _mm_cmpeq_epi16( widened, sse2_load( b + i ) ) ) & 0xFFFF;
+        if ( differ )
+            return i + lowest_bit( differ ) / 2;
+    }
+    return i + scalar_mismatch( a + i, b + i, length - i );
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_mismatch_ignoring_case_8( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length ) {
+    std::int32_t i = 0;
+    for ( ; i + 16 <= length; i += 16 ) {
+        std::uint32_t differ = ~_mm_movemask_epi8( _mm_cmpeq_epi8( sse2_fold_8( sse2_load( a + i ) ), sse2_fold_8( sse2_load( b + i ) ) ) ) & 0xFFFF;
+        if ( differ )
+            return i + lowest_bit( differ );
+    }
+    return i + scalar_mismatch_ignoring_case( a + i, b + i, length - i );
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_mismatch_ignoring_case_16( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length ) {
+    std::int32_t i = 0;
+    for ( ; i + 8 <= length; i += 8 ) {
+        std::uint32_t differ = ~_mm_movemask_epi8( _mm_cmpeq_epi16( sse2_fold_16( sse2_load( a + i ) ), sse2_fold_16( sse2_load( b + i ) ) ) ) & 0xFFFF;
+        if ( differ )
+            return i + lowest_bit( differ ) / 2;
+    }
+    return i + scalar_mismatch_ignoring_case( a + i, b + i, length - i );
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_index_of_8( const std::uint8_t *s, std::int32_t length, std::uint16_t c ) {
+    if ( c > 0xFF )
+        return -1;
+    const __m128i needle = _mm_set1_epi8( static_cast<char>( c ) );
+    std::int32_t  i      = 0;
+    for ( ; i + 16 <= length; i += 16 ) {
+        std::uint32_t found = _mm_movemask_epi8( _mm_cmpeq_epi8( sse2_load( s + i ), needle ) );
+        if ( found )
+            return i + lowest_bit( found );
+    }
+    std::int32_t j = scalar_index_of( s + i, length - i, c );
+    return j < 0 ? -1 : i + j;
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_index_of_16( const std::uint16_t *s, std::int32_t length, std::uint16_t c ) {
+    const __m128i needle = _mm_set1_epi16( static_cast<std::int16_t>( c ) );
+    std::int32_t  i      = 0;
+    for ( ; i + 8 <= length; i += 8 ) {
+        std::uint32_t found = _mm_movemask_epi8( _mm_cmpeq_epi16( sse2_load( s + i ), needle ) );
+        if ( found )
+            return i + lowest_bit( found ) / 2;
+    }
+    std::int32_t j = scalar_index_of( s + i, length - i, c );
+    return j < 0 ? -1 : i + j;
+}
+
+
+// The counts are accumulated per byte (a compare yields -1 per match) for at most 255 steps,
+// then summed up with psadbw.
+TARGET_SSE2 static std::int32_t sse2_occurrences_of_8( const std::uint8_t *s, std::int32_t length, std::uint16_t c ) {
+    if ( c > 0xFF )
+        return 0;
+    const __m128i needle = _mm_set1_epi8( static_cast<char>( c ) );
+    const __m128i zero   = _mm_setzero_si128();
+    std::int32_t  count  = 0;
+    std::int32_t  i      = 0;
+    while ( i + 16 <= length ) {
+        std::int32_t steps = min( ( length - i ) / 16, 255 );
+        __m128i      acc   = zero;
+        for ( std::int32_t k = 0; k < steps; k++, i += 16 ) {
+            acc = _mm_sub_epi8( acc, _mm_cmpeq_epi8( sse2_load( s + i ), needle ) );
+        }
+        __m128i sums = _mm_sad_epu8( acc, zero );
+        count += _mm_cvtsi128_si32( sums ) + _mm_cvtsi128_si32( _mm_unpackhi_epi64( sums, sums ) );
+    }
+    return count + scalar_occurrences_of( s + i, length - i, c );
+}
+
+
+TARGET_SSE2 static std::int32_t sse2_occurrences_of_16( const std::uint16_t *s, std::int32_t length, std::uint16_t c ) {
+    const __m128i needle = _mm_set1_epi16( static_cast<std::int16_t>( c ) );
+    const __m128i ones   = _mm_set1_epi16( 1 );
+    std::int32_t  count  = 0;
+    std::int32_t  i      = 0;
+    while ( i + 8 <= length ) {
+        std::int32_t steps = min( ( length - i ) / 8, 32767 );
+        __m128i      acc   = _mm_setzero_si128();
+        for ( std::int32_t k = 0; k < steps; k++, i += 8 ) {
+            acc = _mm_sub_epi16( acc, _mm_cmpeq_epi16( sse2_load( s + i ), needle ) );
+        }
+        __m128i sums = _mm_madd_epi16( acc, ones );
+        sums = _mm_add_epi32( sums, _mm_shuffle_epi32( sums, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        sums = _mm_add_epi32( sums, _mm_shuffle_epi32( sums, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        count += _mm_cvtsi128_si32( sums );
+    }
+    return count + scalar_occurrences_of( s + i, length - i, c );
+}
+
+
+static const StringKernelTable sse2_kernels = {
+    &sse2_mismatch_8_8,
+    &sse2_mismatch_16_16,
+    &sse2_mismatch_8_16,
+    &sse2_mismatch_ignoring_case_8,
+    &sse2_mismatch_ignoring_case_16,
+    &sse2_index_of_8,
+    &sse2_index_of_16,
+    &sse2_occurrences_of_8,
+    &sse2_occurrences_of_16,
+};
+
+
+// -----------------------------------------------------------------------------
+// AVX2: 32 bytes or 16 double bytes per step, the remainder is left to the SSE2 kernels.
+// Only the bandwidth bound kernels have an AVX2 version.
+
+TARGET_AVX2 static inline __m256i avx2_load( const void *p ) {
+    return _mm256_loadu_si256( reinterpret_cast<const __m256i *>( p ) );
+}
+
+
+TARGET_AVX2 static std::int32_t avx2_mismatch_8_8( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length ) {
+    std::int32_t i = 0;
+    for ( ; i + 32 <= length; i += 32 ) {
+        std::uint32_t differ = ~static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( avx2_load( a + i ), avx2_load( b + i ) ) ) );
+        if ( differ )
+            return i + lowest_bit( differ );
+    }
+    return i + sse2_mismatch_8_8( a + i, b + i, length - i );
+}
+
+
+TARGET_AVX2 static std::int32_t avx2_mismatch_16_16( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length ) {
+    std::int32_t i = 0;
+    for ( ; i + 16 <= length; i += 16 ) {
+        std::uint32_t differ = ~static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi16( avx2_load( a + i ), avx2_load( b + i ) ) ) );
+        if ( differ )
+            return i + lowest_bit( differ ) / 2;
+    }
+    return i + sse2_mismatch_16_16( a + i, b + i, length - i );
+}
+
+
+TARGET_AVX2 static std::int32_t avx2_index_of_8( const std::uint8_t *s, std::int32_t length, std::uint16_t c ) {
+    if ( c > 0xFF )
+        return -1;
+    const __m256i needle = _mm256_set1_epi8( static_cast<char>( c ) );
+    std::int32_t  i      = 0;
+    for ( ; i + 32 <= length; i += 32 ) {
+        std::uint32_t found = static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi8( avx2_load( s + i ), needle ) ) );
+        if ( found )
+            return i + lowest_bit( found );
+    }
+    std::int32_t j = sse2_index_of_8( s + i, length - i, c );
+    return j < 0 ? -1 : i + j;
+}
+
+
+TARGET_AVX2 static std::int32_t avx2_index_of_16( const std::uint16_t *s, std::int32_t length, std::uint16_t c ) {
+    const __m256i needle = _mm256_set1_epi16( static_cast<std::int16_t>( c ) );
+    std::int32_t  i      = 0;
+    for ( ; i + 16 <= length; i += 16 ) {
+        std::uint32_t found = static_cast<std::uint32_t>( _mm256_movemask_epi8( _mm256_cmpeq_epi16( avx2_load( s + i ), needle ) ) );
+        if ( found )
+            return i + lowest_bit( found ) / 2;
+    }
+    std::int32_t j = sse2_index_of_16( s + i, length - i, c );
+    return j < 0 ? -1 : i + j;
+}
+
+
+TARGET_AVX2 static std::int32_t avx2_occurrences_of_8( const std::uint8_t *s, std::int32_t length, std::uint16_t c ) {
+    if ( c > 0xFF )
+        return 0;
+    const __m256i needle = _mm256_set1_epi8( static_cast<char>( c ) );
+    const __m256i zero   = _mm256_setzero_si256();
+    std::int32_t  count  = 0;
+    std::int32_t  i      = 0;
+    while ( i + 32 <= length ) {
+        std::int32_t steps = min( ( length - i ) / 32, 255 );
+        __m256i      acc   = zero;
+        for ( std::int32_t k = 0; k < steps; k++, i += 32 ) {
+            acc = _mm256_sub_epi8( acc, _mm256_cmpeq_epi8( avx2_load( s + i ), needle ) );
+        }
+        __m256i sums = _mm256_sad_epu8( acc, zero );
+        __m128i half = _mm_add_epi64( _mm256_castsi256_si128( sums ), _mm256_extracti128_si256( sums, 1 ) );
+        count += _mm_cvtsi128_si32( half ) + _mm_cvtsi128_si32( _mm_unpackhi_epi64( half, half ) );
+    }
+    return count + sse2_occurrences_of_8( s + i, length - i, c );
+}
+
+
+TARGET_AVX2 static std::int32_t avx2_occurrences_of_16( const std::uint16_t *s, std::int32_t length, std::uint16_t c ) {
+    const __m256i needle = _mm256_set1_epi16( static_cast<std::int16_t>( c ) );
+    const __m256i ones   = _mm256_set1_epi16( 1 );
+    std::int32_t  count  = 0;
+    std::int32_t  i      = 0;
+    while ( i + 16 <= length ) {
+        std::int32_t steps = min( ( length - i ) / 16, 32767 );
+        __m256i      acc   = _mm256_setzero_si256();
+        for ( std::int32_t k = 0; k < steps; k++, i += 16 ) {
+            acc = _mm256_sub_epi16( acc, _mm256_cmpeq_epi16( avx2_load( s + i ), needle ) );
+        }
+        __m256i sums = _mm256_madd_epi16( acc, ones );
+        __m128i half = _mm_add_epi32( _mm256_castsi256_si128( sums ), _mm256_extracti128_si256( sums, 1 ) );
+        half = _mm_add_epi32( half, _mm_shuffle_epi32( half, _MM_SHUFFLE( 1, 0, 3, 2 ) ) );
+        half = _mm_add_epi32( half, _mm_shuffle_epi32( half, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        count += _mm_cvtsi128_si32( half );
+    }
+    return count + sse2_occurrences_of_16( s + i, length - i, c );
+}
+
+
+static const StringKernelTable avx2_kernels = {
+    &avx2_mismatch_8_8,
+    &avx2_mismatch_16_16,
+    &sse2_mismatch_8_16,
+    &sse2_mismatch_ignoring_case_8,
+    &sse2_mismatch_ignoring_case_16,
+    &avx2_index_of_8,
+    &avx2_index_of_16,
+    &avx2_occurrences_of_8,
+    &avx2_occurrences_of_16,
+};
+
+#endif
+
+
+// -----------------------------------------------------------------------------
+
+StringKernels::Level           StringKernels::_level = StringKernels::Level::scalar;
+static const StringKernelTable *kernels              = &scalar_kernels;
+
+
+StringKernels::Level StringKernels::supported_level() {
+#if defined( STRING_KERNELS_X86 ) and defined( _MSC_VER )
+    std::int32_t info[4];
+    __cpuid( info, 0 );
+    const std::int32_t max_leaf = info[ 0 ];
+    __cpuid( info, 1 );
+    const bool sse2    = ( info[ 3 ] & ( 1 << 26 ) ) not_eq 0;
+    const bool osxsave = ( info[ 2 ] & ( 1 << 27 ) ) not_eq 0;
+    bool       avx2    = false;
+    if ( max_leaf >= 7 and osxsave and ( _xgetbv( 0 ) & 0x6 ) == 0x6 ) {
+        // the os saves the ymm registers
+        __cpuidex( info, 7, 0 );
+        avx2 = ( info[ 1 ] & ( 1 << 5 ) ) not_eq 0;
+    }
+    if ( avx2 )
+        return Level::avx2;
+    if ( sse2 )
+        return Level::sse2;
+#elif defined( STRING_KERNELS_X86 )
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports( "avx2" ) )
+        return Level::avx2;
+    if ( __builtin_cpu_supports( "sse2" ) )
+        return Level::sse2;
+#endif
+    return Level::scalar;
+}
+
+
+StringKernels::Level StringKernels::select( Level level ) {
+    Level supported = supported_level();
+    if ( static_cast<std::int32_t>( level ) > static_cast<std::int32_t>( supported ) )
+        level = supported;
+
+    switch ( level ) {
+#ifdef STRING_KERNELS_X86
+        case Level::avx2:
+            kernels = &avx2_kernels;
+            break;
+        case Level::sse2:
+            kernels = &sse2_kernels;
+            break;
+#endif
+        default:
+            level   = Level::scalar;
+            kernels = &scalar_kernels;
+            break;
+    }
+    _level = level;
+    return level;
+}
+
+
+const char *StringKernels::level_name( Level level ) {
+    switch ( level ) {
+        case Level::scalar:
+            return "scalar";
+        case Level::sse2:
+            return "sse2";
+        case Level::avx2:
+            return "avx2";
+    }
+    return "unknown";
+}
+
+
+std::int32_t StringKernels::mismatch( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length ) {
+    return kernels->mismatch_8_8( a, b, length );
+}
+
+
+std::int32_t StringKernels::mismatch( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length ) {
+    return kernels->mismatch_16_16( a, b, length );
+}
+
+
+std::int32_t StringKernels::mismatch( const std::uint8_t *a, const std::uint16_t *b, std::int32_t length ) {
+    return kernels->mismatch_8_16( a, b, length );
+}
+
+
+std::int32_t StringKernels::mismatch_ignoring_case( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length ) {
+    return kernels->mismatch_ignoring_case_8( a, b, length );
+}
+
+
+std::int32_t StringKernels::mismatch_ignoring_case( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length ) {
+    return kernels->mismatch_ignoring_case_16( a, b, length );
+}
+
+
+std::int32_t StringKernels::index_of( const std::uint8_t *s, std::int32_t length, std::uint16_t c ) {
+    return kernels->index_of_8( s, length, c );
+}
+
+
+std::int32_t StringKernels::index_of( const std::uint16_t *s, std::int32_t length, std::uint16_t c ) {
+    return kernels->index_of_16( s, length, c );
+}
+
+
+std::int32_t StringKernels::occurrences_of( const std::uint8_t *s, std::int32_t length, std::uint16_t c ) {
+    return kernels->occurrences_of_8( s, length, c );
+}
+
+
+std::int32_t StringKernels::occurrences_of( const std::uint16_t *s, std::int32_t length, std::uint16_t c ) {
+    return kernels->occurrences_of_16( s, length, c );
+}
+
+
+void stringKernels_init() {
+    SPDLOG_INFO( "system-init:  stringKernels_init" );
+
+    StringKernels::Level level = StringKernels::select( UseSIMDStringKernels ? StringKernels::supported_level() : StringKernels::Level::scalar );
+    SPDLOG_INFO( "string kernels: {}", StringKernels::level_name( level ) );
+}
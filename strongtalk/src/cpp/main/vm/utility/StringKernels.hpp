@@ -0,0 +1,144 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#pragma once
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/allocation.hpp"
+
+
+// StringKernels are the loops behind the string primitives (compare, equality, character and
+// substring search, occurrence counting, case-insensitive compare) for byte strings (ByteArray,
+// Symbol, String) and double byte strings (DoubleByteArray).
+//
+// The kernels come in a scalar, an SSE2 and an AVX2 version; stringKernels_init() selects the
+// best version the processor supports (UseSIMDStringKernels = false keeps the scalar one).
+// All versions compute the same results.
+//
+// Indices are 0-based, lengths are in characters. Case folding is ASCII only ('A'..'Z').
+
+class StringKernels : AllStatic {
+
+public:
+    enum class Level {
+        scalar = 0, //
+        sse2   = 1, //
+        avx2   = 2  //
+    };
+
+private:
+    static Level _level;
+
+public:
+    static Level level() {
+        return _level;
+    }
+
+
+    // the best level supported by the processor
+    static Level supported_level();
+
+    // selects the kernels of the given level (at most the supported level); returns the level selected
+    static Level select( Level level );
+
+    static const char *level_name( Level level );
+
+    // index of the first position where a and b differ, or length
+    static std::int32_t mismatch( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length );
+
+    static std::int32_t mismatch( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length );
+
+    static std::int32_t mismatch( const std::uint8_t *a, const std::uint16_t *b, std::int32_t length );
+
+    static std::int32_t mismatch_ignoring_case( const std::uint8_t *a, const std::uint8_t *b, std::int32_t length );
+
+    static std::int32_t mismatch_ignoring_case( const std::uint16_t *a, const std::uint16_t *b, std::int32_t length );
+
+    // index of the first occurrence of c, or -1
+    static std::int32_t index_of( const std::uint8_t *s, std::int32_t length, std::uint16_t c );
+
+    static std::int32_t index_of( const std::uint16_t *s, std::int32_t length, std::uint16_t c );
+
+    // number of occurrences of c
+    static std::int32_t occurrences_of( const std::uint8_t *s, std::int32_t length, std::uint16_t c );
+
+    static std::int32_t occurrences_of( const std::uint16_t *s, std::int32_t length, std::uint16_t c );
+
+
+    static std::uint32_t fold( std::uint32_t c ) {
+        return c - 'A' < 26 ? c + ( 'a' - 'A' ) : c;
+    }
+
+
+    // three way compare (-1, 0, 1), by character values, then by length
+    template<typename A, typename B>
+    static std::int32_t compare( const A *a, std::int32_t a_length, const B *b, std::int32_t b_length ) {
+        std::int32_t n = a_length < b_length ? a_length : b_length;
+        std::int32_t i = mismatch( a, b, n );
+        if ( i < n )
+            return a[ i ] < b[ i ] ? -1 : 1;
+        return a_length < b_length ? -1 : ( a_length > b_length ? 1 : 0 );
+    }
+
+
+    static std::int32_t compare( const std::uint16_t *a, std::int32_t a_length, const std::uint8_t *b, std::int32_t b_length ) {
+        return -compare( b, b_length, a, a_length );
+    }
+
+
+    template<typename A, typename B>
+    static bool equal( const A *a, std::int32_t a_length, const B *b, std::int32_t b_length ) {
+        return a_length == b_length and mismatch( a, b, a_length ) == a_length;
+    }
+
+
+    static bool equal( const std::uint16_t *a, std::int32_t a_length, const std::uint8_t *b, std::int32_t b_length ) {
+        return equal( b, b_length, a, a_length );
+    }
+
+
+    // three way compare of the case folded strings
+    template<typename T>
+    static std::int32_t compare_ignoring_case( const T *a, std::int32_t a_length, const T *b, std::int32_t b_length ) {
+        std::int32_t n = a_length < b_length ? a_length : b_length;
+        std::int32_t i = mismatch_ignoring_case( a, b, n );
+        if ( i < n )
+            return fold( a[ i ] ) < fold( b[ i ] ) ? -1 : 1;
+        return a_length < b_length ? -1 : ( a_length > b_length ? 1 : 0 );
+    }
+
+
+    template<typename A, typename B>
+    static std::int32_t compare_ignoring_case( const A *a, std::int32_t a_length, const B *b, std::int32_t b_length ) {
+        std::int32_t n = a_length < b_length ? a_length : b_length;
+        for ( std::int32_t i = 0; i < n; i++ ) {
+            std::uint32_t x = fold( a[ i ] );
+            std::uint32_t y = fold( b[ i ] );
+            if ( x not_eq y )
+                return x < y ? -1 : 1;
+        }
+        return a_length < b_length ? -1 : ( a_length > b_length ? 1 : 0 );
+    }
+
+
+    // index of the first occurrence of sub in s, or -1; the empty string occurs at 0
+    template<typename T>
+    static std::int32_t index_of_substring( const T *s, std::int32_t length, const T *sub, std::int32_t sub_length ) {
+        if ( sub_length == 0 )
+            return 0;
+        std::int32_t last = length - sub_length;     // last possible start
+        std::int32_t i    = 0;
+        while ( i <= last ) {
+            std::int32_t j = index_of( s + i, last - i + 1, sub[ 0 ] );
+            if ( j < 0 )
+                return -1;
+            i += j;
+            if ( mismatch( s + i + 1, sub + 1, sub_length - 1 ) == sub_length - 1 )
+                return i;
+            i++;
+        }
+        return -1;
+    }
+};
@@ -0,0 +1,168 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/interpreter/BranchProfile.hpp"
+#include "vm/interpreter/CodeIterator.hpp"
+#include "vm/lookup/LookupResult.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/runtime/Delta.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include "test/compiler/CompilerTests.hpp"
+#include "test/runtime/testProcess.hpp"
+
+#include <gtest/gtest.h>
+
+
+// Runs methods of the image in the interpreter and checks the branch counts and what the compiler makes of them:
+//  - Magnitude>>max: is "^self > other ifTrue: [ self ] ifFalse: [ other ]"
+//  - Integer>>gcd: is "... [ lower == 0 ] whileFalse: [ ... ]. ^higher"
+class BranchProfileTests : public CompilerTests {
+
+protected:
+    void SetUp() override {
+        CompilerTests::SetUp();
+        // counts of earlier tests would spoil the ones expected here
+        BranchProfile::flush();
+    }
+
+
+    static MethodOop method( const char *className, const char *selectorName ) {
+        LookupResult result = interpreter_normal_lookup( KlassOop( Universe::find_global( className ) ), OopFactory::new_symbol( selectorName ) );
+        return result.method();
+    }
+
+
+    static bool is_loop_jump( ByteCodes::Code code ) {
+        return code == ByteCodes::Code::whileTrue_byte or code == ByteCodes::Code::whileTrue_word or code == ByteCodes::Code::whileFalse_byte or code == ByteCodes::Code::whileFalse_word;
+    }
+
+
+    // the byte code index of the first if (or loop) jump of the method
+    static std::int32_t jump_of( MethodOop method, bool loop = false ) {
+        CodeIterator c( method );
+        do {
+            if ( BranchProfile::is_profiled( c.code() ) and is_loop_jump( c.code() ) == loop )
+                return c.byteCodeIndex();
+        } while ( c.advance() );
+        return -1;
+    }
+
+
+    static void send( std::int32_t receiver, const char *selectorName, std::int32_t argument, std::int32_t times ) {
+        for ( std::int32_t i = 0; i < times; i++ ) {
+            Delta::call( smiOopFromValue( receiver ), OopFactory::new_symbol( selectorName ), smiOopFromValue( argument ) );
+        }
+    }
+
+
+    // enough executions for the jump to claim its entry and for the compiler to trust the counts
+    static std::int32_t warm() {
+        return BranchProfileClaimLimit + ColdBranchLimit;
+    }
+};
+
+
+TEST_F( BranchProfileTests, ifCountsPerOutcome ) {
+    MethodOop    max  = method( "SmallInteger", "max:" );
+    std::int32_t jump = jump_of( max );
+    ASSERT_GE( jump, 1 );
+    send( 5, "max:", 3, warm() );
+
+    std::uint32_t thenCount = 0, elseCount = 0;
+    ASSERT_TRUE( BranchProfile::lookup( max, jump, thenCount, elseCount ) );
+    send( 5, "max:", 3, 7 );
+    send( 3, "max:", 5, 2 );
+
+    std::uint32_t thenCount2 = 0, elseCount2 = 0;
+    ASSERT_TRUE( BranchProfile::lookup( max, jump, thenCount2, elseCount2 ) );
+    EXPECT_EQ( thenCount + 7, thenCount2 );
+    EXPECT_EQ( elseCount + 2, elseCount2 );
+}
+
+
+TEST_F( BranchProfileTests, whileCountsRepetitionsAndExits ) {
+    MethodOop    gcd  = method( "SmallInteger", "gcd:" );
+    std::int32_t jump = jump_of( gcd, true );
+    ASSERT_GE( jump, 1 );
+    send( 5, "gcd:", 0, warm() );
+
+    std::uint32_t repeats = 0, exits = 0;
+    ASSERT_TRUE( BranchProfile::lookup( gcd, jump, repeats, exits ) );
+
+    // 12 gcd: 8 takes two rounds (12, 8 -> 8, 4 -> 4, 0)
+    send( 12, "gcd:", 8, 1 );
+    std::uint32_t repeats2 = 0, exits2 = 0;
+    ASSERT_TRUE( BranchProfile::lookup( gcd, jump, repeats2, exits2 ) );
+    EXPECT_EQ( repeats + 2, repeats2 );
+    EXPECT_EQ( exits + 1, exits2 );
+}
+
+
+TEST_F( BranchProfileTests, flushDropsTheEntriesOfTheMethod ) {
+    MethodOop    max  = method( "SmallInteger", "max:" );
+    std::int32_t jump = jump_of( max );
+    send( 5, "max:", 3, warm() );
+
+    std::uint32_t thenCount = 0, elseCount = 0;
+    ASSERT_TRUE( BranchProfile::lookup( max, jump, thenCount, elseCount ) );
+    BranchProfile::flush( max );
+    EXPECT_FALSE( BranchProfile::lookup( max, jump, thenCount, elseCount ) );
+}
+
+
+TEST_F( BranchProfileTests, neverExecutedElsePartBecomesUncommon ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        send( 5, "max:", 3, warm() );
+        NativeMethod *nm = compile( "SmallInteger", "max:" );
+        ASSERT_TRUE( nm not_eq nullptr );
+
+        // the counts have been consumed
+        std::uint32_t thenCount = 0, elseCount = 0;
+        EXPECT_FALSE( BranchProfile::lookup( method( "SmallInteger", "max:" ), jump_of( method( "SmallInteger", "max:" ) ), thenCount, elseCount ) );
+
+        std::int32_t trapCount = nm->uncommon_trap_counter();
+        EXPECT_EQ( smiOopFromValue( 5 ), Delta::call( smiOopFromValue( 5 ), OopFactory::new_symbol( "max:" ), smiOopFromValue( 3 ) ) );
+        EXPECT_EQ( trapCount, nm->uncommon_trap_counter() );
+        EXPECT_EQ( smiOopFromValue( 5 ), Delta::call( smiOopFromValue( 3 ), OopFactory::new_symbol( "max:" ), smiOopFromValue( 5 ) ) );
+        EXPECT_EQ( trapCount + 1, nm->uncommon_trap_counter() );
+    }
+}
+
+
+TEST_F( BranchProfileTests, bothPartsExecutedStaysCommon ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        send( 5, "max:", 3, warm() );
+        send( 3, "max:", 5, warm() );
+        NativeMethod *nm = compile( "SmallInteger", "max:" );
+        ASSERT_TRUE( nm not_eq nullptr );
+
+        std::int32_t trapCount = nm->uncommon_trap_counter();
+        EXPECT_EQ( smiOopFromValue( 5 ), Delta::call( smiOopFromValue( 5 ), OopFactory::new_symbol( "max:" ), smiOopFromValue( 3 ) ) );
+        EXPECT_EQ( smiOopFromValue( 5 ), Delta::call( smiOopFromValue( 3 ), OopFactory::new_symbol( "max:" ), smiOopFromValue( 5 ) ) );
+        EXPECT_EQ( trapCount, nm->uncommon_trap_counter() );
+    }
+}
+
+
+TEST_F( BranchProfileTests, neverEnteredLoopBecomesUncommon ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        send( 5, "gcd:", 0, warm() );
+        NativeMethod *nm = compile( "SmallInteger", "gcd:" );
+        ASSERT_TRUE( nm not_eq nullptr );
+
+        std::int32_t trapCount = nm->uncommon_trap_counter();
+        EXPECT_EQ( smiOopFromValue( 5 ), Delta::call( smiOopFromValue( 5 ), OopFactory::new_symbol( "gcd:" ), smiOopFromValue( 0 ) ) );
+        EXPECT_EQ( trapCount, nm->uncommon_trap_counter() );
+        EXPECT_EQ( smiOopFromValue( 4 ), Delta::call( smiOopFromValue( 12 ), OopFactory::new_symbol( "gcd:" ), smiOopFromValue( 8 ) ) );
+        EXPECT_EQ( trapCount + 1, nm->uncommon_trap_counter() );
+    }
+}
@@ -0,0 +1,153 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/code/Zone.hpp"
+#include "vm/code/ZoneHeap.hpp"
+#include "vm/code/RelocationInformation.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/platform/os.hpp"
+
+#include "test/compiler/CompilerTests.hpp"
+
+#include <vector>
+#include <gtest/gtest.h>
+
+
+// the oops visited by NativeMethod::oops_do (collected by a plain function, as oops_do takes no closure)
+static std::vector<Oop *> visited;
+
+
+static void collect( Oop *p ) {
+    visited.push_back( p );
+}
+
+
+static std::int32_t oopsVisited;
+
+
+static void countOop( Oop *p ) {
+    st_unused( p );
+    oopsVisited++;
+}
+
+
+// Checks the oop offset table of compiled methods against the oop relocations of their code:
+// NativeMethod::oops_do walks the table, the relocation iterator decodes the relocation information.
+class NativeMethodOopTableTests : public CompilerTests {
+
+protected:
+    // the code oops oops_do visits, in order (the lookup key and the scopes are visited as well)
+    static std::vector<Oop *> tableOops( NativeMethod *nm ) {
+        visited.clear();
+        nm->oops_do( &collect );
+        std::vector<Oop *> result;
+        for ( Oop *p : visited ) {
+            if ( (const char *) p >= nm->instructionsStart() and (const char *) p < nm->instructionsEnd() )
+                result.push_back( p );
+        }
+        return result;
+    }
+
+
+    static std::vector<Oop *> relocationOops( NativeMethod *nm ) {
+        std::vector<Oop *>            result;
+        RelocationInformationIterator iter( nm );
+        while ( iter.next() ) {
+            if ( iter.type() == RelocationInformation::RelocationType::oop_type )
+                result.push_back( iter.oop_addr() );
+        }
+        return result;
+    }
+
+
+    static void expectSameOops( NativeMethod *nm ) {
+        std::vector<Oop *> expected = relocationOops( nm );
+        EXPECT_EQ( static_cast<std::int32_t>( expected.size() ), nm->number_of_oops() );
+        EXPECT_EQ( expected, tableOops( nm ) );
+    }
+
+
+    NativeMethod *compileAll() {
+        NativeMethod *nm = nullptr;
+        for ( const char *selector : { "max:", "gcd:", "printString" } ) {
+            nm = compile( "SmallInteger", selector );
+            EXPECT_TRUE( nm not_eq nullptr ) << selector;
+        }
+        return nm;
+    }
+};
+
+
+TEST_F( NativeMethodOopTableTests, tableListsTheOopsOfTheRelocationInformation ) {
+    compileAll();
+    std::int32_t checked = 0;
+    for ( NativeMethod *nm = Universe::code->first_nm(); nm; nm = Universe::code->next_nm( nm ) ) {
+        if ( nm->isZombie() )
+            continue;
+        expectSameOops( nm );
+        checked++;
+    }
+    EXPECT_GE( checked, 3 );
+}
+
+
+TEST_F( NativeMethodOopTableTests, tableSurvivesMovingTheNativeMethod ) {
+    NativeMethod *nm = compileAll();
+    ASSERT_TRUE( nm not_eq nullptr );
+    ASSERT_GT( nm->number_of_oops(), 0 );
+    std::vector<Oop> oops;
+    for ( Oop *p : relocationOops( nm ) )
+        oops.push_back( *p );
+
+    // move the nativeMethod away and back, as Zone::compactStep would (nothing runs in between)
+    std::int32_t size = nm->size();
+    NativeMethod *to  = (NativeMethod *) Universe::code->_methodHeap->allocate( size );
+    ASSERT_TRUE( to not_eq nullptr );
+    nm->moveTo( to, size );
+
+    expectSameOops( to );
+    std::vector<Oop *> moved = tableOops( to );
+    ASSERT_EQ( oops.size(), moved.size() );
+    for ( std::size_t i = 0; i < moved.size(); i++ ) {
+        EXPECT_TRUE( (const char *) moved[ i ] >= to->instructionsStart() and (const char *) moved[ i ] < to->instructionsEnd() ) << i;
+        EXPECT_EQ( oops[ i ], *moved[ i ] ) << i;
+    }
+
+    to->moveTo( nm, size );
+    Universe::code->_methodHeap->deallocate( to, size );
+    expectSameOops( nm );
+    nm->verify();
+}
+
+
+// The benchmark is disabled, run it with --gtest_also_run_disabled_tests.
+TEST_F( NativeMethodOopTableTests, DISABLED_zoneWalkBenchmark ) {
+    compileAll();
+    const std::int32_t rounds = 1000;
+
+    double start = os::elapsedTime();
+    oopsVisited = 0;
+    for ( std::int32_t i = 0; i < rounds; i++ ) {
+        for ( NativeMethod *nm = Universe::code->first_nm(); nm; nm = Universe::code->next_nm( nm ) ) {
+            nm->oops_do( &countOop );
+        }
+    }
+    const double table = ( os::elapsedTime() - start ) / rounds;
+
+    start = os::elapsedTime();
+    std::int32_t decoded = 0;
+    for ( std::int32_t i = 0; i < rounds; i++ ) {
+        for ( NativeMethod *nm = Universe::code->first_nm(); nm; nm = Universe::code->next_nm( nm ) ) {
+            RelocationInformationIterator iter( nm );
+            while ( iter.next() ) {
+                if ( iter.type() == RelocationInformation::RelocationType::oop_type )
+                    decoded++;
+            }
+        }
+    }
+    const double relocations = ( os::elapsedTime() - start ) / rounds;
+
+    SPDLOG_INFO( "zone walk over {} nativeMethods: oops_do {:.1f} us ({} oops incl. keys and scopes), relocation decoding {:.1f} us ({} code oops)", Universe::code->numberOfNativeMethods(), table * 1e6, oopsVisited / rounds, relocations * 1e6, decoded / rounds );
+}
@@ -0,0 +1,84 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/code/Zone.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/primitive/ByteArrayPrimitives.hpp"
+#include "vm/runtime/Delta.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+#include "vm/runtime/Frame.hpp"
+#include "vm/runtime/VMSymbol.hpp"
+
+#include "test/compiler/CompilerTests.hpp"
+
+#include <gtest/gtest.h>
+
+
+// the compiled method the callout below is made from, and what became of it
+static NativeMethod *calloutMethod       = nullptr;
+static bool         calloutMethodOnStack = false;
+static bool         calloutMethodEvicted = false;
+
+
+// evicts every nativeMethod that may go while the compiled caller is still active
+extern "C" Oop __CALLING_CONVENTION evictAllCode() {
+    Frame f = DeltaProcess::active()->last_frame();
+    while ( not f.is_first_frame() ) {
+        if ( f.is_compiled_frame() and findNativeMethod( f.pc() ) == calloutMethod )
+            calloutMethodOnStack = true;
+        f = f.sender();
+    }
+
+    Universe::code->findReplCandidates( Universe::code->capacity() );
+    calloutMethodEvicted = calloutMethod->isZombie();
+    return vmSymbols::completed();
+}
+
+
+// Calls out of a compiled Alien>>primFFICallResult: into evictAllCode, so that the eviction
+// runs while the compiled method has an activation on the stack of the active process.
+class ZoneEvictionTests : public CompilerTests {
+
+protected:
+    void SetUp() override {
+        CompilerTests::SetUp();
+        calloutMethod        = nullptr;
+        calloutMethodOnStack = false;
+        calloutMethodEvicted = false;
+    }
+
+
+    void TearDown() override {
+        calloutMethod = nullptr;
+        CompilerTests::TearDown();
+    }
+
+
+    static Oop newAlien( KlassOop klass, std::int32_t arraySize, std::int32_t alienSize, void *ptr = nullptr ) {
+        ByteArrayOop alien = ByteArrayOop( klass->klass_part()->allocateObjectSize( arraySize ) );
+        ByteArrayPrimitives::alienSetSize( smiOopFromValue( alienSize ), alien );
+        if ( ptr )
+            ByteArrayPrimitives::alienSetAddress( smiOopFromValue( (std::int32_t) ptr ), alien );
+        return alien;
+    }
+};
+
+
+TEST_F( ZoneEvictionTests, evictionSparesNativeMethodsActiveInTheActiveProcess ) {
+    calloutMethod = compile( "Alien", "primFFICallResult:" );
+    ASSERT_TRUE( calloutMethod not_eq nullptr );
+
+    HandleMark mark;
+    Handle     function( newAlien( KlassOop( Universe::find_global( "Alien" ) ), 8, 0, reinterpret_cast<void *>( &evictAllCode ) ) );
+    Handle     result( newAlien( Universe::byteArrayKlassObject(), 12, 8 ) );
+
+    Delta::call( function.as_oop(), OopFactory::new_symbol( "primFFICallResult:" ), result.as_oop() );
+
+    EXPECT_TRUE( calloutMethodOnStack ) << "the callout should have been made from the compiled method";
+    EXPECT_FALSE( calloutMethodEvicted ) << "a nativeMethod with an activation must not be evicted";
+}
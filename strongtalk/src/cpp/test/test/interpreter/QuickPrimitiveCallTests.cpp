@@ -0,0 +1,190 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/interpreter/ByteCodes.hpp"
+#include "vm/interpreter/CodeIterator.hpp"
+#include "vm/lookup/LookupCache.hpp"
+#include "vm/lookup/LookupResult.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/runtime/Delta.hpp"
+
+#include "test/compiler/CompilerTests.hpp"
+#include "test/runtime/testProcess.hpp"
+
+#include <gtest/gtest.h>
+
+
+TEST( QuickPrimitiveCallTests, quickCallsLookLikeTheirGenericCall ) {
+    std::int32_t count = 0;
+    for ( std::int32_t i = 0; i < static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES); i++ ) {
+        const ByteCodes::Code code = ByteCodes::Code( i );
+        if ( not ByteCodes::is_quick_primitive_call( code ) )
+            continue;
+        const ByteCodes::Code generic = ByteCodes::generic_code_for( code );
+        EXPECT_NE( generic, code );
+        EXPECT_EQ( ByteCodes::code_type( generic ), ByteCodes::CodeType::PRIMITIVE_CALL );
+        EXPECT_EQ( ByteCodes::format( code ), ByteCodes::format( generic ) );
+        EXPECT_EQ( ByteCodes::code_type( code ), ByteCodes::code_type( generic ) );
+        EXPECT_FALSE( ByteCodes::is_superinstruction( code ) );
+        count++;
+    }
+    EXPECT_EQ( count, 5 );
+}
+
+
+TEST( QuickPrimitiveCallTests, genericCalls ) {
+    EXPECT_EQ( ByteCodes::generic_code_for( ByteCodes::Code::primitive_call_self_indexable_size ), ByteCodes::Code::primitive_call_self );
+    EXPECT_EQ( ByteCodes::generic_code_for( ByteCodes::Code::primitive_call_self_objectArray_at ), ByteCodes::Code::primitive_call_self_failure );
+    EXPECT_EQ( ByteCodes::generic_code_for( ByteCodes::Code::primitive_call_self_byteArray_at_put ), ByteCodes::Code::primitive_call_self_failure );
+    EXPECT_FALSE( ByteCodes::is_quick_primitive_call( ByteCodes::Code::primitive_call_self ) );
+}
+
+
+// Runs the indexed access methods of Array and ByteArray, which call the quickened primitives on self
+// (see IndexedInstanceVariables and IndexedByteInstanceVariables).
+class QuickPrimitiveCallExecutionTests : public CompilerTests {
+
+protected:
+    static Oop send( Oop receiver, const char *selector ) {
+        return Delta::call( receiver, OopFactory::new_symbol( selector ) );
+    }
+
+
+    static Oop send( Oop receiver, const char *selector, Oop arg1 ) {
+        return Delta::call( receiver, OopFactory::new_symbol( selector ), arg1 );
+    }
+
+
+    static Oop send( Oop receiver, const char *selector, Oop arg1, Oop arg2 ) {
+        return Delta::call( receiver, OopFactory::new_symbol( selector ), arg1, arg2 );
+    }
+
+
+    static Oop newInstance( const char *className, std::int32_t size ) {
+        return send( Universe::find_global( className ), "new:", smiOopFromValue( size ) );
+    }
+
+
+    // tells whether the method of klass for selector has a quick primitive call
+    static bool isQuickened( Oop klass, const char *selector ) {
+        LookupResult result = interpreter_normal_lookup( KlassOop( klass ), OopFactory::new_symbol( selector ) );
+        CodeIterator c( result.method() );
+        do {
+            if ( ByteCodes::is_quick_primitive_call( ByteCodes::Code( *c.hp() ) ) )
+                return true;
+        } while ( c.advance() );
+        return false;
+    }
+};
+
+
+TEST_F( QuickPrimitiveCallExecutionTests, objectArrayAccess ) {
+    PersistentHandle array( newInstance( "Array", 3 ) );
+    SymbolOop        value = OopFactory::new_symbol( "value" );
+
+    // the first execution patches the call, the second one takes the quick path
+    for ( std::int32_t i = 0; i < 2; i++ ) {
+        EXPECT_EQ( array.as_oop(), send( array.as_oop(), "primitiveAt:put:", smiOopFromValue( 2 ), value ) );
+        EXPECT_EQ( value, send( array.as_oop(), "primitiveAt:", smiOopFromValue( 2 ) ) );
+        EXPECT_EQ( nilObject, send( array.as_oop(), "primitiveAt:", smiOopFromValue( 3 ) ) );
+        EXPECT_EQ( smiOopFromValue( 3 ), send( array.as_oop(), "primitiveSize" ) );
+    }
+
+    Oop arrayClass = Universe::find_global( "Array" );
+    EXPECT_TRUE( isQuickened( arrayClass, "primitiveAt:put:" ) );
+    EXPECT_TRUE( isQuickened( arrayClass, "primitiveAt:" ) );
+    EXPECT_TRUE( isQuickened( arrayClass, "primitiveSize" ) );
+}
+
+
+TEST_F( QuickPrimitiveCallExecutionTests, byteArrayAccess ) {
+    PersistentHandle bytes( newInstance( "ByteArray", 4 ) );
+
+    for ( std::int32_t i = 0; i < 2; i++ ) {
+        EXPECT_EQ( bytes.as_oop(), send( bytes.as_oop(), "primitiveAt:put:", smiOopFromValue( 4 ), smiOopFromValue( 255 ) ) );
+        EXPECT_EQ( smiOopFromValue( 255 ), send( bytes.as_oop(), "primitiveAt:", smiOopFromValue( 4 ) ) );
+        EXPECT_EQ( smiOopFromValue( 0 ), send( bytes.as_oop(), "primitiveAt:", smiOopFromValue( 1 ) ) );
+        EXPECT_EQ( smiOopFromValue( 4 ), send( bytes.as_oop(), "primitiveSize" ) );
+    }
+
+    EXPECT_TRUE( isQuickened( Universe::find_global( "ByteArray" ), "primitiveAt:put:" ) );
+    EXPECT_TRUE( isQuickened( Universe::find_global( "ByteArray" ), "primitiveAt:" ) );
+}
+
+
+TEST_F( QuickPrimitiveCallExecutionTests, atPutFastPathDispatchesTheFollowingByteCodes ) {
+    PersistentHandle array( newInstance( "Array", 100 ) );
+    PersistentHandle bytes( newInstance( "ByteArray", 100 ) );
+    SymbolOop        value = OopFactory::new_symbol( "value" );
+
+    // quicken first, then every store takes the fast path and is followed by the return of
+    // primitiveAt:put: and the rest of the sending method
+    send( array.as_oop(), "primitiveAt:put:", smiOopFromValue( 1 ), value );
+    send( bytes.as_oop(), "primitiveAt:put:", smiOopFromValue( 1 ), smiOopFromValue( 1 ) );
+    ASSERT_TRUE( isQuickened( Universe::find_global( "Array" ), "primitiveAt:put:" ) );
+    ASSERT_TRUE( isQuickened( Universe::find_global( "ByteArray" ), "primitiveAt:put:" ) );
+
+    for ( std::int32_t i = 1; i <= 100; i++ ) {
+        EXPECT_EQ( value, send( array.as_oop(), "at:put:", smiOopFromValue( i ), value ) ) << i;
+        EXPECT_EQ( array.as_oop(), send( array.as_oop(), "putNilAt:", smiOopFromValue( i ) ) ) << i;
+        EXPECT_EQ( smiOopFromValue( i ), send( bytes.as_oop(), "at:put:", smiOopFromValue( i ), smiOopFromValue( i ) ) ) << i;
+    }
+    for ( std::int32_t i = 1; i <= 100; i++ ) {
+        EXPECT_EQ( nilObject, send( array.as_oop(), "primitiveAt:", smiOopFromValue( i ) ) ) << i;
+        EXPECT_EQ( smiOopFromValue( i ), send( bytes.as_oop(), "primitiveAt:", smiOopFromValue( i ) ) ) << i;
+    }
+}
+
+
+TEST_F( QuickPrimitiveCallExecutionTests, outOfBoundsIndexRunsTheFailureBlock ) {
+    PersistentHandle array( newInstance( "Array", 3 ) );
+    PersistentHandle bytes( newInstance( "ByteArray", 3 ) );
+    SymbolOop        absent = OopFactory::new_symbol( "absent" );    // "fail value" answers the symbol itself
+
+    // below, at and above the bounds; the quick path leaves these to the generic call
+    for ( std::int32_t i = 0; i < 2; i++ ) {
+        EXPECT_EQ( absent, send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 0 ), absent ) );
+        EXPECT_EQ( nilObject, send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 3 ), absent ) );
+        EXPECT_EQ( absent, send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 4 ), absent ) );
+
+        EXPECT_EQ( absent, send( bytes.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( -1 ), absent ) );
+        EXPECT_EQ( smiOopFromValue( 0 ), send( bytes.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 3 ), absent ) );
+        EXPECT_EQ( absent, send( bytes.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 4 ), absent ) );
+    }
+
+    EXPECT_TRUE( isQuickened( Universe::find_global( "Array" ), "primitiveAt:ifAbsent:" ) );
+    EXPECT_TRUE( isQuickened( Universe::find_global( "ByteArray" ), "primitiveAt:ifAbsent:" ) );
+}
+
+
+TEST_F( QuickPrimitiveCallExecutionTests, compiledFromQuickenedCodeAndDeoptimized ) {
+    AddTestProcess addTest;
+    {
+        initializeSmalltalkEnvironment();
+        PersistentHandle array( newInstance( "Array", 3 ) );
+        SymbolOop        absent = OopFactory::new_symbol( "absent" );
+
+        // quicken, then compile: the compiler must see the generic primitive call
+        for ( std::int32_t i = 0; i < 2; i++ ) {
+            send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 1 ), absent );
+        }
+        ASSERT_TRUE( isQuickened( Universe::find_global( "Array" ), "primitiveAt:ifAbsent:" ) );
+        NativeMethod *nm = compile( "Array", "primitiveAt:ifAbsent:" );
+        ASSERT_TRUE( nm not_eq nullptr );
+
+        send( array.as_oop(), "primitiveAt:put:", smiOopFromValue( 1 ), absent );
+        EXPECT_EQ( absent, send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 1 ), nilObject ) );
+        // the failure has never been seen: the compiled code may trap and continue in the quickened interpreted code
+        EXPECT_EQ( absent, send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 4 ), absent ) );
+
+        // without the compiled code the quickened method is interpreted again
+        Universe::code->flush();
+        DeltaCallCache::clearAll();
+        LookupCache::flush();
+        EXPECT_EQ( absent, send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 4 ), absent ) );
+        EXPECT_EQ( nilObject, send( array.as_oop(), "primitiveAt:ifAbsent:", smiOopFromValue( 2 ), absent ) );
+    }
+}
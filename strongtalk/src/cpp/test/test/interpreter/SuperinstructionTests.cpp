@@ -0,0 +1,142 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/interpreter/ByteCodes.hpp"
+#include "vm/interpreter/CodeIterator.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/memory/MarkSweep.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/MethodOopDescriptor.hpp"
+#include "vm/runtime/Delta.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+
+TEST( SuperinstructionTests, superinstructionsLookLikeTheirFirstComponent ) {
+    for ( std::int32_t i = 0; i < static_cast<std::int32_t>(ByteCodes::Code::NUMBER_OF_CODES); i++ ) {
+        const ByteCodes::Code code = ByteCodes::Code( i );
+        if ( not ByteCodes::is_superinstruction( code ) ) {
+            if ( not ByteCodes::is_quick_primitive_call( code ) )
+                EXPECT_EQ( ByteCodes::generic_code_for( code ), code );
+            continue;
+        }
+        const ByteCodes::Code first = ByteCodes::generic_code_for( code );
+        EXPECT_NE( first, code );
+        EXPECT_EQ( ByteCodes::format( code ), ByteCodes::format( first ) );
+        EXPECT_EQ( ByteCodes::code_type( code ), ByteCodes::code_type( first ) );
+        EXPECT_FALSE( ByteCodes::is_send_code( ByteCodes::second_component_of( code ) ) );
+    }
+}
+
+
+TEST( SuperinstructionTests, pairsAreFused ) {
+    EXPECT_EQ( ByteCodes::superinstruction_for( ByteCodes::Code::push_self, ByteCodes::Code::push_literal ), ByteCodes::Code::push_self_push_literal );
+    EXPECT_EQ( ByteCodes::superinstruction_for( ByteCodes::Code::push_nil, ByteCodes::Code::return_tos_pop_0 ), ByteCodes::Code::push_nil_return_tos_pop_0 );
+    EXPECT_EQ( ByteCodes::second_component_of( ByteCodes::Code::push_temp_0_push_temp_1 ), ByteCodes::Code::push_temp_1 );
+}
+
+
+TEST( SuperinstructionTests, otherPairsAreLeftAlone ) {
+    EXPECT_EQ( ByteCodes::superinstruction_for( ByteCodes::Code::push_self, ByteCodes::Code::return_tos_pop_1 ), ByteCodes::Code::push_self );
+    EXPECT_EQ( ByteCodes::superinstruction_for( ByteCodes::Code::push_temp_1, ByteCodes::Code::push_temp_0 ), ByteCodes::Code::push_temp_1 );
+}
+
+
+// Executes the fused handlers: the methods below consist of one fusable pair (e.g., "^true" is push_true; return_tos_pop_0).
+// The methods belong to the shared test image, so the tests fuse them only for their own duration.
+class SuperinstructionExecutionTests : public ::testing::Test {
+
+protected:
+    std::vector<MethodOop> fusedMethods;
+
+
+    void TearDown() override {
+        // undo the fusion before the collection, which may move the methods
+        for ( MethodOop method : fusedMethods ) {
+            defuse( method );
+        }
+        fusedMethods.clear();
+        MarkSweep::collect();
+    }
+
+
+    // rewrites the superinstructions of method and of its blocks back into their first components
+    static void defuse( MethodOop method ) {
+        if ( not method->has_superinstructions() )
+            return;
+        CodeIterator c( method );
+        do {
+            if ( c.block_method() )
+                defuse( c.block_method() );
+            if ( ByteCodes::is_superinstruction( ByteCodes::Code( *c.hp() ) ) )
+                c.set_code( c.code() );
+        } while ( c.advance() );
+        method->set_flags( subNthBit( method->flags(), MethodOopDescriptor::hasSuperinstructionsFlag ) );
+    }
+
+
+    // fuses the method of klass for selector and checks that it starts with the superinstruction expected
+    MethodOop fused( KlassOop klass, const char *selector, ByteCodes::Code expected ) {
+        MethodOop method = klass->klass_part()->lookup( OopFactory::new_symbol( selector ) );
+        EXPECT_TRUE( method not_eq nullptr ) << selector;
+        if ( not method->has_superinstructions() )
+            fusedMethods.push_back( method );
+        method->install_superinstructions();
+        EXPECT_TRUE( method->has_superinstructions() );
+        EXPECT_EQ( static_cast<std::uint8_t>( expected ), *method->codes() ) << selector << " starts with " << ByteCodes::name( ByteCodes::Code( *method->codes() ) );
+        return method;
+    }
+};
+
+
+TEST_F( SuperinstructionExecutionTests, pushConstantAndReturn ) {
+    fused( KlassOop( Universe::find_global( "Object" ) ), "isNil", ByteCodes::Code::push_false_return_tos_pop_0 );
+    fused( KlassOop( Universe::find_global( "Object" ) ), "notNil", ByteCodes::Code::push_true_return_tos_pop_0 );
+    fused( KlassOop( Universe::find_global( "UndefinedObject" ) ), "isNil", ByteCodes::Code::push_true_return_tos_pop_0 );
+    fused( KlassOop( Universe::find_global( "UndefinedObject" ) ), "notNil", ByteCodes::Code::push_false_return_tos_pop_0 );
+
+    EXPECT_EQ( falseObject, Delta::call( smiOopFromValue( 1 ), OopFactory::new_symbol( "isNil" ) ) );
+    EXPECT_EQ( trueObject, Delta::call( smiOopFromValue( 1 ), OopFactory::new_symbol( "notNil" ) ) );
+    EXPECT_EQ( trueObject, Delta::call( nilObject, OopFactory::new_symbol( "isNil" ) ) );
+    EXPECT_EQ( falseObject, Delta::call( nilObject, OopFactory::new_symbol( "notNil" ) ) );
+}
+
+
+TEST_F( SuperinstructionExecutionTests, pushArgumentAndReturn ) {
+    KlassOop fixtureClass = KlassOop( Universe::find_global( "DoesNotUnderstandFixture" ) );
+    fused( fixtureClass, "doesNotUnderstand:", ByteCodes::Code::push_arg_1_return_tos_pop_1 );
+
+    Oop fixture  = fixtureClass->klass_part()->allocateObject();
+    Oop argument = OopFactory::new_symbol( "argument" );
+    EXPECT_EQ( argument, Delta::call( fixture, OopFactory::new_symbol( "doesNotUnderstand:" ), argument ) );
+
+    // entered from interpreted code (dnuTrigger1 sends #quack)
+    Oop message = Delta::call( fixture, OopFactory::new_symbol( "dnuTrigger1" ) );
+    ASSERT_TRUE( message->isMemOop() );
+    EXPECT_EQ( Universe::find_global( "Message" ), message->klass() );
+    EXPECT_EQ( fixture, MemOop( message )->raw_at( 2 ) );
+}
+
+
+TEST_F( SuperinstructionExecutionTests, defuseRestoresTheOriginalCodes ) {
+    MethodOop  method   = KlassOop( Universe::find_global( "Object" ) )->klass_part()->lookup( OopFactory::new_symbol( "isNil" ) );
+    const bool wasFused = method->has_superinstructions();    // by an interpreted send that reached it earlier
+    defuse( method );
+    std::vector<std::uint8_t> original( method->codes(), method->codes() + method->size_of_codes() * OOP_SIZE );
+
+    method->install_superinstructions();
+    EXPECT_EQ( static_cast<std::uint8_t>( ByteCodes::Code::push_false_return_tos_pop_0 ), *method->codes() );
+    defuse( method );
+    EXPECT_FALSE( method->has_superinstructions() );
+    EXPECT_EQ( original, std::vector<std::uint8_t>( method->codes(), method->codes() + method->size_of_codes() * OOP_SIZE ) );
+    EXPECT_EQ( falseObject, Delta::call( smiOopFromValue( 1 ), OopFactory::new_symbol( "isNil" ) ) );
+
+    if ( wasFused )
+        method->install_superinstructions();
+}
@@ -12,9 +12,15 @@
 #include "vm/interpreter/HeapCodeBuffer.hpp"
 #include "vm/memory/MarkSweep.hpp"
 #include "vm/klass/DoubleValueArrayKlass.hpp"
+#include "vm/primitive/DoubleValueArray_primitives.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/runtime/VMSymbol.hpp"
 
 #include <gtest/gtest.h>
 
+#include <limits>
+
 // reinstate once status of dValueArray* is firmly established
 
 extern "C" Oop *eden_top;
@@ -47,6 +53,26 @@ protected:
     KlassOop theClass;
     Oop      *oldEdenTop;
 
+
+    // a new array holding the given values
+    DoubleValueArrayOop array( std::initializer_list<double> values ) {
+        DoubleValueArrayOop result = DoubleValueArrayOop( DoubleValueArrayPrimitives::allocateSize( smiOopFromValue( values.size() ), theClass ) );
+        std::int32_t        index  = 1;
+        for ( double value : values )
+            result->double_at_put( index++, value );
+        return result;
+    }
+
+
+    static void expectValues( std::initializer_list<double> expected, DoubleValueArrayOop array ) {
+        ASSERT_EQ( static_cast<small_int_t>( expected.size() ), array->length() );
+        std::int32_t index = 1;
+        for ( double value : expected ) {
+            EXPECT_EQ( value, array->double_at( index ) ) << index;
+            index++;
+        }
+    }
+
 };
 
 
@@ -105,3 +131,99 @@ TEST_F( DoubleValueArrayKlassTests, findDoubleValueArrayClass ) {
         SPDLOG_INFO( "No matching class found" );
     }
 }
+
+
+TEST_F( DoubleValueArrayKlassTests, sumAndDotShouldAddAllElements ) {
+    DoubleValueArrayOop x = array( { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 } );
+    DoubleValueArrayOop y = array( { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1 } );
+
+    Oop sum = DoubleValueArrayPrimitives::sum( x );
+    ASSERT_TRUE( sum->isDouble() );
+    EXPECT_EQ( 66.0, DoubleOop( sum )->value() );
+
+    Oop dot = DoubleValueArrayPrimitives::dot( y, x );
+    ASSERT_TRUE( dot->isDouble() );
+    EXPECT_EQ( 44.0, DoubleOop( dot )->value() );
+
+    EXPECT_EQ( 0.0, DoubleOop( DoubleValueArrayPrimitives::sum( array( {} ) ) )->value() );
+}
+
+
+TEST_F( DoubleValueArrayKlassTests, bulkPrimitivesShouldFailForArraysOfDifferentSize ) {
+    DoubleValueArrayOop x = array( { 1, 2, 3 } );
+    DoubleValueArrayOop y = array( { 1, 2 } );
+
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::dot( y, x ) );
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::add( y, x ) );
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::axpy( OopFactory::new_double( 2.0 ), y, x ) );
+    EXPECT_EQ( markSymbol( vmSymbols::first_argument_has_wrong_type() ), DoubleValueArrayPrimitives::multiply( smiOopFromValue( 1 ), x ) );
+    EXPECT_EQ( markSymbol( vmSymbols::first_argument_has_wrong_type() ), DoubleValueArrayPrimitives::scale( smiOopFromValue( 2 ), x ) );
+    expectValues( { 1, 2, 3 }, x );
+}
+
+
+TEST_F( DoubleValueArrayKlassTests, arithmeticPrimitivesShouldUpdateReceiverInPlace ) {
+    DoubleValueArrayOop x     = array( { 1, 2, 3, 4, 5, 6, 7, 8, 9 } );
+    DoubleValueArrayOop y     = array( { 2, 2, 2, 2, 2, 2, 2, 2, 2 } );
+    Oop                 three = OopFactory::new_double( 3.0 );
+
+    EXPECT_EQ( (const char *) x, (const char *) DoubleValueArrayPrimitives::axpy( three, y, x ) );
+    expectValues( { 7, 8, 9, 10, 11, 12, 13, 14, 15 }, x );
+    DoubleValueArrayPrimitives::subtract( y, x );
+    expectValues( { 5, 6, 7, 8, 9, 10, 11, 12, 13 }, x );
+    DoubleValueArrayPrimitives::multiply( y, x );
+    expectValues( { 10, 12, 14, 16, 18, 20, 22, 24, 26 }, x );
+    DoubleValueArrayPrimitives::divide( y, x );
+    expectValues( { 5, 6, 7, 8, 9, 10, 11, 12, 13 }, x );
+    DoubleValueArrayPrimitives::add( x, x );
+    expectValues( { 10, 12, 14, 16, 18, 20, 22, 24, 26 }, x );
+    DoubleValueArrayPrimitives::scale( OopFactory::new_double( 0.5 ), x );
+    expectValues( { 5, 6, 7, 8, 9, 10, 11, 12, 13 }, x );
+    expectValues( { 2, 2, 2, 2, 2, 2, 2, 2, 2 }, y );
+}
+
+
+TEST_F( DoubleValueArrayKlassTests, minAndMaxIndexShouldAnswerFirstExtremeIgnoringNaN ) {
+    double              nan = std::numeric_limits<double>::quiet_NaN();
+    DoubleValueArrayOop x   = array( { 3, nan, -1, 7, 7, -1, 0, 2, 1, nan, -0.5 } );
+
+    EXPECT_EQ( smiOopFromValue( 3 ), DoubleValueArrayPrimitives::min_index( x ) );
+    EXPECT_EQ( smiOopFromValue( 4 ), DoubleValueArrayPrimitives::max_index( x ) );
+    EXPECT_EQ( smiOopFromValue( 0 ), DoubleValueArrayPrimitives::min_index( array( {} ) ) );
+    EXPECT_EQ( smiOopFromValue( 1 ), DoubleValueArrayPrimitives::max_index( array( { nan, nan } ) ) );
+}
+
+
+TEST_F( DoubleValueArrayKlassTests, atAllPutShouldFillArray ) {
+    DoubleValueArrayOop x = array( { 1, 2, 3, 4, 5 } );
+    DoubleValueArrayPrimitives::at_all_put( OopFactory::new_double( 2.5 ), x );
+    expectValues( { 2.5, 2.5, 2.5, 2.5, 2.5 }, x );
+    EXPECT_EQ( markSymbol( vmSymbols::first_argument_has_wrong_type() ), DoubleValueArrayPrimitives::at_all_put( smiOopFromValue( 1 ), x ) );
+}
+
+
+TEST_F( DoubleValueArrayKlassTests, replaceFromToShouldCopyOverlappingRanges ) {
+    DoubleValueArrayOop x = array( { 1, 2, 3, 4, 5, 6 } );
+    DoubleValueArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), x, smiOopFromValue( 5 ), smiOopFromValue( 2 ), x );
+    expectValues( { 1, 1, 2, 3, 4, 6 }, x );
+
+    DoubleValueArrayOop y = array( { 9, 8 } );
+    DoubleValueArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), y, smiOopFromValue( 6 ), smiOopFromValue( 5 ), x );
+    expectValues( { 1, 1, 2, 3, 9, 8 }, x );
+
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), y, smiOopFromValue( 3 ), smiOopFromValue( 1 ), x ) );
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::replace_from_to( smiOopFromValue( 0 ), y, smiOopFromValue( 2 ), smiOopFromValue( 1 ), x ) );
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), DoubleValueArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), y, smiOopFromValue( 7 ), smiOopFromValue( 6 ), x ) );
+}
+
+
+TEST_F( DoubleValueArrayKlassTests, equalShouldCompareElements ) {
+    DoubleValueArrayOop x = array( { 1, 2, 3, 4, 5, 6, 7, 8, 9 } );
+    EXPECT_EQ( trueObject, DoubleValueArrayPrimitives::equal( array( { 1, 2, 3, 4, 5, 6, 7, 8, 9 } ), x ) );
+    EXPECT_EQ( falseObject, DoubleValueArrayPrimitives::equal( array( { 1, 2, 3, 4, 5, 6, 7, 8, 0 } ), x ) );
+    EXPECT_EQ( falseObject, DoubleValueArrayPrimitives::equal( array( { 1, 2, 3 } ), x ) );
+    EXPECT_EQ( trueObject, DoubleValueArrayPrimitives::equal( array( { -0.0 } ), array( { 0.0 } ) ) );
+
+    DoubleValueArrayOop nan = array( { std::numeric_limits<double>::quiet_NaN() } );
+    EXPECT_EQ( falseObject, DoubleValueArrayPrimitives::equal( nan, nan ) );
+}
@@ -0,0 +1,62 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/memory/SymbolTable.hpp"
+#include "vm/oop/SymbolOopDescriptor.hpp"
+#include "vm/utility/StringHash.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+
+// Uses a table of its own, so the symbols of the image stay where they are while the full hash is selected.
+class SymbolTableTests : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        savedVersion = StringHash::version();
+        StringHash::select_version( StringHash::Version::full_contents );
+        table = new SymbolTable();
+    }
+
+
+    void TearDown() override {
+        StringHash::select_version( savedVersion );
+        delete table;
+        table = nullptr;
+    }
+
+
+    // a name whose full hash does not fit into a non-negative std::int32_t
+    static std::string nameWithBit31Set() {
+        char name[ 32 ];
+        for ( std::int32_t i = 0; i < 1000; i++ ) {
+            std::snprintf( name, sizeof( name ), "symbolTableTest%d", i );
+            if ( StringHash::full_hash( reinterpret_cast<const std::uint8_t *>( name ), std::strlen( name ) ) & 0x80000000 )
+                return name;
+        }
+        return "";
+    }
+
+
+    StringHash::Version savedVersion;
+    SymbolTable         *table;
+};
+
+
+TEST_F( SymbolTableTests, nameWithBit31SetOfFullHash ) {
+    const std::string name = nameWithBit31Set();
+    ASSERT_FALSE( name.empty() );
+    EXPECT_GE( std::int32_t( hash( name.data(), name.size() ) ), 0 );
+
+    SymbolOop symbol = table->lookup( name.data(), name.size() );
+    ASSERT_TRUE( symbol not_eq nullptr );
+    EXPECT_TRUE( symbol->equals( name.data(), name.size() ) );
+    EXPECT_EQ( symbol, table->lookup( name.data(), name.size() ) );
+    EXPECT_TRUE( table->is_present( symbol ) );
+}
@@ -14,9 +14,14 @@
 #include "vm/memory/OopFactory.hpp"
 #include "vm/oop/ObjectArrayOopDescriptor.hpp"
 #include "vm/runtime/ResourceMark.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+#include "vm/platform/os.hpp"
+#include "vm/code/StubRoutines.hpp"
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 
 extern "C" std::int32_t __CALLING_CONVENTION returnFirst2( std::int32_t a, std::int32_t b ) {
     st_unused( b );
@@ -50,6 +55,23 @@ extern "C" std::int32_t __CALLING_CONVENTION argAlignment2( std::int32_t a, std:
     return ( (std::int32_t) &a ) & 0xF;
 }
 
+extern "C" std::int32_t __CALLING_CONVENTION mixedArguments( std::int32_t a, double b, float c, std::int32_t *d ) {
+    return a + static_cast<std::int32_t>( b * 10 ) + static_cast<std::int32_t>( c * 100 ) + *d;
+}
+
+extern "C" double __CALLING_CONVENTION multiplyDoubles( double a, double b ) {
+    return a * b;
+}
+
+extern "C" float __CALLING_CONVENTION halveFloat( float a ) {
+    return a / 2;
+}
+
+extern "C" double __CALLING_CONVENTION forceScavengeDouble( std::int32_t a ) {
+    Universe::scavenge();
+    return a;
+}
+
 
 class AlienIntegerCalloutWithArgumentsTests : public ::testing::Test {
 
@@ -206,6 +228,21 @@ protected:
     }
 
 
+    Oop signatureCallout( const char *signature, const std::vector<Oop> &arguments, Oop result ) {
+        ObjectArrayOop argOops = OopFactory::new_objectArray( arguments.size() );
+        for ( std::size_t index = 0; index < arguments.size(); index++ ) {
+            argOops->obj_at_put( index + 1, arguments[ index ] );
+        }
+
+        return ByteArrayPrimitives::alienCallResultWithSignature( argOops, OopFactory::new_byteArray( signature ), result, functionAlien->as_oop() );
+    }
+
+
+    Oop signatureCallout( const char *signature, const std::vector<Oop> &arguments ) {
+        return signatureCallout( signature, arguments, resultAlien->as_oop() );
+    }
+
+
     void checkArgnPassed( std::int32_t argIndex, std::int32_t argValue, std::array<void *, argCount> functionArray ) {
         setAddress( functionAlien, functionArray[ argIndex ] );
         std::array<Oop, argCount> arg;
@@ -324,3 +361,148 @@ TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithArgumentsShoul
         checkIllegalArgnPassed( arg, trueObject );
     }
 }
+
+
+// alien call outs through stubs specialized to a signature
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldCallIntArgFunction ) {
+    for ( std::int32_t arg = 0; arg < argCount; arg++ ) {
+        setAddress( functionAlien, intCalloutFunctions[ arg ] );
+        Oop result = signatureCallout( "ii", { arg == 0 ? asOop( -7 ) : smi0, arg == 1 ? asOop( -7 ) : smi0 } );
+        EXPECT_TRUE( result == resultAlien->as_oop() ) << "Should return result alien";
+        checkIntResult( "wrong result", -7, resultAlien );
+    }
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldPassPointers ) {
+    ByteArrayPrimitives::alienSignedLongAtPut( asOop( -1 ), smi1, pointerAlien->as_oop() );
+    setAddress( functionAlien, intPointerCalloutFunctions[ 1 ] );
+    signatureCallout( "ip", { smi0, pointerAlien->as_oop() } );
+    checkIntResult( "pointer alien", -1, resultAlien );
+
+    ByteArrayPrimitives::alienSignedLongAtPut( asOop( 42 ), smi1, directAlien->as_oop() );
+    signatureCallout( "ip", { smi0, directAlien->as_oop() } );
+    checkIntResult( "direct alien", 42, resultAlien );
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldPassDoublesAndFloats ) {
+    ByteArrayPrimitives::alienSignedLongAtPut( asOop( 1000 ), smi1, pointerAlien->as_oop() );
+    setAddress( functionAlien, reinterpret_cast<void *>( &mixedArguments ) );
+    signatureCallout( "idfp", { asOop( 3 ), OopFactory::new_double( 2.5 ), OopFactory::new_double( 0.5 ), pointerAlien->as_oop() } );
+    checkIntResult( "mixed arguments", 3 + 25 + 50 + 1000, resultAlien );
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldStoreFloatResults ) {
+    setAddress( functionAlien, reinterpret_cast<void *>( &multiplyDoubles ) );
+    signatureCallout( "dd>d", { OopFactory::new_double( 1.5 ), OopFactory::new_double( -3.0 ) } );
+    EXPECT_EQ( -4.5, DoubleOop( ByteArrayPrimitives::alienDoubleAt( smi1, resultAlien->as_oop() ) )->value() );
+
+    setAddress( functionAlien, reinterpret_cast<void *>( &halveFloat ) );
+    signatureCallout( "f>f", { OopFactory::new_double( 5.0 ) } );
+    EXPECT_EQ( 2.5, DoubleOop( ByteArrayPrimitives::alienFloatAt( smi1, resultAlien->as_oop() ) )->value() );
+
+    // the result is popped from the FPU even when it is not wanted
+    for ( std::int32_t index = 0; index < 10; index++ ) {
+        Oop result = signatureCallout( "f>f", { OopFactory::new_double( 5.0 ) }, nilObject );
+        EXPECT_FALSE( result->isMarkOop() );
+    }
+    EXPECT_EQ( 0.75, multiplyDoubles( 0.5, 1.5 ) ) << "FPU stack overflow";
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldAlignArgs ) {
+    setAddress( functionAlien, reinterpret_cast<void *>( &argAlignment2 ) );
+    for ( const char *signature : { "ii", "i", "iiii" } ) {
+        std::vector<Oop> arguments( std::strlen( signature ), smi0 );
+        signatureCallout( signature, arguments );
+        checkIntResult( signature, 0, resultAlien );
+    }
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureWithScavengeShouldReturnCorrectResult ) {
+    setAddress( functionAlien, reinterpret_cast<void *>( &forceScavengeWA ) );
+    signatureCallout( "ii", { smi0, smi0 } );
+    checkIntResult( "result alien not updated", -1, resultAlien );
+
+    setAddress( functionAlien, reinterpret_cast<void *>( &forceScavengeDouble ) );
+    signatureCallout( "i>d", { asOop( 17 ) } );
+    EXPECT_EQ( 17.0, DoubleOop( ByteArrayPrimitives::alienDoubleAt( smi1, resultAlien->as_oop() ) )->value() );
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldShareStubs ) {
+    EXPECT_TRUE( StubRoutines::alien_call_entry( "idfp>d", 6 ) not_eq nullptr );
+    EXPECT_EQ( StubRoutines::alien_call_entry( "idfp>d", 6 ), StubRoutines::alien_call_entry( "idfp>d", 6 ) );
+    EXPECT_NE( StubRoutines::alien_call_entry( "idfp>d", 6 ), StubRoutines::alien_call_entry( "idfp>f", 6 ) );
+    EXPECT_TRUE( StubRoutines::contains( StubRoutines::alien_call_entry( "idfp>d", 6 ) ) );
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldRejectInvalidSignatures ) {
+    for ( const char *signature : { "ix", "i>", "i>p", "i>ii", ">i>i", "iiiiiiiiiiiiiiiii" } ) {
+        EXPECT_EQ( -1, StubRoutines::alien_signature_args( signature, std::strlen( signature ) ) ) << signature;
+        EXPECT_EQ( nullptr, StubRoutines::alien_call_entry( signature, std::strlen( signature ) ) ) << signature;
+    }
+    EXPECT_EQ( 0, StubRoutines::alien_signature_args( ">d", 2 ) );
+    EXPECT_EQ( 'd', StubRoutines::alien_signature_result( ">d", 2 ) );
+
+    checkMarkedSymbol( "invalid signature", signatureCallout( "ix", { smi0, smi0 } ), vmSymbols::argument_is_invalid() );
+    checkMarkedSymbol( "argument count", signatureCallout( "iii", { smi0, smi0 } ), vmSymbols::argument_is_invalid() );
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCallResultWithSignatureShouldCheckArgumentTypes ) {
+    checkMarkedSymbol( "int", signatureCallout( "ii", { smi0, pointerAlien->as_oop() } ), vmSymbols::argument_has_wrong_type() );
+    checkMarkedSymbol( "pointer", signatureCallout( "ip", { smi0, smi0 } ), vmSymbols::argument_has_wrong_type() );
+    checkMarkedSymbol( "double", signatureCallout( "di", { smi0, smi0 } ), vmSymbols::argument_has_wrong_type() );
+    checkMarkedSymbol( "float", signatureCallout( "if", { smi0, trueObject } ), vmSymbols::argument_has_wrong_type() );
+    checkMarkedSymbol( "short result", signatureCallout( "i>d", { smi0 }, directAlien->as_oop() ), vmSymbols::first_argument_has_wrong_type() );
+    checkMarkedSymbol( "result", signatureCallout( "ii", { smi0, smi0 }, trueObject ), vmSymbols::first_argument_has_wrong_type() );
+    checkMarkedSymbol( "receiver", ByteArrayPrimitives::alienCallResultWithSignature( OopFactory::new_objectArray( 0 ), OopFactory::new_byteArray( "" ), resultAlien->as_oop(), smi0 ), vmSymbols::receiver_has_wrong_type() );
+}
+
+
+TEST_F( AlienIntegerCalloutWithArgumentsTests, alienCalloutTiming ) {
+    // logs the time per call out of the fixed argument count, the generic argument array and the
+    // signature stubs, for integer and pointer arguments
+    constexpr std::int32_t calls = 200000;
+    ByteArrayPrimitives::alienSignedLongAtPut( asOop( 1 ), smi1, pointerAlien->as_oop() );
+
+    for ( bool pointers : { false, true } ) {
+        setAddress( functionAlien, pointers ? intPointerCalloutFunctions[ 0 ] : intCalloutFunctions[ 0 ] );
+        Oop argument = pointers ? pointerAlien->as_oop() : asOop( 1 );
+
+        ObjectArrayOop arguments = OopFactory::new_objectArray( 2 );
+        arguments->obj_at_put( 1, argument );
+        arguments->obj_at_put( 2, smi0 );
+        ByteArrayOop signature = OopFactory::new_byteArray( pointers ? "pi" : "ii" );
+        Oop          result    = resultAlien->as_oop();
+        Oop          function  = functionAlien->as_oop();
+
+        // nothing below allocates, so the oops stay valid
+        double start = os::elapsedTime();
+        for ( std::int32_t index = 0; index < calls; index++ ) {
+            ByteArrayPrimitives::alienCallResult2( smi0, argument, result, function );
+        }
+        double fixed = os::elapsedTime() - start;
+
+        start = os::elapsedTime();
+        for ( std::int32_t index = 0; index < calls; index++ ) {
+            ByteArrayPrimitives::alienCallResultWithArguments( arguments, result, function );
+        }
+        double generic = os::elapsedTime() - start;
+
+        start = os::elapsedTime();
+        for ( std::int32_t index = 0; index < calls; index++ ) {
+            ByteArrayPrimitives::alienCallResultWithSignature( arguments, signature, result, function );
+        }
+        double specialized = os::elapsedTime() - start;
+
+        checkIntResult( "wrong result", 1, resultAlien );
+        SPDLOG_INFO( "{} arguments: fixed {:.1f} ns, with arguments {:.1f} ns, with signature {:.1f} ns per call", pointers ? "pointer" : "integer", fixed * 1e9 / calls, generic * 1e9 / calls, specialized * 1e9 / calls );
+    }
+}
@@ -0,0 +1,291 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/oop/KlassOopDescriptor.hpp"
+#include "vm/oop/DoubleOopDescriptor.hpp"
+#include "vm/primitive/ByteArrayPrimitives.hpp"
+#include "vm/primitive/SystemPrimitives.hpp"
+#include "vm/memory/Handle.hpp"
+#include "vm/runtime/VMSymbol.hpp"
+#include "vm/memory/OopFactory.hpp"
+#include "vm/runtime/ResourceMark.hpp"
+#include "vm/platform/os.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+
+class AlienMappedFileTests : public ::testing::Test {
+
+public:
+    AlienMappedFileTests() :
+        ::testing::Test(),
+        rm{ nullptr },
+        alien{ nullptr },
+        fileName{ "AlienMappedFileTests.dat" },
+        fileSize{ 0 } {}
+
+
+protected:
+    void SetUp() override {
+        rm       = new HeapResourceMark();
+        alien    = new PersistentHandle( newAlien() );
+        fileSize = 3 * os::file_mapping_granularity();
+        writeFile( fileSize );
+    }
+
+
+    void TearDown() override {
+        if ( ByteArrayPrimitives::alienGetAddress( alien->as_oop() ) not_eq smiOopFromValue( 0 ) ) {
+            ByteArrayPrimitives::alienUnmap( alien->as_oop() );
+        }
+        delete alien;
+        alien = nullptr;
+        std::remove( fileName );
+        delete rm;
+        rm = nullptr;
+    }
+
+
+    HeapResourceMark *rm;
+    PersistentHandle *alien;
+    const char       *fileName;
+    std::int32_t     fileSize;
+
+
+    // an indirect alien without contents
+    static ByteArrayOop newAlien() {
+        ByteArrayOop result = ByteArrayOop( Universe::byteArrayKlassObject()->klass_part()->allocateObjectSize( 8 ) );
+        ByteArrayPrimitives::alienSetSize( smiOopFromValue( 0 ), result );
+        return result;
+    }
+
+
+    // byte i (0-based) of the test file
+    static std::int32_t fileByte( std::int32_t i ) {
+        return ( i * 7 + i / 251 ) & 0xFF;
+    }
+
+
+    void writeFile( std::int32_t size ) {
+        FILE *file = std::fopen( fileName, "wb" );
+        ASSERT_TRUE( file not_eq nullptr );
+        for ( std::int32_t i = 0; i < size; i++ ) {
+            std::fputc( fileByte( i ), file );
+        }
+        std::fclose( file );
+    }
+
+
+    std::int32_t readFileByte( std::int32_t i ) {
+        FILE *file = std::fopen( fileName, "rb" );
+        std::fseek( file, i, SEEK_SET );
+        std::int32_t result = std::fgetc( file );
+        std::fclose( file );
+        return result;
+    }
+
+
+    Oop map( std::int32_t offset, std::int32_t size, bool copyOnWrite ) {
+        return ByteArrayPrimitives::alienMapFile( copyOnWrite ? trueObject : falseObject, smiOopFromValue( size ), smiOopFromValue( offset ), OopFactory::new_byteArray( fileName ), alien->as_oop() );
+    }
+
+
+    std::int32_t byteAt( std::int32_t index ) {
+        return SmallIntegerOop( ByteArrayPrimitives::alienUnsignedByteAt( smiOopFromValue( index ), alien->as_oop() ) )->value();
+    }
+
+
+    static void checkMarkedSymbol( const char *message, Oop result, SymbolOop expected ) {
+        EXPECT_TRUE( result->isMarkOop() ) << message << ": should be marked";
+        EXPECT_TRUE( unmarkSymbol( result ) == expected ) << message << ": should be " << expected->as_string() << ", was " << unmarkSymbol( result )->as_string();
+    }
+};
+
+
+TEST_F( AlienMappedFileTests, mapFileShouldExposeFileContents ) {
+    Oop result = map( 0, 0, false );
+    EXPECT_TRUE( result == alien->as_oop() );
+    EXPECT_EQ( -fileSize, SmallIntegerOop( ByteArrayPrimitives::alienGetSize( alien->as_oop() ) )->value() );
+    for ( std::int32_t i : { 0, 1, 250, 251, fileSize / 2, fileSize - 1 } ) {
+        EXPECT_EQ( fileByte( i ), byteAt( i + 1 ) ) << i;
+    }
+}
+
+
+TEST_F( AlienMappedFileTests, mapFileShouldMapRangeAtOffset ) {
+    std::int32_t offset = os::file_mapping_granularity();
+    map( offset, 100, false );
+    EXPECT_EQ( -100, SmallIntegerOop( ByteArrayPrimitives::alienGetSize( alien->as_oop() ) )->value() );
+    EXPECT_EQ( fileByte( offset ), byteAt( 1 ) );
+    EXPECT_EQ( fileByte( offset + 99 ), byteAt( 100 ) );
+    checkMarkedSymbol( "beyond the range", ByteArrayPrimitives::alienUnsignedByteAt( smiOopFromValue( 101 ), alien->as_oop() ), vmSymbols::index_not_valid() );
+}
+
+
+TEST_F( AlienMappedFileTests, copyOnWriteMappingShouldNotChangeFile ) {
+    map( 0, 0, true );
+    ByteArrayPrimitives::alienUnsignedByteAtPut( smiOopFromValue( 255 - fileByte( 9 ) ), smiOopFromValue( 10 ), alien->as_oop() );
+    EXPECT_EQ( 255 - fileByte( 9 ), byteAt( 10 ) );
+    EXPECT_EQ( fileByte( 9 ), readFileByte( 9 ) );
+}
+
+
+TEST_F( AlienMappedFileTests, writesToReadOnlyMappingShouldFail ) {
+    map( 0, 0, false );
+    checkMarkedSymbol( "byte", ByteArrayPrimitives::alienUnsignedByteAtPut( smiOopFromValue( 255 - fileByte( 9 ) ), smiOopFromValue( 10 ), alien->as_oop() ), vmSymbols::illegal_state() );
+    checkMarkedSymbol( "long", ByteArrayPrimitives::alienSignedLongAtPut( smiOopFromValue( 1 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::illegal_state() );
+    checkMarkedSymbol( "double", ByteArrayPrimitives::alienDoubleAtPut( OopFactory::new_double( 1.0 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::illegal_state() );
+
+    ByteArrayOop bytes = OopFactory::new_byteArray( 10 );
+    checkMarkedSymbol( "bytes", ByteArrayPrimitives::alienReplaceFromToWithBytes( smiOopFromValue( 1 ), bytes, smiOopFromValue( 10 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::illegal_state() );
+    checkMarkedSymbol( "alien", ByteArrayPrimitives::alienReplaceFromToWithAlien( smiOopFromValue( 100 ), alien->as_oop(), smiOopFromValue( 10 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::illegal_state() );
+
+    EXPECT_EQ( fileByte( 9 ), byteAt( 10 ) );
+    EXPECT_EQ( fileByte( 9 ), readFileByte( 9 ) );
+    // reads are still fine, and so is copying out
+    EXPECT_TRUE( ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 1 ), bytes, smiOopFromValue( 10 ), smiOopFromValue( 1 ), alien->as_oop() ) == bytes );
+}
+
+
+TEST_F( AlienMappedFileTests, writesAfterUnmapOfReadOnlyMappingShouldSucceed ) {
+    map( 0, 0, false );
+    ByteArrayPrimitives::alienUnmap( alien->as_oop() );
+    map( 0, 0, true );
+    EXPECT_TRUE( ByteArrayPrimitives::alienUnsignedByteAtPut( smiOopFromValue( 7 ), smiOopFromValue( 1 ), alien->as_oop() ) == smiOopFromValue( 7 ) );
+    EXPECT_EQ( 7, byteAt( 1 ) );
+}
+
+
+TEST_F( AlienMappedFileTests, mapFileShouldFailForMappedAlien ) {
+    map( 0, 100, false );
+    checkMarkedSymbol( "mapped twice", map( 0, 0, true ), vmSymbols::illegal_state() );
+
+    // the first mapping is still in place, read-only
+    EXPECT_EQ( -100, SmallIntegerOop( ByteArrayPrimitives::alienGetSize( alien->as_oop() ) )->value() );
+    EXPECT_EQ( fileByte( 99 ), byteAt( 100 ) );
+    checkMarkedSymbol( "write", ByteArrayPrimitives::alienUnsignedByteAtPut( smiOopFromValue( 1 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::illegal_state() );
+}
+
+
+TEST_F( AlienMappedFileTests, unmapShouldResetAlien ) {
+    map( 0, 0, false );
+    EXPECT_TRUE( ByteArrayPrimitives::alienUnmap( alien->as_oop() ) == alien->as_oop() );
+    EXPECT_EQ( 0, SmallIntegerOop( ByteArrayPrimitives::alienGetSize( alien->as_oop() ) )->value() );
+    EXPECT_TRUE( ByteArrayPrimitives::alienGetAddress( alien->as_oop() ) == smiOopFromValue( 0 ) );
+    checkMarkedSymbol( "unmapped twice", ByteArrayPrimitives::alienUnmap( alien->as_oop() ), vmSymbols::illegal_state() );
+}
+
+
+TEST_F( AlienMappedFileTests, unmapShouldFailForMemoryNotMapped ) {
+    Oop address = SystemPrimitives::alienCalloc( smiOopFromValue( 16 ) );
+    ByteArrayPrimitives::alienSetSize( smiOopFromValue( -16 ), alien->as_oop() );
+    ByteArrayPrimitives::alienSetAddress( address, alien->as_oop() );
+    checkMarkedSymbol( "malloced", ByteArrayPrimitives::alienUnmap( alien->as_oop() ), vmSymbols::illegal_state() );
+    SystemPrimitives::alienFree( address );
+    ByteArrayPrimitives::alienSetAddress( smiOopFromValue( 0 ), alien->as_oop() );
+}
+
+
+TEST_F( AlienMappedFileTests, mapFileShouldFailForInvalidArguments ) {
+    checkMarkedSymbol( "misaligned offset", map( 1, 0, false ), vmSymbols::argument_is_invalid() );
+    checkMarkedSymbol( "negative size", map( 0, -1, false ), vmSymbols::argument_is_invalid() );
+    checkMarkedSymbol( "beyond the file", map( 0, fileSize + 1, false ), vmSymbols::not_found() );
+    checkMarkedSymbol( "offset beyond the file", map( fileSize, 0, false ), vmSymbols::not_found() );
+    checkMarkedSymbol( "name", ByteArrayPrimitives::alienMapFile( falseObject, smiOopFromValue( 0 ), smiOopFromValue( 0 ), smiOopFromValue( 0 ), alien->as_oop() ), vmSymbols::first_argument_has_wrong_type() );
+    checkMarkedSymbol( "copy on write", ByteArrayPrimitives::alienMapFile( nilObject, smiOopFromValue( 0 ), smiOopFromValue( 0 ), OopFactory::new_byteArray( fileName ), alien->as_oop() ), vmSymbols::fourth_argument_has_wrong_type() );
+
+    std::remove( fileName );
+    checkMarkedSymbol( "missing file", map( 0, 0, false ), vmSymbols::not_found() );
+}
+
+
+TEST_F( AlienMappedFileTests, bulkCopiesShouldCopyRanges ) {
+    map( 0, 0, true );
+    ByteArrayOop bytes = OopFactory::new_byteArray( 10 );
+
+    EXPECT_TRUE( ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 3 ), bytes, smiOopFromValue( 1005 ), smiOopFromValue( 1000 ), alien->as_oop() ) == bytes );
+    for ( std::int32_t i = 0; i < 6; i++ ) {
+        EXPECT_EQ( fileByte( 999 + i ), bytes->byte_at( 3 + i ) );
+    }
+
+    ByteArrayPrimitives::alienReplaceFromToWithBytes( smiOopFromValue( 3 ), bytes, smiOopFromValue( 6 ), smiOopFromValue( 1 ), alien->as_oop() );
+    for ( std::int32_t i = 0; i < 6; i++ ) {
+        EXPECT_EQ( fileByte( 999 + i ), byteAt( 1 + i ) );
+    }
+
+    // overlapping alien ranges are moved, not smeared
+    ByteArrayPrimitives::alienReplaceFromToWithAlien( smiOopFromValue( 1 ), alien->as_oop(), smiOopFromValue( 503 ), smiOopFromValue( 3 ), alien->as_oop() );
+    EXPECT_EQ( fileByte( 999 ), byteAt( 3 ) );
+    EXPECT_EQ( fileByte( 999 + 5 ), byteAt( 8 ) );
+    EXPECT_EQ( fileByte( 500 ), byteAt( 503 ) );
+}
+
+
+TEST_F( AlienMappedFileTests, bulkCopiesShouldCheckBounds ) {
+    map( 0, 100, false );
+    ByteArrayOop bytes = OopFactory::new_byteArray( 10 );
+    checkMarkedSymbol( "past the alien", ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 1 ), bytes, smiOopFromValue( 101 ), smiOopFromValue( 92 ), alien->as_oop() ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "past the bytes", ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 2 ), bytes, smiOopFromValue( 10 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "from 0", ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 1 ), bytes, smiOopFromValue( 5 ), smiOopFromValue( 0 ), alien->as_oop() ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "source bytes", ByteArrayPrimitives::alienReplaceFromToWithBytes( smiOopFromValue( 5 ), bytes, smiOopFromValue( 10 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "source alien", ByteArrayPrimitives::alienReplaceFromToWithAlien( smiOopFromValue( 91 ), alien->as_oop(), smiOopFromValue( 20 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::out_of_bounds() );
+    checkMarkedSymbol( "source not an alien", ByteArrayPrimitives::alienReplaceFromToWithAlien( smiOopFromValue( 1 ), OopFactory::new_byteArray( 4 ), smiOopFromValue( 1 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::third_argument_has_wrong_type() );
+    checkMarkedSymbol( "source a symbol", ByteArrayPrimitives::alienReplaceFromToWithAlien( smiOopFromValue( 1 ), OopFactory::new_symbol( "notAnAlien" ), smiOopFromValue( 1 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::third_argument_has_wrong_type() );
+    checkMarkedSymbol( "target type", ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 1 ), smiOopFromValue( 0 ), smiOopFromValue( 5 ), smiOopFromValue( 1 ), alien->as_oop() ), vmSymbols::third_argument_has_wrong_type() );
+
+    // empty ranges are fine
+    EXPECT_TRUE( ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 11 ), bytes, smiOopFromValue( 100 ), smiOopFromValue( 101 ), alien->as_oop() ) == bytes );
+}
+
+
+TEST_F( AlienMappedFileTests, adviseShouldCheckArguments ) {
+    map( 0, 0, false );
+    for ( std::int32_t advice = 0; advice <= 4; advice++ ) {
+        EXPECT_TRUE( ByteArrayPrimitives::alienAdvise( smiOopFromValue( fileSize ), smiOopFromValue( 10 ), smiOopFromValue( advice ), alien->as_oop() ) == alien->as_oop() ) << advice;
+    }
+    checkMarkedSymbol( "advice", ByteArrayPrimitives::alienAdvise( smiOopFromValue( 10 ), smiOopFromValue( 1 ), smiOopFromValue( 5 ), alien->as_oop() ), vmSymbols::argument_is_invalid() );
+    checkMarkedSymbol( "range", ByteArrayPrimitives::alienAdvise( smiOopFromValue( fileSize + 1 ), smiOopFromValue( 1 ), smiOopFromValue( 2 ), alien->as_oop() ), vmSymbols::out_of_bounds() );
+}
+
+
+TEST_F( AlienMappedFileTests, scanThroughput ) {
+    // logs the throughput of summing the bytes of a mapped file: byte by byte through the alien
+    // accessor (the read loop of the image), and in chunks copied into a byte array
+    std::int32_t granularity = os::file_mapping_granularity();
+    fileSize = ( 16 * 1024 * 1024 / granularity ) * granularity;
+    writeFile( fileSize );
+
+    map( 0, 0, false );
+    ByteArrayPrimitives::alienAdvise( smiOopFromValue( fileSize ), smiOopFromValue( 1 ), smiOopFromValue( static_cast<std::int32_t>( os::MemoryAdvice::sequential ) ), alien->as_oop() );
+
+    double       start = os::elapsedTime();
+    std::int32_t sum1  = 0;
+    for ( std::int32_t index = 1; index <= fileSize; index++ ) {
+        sum1 += SmallIntegerOop( ByteArrayPrimitives::alienUnsignedByteAt( smiOopFromValue( index ), alien->as_oop() ) )->value();
+    }
+    double byteLoop = os::elapsedTime() - start;
+
+    constexpr std::int32_t chunk = 64 * 1024;
+    PersistentHandle       buffer( OopFactory::new_byteArray( chunk ) );
+    start = os::elapsedTime();
+    std::int32_t sum2 = 0;
+    for ( std::int32_t from = 1; from <= fileSize; from += chunk ) {
+        std::int32_t to    = std::min( from + chunk - 1, fileSize );
+        ByteArrayOop bytes = ByteArrayOop( buffer.as_oop() );
+        ByteArrayPrimitives::alienCopyFromToIntoBytes( smiOopFromValue( 1 ), bytes, smiOopFromValue( to ), smiOopFromValue( from ), alien->as_oop() );
+        for ( std::int32_t i = 1; i <= to - from + 1; i++ ) {
+            sum2 += bytes->byte_at( i );
+        }
+    }
+    double chunked = os::elapsedTime() - start;
+
+    EXPECT_EQ( sum1, sum2 );
+    double megabytes = fileSize / ( 1024.0 * 1024.0 );
+    SPDLOG_INFO( "scan of a mapped {:.0f} MB file: byte by byte {:.1f} MB/s, copied in {} KB chunks {:.1f} MB/s", megabytes, megabytes / byteLoop, chunk / 1024, megabytes / chunked );
+}
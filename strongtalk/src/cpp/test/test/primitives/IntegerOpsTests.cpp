@@ -9,9 +9,14 @@
 #include "vm/utility/IntegerOps.hpp"
 #include "vm/runtime/ResourceMark.hpp"
 #include "vm/runtime/ResourceArea.hpp"
+#include "vm/platform/os.hpp"
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <random>
+#include <string>
+
 
 #define ASSERT_TRUE_M( expression, message ) \
     EXPECT_TRUE( expression ) << message;
@@ -91,10 +96,12 @@ protected:
         x  = (Integer *) NEW_RESOURCE_ARRAY( Digit, 5 );
         y  = (Integer *) NEW_RESOURCE_ARRAY( Digit, 5 );
         z  = (Integer *) NEW_RESOURCE_ARRAY( Digit, 5 );
+        saveThresholds();
     }
 
 
     void TearDown() override {
+        restoreThresholds();
         delete rm;
         rm = nullptr;
     }
@@ -102,6 +109,102 @@ protected:
 
     HeapResourceMark *rm;
     Integer          *x, *y, *z;
+    std::int32_t     thresholds[7];
+    std::mt19937     random{ 4711 };
+
+
+    void saveThresholds() {
+        thresholds[ 0 ] = IntegerOps::karatsuba_threshold;
+        thresholds[ 1 ] = IntegerOps::toom3_threshold;
+        thresholds[ 2 ] = IntegerOps::karatsuba_square_threshold;
+        thresholds[ 3 ] = IntegerOps::toom3_square_threshold;
+        thresholds[ 4 ] = IntegerOps::burnikel_ziegler_threshold;
+        thresholds[ 5 ] = IntegerOps::burnikel_ziegler_minimum;
+        thresholds[ 6 ] = IntegerOps::radix_conversion_threshold;
+    }
+
+
+    void restoreThresholds() {
+        IntegerOps::karatsuba_threshold        = thresholds[ 0 ];
+        IntegerOps::toom3_threshold            = thresholds[ 1 ];
+        IntegerOps::karatsuba_square_threshold = thresholds[ 2 ];
+        IntegerOps::toom3_square_threshold     = thresholds[ 3 ];
+        IntegerOps::burnikel_ziegler_threshold = thresholds[ 4 ];
+        IntegerOps::burnikel_ziegler_minimum   = thresholds[ 5 ];
+        IntegerOps::radix_conversion_threshold = thresholds[ 6 ];
+    }
+
+
+    // multiplication thresholds; basecase only for large values
+    static void setMultiplicationThresholds( std::int32_t karatsuba, std::int32_t toom3 ) {
+        IntegerOps::karatsuba_threshold        = karatsuba;
+        IntegerOps::toom3_threshold            = toom3;
+        IntegerOps::karatsuba_square_threshold = karatsuba;
+        IntegerOps::toom3_square_threshold     = toom3;
+    }
+
+
+    static Integer *newInteger( std::int32_t length ) {
+        Integer *result = (Integer *) NEW_RESOURCE_ARRAY( Digit, length + 1 );
+        result->set_signed_length( 0 );
+        return result;
+    }
+
+
+    // a random positive Integer of length digits; runs of zero and all ones digits included
+    Integer *randomInteger( std::int32_t length ) {
+        Integer *result = newInteger( length );
+        result->set_signed_length( length );
+        for ( std::int32_t i = 0; i < length; i++ ) {
+            std::uint32_t r = random();
+            ( *result )[ i ] = r % 7 == 0 ? 0 : r % 7 == 1 ? oneB : r;
+        }
+        ( *result )[ length - 1 ] |= 1;
+        return result;
+    }
+
+
+    static char *toString( Integer &a, std::int32_t base ) {
+        char *result = NEW_RESOURCE_ARRAY( char, IntegerOps::Integer_to_string_result_size_in_bytes( a, base ) );
+        IntegerOps::Integer_to_string( a, base, result );
+        return result;
+    }
+
+
+    static Integer *fromString( const char *s, std::int32_t base ) {
+        Integer *result = (Integer *) NEW_RESOURCE_ARRAY( char, IntegerOps::string_to_Integer_result_size_in_bytes( s, base ) );
+        IntegerOps::string_to_Integer( s, base, *result );
+        return result;
+    }
+
+
+    static bool equal( Integer &a, Integer &b ) {
+        return IntegerOps::cmp( a, b ) == 0;
+    }
+
+
+    static double microsecondsPerMultiplication( Integer &a, Integer &b, Integer &c ) {
+        std::int32_t repetitions = 0;
+        const double start       = os::elapsedTime();
+        double       elapsed;
+        do {
+            IntegerOps::mul( a, b, c );
+            repetitions++;
+        } while ( ( elapsed = os::elapsedTime() - start ) < 0.01 );
+        return elapsed * 1e6 / repetitions;
+    }
+
+
+    static double microsecondsPerDivision( Integer &a, Integer &b, Integer &q ) {
+        std::int32_t repetitions = 0;
+        const double start       = os::elapsedTime();
+        double       elapsed;
+        do {
+            IntegerOps::quo( a, b, q );
+            repetitions++;
+        } while ( ( elapsed = os::elapsedTime() - start ) < 0.01 );
+        return elapsed * 1e6 / repetitions;
+    }
 
     char message[100];
 
@@ -1024,3 +1127,218 @@ TEST_F( IntegerOpsTests, hashShouldXorDigits ) {
     std::int32_t result = IntegerOps::hash( *x );
     ASSERT_EQ_M2( ( 0x12345678 ^ 0xffffffff ^ -2 ) >> 2, result, "Wrong hash" );
 }
+
+
+TEST_F( IntegerOpsTests, mulWithZeroDigit ) {
+    CHECK_OP( mul, "300000000", "2", "600000000" );
+}
+
+
+TEST_F( IntegerOpsTests, mulAlgorithmsAgreeWithBasecase ) {
+    std::int32_t sizes[] = { 1, 5, 17, 40, 41, 99, 160, 250, 401 };
+    for ( std::int32_t xl : sizes ) {
+        for ( std::int32_t yl : sizes ) {
+            Integer *a        = randomInteger( xl );
+            Integer *b        = randomInteger( yl );
+            Integer *expected = newInteger( xl + yl );
+            Integer *actual   = newInteger( xl + yl );
+
+            setMultiplicationThresholds( 1 << 30, 1 << 30 );
+            IntegerOps::mul( *a, *b, *expected );
+            EXPECT_EQ( IntegerOps::mul_result_size_in_bytes( *a, *b ), Integer::length_to_size_in_bytes( xl + yl ) );
+
+            // Karatsuba only, then Toom-3 down to small operands
+            setMultiplicationThresholds( 4, 1 << 30 );
+            IntegerOps::mul( *a, *b, *actual );
+            EXPECT_TRUE( actual->is_valid() and equal( *expected, *actual ) ) << "Karatsuba " << xl << " x " << yl;
+            setMultiplicationThresholds( 4, 8 );
+            IntegerOps::mul( *a, *b, *actual );
+            EXPECT_TRUE( actual->is_valid() and equal( *expected, *actual ) ) << "Toom-3 " << xl << " x " << yl;
+        }
+    }
+}
+
+
+TEST_F( IntegerOpsTests, squareAgreesWithProduct ) {
+    for ( std::int32_t length : { 3, 33, 100, 301 } ) {
+        Integer *a        = randomInteger( length );
+        Integer *b        = newInteger( length );
+        Integer *expected = newInteger( 2 * length );
+        Integer *actual   = newInteger( 2 * length );
+        IntegerOps::copy( *a, *b );
+        IntegerOps::neg( *b );
+
+        setMultiplicationThresholds( 1 << 30, 1 << 30 );
+        IntegerOps::mul( *a, *b, *expected );
+        IntegerOps::neg( *expected );
+        for ( std::int32_t toom3 : { 1 << 30, 8 } ) {
+            setMultiplicationThresholds( 4, toom3 );
+            IntegerOps::mul( *a, *a, *actual );
+            EXPECT_TRUE( actual->is_valid() and not actual->is_negative() and equal( *expected, *actual ) ) << "length " << length;
+            IntegerOps::mul( *b, *b, *actual );
+            EXPECT_TRUE( equal( *expected, *actual ) ) << "length " << length;
+        }
+    }
+}
+
+
+TEST_F( IntegerOpsTests, burnikelZieglerDivisionAgreesWithLongDivision ) {
+    for ( std::int32_t divisorLength : { 2, 9, 40, 130 } ) {
+        for ( std::int32_t quotientLength : { 1, 2, 50, 333 } ) {
+            Integer *a = randomInteger( divisorLength + quotientLength );
+            Integer *b = randomInteger( divisorLength );
+            Integer *q = newInteger( quotientLength + 1 );
+            Integer *r = newInteger( divisorLength );
+            Integer *expectedQ = newInteger( quotientLength + 1 );
+            Integer *expectedR = newInteger( divisorLength );
+
+            IntegerOps::burnikel_ziegler_minimum = 1 << 30;
+            IntegerOps::quo( *a, *b, *expectedQ );
+            IntegerOps::rem( *a, *b, *expectedR );
+
+            IntegerOps::burnikel_ziegler_minimum   = 2;
+            IntegerOps::burnikel_ziegler_threshold = 4;
+            IntegerOps::quo( *a, *b, *q );
+            IntegerOps::rem( *a, *b, *r );
+            EXPECT_TRUE( q->is_valid() and equal( *expectedQ, *q ) ) << divisorLength << " / " << quotientLength;
+            EXPECT_TRUE( r->is_valid() and equal( *expectedR, *r ) ) << divisorLength << " / " << quotientLength;
+
+            // q * b + r = a and r < b
+            Integer *p = newInteger( divisorLength + quotientLength + 2 );
+            Integer *s = newInteger( divisorLength + quotientLength + 2 );
+            IntegerOps::mul( *q, *b, *p );
+            IntegerOps::add( *p, *r, *s );
+            EXPECT_TRUE( equal( *a, *s ) ) << divisorLength << " / " << quotientLength;
+            EXPECT_LT( IntegerOps::cmp( *r, *b ), 0 );
+        }
+    }
+}
+
+
+TEST_F( IntegerOpsTests, burnikelZieglerDivisionWithTinyThresholds ) {
+    // thresholds below the base case the recursion needs are raised to it
+    Integer *a = randomInteger( 70 );
+    Integer *b = randomInteger( 33 );
+    Integer *q = newInteger( 38 );
+    Integer *r = newInteger( 33 );
+    Integer *expectedQ = newInteger( 38 );
+    Integer *expectedR = newInteger( 33 );
+
+    IntegerOps::burnikel_ziegler_minimum = 1 << 30;
+    IntegerOps::quo( *a, *b, *expectedQ );
+    IntegerOps::rem( *a, *b, *expectedR );
+
+    IntegerOps::burnikel_ziegler_minimum = 2;
+    for ( std::int32_t threshold : { 0, 1, 2, 3 } ) {
+        IntegerOps::burnikel_ziegler_threshold = threshold;
+        IntegerOps::quo( *a, *b, *q );
+        IntegerOps::rem( *a, *b, *r );
+        EXPECT_TRUE( q->is_valid() and equal( *expectedQ, *q ) ) << threshold;
+        EXPECT_TRUE( r->is_valid() and equal( *expectedR, *r ) ) << threshold;
+    }
+}
+
+
+// The benchmarks are disabled, run them with --gtest_also_run_disabled_tests.
+TEST_F( IntegerOpsTests, DISABLED_multiplicationCrossoverBenchmark ) {
+    // logs the time per multiplication around the crossover points: basecase, one level of
+    // Karatsuba over basecase and one level of Toom-3 over the default algorithms
+    for ( std::int32_t length : { 32, 48, 64, 96, 128, 192, 256, 384, 512 } ) {
+        Integer *a = randomInteger( length );
+        Integer *b = randomInteger( length );
+        Integer *c = newInteger( 2 * length );
+
+        setMultiplicationThresholds( 1 << 30, 1 << 30 );
+        const double basecase = microsecondsPerMultiplication( *a, *b, *c );
+        const double square   = microsecondsPerMultiplication( *a, *a, *c );
+        setMultiplicationThresholds( length, 1 << 30 );
+        const double karatsuba       = microsecondsPerMultiplication( *a, *b, *c );
+        const double karatsubaSquare = microsecondsPerMultiplication( *a, *a, *c );
+        setMultiplicationThresholds( thresholds[ 0 ], length );
+        const double toom3       = microsecondsPerMultiplication( *a, *b, *c );
+        const double toom3Square = microsecondsPerMultiplication( *a, *a, *c );
+
+        SPDLOG_INFO( "{} digits: basecase {:.2f} us, Karatsuba {:.2f} us, Toom-3 {:.2f} us; squares {:.2f} us, {:.2f} us, {:.2f} us", length, basecase, karatsuba, toom3, square, karatsubaSquare, toom3Square );
+    }
+}
+
+
+TEST_F( IntegerOpsTests, DISABLED_divisionCrossoverBenchmark ) {
+    // logs the time per division of a 2n by an n digit Integer: algorithm D and the recursive
+    // division for a range of base case sizes
+    for ( std::int32_t length : { 40, 80, 160, 320, 640, 1280 } ) {
+        Integer *a = randomInteger( 2 * length );
+        Integer *b = randomInteger( length );
+        Integer *q = newInteger( length + 1 );
+
+        IntegerOps::burnikel_ziegler_minimum = 1 << 30;
+        const double algorithmD = microsecondsPerDivision( *a, *b, *q );
+
+        IntegerOps::burnikel_ziegler_minimum = 2;
+        std::string recursive;
+        for ( std::int32_t threshold : { 20, 40, 80, 160 } ) {
+            IntegerOps::burnikel_ziegler_threshold = threshold;
+            recursive += fmt::format( ", base case {} {:.2f} us", threshold, microsecondsPerDivision( *a, *b, *q ) );
+        }
+        IntegerOps::burnikel_ziegler_threshold = thresholds[ 4 ];
+
+        SPDLOG_INFO( "{} digits: algorithm D {:.2f} us{}", length, algorithmD, recursive );
+    }
+}
+
+
+TEST_F( IntegerOpsTests, radixConversionAgreesWithBasecaseInAllBases ) {
+    for ( std::int32_t length : { 1, 7, 120, 333 } ) {
+        Integer *a = randomInteger( length );
+        if ( length % 2 == 1 )
+            IntegerOps::neg( *a );
+        for ( std::int32_t base = 2; base <= 36; base++ ) {
+            IntegerOps::radix_conversion_threshold = 1 << 30;
+            char *expected = toString( *a, base );
+            IntegerOps::radix_conversion_threshold = 4;
+            char *actual = toString( *a, base );
+            EXPECT_STREQ( expected, actual ) << "base " << base << ", " << length << " digits";
+
+            Integer *b = fromString( actual, base );
+            EXPECT_TRUE( b->is_valid() and equal( *a, *b ) ) << "base " << base << ", " << length << " digits";
+        }
+    }
+}
+
+
+TEST_F( IntegerOpsTests, radixConversionKeepsInnerZeros ) {
+    IntegerOps::radix_conversion_threshold = 4;
+    for ( std::int32_t base : { 3, 10, 16, 36 } ) {
+        // 1 followed by 2000 zeros, i.e. base^2000, and base^2000 - 1
+        std::string power = "1" + std::string( 2000, '0' );
+        Integer     *a    = fromString( power.c_str(), base );
+        EXPECT_EQ( power, toString( *a, base ) ) << "base " << base;
+
+        Integer *one = newInteger( 1 );
+        Integer *b   = newInteger( a->length() );
+        IntegerOps::int_to_Integer( 1, *one );
+        IntegerOps::sub( *a, *one, *b );
+        std::string allDigits( 2000, IntegerOps::as_char( base - 1 ) );
+        EXPECT_EQ( allDigits, toString( *b, base ) ) << "base " << base;
+        EXPECT_TRUE( equal( *b, *fromString( ( "0000" + allDigits ).c_str(), base ) ) ) << "base " << base;
+    }
+    EXPECT_STREQ( "0", toString( *fromString( "-000", 10 ), 10 ) );
+    EXPECT_STREQ( "-ff", toString( *fromString( "-0FF", 16 ), 16 ) );
+}
+
+
+TEST_F( IntegerOpsTests, DISABLED_radixConversionBenchmark ) {
+    // logs the time to print and parse a 100000 digit decimal number, recursively and with the basecase
+    // (disabled like the crossover benchmarks, the basecase takes seconds)
+    Integer *a = randomInteger( 10380 );       // 2^(32 * 10380) ~ 10^100000
+    for ( std::int32_t threshold : { thresholds[ 6 ], 1 << 30 } ) {
+        IntegerOps::radix_conversion_threshold = threshold;
+        const double start  = os::elapsedTime();
+        char         *s     = toString( *a, 10 );
+        const double middle = os::elapsedTime();
+        Integer      *b     = fromString( s, 10 );
+        const double end    = os::elapsedTime();
+        EXPECT_TRUE( equal( *a, *b ) );
+        SPDLOG_INFO( "{} decimal digits, radix conversion threshold {}: print {:.1f} ms, parse {:.1f} ms", strlen( s ), threshold, ( middle - start ) * 1e3, ( end - middle ) * 1e3 );
+    }
+}
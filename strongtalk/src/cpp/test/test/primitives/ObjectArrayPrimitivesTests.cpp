@@ -43,6 +43,20 @@ protected:
 
     KlassOop arrayClass;
 
+
+    // a new (or tenured) array holding 1..length
+    ObjectArrayOop numbers( std::int32_t length, bool tenured = false ) {
+        ObjectArrayOop array = ObjectArrayOop( ObjectArrayPrimitives::allocateSize2( tenured ? trueObject : falseObject, smiOopFromValue( length ), arrayClass ) );
+        for ( std::int32_t index = 1; index <= length; index++ )
+            array->obj_at_put( index, smiOopFromValue( index ) );
+        return array;
+    }
+
+
+    static std::int32_t valueAt( ObjectArrayOop array, std::int32_t index ) {
+        return SmallIntegerOop( array->obj_at( index ) )->value();
+    }
+
 };
 
 TEST_F( ObjectArrayPrimitivesTests, allocateSize2ShouldAllocateArrayOfCorrectSize ) {
@@ -116,3 +130,96 @@ TEST_F( ObjectArrayPrimitivesTests, allocateSize2ShouldFailWhenTooBigForOldGen )
     ASSERT_TRUE( result->isMarkOop() );
     EXPECT_EQ( markSymbol( vmSymbols::failed_allocation() ), result ) << unmarkSymbol( result )->as_string();
 }
+
+
+TEST_F( ObjectArrayPrimitivesTests, replaceFromToShouldCopyOverlappingRangesUp ) {
+    ObjectArrayOop array  = numbers( 10 );
+    Oop            result = ObjectArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), array, smiOopFromValue( 7 ), smiOopFromValue( 3 ), array );
+    ASSERT_EQ( (const char *) array, (const char *) result );
+    std::int32_t expected[] = { 1, 2, 1, 2, 3, 4, 5, 8, 9, 10 };
+    for ( std::int32_t index = 1; index <= 10; index++ )
+        EXPECT_EQ( expected[ index - 1 ], valueAt( array, index ) ) << index;
+}
+
+
+TEST_F( ObjectArrayPrimitivesTests, replaceFromToShouldCopyOverlappingRangesDown ) {
+    ObjectArrayOop array = numbers( 10 );
+    ObjectArrayPrimitives::replace_from_to( smiOopFromValue( 4 ), array, smiOopFromValue( 5 ), smiOopFromValue( 1 ), array );
+    std::int32_t expected[] = { 4, 5, 6, 7, 8, 6, 7, 8, 9, 10 };
+    for ( std::int32_t index = 1; index <= 10; index++ )
+        EXPECT_EQ( expected[ index - 1 ], valueAt( array, index ) ) << index;
+}
+
+
+TEST_F( ObjectArrayPrimitivesTests, replaceFromToShouldCopyWholeSourceOfExactSize ) {
+    ObjectArrayOop array  = numbers( 5 );
+    ObjectArrayOop source = numbers( 5 );
+    for ( std::int32_t index = 1; index <= 5; index++ )
+        source->obj_at_put( index, smiOopFromValue( 10 * index ) );
+
+    Oop result = ObjectArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), source, smiOopFromValue( 5 ), smiOopFromValue( 1 ), array );
+    ASSERT_EQ( (const char *) array, (const char *) result );
+    for ( std::int32_t index = 1; index <= 5; index++ )
+        EXPECT_EQ( 10 * index, valueAt( array, index ) ) << index;
+
+    // one element further into the source is out of bounds
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), ObjectArrayPrimitives::replace_from_to( smiOopFromValue( 2 ), source, smiOopFromValue( 5 ), smiOopFromValue( 1 ), array ) );
+}
+
+
+TEST_F( ObjectArrayPrimitivesTests, replaceFromToShouldFailWhenSourceTooSmallOrStartBelowOne ) {
+    ObjectArrayOop array  = numbers( 10 );
+    ObjectArrayOop source = numbers( 3 );
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), ObjectArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), source, smiOopFromValue( 4 ), smiOopFromValue( 1 ), array ) );
+    EXPECT_EQ( markSymbol( vmSymbols::out_of_bounds() ), ObjectArrayPrimitives::replace_from_to( smiOopFromValue( 0 ), source, smiOopFromValue( 2 ), smiOopFromValue( 1 ), array ) );
+    EXPECT_EQ( 1, valueAt( array, 1 ) );
+}
+
+
+TEST_F( ObjectArrayPrimitivesTests, replaceFromToShouldMarkCardsOfTenuredReceiver ) {
+    HandleMark     handles;
+    ObjectArrayOop array   = numbers( 1000, true );
+    ObjectArrayOop source  = numbers( 1000 );
+    Handle         arrayHandle( array );
+    ASSERT_TRUE( array->is_old() );
+    ASSERT_TRUE( source->is_new() );
+    source->obj_at_put( 1, source );
+
+    Universe::remembered_set->clear();
+    ObjectArrayPrimitives::replace_from_to( smiOopFromValue( 1 ), source, smiOopFromValue( 900 ), smiOopFromValue( 2 ), array );
+    EXPECT_FALSE( Universe::remembered_set->is_dirty( array->objs( 1 ) ) );
+    EXPECT_TRUE( Universe::remembered_set->is_dirty( array->objs( 2 ) ) );
+    EXPECT_TRUE( Universe::remembered_set->is_dirty( array->objs( 500 ) ) );
+    EXPECT_TRUE( Universe::remembered_set->is_dirty( array->objs( 900 ) ) );
+    EXPECT_EQ( (const char *) source, (const char *) array->obj_at( 2 ) );
+    EXPECT_EQ( 899, valueAt( array, 900 ) );
+}
+
+
+TEST_F( ObjectArrayPrimitivesTests, atAllPutShouldMarkCardsOfTenuredReceiver ) {
+    ObjectArrayOop array = numbers( 1000, true );
+    ObjectArrayOop value = numbers( 1 );
+
+    Universe::remembered_set->clear();
+    ObjectArrayPrimitives::at_all_put( value, array );
+    for ( std::int32_t index : { 1, 333, 1000 } ) {
+        EXPECT_EQ( (const char *) value, (const char *) array->obj_at( index ) );
+        EXPECT_TRUE( Universe::remembered_set->is_dirty( array->objs( index ) ) ) << index;
+    }
+}
+
+
+TEST_F( ObjectArrayPrimitivesTests, copySizeShouldCopyAndPadWithNil ) {
+    ObjectArrayOop array  = numbers( 10 );
+    Oop            result = ObjectArrayPrimitives::copy_size( smiOopFromValue( 15 ), smiOopFromValue( 1 ), smiOopFromValue( 1 ), array );
+    ASSERT_TRUE( result->isObjectArray() );
+    ASSERT_EQ( 15, ObjectArrayOop( result )->length() );
+    for ( std::int32_t index = 1; index <= 10; index++ )
+        EXPECT_EQ( index, valueAt( ObjectArrayOop( result ), index ) );
+    for ( std::int32_t index = 11; index <= 15; index++ )
+        EXPECT_EQ( Universe::nilObject(), ObjectArrayOop( result )->obj_at( index ) );
+
+    result = ObjectArrayPrimitives::copy_size( smiOopFromValue( 4 ), smiOopFromValue( 1 ), smiOopFromValue( 1 ), array );
+    ASSERT_EQ( 4, ObjectArrayOop( result )->length() );
+    EXPECT_EQ( 4, valueAt( ObjectArrayOop( result ), 4 ) );
+}
@@ -0,0 +1,107 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/runtime/AsyncDLLPool.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+#include "vm/runtime/Processes.hpp"
+#include "vm/platform/os.hpp"
+
+#include <gtest/gtest.h>
+
+
+// A user-mode process that is never scheduled; its stack runs fakeDLLCall, which plays the native code of an
+// asynchronous dll call on the worker the call has been handed to.
+class TestAsyncDLLProcess : public DeltaProcess {
+
+public:
+    TestAsyncDLLProcess( void entry() ) :
+        DeltaProcess( nullptr, nullptr, false ) {
+        Processes::remove( this );
+        _user_mode = true;
+        allocate_stack( entry );
+    }
+
+
+    ~TestAsyncDLLProcess() {
+        release_stack();
+    }
+};
+
+
+static TestAsyncDLLProcess *process = nullptr;
+static std::int32_t        threadOfCall;
+static std::int32_t        threadOfNestedCall;
+static std::int32_t        threadAfterCallBack;
+
+
+// the dll call calls back into Delta, the call back makes an asynchronous call of its own and returns
+static void fakeDLLCall() {
+    threadOfCall = os::current_thread_id();
+    process->wait_for_control( false );
+
+    // the nested call, handed off by the call back
+    threadOfNestedCall = os::current_thread_id();
+    process->exit_async_dll_call();
+    process->wait_for_control();
+
+    // the call back has returned
+    threadAfterCallBack = os::current_thread_id();
+    process->exit_async_dll_call();
+    process->wait_for_control();
+    ShouldNotReachHere();
+}
+
+
+class AsyncDLLPoolTests : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        threadOfCall        = -1;
+        threadOfNestedCall  = -1;
+        threadAfterCallBack = -1;
+        process             = new TestAsyncDLLProcess( &fakeDLLCall );
+    }
+
+
+    void TearDown() override {
+        AsyncDLLPool::remove( process );
+        delete process;
+        process = nullptr;
+    }
+
+
+    // hands the process to the pool, as DeltaProcess::transfer_and_continue does, and waits until it comes back
+    static bool handOffAndWait() {
+        AsyncDLLPool::submit( process );
+        for ( std::int32_t i = 0; i < 5000 and not AsyncDLLPool::has_completed(); i++ ) {
+            os::sleep( 1 );
+        }
+        if ( not AsyncDLLPool::has_completed() )
+            return false;
+        AsyncDLLPool::remove( process );
+        return true;
+    }
+};
+
+
+TEST_F( AsyncDLLPoolTests, nestedCallOfCallBackKeepsTheWorker ) {
+    process->enter_async_dll_call();
+    ASSERT_TRUE( handOffAndWait() );
+    EXPECT_NE( -1, threadOfCall );
+    EXPECT_EQ( threadOfCall, process->dll_thread_id() );
+
+    // the call back makes a call of its own
+    process->enter_async_dll_call();
+    ASSERT_TRUE( handOffAndWait() );
+    EXPECT_EQ( threadOfCall, threadOfNestedCall );
+    EXPECT_EQ( threadOfCall, process->dll_thread_id() );
+    EXPECT_EQ( 1, process->async_dll_calls() );
+
+    // back from the call back, the outer call continues on its worker and completes
+    ASSERT_TRUE( handOffAndWait() );
+    EXPECT_EQ( threadOfCall, threadAfterCallBack );
+    EXPECT_EQ( -1, process->dll_thread_id() );
+    EXPECT_EQ( 0, process->async_dll_calls() );
+}
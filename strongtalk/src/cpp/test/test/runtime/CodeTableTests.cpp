@@ -0,0 +1,387 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/code/CodeTable.hpp"
+#include "vm/code/JumpTable.hpp"
+#include "vm/code/NativeMethod.hpp"
+#include "vm/memory/Universe.hpp"
+#include "vm/memory/OopFactory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+
+// exposes the protected parts of the table; entries are added directly instead of through the zone
+class TestCodeTable : public CodeTable {
+
+public:
+    TestCodeTable( std::int32_t size ) :
+        CodeTable( size ) {
+    }
+
+
+    using CodeTable::add;
+    using CodeTable::addIfAbsent;
+    using CodeTable::is_resizing;
+
+
+    std::int32_t tombstones() const {
+        return _numberOfTombstones;
+    }
+
+
+    // tells whether nm sits in the bucket array being migrated (only during a resize)
+    bool in_old_buckets( NativeMethod *nm ) const {
+        return contains( _oldBuckets, _oldTableSize, nm );
+    }
+
+
+    bool in_new_buckets( NativeMethod *nm ) const {
+        return contains( _buckets, _tableSize, nm );
+    }
+
+
+    std::int32_t buckets_to_migrate() const {
+        return _oldTableSize - _migrationIndex;
+    }
+
+
+private:
+    static bool contains( NativeMethod **buckets, std::int32_t size, NativeMethod *nm ) {
+        for ( std::int32_t i = 0; i < size; i++ ) {
+            if ( buckets[ i ] == nm )
+                return true;
+        }
+        return false;
+    }
+};
+
+
+class CodeTableTests : public ::testing::Test {
+
+protected:
+    // several times codeTableMigrationStride buckets, so that a resize spans many adds
+    static constexpr std::int32_t initialSize  = 256;
+    static constexpr std::int32_t numberOfKeys = 400;
+
+    TestCodeTable *table;
+    NativeMethod  *nms[ numberOfKeys ];
+
+
+    void SetUp() override {
+        table = new TestCodeTable( initialSize );
+        // only the lookup key of the fake nativeMethods is ever looked at by the table
+        for ( std::int32_t i = 0; i < numberOfKeys; i++ ) {
+            char name[ 32 ];
+            std::snprintf( name, sizeof( name ), "codeTableTest%d", i );
+            nms[ i ] = static_cast<NativeMethod *>( std::malloc( sizeof( NativeMethod ) ) );
+            nms[ i ]->_lookupKey.initialize( i % 2 == 0 ? Universe::smiKlassObject() : Universe::objectArrayKlassObject(), OopFactory::new_symbol( name ) );
+        }
+    }
+
+
+    void TearDown() override {
+        for ( std::int32_t i = 0; i < numberOfKeys; i++ ) {
+            std::free( nms[ i ] );
+        }
+        delete table;
+        table = nullptr;
+    }
+
+
+    void addAll() {
+        for ( std::int32_t i = 0; i < numberOfKeys; i++ ) {
+            table->add( nms[ i ] );
+        }
+    }
+
+
+    // adds entries until a resize has started, returns the # of entries added
+    std::int32_t addUntilResizing() {
+        std::int32_t i = 0;
+        while ( not table->is_resizing() and i < numberOfKeys ) {
+            table->add( nms[ i++ ] );
+        }
+        return i;
+    }
+};
+
+
+TEST_F( CodeTableTests, addAndLookupAcrossIncrementalResize ) {
+    bool sawResize = false;
+    for ( std::int32_t i = 0; i < numberOfKeys; i++ ) {
+        table->add( nms[ i ] );
+        sawResize = sawResize or table->is_resizing();
+
+        // every entry added so far is found, whether it has been migrated yet or not
+        for ( std::int32_t j = 0; j <= i; j++ ) {
+            ASSERT_EQ( nms[ j ], table->lookup( &nms[ j ]->_lookupKey ) ) << "entry " << j << " after adding " << i;
+        }
+        ASSERT_TRUE( table->verify() );
+    }
+
+    EXPECT_TRUE( sawResize );
+    EXPECT_EQ( numberOfKeys, table->length() );
+    EXPECT_GT( table->capacity(), initialSize );
+    EXPECT_LE( table->load_factor(), codeTableMaxLoad );
+}
+
+
+TEST_F( CodeTableTests, lookupOfAbsentKeyFails ) {
+    for ( std::int32_t i = 0; i < numberOfKeys / 2; i++ ) {
+        table->add( nms[ i ] );
+    }
+    for ( std::int32_t i = numberOfKeys / 2; i < numberOfKeys; i++ ) {
+        EXPECT_EQ( nullptr, table->lookup( &nms[ i ]->_lookupKey ) );
+        EXPECT_FALSE( table->is_present( nms[ i ] ) );
+    }
+}
+
+
+TEST_F( CodeTableTests, removeLeavesTombstonesThatKeepProbeChainsIntact ) {
+    addAll();
+    for ( std::int32_t i = 0; i < numberOfKeys; i += 2 ) {
+        table->remove( nms[ i ] );
+    }
+
+    EXPECT_EQ( numberOfKeys / 2, table->length() );
+    EXPECT_GT( table->tombstones(), 0 );
+    EXPECT_TRUE( table->verify() );
+    for ( std::int32_t i = 0; i < numberOfKeys; i++ ) {
+        EXPECT_EQ( i % 2 == 0 ? nullptr : nms[ i ], table->lookup( &nms[ i ]->_lookupKey ) ) << "entry " << i;
+    }
+}
+
+
+TEST_F( CodeTableTests, removeDuringResizeFindsEntriesInBothArrays ) {
+    std::int32_t i = addUntilResizing();
+    ASSERT_TRUE( table->is_resizing() );
+
+    // some entries are still in the old array, the last one is in the new one
+    std::int32_t old = 0;
+    for ( std::int32_t j = 0; j < i; j++ ) {
+        old += table->in_old_buckets( nms[ j ] ) ? 1 : 0;
+    }
+    EXPECT_GT( old, 0 );
+    EXPECT_TRUE( table->in_new_buckets( nms[ i - 1 ] ) );
+
+    for ( std::int32_t j = 0; j < i; j++ ) {
+        table->remove( nms[ j ] );
+        EXPECT_FALSE( table->is_present( nms[ j ] ) );
+    }
+    EXPECT_EQ( 0, table->length() );
+    EXPECT_TRUE( table->verify() );
+}
+
+
+TEST_F( CodeTableTests, entriesAreFoundInBothArraysMidMigration ) {
+    std::int32_t i = addUntilResizing();
+    ASSERT_TRUE( table->is_resizing() );
+    ASSERT_GT( table->buckets_to_migrate(), codeTableMigrationStride );
+
+    // a few more adds, each moving only codeTableMigrationStride old buckets over
+    for ( std::int32_t n = 0; n < 3; n++ ) {
+        std::int32_t before = table->buckets_to_migrate();
+        table->add( nms[ i++ ] );
+        ASSERT_TRUE( table->is_resizing() );
+        EXPECT_EQ( before - codeTableMigrationStride, table->buckets_to_migrate() );
+    }
+
+    NativeMethod *inOld = nullptr;
+    NativeMethod *inNew = nullptr;
+    for ( std::int32_t j = 0; j < i; j++ ) {
+        bool old = table->in_old_buckets( nms[ j ] );
+        EXPECT_NE( old, table->in_new_buckets( nms[ j ] ) ) << "entry " << j << " should be in exactly one array";
+        EXPECT_EQ( nms[ j ], table->lookup( &nms[ j ]->_lookupKey ) ) << "entry " << j;
+        if ( old and not inOld )
+            inOld = nms[ j ];
+        if ( not old and not inNew )
+            inNew = nms[ j ];
+    }
+    ASSERT_TRUE( inOld not_eq nullptr );
+    ASSERT_TRUE( inNew not_eq nullptr );
+    EXPECT_TRUE( table->verify() );
+
+    // remove one entry of each array and add both again, still mid-migration
+    table->remove( inOld );
+    table->remove( inNew );
+    EXPECT_FALSE( table->is_present( inOld ) );
+    EXPECT_FALSE( table->is_present( inNew ) );
+    EXPECT_EQ( i - 2, table->length() );
+    EXPECT_TRUE( table->verify() );
+
+    table->add( inOld );
+    ASSERT_TRUE( table->is_resizing() );
+    table->add( inNew );
+    EXPECT_TRUE( table->in_new_buckets( inOld ) );
+    EXPECT_TRUE( table->in_new_buckets( inNew ) );
+    EXPECT_EQ( i, table->length() );
+    EXPECT_TRUE( table->verify() );
+
+    // finishing the migration leaves everything in the new array
+    while ( table->is_resizing() ) {
+        table->add( nms[ i++ ] );
+    }
+    for ( std::int32_t j = 0; j < i; j++ ) {
+        EXPECT_TRUE( table->in_new_buckets( nms[ j ] ) ) << "entry " << j;
+        EXPECT_EQ( nms[ j ], table->lookup( &nms[ j ]->_lookupKey ) ) << "entry " << j;
+    }
+    EXPECT_TRUE( table->verify() );
+}
+
+
+TEST_F( CodeTableTests, readdingAfterRemoveReusesTheTable ) {
+    addAll();
+    std::int32_t capacity = table->capacity();
+
+    // churning the same keys must not grow the table, resizes just drop the tombstones
+    for ( std::int32_t round = 0; round < 20; round++ ) {
+        for ( std::int32_t i = 0; i < numberOfKeys; i += 2 ) {
+            table->remove( nms[ i ] );
+        }
+        for ( std::int32_t i = 0; i < numberOfKeys; i += 2 ) {
+            table->add( nms[ i ] );
+        }
+        ASSERT_TRUE( table->verify() );
+    }
+
+    EXPECT_EQ( numberOfKeys, table->length() );
+    EXPECT_LE( table->capacity(), capacity * 2 );
+    for ( std::int32_t i = 0; i < numberOfKeys; i++ ) {
+        EXPECT_EQ( nms[ i ], table->lookup( &nms[ i ]->_lookupKey ) );
+    }
+}
+
+
+TEST_F( CodeTableTests, addIfAbsentIgnoresPresentKeys ) {
+    table->add( nms[ 0 ] );
+    table->addIfAbsent( nms[ 0 ] );
+    table->addIfAbsent( nms[ 1 ] );
+    EXPECT_EQ( 2, table->length() );
+    EXPECT_TRUE( table->verify() );
+}
+
+
+TEST_F( CodeTableTests, replaceKeepsTheKey ) {
+    addAll();
+    NativeMethod *copy = static_cast<NativeMethod *>( std::malloc( sizeof( NativeMethod ) ) );
+    copy->_lookupKey.initialize( nms[ 7 ]->_lookupKey.klass(), nms[ 7 ]->_lookupKey.selector_or_method() );
+
+    table->replace( nms[ 7 ], copy );
+    EXPECT_EQ( copy, table->lookup( &nms[ 7 ]->_lookupKey ) );
+    EXPECT_FALSE( table->is_present( nms[ 7 ] ) );
+    EXPECT_EQ( numberOfKeys, table->length() );
+    EXPECT_TRUE( table->verify() );
+
+    table->replace( copy, nms[ 7 ] );
+    std::free( copy );
+}
+
+
+// exposes the block structure of the table
+class TestJumpTable : public JumpTable {
+
+public:
+    std::int32_t numberOfBlocks() const {
+        return _numberOfBlocks;
+    }
+
+
+    std::int32_t blockLength() const {
+        return _blockLength;
+    }
+};
+
+
+class JumpTableTests : public ::testing::Test {
+
+protected:
+    static constexpr std::int32_t blockLength = 8;
+
+    std::int32_t savedSize;
+
+
+    void SetUp() override {
+        // small blocks so that the table grows after a few IDs
+        savedSize = Universe::current_sizes._jump_table_size;
+        Universe::current_sizes._jump_table_size = blockLength;
+    }
+
+
+    void TearDown() override {
+        Universe::current_sizes._jump_table_size = savedSize;
+    }
+};
+
+
+TEST_F( JumpTableTests, newIDGrowsTheTableWithoutMovingEntries ) {
+    TestJumpTable table;
+    table.init();
+    ASSERT_EQ( blockLength, table.blockLength() );
+    ASSERT_EQ( blockLength, table.length );
+
+    JumpTableEntry *first[ blockLength ];
+    for ( std::int32_t i = 0; i < blockLength; i++ ) {
+        ASSERT_EQ( i, table.newID() );
+        first[ i ] = table.at( JumpTableID( i ) );
+    }
+    EXPECT_EQ( 1, table.numberOfBlocks() );
+
+    // more blocks than the initial block directory holds
+    const std::int32_t n = blockLength * 10;
+    for ( std::int32_t i = blockLength; i < n; i++ ) {
+        EXPECT_EQ( i, table.peekID() );
+        EXPECT_EQ( i, table.newID() );
+        EXPECT_TRUE( table.at( JumpTableID( i ) )->is_unused() );
+    }
+
+    EXPECT_EQ( 10, table.numberOfBlocks() );
+    EXPECT_EQ( n, table.length );
+    EXPECT_EQ( n, table.usedIDs );
+    for ( std::int32_t i = 0; i < blockLength; i++ ) {
+        EXPECT_EQ( first[ i ], table.at( JumpTableID( i ) ) );
+    }
+}
+
+
+TEST_F( JumpTableTests, freedIDsAreReusedFirst ) {
+    TestJumpTable table;
+    table.init();
+    for ( std::int32_t i = 0; i < blockLength + 3; i++ ) {
+        table.newID();
+    }
+
+    table.freeID( 2 );
+    table.freeID( blockLength + 1 );
+    EXPECT_EQ( blockLength + 1, table.peekID() );
+    EXPECT_EQ( blockLength + 1, table.newID() );
+    EXPECT_EQ( 2, table.newID() );
+    EXPECT_EQ( blockLength + 3, table.newID() );
+    EXPECT_EQ( 2, table.numberOfBlocks() );
+    EXPECT_EQ( blockLength + 4, table.usedIDs );
+}
+
+
+TEST_F( JumpTableTests, allocateInTheGrownPart ) {
+    TestJumpTable table;
+    table.init();
+    for ( std::int32_t i = 0; i < blockLength; i++ ) {
+        table.newID();
+    }
+
+    JumpTableID single = table.allocate( 1 );
+    EXPECT_EQ( blockLength, single.major() );
+    EXPECT_FALSE( single.has_minor() );
+    EXPECT_TRUE( table.at( single )->is_NativeMethod_stub() );
+
+    JumpTableID blocks = table.allocate( 3 );
+    EXPECT_EQ( blockLength + 1, blocks.major() );
+    EXPECT_TRUE( table.at( JumpTableID( blocks.major() ) )->is_link() );
+    EXPECT_TRUE( table.at( blocks.sub( 0 ) )->is_NativeMethod_stub() );
+    EXPECT_TRUE( table.at( blocks.sub( 1 ) )->is_block_closure_stub() );
+    EXPECT_TRUE( table.at( blocks.sub( 2 ) )->is_block_closure_stub() );
+}
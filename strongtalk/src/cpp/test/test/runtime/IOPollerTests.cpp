@@ -0,0 +1,318 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/runtime/IOPoller.hpp"
+#include "vm/klass/WeakArrayKlass.hpp"
+#include "vm/oop/SmallIntegerOopDescriptor.hpp"
+#include "vm/primitive/SystemPrimitives.hpp"
+#include "vm/runtime/VMSymbol.hpp"
+#include "vm/platform/os.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+
+#include <gtest/gtest.h>
+
+#if defined( __linux__ )
+
+#include <algorithm>
+#include <vector>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+// Each socket pair is armed on its first end with the pair's index as the waiter; writing to
+// the second end makes the first one readable.
+
+class IOPollerTests : public ::testing::Test {
+
+protected:
+    std::vector<std::int32_t> ends;     // armed end of each pair
+    std::vector<std::int32_t> peers;    // the other end
+
+
+    void SetUp() override {
+        drainQueue();
+        IOPoller::take_queued();
+    }
+
+
+    void TearDown() override {
+        for ( std::size_t i = 0; i < ends.size(); i++ ) {
+            IOPoller::remove( ends[ i ] );
+            if ( ends[ i ] >= 0 )
+                close( ends[ i ] );
+            if ( peers[ i ] >= 0 )
+                close( peers[ i ] );
+        }
+        drainQueue();
+        IOPoller::take_queued();
+    }
+
+
+    static std::vector<std::int32_t> drainQueue() {
+        std::vector<std::int32_t> result;
+        while ( not NotificationQueue::is_empty() ) {
+            Oop waiter = NotificationQueue::get();
+            if ( waiter->isSmallIntegerOop() )
+                result.push_back( SmallIntegerOop( waiter )->value() );
+        }
+        std::sort( result.begin(), result.end() );
+        return result;
+    }
+
+
+    // as many pairs as the descriptor limit leaves room for, at most n
+    void openPairs( std::int32_t n ) {
+        struct rlimit limit{};
+        if ( getrlimit( RLIMIT_NOFILE, &limit ) == 0 and limit.rlim_cur not_eq RLIM_INFINITY ) {
+            n = std::min( n, static_cast<std::int32_t>( ( limit.rlim_cur - 64 ) / 2 ) );
+        }
+        for ( std::int32_t i = 0; i < n; i++ ) {
+            std::int32_t fds[2];
+            ASSERT_EQ( 0, socketpair( AF_UNIX, SOCK_STREAM, 0, fds ) );
+            ends.push_back( fds[ 0 ] );
+            peers.push_back( fds[ 1 ] );
+        }
+    }
+
+
+    void armAll( std::int32_t events ) {
+        for ( std::size_t i = 0; i < ends.size(); i++ ) {
+            ASSERT_TRUE( IOPoller::arm( ends[ i ], events, smiOopFromValue( i ) ) );
+        }
+    }
+
+
+    void send( std::int32_t i ) {
+        char c = 'x';
+        ASSERT_EQ( 1, write( peers[ i ], &c, 1 ) );
+    }
+
+
+    // polls until n waiters are queued (more than IOPollerEventsPerWait may be ready)
+    static std::int32_t pollFor( std::int32_t n ) {
+        std::int32_t queued = 0;
+        for ( std::int32_t tries = 0; queued < n and tries < 1000; tries++ ) {
+            queued += IOPoller::poll( 100 );
+        }
+        return queued;
+    }
+};
+
+
+TEST_F( IOPollerTests, isSupported ) {
+    EXPECT_TRUE( IOPoller::is_supported() );
+}
+
+
+TEST_F( IOPollerTests, readyDescriptorsQueueTheirWaitersAtHighFanIn ) {
+    openPairs( 1000 );
+    armAll( IOPoller::readable );
+    std::int32_t armed = IOPoller::number_of_armed();
+
+    EXPECT_EQ( 0, IOPoller::poll( 0 ) );
+    EXPECT_TRUE( NotificationQueue::is_empty() );
+
+    std::vector<std::int32_t> expected;
+    for ( std::int32_t i = 0; i < static_cast<std::int32_t>( ends.size() ); i += 3 ) {
+        send( i );
+        expected.push_back( i );
+    }
+
+    double start  = os::elapsedTime();
+    std::int32_t queued = pollFor( expected.size() );
+    double elapsed = os::elapsedTime() - start;
+    SPDLOG_INFO( "{} of {} descriptors ready, queued in {:.1f} us", queued, ends.size(), elapsed * 1e6 );
+
+    EXPECT_EQ( static_cast<std::int32_t>( expected.size() ), queued );
+    EXPECT_EQ( expected, drainQueue() );
+    EXPECT_EQ( armed - static_cast<std::int32_t>( expected.size() ), IOPoller::number_of_armed() );
+    EXPECT_EQ( queued, IOPoller::take_queued() );
+    EXPECT_EQ( 0, IOPoller::take_queued() );
+
+    for ( std::size_t i = 0; i < ends.size(); i++ ) {
+        EXPECT_EQ( i % 3 == 0 ? IOPoller::readable : 0, IOPoller::ready_events( ends[ i ] ) ) << i;
+    }
+}
+
+
+TEST_F( IOPollerTests, registrationsAreOneShot ) {
+    openPairs( 4 );
+    armAll( IOPoller::readable );
+    send( 1 );
+    EXPECT_EQ( 1, pollFor( 1 ) );
+    EXPECT_EQ( std::vector<std::int32_t>{ 1 }, drainQueue() );
+
+    // disarmed, further data does not queue the waiter again
+    send( 1 );
+    EXPECT_EQ( 0, IOPoller::poll( 10 ) );
+    EXPECT_TRUE( NotificationQueue::is_empty() );
+
+    // re-armed, the unread data makes it ready at once
+    ASSERT_TRUE( IOPoller::arm( ends[ 1 ], IOPoller::readable, smiOopFromValue( 42 ) ) );
+    EXPECT_EQ( 0, IOPoller::ready_events( ends[ 1 ] ) );
+    EXPECT_EQ( 1, IOPoller::poll( 0 ) );
+    EXPECT_EQ( std::vector<std::int32_t>{ 42 }, drainQueue() );
+}
+
+
+TEST_F( IOPollerTests, removedDescriptorsAreNotPolled ) {
+    openPairs( 2 );
+    armAll( IOPoller::readable );
+    std::int32_t armed = IOPoller::number_of_armed();
+
+    EXPECT_TRUE( IOPoller::remove( ends[ 0 ] ) );
+    EXPECT_FALSE( IOPoller::remove( ends[ 0 ] ) );
+    EXPECT_EQ( -1, IOPoller::ready_events( ends[ 0 ] ) );
+    EXPECT_EQ( armed - 1, IOPoller::number_of_armed() );
+
+    send( 0 );
+    EXPECT_EQ( 0, IOPoller::poll( 10 ) );
+    EXPECT_TRUE( NotificationQueue::is_empty() );
+}
+
+
+TEST_F( IOPollerTests, writableAndHangUpEvents ) {
+    openPairs( 2 );
+    ASSERT_TRUE( IOPoller::arm( ends[ 0 ], IOPoller::writable, smiOopFromValue( 0 ) ) );
+    ASSERT_TRUE( IOPoller::arm( ends[ 1 ], IOPoller::readable, smiOopFromValue( 1 ) ) );
+
+    close( peers[ 1 ] );
+    peers[ 1 ] = -1;
+
+    EXPECT_EQ( 2, pollFor( 2 ) );
+    EXPECT_EQ( ( std::vector<std::int32_t>{ 0, 1 } ), drainQueue() );
+    EXPECT_EQ( IOPoller::writable, IOPoller::ready_events( ends[ 0 ] ) );
+    EXPECT_EQ( IOPoller::readable | IOPoller::hang_up, IOPoller::ready_events( ends[ 1 ] ) );
+}
+
+
+TEST_F( IOPollerTests, armedDescriptorsHaveOneWaiter ) {
+    openPairs( 1 );
+    ASSERT_TRUE( IOPoller::arm( ends[ 0 ], IOPoller::readable, smiOopFromValue( 1 ) ) );
+    std::int32_t armed = IOPoller::number_of_armed();
+
+    EXPECT_FALSE( IOPoller::arm( ends[ 0 ], IOPoller::readable, smiOopFromValue( 2 ) ) );
+    EXPECT_EQ( markSymbol( vmSymbols::illegal_state() ), SystemPrimitives::ioPollerArm( smiOopFromValue( 2 ), smiOopFromValue( IOPoller::readable ), smiOopFromValue( ends[ 0 ] ) ) );
+    // the waiter that has it armed may change its interest set
+    EXPECT_TRUE( IOPoller::arm( ends[ 0 ], IOPoller::readable | IOPoller::writable, smiOopFromValue( 1 ) ) );
+    EXPECT_EQ( armed, IOPoller::number_of_armed() );
+
+    EXPECT_EQ( 1, pollFor( 1 ) );
+    EXPECT_EQ( std::vector<std::int32_t>{ 1 }, drainQueue() );
+
+    // disarmed, another waiter may have it
+    EXPECT_TRUE( IOPoller::arm( ends[ 0 ], IOPoller::readable, smiOopFromValue( 2 ) ) );
+}
+
+
+TEST_F( IOPollerTests, closedArmedDescriptorsQueueTheirWaiters ) {
+    openPairs( 2 );
+    armAll( IOPoller::readable );
+    std::int32_t armed = IOPoller::number_of_armed();
+
+    // closed without being removed first
+    std::int32_t closed = ends[ 0 ];
+    close( closed );
+    ends[ 0 ] = -1;
+
+    // only noticed when the poll times out
+    EXPECT_EQ( 0, IOPoller::poll( 0 ) );
+    EXPECT_EQ( 1, IOPoller::poll( 10 ) );
+    EXPECT_EQ( std::vector<std::int32_t>{ 0 }, drainQueue() );
+    EXPECT_EQ( armed - 1, IOPoller::number_of_armed() );
+    EXPECT_EQ( IOPoller::hang_up, IOPoller::ready_events( closed ) );
+
+    // the open one is still armed
+    send( 1 );
+    EXPECT_EQ( 1, pollFor( 1 ) );
+    EXPECT_EQ( std::vector<std::int32_t>{ 1 }, drainQueue() );
+    EXPECT_TRUE( IOPoller::remove( closed ) );
+}
+
+
+TEST_F( IOPollerTests, wakeEndsAWaitingPoll ) {
+    openPairs( 1 );
+    armAll( IOPoller::readable );
+
+    IOPoller::wake();
+    double start = os::elapsedTime();
+    EXPECT_EQ( 0, IOPoller::poll( 5000 ) );
+    EXPECT_LT( os::elapsedTime() - start, 1.0 );
+
+    // the wake up has been consumed
+    start = os::elapsedTime();
+    EXPECT_EQ( 0, IOPoller::poll( 20 ) );
+    EXPECT_GE( os::elapsedTime() - start, 0.01 );
+}
+
+
+// writes to its descriptor once the system has gone idle
+static void *writeWhenIdle( void *peer ) {
+    for ( std::int32_t tries = 0; not DeltaProcess::is_idle() and tries < 1000; tries++ ) {
+        usleep( 1000 );
+    }
+    char c = 'x';
+    write( *static_cast<std::int32_t *>( peer ), &c, 1 );
+    return nullptr;
+}
+
+
+TEST_F( IOPollerTests, idleWaitEndsWhenAnArmedDescriptorBecomesReadable ) {
+    openPairs( 1 );
+    armAll( IOPoller::readable );
+
+    pthread_t writer;
+    ASSERT_EQ( 0, pthread_create( &writer, nullptr, &writeWhenIdle, &peers[ 0 ] ) );
+    double start    = os::elapsedTime();
+    bool   timedOut = DeltaProcess::wait_for_async_dll( 5000 );
+    double elapsed  = os::elapsedTime() - start;
+    pthread_join( writer, nullptr );
+
+    EXPECT_FALSE( timedOut );
+    EXPECT_LT( elapsed, 1.0 );
+    EXPECT_FALSE( DeltaProcess::is_idle() );
+    EXPECT_EQ( std::vector<std::int32_t>{ 0 }, drainQueue() );
+    EXPECT_EQ( 1, IOPoller::take_queued() );
+}
+
+
+TEST_F( IOPollerTests, idleWaitTimesOutWithoutEvents ) {
+    openPairs( 1 );
+    armAll( IOPoller::readable );
+
+    double start = os::elapsedTime();
+    EXPECT_TRUE( DeltaProcess::wait_for_async_dll( 20 ) );
+    EXPECT_GE( os::elapsedTime() - start, 0.01 );
+    EXPECT_TRUE( NotificationQueue::is_empty() );
+}
+
+
+TEST_F( IOPollerTests, primitivesCheckTheirArguments ) {
+    openPairs( 1 );
+    Oop waiter = smiOopFromValue( 7 );
+
+    EXPECT_EQ( markSymbol( vmSymbols::value_out_of_range() ), SystemPrimitives::ioPollerArm( waiter, smiOopFromValue( 0 ), smiOopFromValue( ends[ 0 ] ) ) );
+    EXPECT_EQ( markSymbol( vmSymbols::value_out_of_range() ), SystemPrimitives::ioPollerArm( waiter, smiOopFromValue( 1 ), smiOopFromValue( -1 ) ) );
+    EXPECT_EQ( markSymbol( vmSymbols::second_argument_has_wrong_type() ), SystemPrimitives::ioPollerArm( waiter, nilObject, smiOopFromValue( ends[ 0 ] ) ) );
+    EXPECT_EQ( markSymbol( vmSymbols::is_absent() ), SystemPrimitives::ioPollerReadyEvents( smiOopFromValue( ends[ 0 ] ) ) );
+
+    EXPECT_EQ( waiter, SystemPrimitives::ioPollerArm( waiter, smiOopFromValue( IOPoller::readable ), smiOopFromValue( ends[ 0 ] ) ) );
+    EXPECT_EQ( smiOopFromValue( 0 ), SystemPrimitives::ioPollerReadyEvents( smiOopFromValue( ends[ 0 ] ) ) );
+    send( 0 );
+    for ( std::int32_t tries = 0; tries < 100 and NotificationQueue::is_empty(); tries++ ) {
+        IOPoller::poll( 10 );
+    }
+    EXPECT_EQ( smiOopFromValue( 1 ), SystemPrimitives::ioPollerPoll() );
+    EXPECT_EQ( waiter, SystemPrimitives::notificationQueueGet() );
+    EXPECT_EQ( smiOopFromValue( IOPoller::readable ), SystemPrimitives::ioPollerReadyEvents( smiOopFromValue( ends[ 0 ] ) ) );
+
+    EXPECT_EQ( smiOopFromValue( ends[ 0 ] ), SystemPrimitives::ioPollerRemove( smiOopFromValue( ends[ 0 ] ) ) );
+    EXPECT_EQ( markSymbol( vmSymbols::is_absent() ), SystemPrimitives::ioPollerRemove( smiOopFromValue( ends[ 0 ] ) ) );
+}
+
+#endif
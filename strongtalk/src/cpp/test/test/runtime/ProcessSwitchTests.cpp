@@ -0,0 +1,83 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/platform/os.hpp"
+#include "vm/code/StubRoutines.hpp"
+
+#include <gtest/gtest.h>
+
+
+typedef void (switch_stack_func)( void **save_sp, void *new_sp );
+
+static void         *test_sp;
+static void         *coroutine_sp;
+static std::int32_t switches;
+
+
+static void switch_stack( void **save_sp, void *new_sp ) {
+    switch_stack_func *f = (switch_stack_func *) StubRoutines::switch_stack();
+    f( save_sp, new_sp );
+}
+
+
+static void coroutine() {
+    while ( true ) {
+        switches++;
+        switch_stack( &coroutine_sp, test_sp );
+    }
+}
+
+
+class ProcessSwitchTests : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        stack    = (char *) os::malloc( stack_size );
+        switches = 0;
+
+        // same initial frame as Process::allocate_stack
+        std::int32_t *sp = (std::int32_t *) ( stack + stack_size );
+        *--sp = 0;
+        *--sp = std::int32_t( &coroutine );
+        *--sp = 0;
+        *--sp = 0;
+        *--sp = 0;
+        *--sp = 0;
+        coroutine_sp = sp;
+    }
+
+
+    void TearDown() override {
+        os::free( stack );
+    }
+
+
+    static constexpr std::int32_t stack_size = 64 * 1024;
+    char                          *stack;
+};
+
+
+TEST_F( ProcessSwitchTests, switchesBackAndForth ) {
+    for ( std::int32_t i = 0; i < 10; i++ ) {
+        switch_stack( &test_sp, coroutine_sp );
+    }
+    EXPECT_EQ( switches, 10 );
+}
+
+
+TEST_F( ProcessSwitchTests, manyRoundTripsKeepTheCallersState ) {
+    constexpr std::int32_t round_trips = 1000;
+
+    // locals of the switching frame survive the round trips
+    std::int32_t sum = 0;
+    for ( std::int32_t i = 0; i < round_trips; i++ ) {
+        switch_stack( &test_sp, coroutine_sp );
+        sum += i;
+    }
+
+    EXPECT_EQ( switches, round_trips );
+    EXPECT_EQ( sum, round_trips * ( round_trips - 1 ) / 2 );
+}
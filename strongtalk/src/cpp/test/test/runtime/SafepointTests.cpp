@@ -0,0 +1,109 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/runtime/Safepoint.hpp"
+#include "vm/runtime/DeltaProcess.hpp"
+#include "vm/platform/os.hpp"
+#include "vm/system/ThreadCritical.hpp"
+
+#include <gtest/gtest.h>
+
+
+static std::int32_t operationRuns = 0;
+static bool         ranAtSafepoint = false;
+
+
+static void countingOperation() {
+    operationRuns++;
+    ranAtSafepoint = Safepoint::is_synchronized();
+}
+
+
+static volatile bool requesting = false;
+static Event         *requesterDone = nullptr;
+
+
+static std::int32_t requester( void *ignored ) {
+    while ( requesting ) {
+        Safepoint::request( &countingOperation );
+    }
+    os::signal_event( requesterDone );
+    return 0;
+}
+
+
+static bool pollIsArmed() {
+    return *(char *volatile *) active_stack_limit() == (char *) 0x7fffffff;
+}
+
+
+class SafepointTests : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        operationRuns  = 0;
+        ranAtSafepoint = false;
+    }
+};
+
+
+TEST_F( SafepointTests, leavingNativeCodeDoesNotBlockOutsideSafepoint ) {
+    EXPECT_FALSE( Safepoint::is_active() );
+    {
+        ThreadInVM tiv;
+        EXPECT_FALSE( Safepoint::is_active() );
+    }
+    EXPECT_FALSE( Safepoint::is_active() );
+}
+
+
+TEST_F( SafepointTests, requestedOperationRunsOnceAtSafepoint ) {
+    Safepoint::request( &countingOperation );
+    EXPECT_TRUE( Safepoint::is_requested() );
+
+    Safepoint::run_requested_operation();
+    EXPECT_FALSE( Safepoint::is_requested() );
+    EXPECT_EQ( operationRuns, 1 );
+    EXPECT_TRUE( ranAtSafepoint );
+    EXPECT_FALSE( Safepoint::is_active() );
+
+    // nothing pending any more
+    Safepoint::run_requested_operation();
+    EXPECT_EQ( operationRuns, 1 );
+}
+
+
+TEST_F( SafepointTests, requestDuringProcessSwitchArmsThePoll ) {
+    DeltaProcess *process = DeltaProcess::active();
+    ASSERT_TRUE( process not_eq nullptr );
+
+    if ( requesterDone == nullptr )
+        requesterDone = os::create_event( false );
+    os::reset_event( requesterDone );
+    requesting = true;
+    std::int32_t id;
+    Thread       *thread = os::create_thread( &requester, nullptr, &id );
+
+    // a request that is pending once set_active has returned must have armed the poll
+    std::int32_t missed = 0;
+    for ( std::int32_t i = 0; i < 1000; i++ ) {
+        DeltaProcess::set_active( process );
+        {
+            ThreadCritical tc;  // a request in progress has completed
+            if ( Safepoint::is_requested() and not pollIsArmed() )
+                missed++;
+        }
+        Safepoint::run_requested_operation();
+    }
+
+    requesting = false;
+    os::wait_for_event( requesterDone );
+    Safepoint::run_requested_operation();
+    os::terminate_thread( thread );
+
+    DeltaProcess::set_active( process );
+    EXPECT_EQ( 0, missed );
+    EXPECT_GT( operationRuns, 0 );
+}
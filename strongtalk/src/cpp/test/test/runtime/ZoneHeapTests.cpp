@@ -0,0 +1,153 @@
+
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/code/ZoneHeap.hpp"
+#include "vm/runtime/flags.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+
+static std::int32_t numberOfMoves = 0;
+
+
+static bool moveChunk( const char *from, char *to, std::int32_t nbytes ) {
+    std::memcpy( to, from, nbytes );
+    numberOfMoves++;
+    return true;
+}
+
+
+static bool pinChunk( const char *from, char *to, std::int32_t nbytes ) {
+    st_unused( from );
+    st_unused( to );
+    st_unused( nbytes );
+    return false;
+}
+
+
+class ZoneHeapTests : public ::testing::Test {
+
+protected:
+    void SetUp() override {
+        heap          = new ZoneHeap( heapSize, blockSize );
+        numberOfMoves = 0;
+    }
+
+
+    void TearDown() override {
+        delete heap;
+        heap = nullptr;
+    }
+
+
+    // fills region 0 with chunks of 2K and frees all but two of them (keeping the last one so that the frontier stays in region 1)
+    void makeSparseFirstRegion( void *kept[ 2 ] ) {
+        const std::int32_t chunkSize = 2 * 1024;
+        const std::int32_t n         = heap->regionSize() / chunkSize;
+        void               *chunks[ 64 ];
+        ASSERT_LE( n, 64 );
+        for ( std::int32_t i = 0; i < n; i++ ) {
+            chunks[ i ] = heap->allocate( chunkSize );
+            ASSERT_TRUE( chunks[ i ] not_eq nullptr );
+        }
+        for ( std::int32_t i = 0; i < n; i++ ) {
+            if ( i == 3 or i == n - 1 )
+                continue;
+            heap->deallocate( chunks[ i ], chunkSize );
+        }
+        kept[ 0 ] = chunks[ 3 ];
+        kept[ 1 ] = chunks[ n - 1 ];
+    }
+
+
+    static constexpr std::int32_t heapSize  = 256 * 1024;
+    static constexpr std::int32_t blockSize = 64;
+
+    ZoneHeap *heap;
+};
+
+
+TEST_F( ZoneHeapTests, allocationsAreBumpedFromFrontier ) {
+    char *a = (char *) heap->allocate( 100 );
+    char *b = (char *) heap->allocate( 100 );
+    EXPECT_EQ( a, heap->startAddr() );
+    EXPECT_EQ( b, a + 2 * blockSize );
+    EXPECT_EQ( heap->frontierBytes(), heapSize - 4 * blockSize );
+}
+
+
+TEST_F( ZoneHeapTests, exactFitIsReused ) {
+    void *a = heap->allocate( 3 * blockSize );
+    heap->allocate( blockSize );
+    heap->deallocate( a, 3 * blockSize );
+    EXPECT_EQ( heap->allocate( 3 * blockSize ), a );
+}
+
+
+TEST_F( ZoneHeapTests, regionUsageIsTracked ) {
+    void *a = heap->allocate( 3 * blockSize );
+    EXPECT_EQ( heap->usedBytesInRegion( 0 ), 3 * blockSize );
+    EXPECT_EQ( heap->numberOfRegionsUsed(), 1 );
+    heap->deallocate( a, 3 * blockSize );
+    EXPECT_EQ( heap->usedBytesInRegion( 0 ), 0 );
+    EXPECT_EQ( heap->numberOfRegionsUsed(), 0 );
+}
+
+
+TEST_F( ZoneHeapTests, evacuateEmptiesSparseRegion ) {
+    ASSERT_GT( heap->numberOfRegions(), 1 );
+    void *kept[ 2 ];
+    makeSparseFirstRegion( kept );
+    std::strcpy( (char *) kept[ 0 ], "moved" );
+
+    EXPECT_EQ( heap->findEvacuationCandidate( 50, -1 ), 0 );
+    EXPECT_EQ( heap->findEvacuationCandidate( 50, 0 ), -1 );
+
+    std::int32_t used = heap->usedBytes();
+    bool         done = false;
+    std::int32_t moved = heap->evacuate( 0, heapSize, moveChunk, done );
+    EXPECT_TRUE( done );
+    EXPECT_EQ( moved, 4 * 1024 );
+    EXPECT_EQ( numberOfMoves, 2 );
+    EXPECT_EQ( heap->usedBytesInRegion( 0 ), 0 );
+    EXPECT_EQ( heap->usedBytes(), used );
+
+    const char *first = (const char *) heap->firstUsed();
+    EXPECT_STREQ( first, "moved" );
+    heap->verify();
+}
+
+
+TEST_F( ZoneHeapTests, evacuateIsBounded ) {
+    void *kept[ 2 ];
+    makeSparseFirstRegion( kept );
+
+    bool         done  = true;
+    std::int32_t moved = heap->evacuate( 0, 2 * 1024, moveChunk, done );
+    EXPECT_FALSE( done );
+    EXPECT_EQ( moved, 2 * 1024 );
+    EXPECT_EQ( heap->usedBytesInRegion( 0 ), 2 * 1024 );
+
+    moved = heap->evacuate( 0, 2 * 1024, moveChunk, done );
+    EXPECT_TRUE( done );
+    EXPECT_EQ( heap->usedBytesInRegion( 0 ), 0 );
+}
+
+
+TEST_F( ZoneHeapTests, pinnedChunksStay ) {
+    void *kept[ 2 ];
+    makeSparseFirstRegion( kept );
+
+    std::int32_t frontier = heap->frontierBytes();
+    bool         done     = false;
+    EXPECT_EQ( heap->evacuate( 0, heapSize, pinChunk, done ), 0 );
+    EXPECT_TRUE( done );
+    EXPECT_EQ( heap->usedBytesInRegion( 0 ), 4 * 1024 );
+    EXPECT_EQ( heap->frontierBytes(), frontier );
+    heap->verify();
+}
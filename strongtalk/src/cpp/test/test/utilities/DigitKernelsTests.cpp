@@ -0,0 +1,161 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/utility/DigitKernels.hpp"
+#include "vm/platform/os.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+
+// Each kernel is run at every supported level and checked against the scalar kernels, on
+// lengths around the vector widths (two and four digits) and on digits with extreme carries.
+
+class DigitKernelsTests : public ::testing::Test {
+
+protected:
+    DigitKernels::Level _saved;
+    std::mt19937        random{ 4711 };
+
+
+    void SetUp() override {
+        _saved = DigitKernels::level();
+    }
+
+
+    void TearDown() override {
+        DigitKernels::select( _saved );
+    }
+
+
+    static std::vector<DigitKernels::Level> levels() {
+        std::vector<DigitKernels::Level> result;
+        for ( std::int32_t l = 0; l <= static_cast<std::int32_t>( DigitKernels::supported_level() ); l++ ) {
+            result.push_back( static_cast<DigitKernels::Level>( l ) );
+        }
+        return result;
+    }
+
+
+    // random digits, with many 0 and B - 1 digits
+    Digit randomDigit() {
+        switch ( random() % 5 ) {
+            case 0:
+                return 0;
+            case 1:
+                return 0xFFFFFFFF;
+            default:
+                return random();
+        }
+    }
+
+
+    std::vector<Digit> randomDigits( std::int32_t length ) {
+        std::vector<Digit> result( length );
+        for ( auto &d : result )
+            d = randomDigit();
+        return result;
+    }
+
+
+    // nanoseconds per digit of kernel( n )
+    template<typename Kernel>
+    static double nanosecondsPerDigit( std::int32_t n, Kernel kernel ) {
+        std::int32_t repetitions = 1 + 2000000 / n;
+        double       start       = os::elapsedTime();
+        for ( std::int32_t i = 0; i < repetitions; i++ )
+            kernel( i );
+        return ( os::elapsedTime() - start ) * 1e9 / repetitions / n;
+    }
+};
+
+
+TEST_F( DigitKernelsTests, kernelsAgreeWithScalar ) {
+    for ( std::int32_t n = 0; n <= 21; n++ ) {
+        for ( std::int32_t repeat = 0; repeat < 50; repeat++ ) {
+            std::vector<Digit> x = randomDigits( n );
+            std::vector<Digit> y = randomDigits( n );
+            Digit              a = randomDigit();
+            Digit              d = repeat % 2 == 0 ? 1 + random() % 100 : random() | 1;
+
+            DigitKernels::select( DigitKernels::Level::scalar );
+            std::vector<Digit> sum( n ), difference( n ), product( n ), accumulated = y, reduced = y, quotient( n );
+            Digit              carry     = DigitKernels::add_n( sum.data(), x.data(), y.data(), n );
+            Digit              borrow    = DigitKernels::sub_n( difference.data(), x.data(), y.data(), n );
+            Digit              high      = DigitKernels::mul_1( product.data(), x.data(), n, a );
+            Digit              addHigh   = DigitKernels::addmul_1( accumulated.data(), x.data(), n, a );
+            Digit              subHigh   = DigitKernels::submul_1( reduced.data(), x.data(), n, a );
+            Digit              remainder = DigitKernels::divrem_1( quotient.data(), x.data(), n, d );
+
+            for ( auto level : levels() ) {
+                DigitKernels::select( level );
+                std::vector<Digit> z( n ), w = y;
+                EXPECT_EQ( carry, DigitKernels::add_n( z.data(), x.data(), y.data(), n ) ) << DigitKernels::level_name( level );
+                EXPECT_EQ( sum, z ) << DigitKernels::level_name( level );
+                EXPECT_EQ( borrow, DigitKernels::sub_n( z.data(), x.data(), y.data(), n ) ) << DigitKernels::level_name( level );
+                EXPECT_EQ( difference, z ) << DigitKernels::level_name( level );
+                EXPECT_EQ( high, DigitKernels::mul_1( z.data(), x.data(), n, a ) ) << DigitKernels::level_name( level );
+                EXPECT_EQ( product, z ) << DigitKernels::level_name( level );
+                EXPECT_EQ( addHigh, DigitKernels::addmul_1( w.data(), x.data(), n, a ) ) << DigitKernels::level_name( level );
+                EXPECT_EQ( accumulated, w ) << DigitKernels::level_name( level );
+                w = y;
+                EXPECT_EQ( subHigh, DigitKernels::submul_1( w.data(), x.data(), n, a ) ) << DigitKernels::level_name( level );
+                EXPECT_EQ( reduced, w ) << DigitKernels::level_name( level );
+                EXPECT_EQ( remainder, DigitKernels::divrem_1( z.data(), x.data(), n, d ) ) << DigitKernels::level_name( level ) << " / " << d;
+                EXPECT_EQ( quotient, z ) << DigitKernels::level_name( level ) << " / " << d;
+            }
+        }
+    }
+}
+
+
+TEST_F( DigitKernelsTests, kernelsWorkInPlace ) {
+    std::vector<Digit> x = randomDigits( 37 );
+    for ( auto level : levels() ) {
+        DigitKernels::select( level );
+
+        // x + x - x = x
+        std::vector<Digit> z = x;
+        Digit              c = DigitKernels::add_n( z.data(), z.data(), z.data(), 37 );
+        EXPECT_EQ( c, DigitKernels::sub_n( z.data(), z.data(), x.data(), 37 ) );
+        EXPECT_EQ( x, z );
+
+        // x + 7x - 8x = 0
+        z = x;
+        Digit h = DigitKernels::addmul_1( z.data(), z.data(), 37, 7 );
+        EXPECT_EQ( h, DigitKernels::submul_1( z.data(), x.data(), 37, 8 ) );
+        EXPECT_EQ( std::vector<Digit>( 37, 0 ), z );
+
+        // (8x + 5) div 8 = x, with the quotient shifted up by one digit
+        std::vector<Digit> y( 39 );
+        y[ 37 ] = DigitKernels::mul_1( y.data(), x.data(), 37, 8 );
+        y[ 0 ] += 5;
+        EXPECT_EQ( 5u, DigitKernels::divrem_1( y.data() + 1, y.data(), 38, 8 ) ) << DigitKernels::level_name( level );
+        EXPECT_EQ( 0u, y[ 38 ] );
+        EXPECT_EQ( x, std::vector<Digit>( y.begin() + 1, y.begin() + 38 ) ) << DigitKernels::level_name( level );
+    }
+}
+
+
+TEST_F( DigitKernelsTests, kernelBenchmark ) {
+    // logs the time per digit of each kernel at every supported level, across operand lengths
+    for ( std::int32_t n : { 4, 16, 64, 256, 1024 } ) {
+        std::vector<Digit> x = randomDigits( n );
+        std::vector<Digit> y = randomDigits( n );
+        std::vector<Digit> z( n );
+        for ( auto level : levels() ) {
+            DigitKernels::select( level );
+            double add    = nanosecondsPerDigit( n, [ & ]( std::int32_t i ) { DigitKernels::add_n( z.data(), x.data(), y.data(), n ); } );
+            double mul    = nanosecondsPerDigit( n, [ & ]( std::int32_t i ) { DigitKernels::mul_1( z.data(), x.data(), n, 0x9E3779B9 + i ); } );
+            double addmul = nanosecondsPerDigit( n, [ & ]( std::int32_t i ) { DigitKernels::addmul_1( z.data(), x.data(), n, 0x9E3779B9 + i ); } );
+            double submul = nanosecondsPerDigit( n, [ & ]( std::int32_t i ) { DigitKernels::submul_1( z.data(), x.data(), n, 0x9E3779B9 + i ); } );
+            double divrem = nanosecondsPerDigit( n, [ & ]( std::int32_t i ) { DigitKernels::divrem_1( z.data(), x.data(), n, 1000000007 + i ); } );
+            SPDLOG_INFO( "{} digits, {}: add {:.2f} ns, mul {:.2f} ns, addmul {:.2f} ns, submul {:.2f} ns, divrem {:.2f} ns per digit", n, DigitKernels::level_name( level ), add, mul, addmul, submul, divrem );
+        }
+    }
+}
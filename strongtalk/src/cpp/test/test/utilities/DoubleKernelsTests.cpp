@@ -0,0 +1,197 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/utility/DoubleKernels.hpp"
+#include "vm/platform/os.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+
+// Each kernel is run at every supported level and checked against the scalar kernels, on
+// lengths around the vector widths and the eight partial sums, with zeros, infinities and NaNs.
+
+class DoubleKernelsTests : public ::testing::Test {
+
+protected:
+    DoubleKernels::Level _saved;
+    std::mt19937         random{ 4711 };
+
+
+    void SetUp() override {
+        _saved = DoubleKernels::level();
+    }
+
+
+    void TearDown() override {
+        DoubleKernels::select( _saved );
+    }
+
+
+    static std::vector<DoubleKernels::Level> levels() {
+        std::vector<DoubleKernels::Level> result;
+        for ( std::int32_t l = 0; l <= static_cast<std::int32_t>( DoubleKernels::supported_level() ); l++ ) {
+            result.push_back( static_cast<DoubleKernels::Level>( l ) );
+        }
+        return result;
+    }
+
+
+    // random doubles, with some signed zeros and (if wanted) infinities and NaNs
+    double randomDouble( bool special ) {
+        switch ( random() % 10 ) {
+            case 0:
+                return 0.0;
+            case 1:
+                return -0.0;
+            case 2:
+                return special ? std::numeric_limits<double>::infinity() : 1.0;
+            case 3:
+                return special ? std::numeric_limits<double>::quiet_NaN() : -1.0;
+            default:
+                return static_cast<std::int32_t>( random() ) / 65536.0;
+        }
+    }
+
+
+    std::vector<double> randomDoubles( std::int32_t length, bool special ) {
+        std::vector<double> result( length );
+        for ( auto &d : result )
+            d = randomDouble( special );
+        return result;
+    }
+
+
+    // equal, or both NaNs. Where the compiler evaluates the scalar kernels with extended (x87)
+    // precision they may round differently; the elements are at most 2^15 in magnitude.
+    static bool same( double a, double b ) {
+        if ( a == b or ( std::isnan( a ) and std::isnan( b ) ) )
+            return true;
+#if FLT_EVAL_METHOD == 0
+        return false;
+#else
+        return std::abs( a - b ) <= 1e-6 * std::max( std::abs( a ), 1.0 );
+#endif
+    }
+
+
+    static bool same( const std::vector<double> &a, const std::vector<double> &b ) {
+        if ( a.size() not_eq b.size() )
+            return false;
+        for ( std::size_t i = 0; i < a.size(); i++ ) {
+            if ( not same( a[ i ], b[ i ] ) )
+                return false;
+        }
+        return true;
+    }
+
+
+    // nanoseconds per element of kernel( n )
+    template<typename Kernel>
+    static double nanosecondsPerElement( std::int32_t n, Kernel kernel ) {
+        std::int32_t repetitions = 1 + 4000000 / n;
+        double       start       = os::elapsedTime();
+        for ( std::int32_t i = 0; i < repetitions; i++ )
+            kernel( i );
+        return ( os::elapsedTime() - start ) * 1e9 / repetitions / n;
+    }
+};
+
+
+TEST_F( DoubleKernelsTests, kernelsAgreeWithScalar ) {
+    for ( std::int32_t n = 0; n <= 35; n++ ) {
+        for ( std::int32_t repeat = 0; repeat < 40; repeat++ ) {
+            std::vector<double> x = randomDoubles( n, repeat % 4 == 0 );
+            std::vector<double> y = repeat % 5 == 0 ? x : randomDoubles( n, false );
+            double              a = randomDouble( false );
+
+            DoubleKernels::select( DoubleKernels::Level::scalar );
+            double              sum = DoubleKernels::sum( x.data(), n );
+            double              dot = DoubleKernels::dot( x.data(), y.data(), n );
+            std::vector<double> axpy = y, scaled = x, sums( n ), differences( n ), products( n ), quotients( n ), filled( n );
+            DoubleKernels::axpy( axpy.data(), a, x.data(), n );
+            DoubleKernels::scale( scaled.data(), a, n );
+            DoubleKernels::add( sums.data(), x.data(), y.data(), n );
+            DoubleKernels::subtract( differences.data(), x.data(), y.data(), n );
+            DoubleKernels::multiply( products.data(), x.data(), y.data(), n );
+            DoubleKernels::divide( quotients.data(), x.data(), y.data(), n );
+            DoubleKernels::fill( filled.data(), a, n );
+            std::int32_t min      = DoubleKernels::min_index( x.data(), n );
+            std::int32_t max      = DoubleKernels::max_index( x.data(), n );
+            std::int32_t mismatch = DoubleKernels::mismatch( x.data(), y.data(), n );
+
+            for ( auto level : levels() ) {
+                DoubleKernels::select( level );
+                const char          *name = DoubleKernels::level_name( level );
+                std::vector<double> z     = y;
+                EXPECT_TRUE( same( sum, DoubleKernels::sum( x.data(), n ) ) ) << name << " " << n;
+                EXPECT_TRUE( same( dot, DoubleKernels::dot( x.data(), y.data(), n ) ) ) << name << " " << n;
+                DoubleKernels::axpy( z.data(), a, x.data(), n );
+                EXPECT_TRUE( same( axpy, z ) ) << name;
+                z = x;
+                DoubleKernels::scale( z.data(), a, n );
+                EXPECT_TRUE( same( scaled, z ) ) << name;
+                DoubleKernels::add( z.data(), x.data(), y.data(), n );
+                EXPECT_TRUE( same( sums, z ) ) << name;
+                DoubleKernels::subtract( z.data(), x.data(), y.data(), n );
+                EXPECT_TRUE( same( differences, z ) ) << name;
+                z = x;
+                DoubleKernels::multiply( z.data(), z.data(), y.data(), n );
+                EXPECT_TRUE( same( products, z ) ) << name;
+                DoubleKernels::divide( z.data(), x.data(), y.data(), n );
+                EXPECT_TRUE( same( quotients, z ) ) << name;
+                DoubleKernels::fill( z.data(), a, n );
+                EXPECT_TRUE( same( filled, z ) ) << name;
+                EXPECT_EQ( min, DoubleKernels::min_index( x.data(), n ) ) << name;
+                EXPECT_EQ( max, DoubleKernels::max_index( x.data(), n ) ) << name;
+                EXPECT_EQ( mismatch, DoubleKernels::mismatch( x.data(), y.data(), n ) ) << name;
+            }
+        }
+    }
+}
+
+
+TEST_F( DoubleKernelsTests, minIndexIgnoresNaNs ) {
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    double inf = std::numeric_limits<double>::infinity();
+    for ( auto level : levels() ) {
+        DoubleKernels::select( level );
+        std::vector<double> x = { nan, 5, nan, 3, 4, 3, nan, 9, 9, nan, 1, 1, 1 };
+        EXPECT_EQ( 10, DoubleKernels::min_index( x.data(), 13 ) ) << DoubleKernels::level_name( level );
+        EXPECT_EQ( 7, DoubleKernels::max_index( x.data(), 13 ) ) << DoubleKernels::level_name( level );
+        EXPECT_EQ( 3, DoubleKernels::min_index( x.data(), 10 ) ) << DoubleKernels::level_name( level );
+
+        std::vector<double> y = { nan, nan, inf, nan, inf, nan, nan, nan, nan };
+        EXPECT_EQ( 2, DoubleKernels::min_index( y.data(), 9 ) ) << DoubleKernels::level_name( level );
+        EXPECT_EQ( 0, DoubleKernels::min_index( y.data(), 2 ) ) << DoubleKernels::level_name( level );
+        EXPECT_EQ( -1, DoubleKernels::max_index( y.data(), 0 ) ) << DoubleKernels::level_name( level );
+    }
+}
+
+
+TEST_F( DoubleKernelsTests, kernelBenchmark ) {
+    // logs the time per element of the kernels at every supported level, across array lengths
+    for ( std::int32_t n : { 16, 256, 4096, 65536 } ) {
+        std::vector<double> x = randomDoubles( n, false );
+        std::vector<double> y = randomDoubles( n, false );
+        for ( auto level : levels() ) {
+            DoubleKernels::select( level );
+            double sink = 0;
+            double sum  = nanosecondsPerElement( n, [ & ]( std::int32_t i ) { sink += DoubleKernels::sum( x.data(), n ); } );
+            double dot  = nanosecondsPerElement( n, [ & ]( std::int32_t i ) { sink += DoubleKernels::dot( x.data(), y.data(), n ); } );
+            double axpy = nanosecondsPerElement( n, [ & ]( std::int32_t i ) { DoubleKernels::axpy( y.data(), 1e-9, x.data(), n ); } );
+            double add  = nanosecondsPerElement( n, [ & ]( std::int32_t i ) { DoubleKernels::add( y.data(), y.data(), x.data(), n ); } );
+            double min  = nanosecondsPerElement( n, [ & ]( std::int32_t i ) { sink += DoubleKernels::min_index( x.data(), n ); } );
+            SPDLOG_INFO( "{} elements, {}: sum {:.2f} ns, dot {:.2f} ns, axpy {:.2f} ns, add {:.2f} ns, min index {:.2f} ns per element ({})", n, DoubleKernels::level_name( level ), sum, dot, axpy, add, min, sink > 0 );
+        }
+    }
+}
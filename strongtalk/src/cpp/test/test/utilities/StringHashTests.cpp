@@ -0,0 +1,84 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/utility/StringHash.hpp"
+#include "vm/oop/MarkOopDescriptor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+
+class StringHashTests : public ::testing::Test {
+
+protected:
+    // generated keys like 'order-1000123-eu', sharing their first and last characters
+    static std::vector<std::string> generatedKeys( std::int32_t count ) {
+        std::vector<std::string> keys;
+        char                     buffer[32];
+        for ( std::int32_t i = 1; i <= count; i++ ) {
+            snprintf( buffer, sizeof( buffer ), "order-%07d-eu", 1000000 + i );
+            keys.emplace_back( buffer );
+        }
+        return keys;
+    }
+
+
+    static std::int32_t distinctHashes( const std::vector<std::string> &keys, std::uint32_t hash( const std::uint8_t *, std::int32_t ) ) {
+        std::set<std::int32_t> hashes;
+        for ( const auto &key : keys ) {
+            hashes.insert( MarkOopDescriptor::masked_hash( hash( reinterpret_cast<const std::uint8_t *>( key.data() ), key.size() ) ) );
+        }
+        return hashes.size();
+    }
+
+
+    static std::vector<std::uint16_t> widened( const std::string &s ) {
+        return std::vector<std::uint16_t>( s.begin(), s.end() );
+    }
+};
+
+
+TEST_F( StringHashTests, byteAndDoubleByteStringsHashAlike ) {
+    std::string s = "the quick brown fox jumps over the lazy dog";
+    for ( std::int32_t length = 0; length <= std::int32_t( s.size() ); length++ ) {
+        std::vector<std::uint16_t> wide  = widened( s );
+        auto                       bytes = reinterpret_cast<const std::uint8_t *>( s.data() );
+        EXPECT_EQ( StringHash::full_hash( bytes, length ), StringHash::full_hash( wide.data(), length ) ) << "length " << length;
+        EXPECT_EQ( StringHash::sampled_hash( bytes, length ), StringHash::sampled_hash( wide.data(), length ) ) << "length " << length;
+    }
+}
+
+
+TEST_F( StringHashTests, fullHashDependsOnEveryCharacter ) {
+    std::string s = "abcdefghijklmnopqrstuvwxyz0123456789";
+    auto        bytes = reinterpret_cast<const std::uint8_t *>( s.data() );
+    std::uint32_t original = StringHash::full_hash( bytes, s.size() );
+
+    for ( std::size_t i = 0; i < s.size(); i++ ) {
+        std::string changed = s;
+        changed[ i ] ^= 1;
+        EXPECT_NE( original, StringHash::full_hash( reinterpret_cast<const std::uint8_t *>( changed.data() ), changed.size() ) ) << "index " << i;
+    }
+}
+
+
+TEST_F( StringHashTests, fullHashSpreadsGeneratedKeys ) {
+    std::vector<std::string> keys = generatedKeys( 10000 );
+
+    // only the middle digit is sampled
+    EXPECT_LE( distinctHashes( keys, &StringHash::sampled_hash ), 10 );
+    EXPECT_GE( distinctHashes( keys, &StringHash::full_hash ), 9900 );
+}
+
+
+TEST_F( StringHashTests, fullHashOfDoubleByteCharacters ) {
+    std::vector<std::uint16_t> s1 = { 0x3042, 0x3044, 0x3046, 0x3048, 0x304a, 0x304b, 0x304d, 0x304f, 0x3051 };
+    std::vector<std::uint16_t> s2 = s1;
+    s2[ 3 ] = 0x0048;   // same low byte
+    EXPECT_NE( StringHash::full_hash( s1.data(), s1.size() ), StringHash::full_hash( s2.data(), s2.size() ) );
+}
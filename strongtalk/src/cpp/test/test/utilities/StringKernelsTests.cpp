@@ -0,0 +1,193 @@
+//
+//  (C) 1994 - 2021, The Strongtalk authors and contributors
+//  Refer to the "COPYRIGHTS" file at the root of this source tree for complete licence and copyright terms
+//
+
+#include "vm/platform/platform.hpp"
+#include "vm/utility/StringKernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+
+// Each kernel is run at every supported level and checked against the scalar kernels, on
+// lengths and offsets around the vector widths (16 and 32 bytes).
+
+class StringKernelsTests : public ::testing::Test {
+
+protected:
+    StringKernels::Level _saved;
+
+
+    void SetUp() override {
+        _saved = StringKernels::level();
+    }
+
+
+    void TearDown() override {
+        StringKernels::select( _saved );
+    }
+
+
+    static std::vector<StringKernels::Level> levels() {
+        std::vector<StringKernels::Level> result;
+        for ( std::int32_t l = 0; l <= static_cast<std::int32_t>( StringKernels::supported_level() ); l++ ) {
+            result.push_back( static_cast<StringKernels::Level>( l ) );
+        }
+        return result;
+    }
+
+
+    static std::vector<std::uint8_t> text( std::int32_t length ) {
+        std::vector<std::uint8_t> result;
+        for ( std::int32_t i = 0; i < length; i++ ) {
+            result.push_back( "the Quick brown FOX jumps over the lazy dog; " [ i % 45 ] );
+        }
+        return result;
+    }
+
+
+    static std::vector<std::uint16_t> widened( const std::vector<std::uint8_t> &s ) {
+        return std::vector<std::uint16_t>( s.begin(), s.end() );
+    }
+};
+
+
+TEST_F( StringKernelsTests, mismatchFindsEveryPosition ) {
+    for ( auto level : levels() ) {
+        StringKernels::select( level );
+        for ( std::int32_t length = 0; length <= 70; length++ ) {
+            std::vector<std::uint8_t>  a  = text( length );
+            std::vector<std::uint16_t> wa = widened( a );
+            EXPECT_EQ( length, StringKernels::mismatch( a.data(), a.data(), length ) );
+            EXPECT_EQ( length, StringKernels::mismatch( wa.data(), wa.data(), length ) );
+            EXPECT_EQ( length, StringKernels::mismatch( a.data(), wa.data(), length ) );
+
+            for ( std::int32_t i = 0; i < length; i++ ) {
+                std::vector<std::uint8_t>  b  = a;
+                std::vector<std::uint16_t> wb = wa;
+                b[ i ]++;
+                wb[ i ] += 0x100;
+                EXPECT_EQ( i, StringKernels::mismatch( a.data(), b.data(), length ) ) << StringKernels::level_name( level );
+                EXPECT_EQ( i, StringKernels::mismatch( wa.data(), wb.data(), length ) ) << StringKernels::level_name( level );
+                EXPECT_EQ( i, StringKernels::mismatch( a.data(), wb.data(), length ) ) << StringKernels::level_name( level );
+            }
+        }
+    }
+}
+
+
+TEST_F( StringKernelsTests, compareOrdersByCharactersThenLength ) {
+    for ( auto level : levels() ) {
+        StringKernels::select( level );
+        std::vector<std::uint8_t> a = text( 40 );
+        std::vector<std::uint8_t> b = a;
+        b[ 33 ] = 0xFF;
+        EXPECT_EQ( -1, StringKernels::compare( a.data(), 40, b.data(), 40 ) );
+        EXPECT_EQ( 1, StringKernels::compare( b.data(), 40, a.data(), 40 ) );
+        EXPECT_EQ( 0, StringKernels::compare( a.data(), 40, a.data(), 40 ) );
+        EXPECT_EQ( -1, StringKernels::compare( a.data(), 39, a.data(), 40 ) );
+
+        // trailing zero bytes are characters too
+        std::vector<std::uint8_t> z = a;
+        z.push_back( 0 );
+        EXPECT_EQ( -1, StringKernels::compare( a.data(), 40, z.data(), 41 ) );
+        EXPECT_FALSE( StringKernels::equal( a.data(), 40, z.data(), 41 ) );
+
+        std::vector<std::uint16_t> wb = widened( b );
+        EXPECT_EQ( -1, StringKernels::compare( a.data(), 40, wb.data(), 40 ) );
+        EXPECT_EQ( 1, StringKernels::compare( wb.data(), 40, a.data(), 40 ) );
+        EXPECT_TRUE( StringKernels::equal( widened( a ).data(), 40, a.data(), 40 ) );
+    }
+}
+
+
+TEST_F( StringKernelsTests, caseFoldingIsAsciiOnly ) {
+    for ( auto level : levels() ) {
+        StringKernels::select( level );
+        std::string               upper = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG @[`{";
+        std::string               lower = "the quick brown fox jumps over the lazy dog @[`{";
+        std::vector<std::uint8_t> u( upper.begin(), upper.end() );
+        std::vector<std::uint8_t> l( lower.begin(), lower.end() );
+        std::int32_t              n = u.size();
+
+        EXPECT_EQ( 0, StringKernels::compare_ignoring_case( u.data(), n, l.data(), n ) );
+        EXPECT_EQ( 0, StringKernels::compare_ignoring_case( widened( u ).data(), n, widened( l ).data(), n ) );
+
+        // '@' vs '`' and '[' vs '{' differ by 0x20 but are no letters
+        u[ n - 4 ] = '`';
+        EXPECT_EQ( n - 4, StringKernels::mismatch_ignoring_case( u.data(), l.data(), n ) ) << StringKernels::level_name( level );
+        EXPECT_EQ( 1, StringKernels::compare_ignoring_case( u.data(), n, l.data(), n ) );
+
+        // Latin-1 upper case letters are not folded
+        std::vector<std::uint8_t> a = { 0xC0 };
+        std::vector<std::uint8_t> b = { 0xE0 };
+        EXPECT_EQ( -1, StringKernels::compare_ignoring_case( a.data(), 1, b.data(), 1 ) );
+    }
+}
+
+
+TEST_F( StringKernelsTests, indexOfAndOccurrencesAgreeWithScalar ) {
+    std::vector<std::uint8_t>  s  = text( 1000 );
+    std::vector<std::uint16_t> ws = widened( s );
+    ws[ 500 ] = 0x3042;
+
+    for ( auto level : levels() ) {
+        StringKernels::select( level );
+        for ( std::uint16_t c : std::initializer_list<std::uint16_t>{ 'a', 'Q', 'z', ';', ' ', '#', 0x00, 0x3042, 0x0165 } ) {
+            for ( std::int32_t start : { 0, 1, 15, 17, 31, 33, 490, 999, 1000 } ) {
+                std::int32_t expected_index = -1;
+                std::int32_t expected_count = 0;
+                for ( std::int32_t i = 999; i >= start; i-- ) {
+                    if ( s[ i ] == c ) {
+                        expected_index = i - start;
+                        expected_count++;
+                    }
+                }
+                EXPECT_EQ( expected_index, StringKernels::index_of( s.data() + start, 1000 - start, c ) ) << StringKernels::level_name( level );
+                EXPECT_EQ( expected_count, StringKernels::occurrences_of( s.data() + start, 1000 - start, c ) ) << StringKernels::level_name( level );
+            }
+        }
+        EXPECT_EQ( 500, StringKernels::index_of( ws.data(), 1000, 0x3042 ) );
+        EXPECT_EQ( 1, StringKernels::occurrences_of( ws.data(), 1000, 0x3042 ) );
+        EXPECT_EQ( 0, StringKernels::occurrences_of( ws.data(), 1000, 0x0042 + 0x100 ) );
+    }
+}
+
+
+TEST_F( StringKernelsTests, occurrencesOfManyMatches ) {
+    // more matches than fit the per byte / per word accumulators
+    std::vector<std::uint8_t>  s( 100000, 'x' );
+    std::vector<std::uint16_t> ws( 100000 * 6, 'x' );
+    for ( auto level : levels() ) {
+        StringKernels::select( level );
+        EXPECT_EQ( 100000, StringKernels::occurrences_of( s.data(), s.size(), 'x' ) );
+        EXPECT_EQ( 600000, StringKernels::occurrences_of( ws.data(), ws.size(), 'x' ) );
+    }
+}
+
+
+TEST_F( StringKernelsTests, indexOfSubstring ) {
+    std::string               haystack = "abababababababababababababababababababcabababababc";
+    std::vector<std::uint8_t> s( haystack.begin(), haystack.end() );
+    std::int32_t              n        = s.size();
+
+    for ( auto level : levels() ) {
+        StringKernels::select( level );
+        auto find = [ & ]( const std::string &sub ) {
+            std::vector<std::uint8_t> p( sub.begin(), sub.end() );
+            std::int32_t              r = StringKernels::index_of_substring( s.data(), n, p.data(), p.size() );
+            EXPECT_EQ( r, StringKernels::index_of_substring( widened( s ).data(), n, widened( p ).data(), p.size() ) );
+            return r;
+        };
+        EXPECT_EQ( std::int32_t( haystack.find( "abc" ) ), find( "abc" ) );
+        EXPECT_EQ( std::int32_t( haystack.find( "cab" ) ), find( "cab" ) );
+        EXPECT_EQ( 0, find( "" ) );
+        EXPECT_EQ( 0, find( haystack ) );
+        EXPECT_EQ( std::int32_t( haystack.find( "c" ) ), find( "c" ) );
+        EXPECT_EQ( -1, find( "abd" ) );
+        EXPECT_EQ( -1, find( haystack + "a" ) );
+    }
+}